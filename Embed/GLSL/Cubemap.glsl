@@ -15,8 +15,6 @@ layout (group = 1, binding = 0, std140) uniform ViewportUBO
 	mat4 ViewProjMat;
 	vec3 ViewPos;
 	vec2 Extent;
-	int PointLightStart;
-	int PointLightCount;
 } uViewportUBO;
 
 void main()
@@ -33,7 +31,11 @@ void main()
 layout (location = 0) in vec3 vPos;
 
 // outputs to GBuffer albedo color after depth test
+#ifdef LD_GBUFFER_COMPACT
+layout (location = 1) out vec4 fAlbedoSpec;
+#else
 layout (location = 2) out vec4 fAlbedoSpec;
+#endif
 
 layout (group = 2, binding = 0) uniform samplerCube uCubemap;
 
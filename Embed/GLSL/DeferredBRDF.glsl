@@ -22,17 +22,24 @@ void main()
 layout (location = 0) in vec2 vTexUV;
 layout (location = 0) out vec4 fColor;
 
-struct PointLightUBO
+// must match LD_MAX_LIGHTS and the light cluster dimensions in FrameStaticGroup.h and ViewportGroup.h
+#define MAX_LIGHTS 256
+#define LIGHT_CLUSTER_X 16
+#define LIGHT_CLUSTER_Y 8
+#define LIGHT_CLUSTER_Z 24
+
+struct LightUBO
 {
 	vec4 PosRadius;
 	vec4 Color;
+	vec4 Dir;
 };
 
 layout (group = 0, binding = 0, std140) uniform LightingUBO
 {
 	vec4 DirLight;
 	vec4 DirLightColor;
-	PointLightUBO PointLights[128];
+	LightUBO Lights[MAX_LIGHTS];
 } uLightingUBO;
 
 layout (group = 1, binding = 0, std140) uniform ViewportUBO
@@ -42,15 +49,101 @@ layout (group = 1, binding = 0, std140) uniform ViewportUBO
 	mat4 ViewProjMat;
 	vec4 ViewPos;
 	vec2 Viewport;
-	int PointLightStart;
-	int PointLightCount;
+	mat4 InvProjMat;
 } uViewportUBO;
 
+#ifdef LD_GBUFFER_COMPACT
+layout (group = 1, binding = 1) uniform sampler2D uGBufferDepth;
+#else
 layout (group = 1, binding = 1) uniform sampler2D uGBufferPosition;
+#endif
 layout (group = 1, binding = 2) uniform sampler2D uGBufferNormal;
 layout (group = 1, binding = 3) uniform sampler2D uGBufferAlbedo;
 layout (group = 1, binding = 4) uniform sampler2D uSSAOTexture;
 
+layout (group = 1, binding = 5, std140) uniform LightClusterUBO
+{
+	vec4 DepthParams;
+	uvec4 Records[LIGHT_CLUSTER_X * LIGHT_CLUSTER_Y * LIGHT_CLUSTER_Z / 4];
+} uLightClusterUBO;
+
+layout (group = 1, binding = 6, std140) uniform LightIndexUBO
+{
+	uvec4 Indices[1024];
+} uLightIndexUBO;
+
+#ifdef LD_GBUFFER_COMPACT
+// octahedral normal decoding, must match GBufferDecodeNormal in GBufferLayout.h
+vec3 DecodeNormal(vec2 e)
+{
+	vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+	float t = max(-n.z, 0.0);
+	n.x += n.x >= 0.0 ? -t : t;
+	n.y += n.y >= 0.0 ? -t : t;
+	return normalize(n);
+}
+
+// view space position from a depth attachment sample at viewport coordinates uv,
+// must match GBufferReconstructPosition in GBufferLayout.h
+vec3 ReconstructPosition(vec2 uv, float depth)
+{
+#ifdef LD_VULKAN
+	// Mat4::Perspective produces OpenGL NDC depth, which Vulkan stores as is
+	float ndcDepth = depth;
+#else
+	float ndcDepth = depth * 2.0 - 1.0;
+#endif
+	vec4 position = uViewportUBO.InvProjMat * vec4(uv * 2.0 - 1.0, ndcDepth, 1.0);
+	return position.xyz / position.w;
+}
+#endif
+
+// framebuffer texture coordinates of uv, the rendered area may be smaller than the
+// framebuffer textures under dynamic resolution
+vec2 FrameBufferUV(vec2 uv)
+{
+#ifdef LD_VULKAN
+	uv.y = 1.0 - uv.y;
+#endif
+	return uv * uViewportUBO.Viewport / vec2(textureSize(uGBufferNormal, 0));
+}
+
+// cluster record of a view space position, the first light index offset in the low 16 bits
+// and the light count in the high 16 bits
+uint GetLightClusterRecord(vec3 position)
+{
+    vec4 clip = uViewportUBO.ProjMat * vec4(position, 1.0);
+    vec2 tile = clamp(clip.xy / clip.w * 0.5 + 0.5, 0.0, 0.99999) * vec2(LIGHT_CLUSTER_X, LIGHT_CLUSTER_Y);
+    float slice = log(-position.z) * uLightClusterUBO.DepthParams.z + uLightClusterUBO.DepthParams.w;
+    slice = clamp(slice, 0.0, float(LIGHT_CLUSTER_Z - 1));
+
+    uint cluster = (uint(slice) * uint(LIGHT_CLUSTER_Y) + uint(tile.y)) * uint(LIGHT_CLUSTER_X) + uint(tile.x);
+    return uLightClusterUBO.Records[cluster >> 2][cluster & 3u];
+}
+
+// 8 bit light indices, 16 in each uvec4
+uint GetLightIndex(uint i)
+{
+    uint word = uLightIndexUBO.Indices[i >> 4][(i >> 2) & 3u];
+    return (word >> ((i & 3u) * 8u)) & 0xFFu;
+}
+
+// distance attenuation that fades to zero at the light range, and the spot cone falloff,
+// point lights have a zero direction and cone cosines of -1 so the cone factor is always 1
+float LightAttenuation(LightUBO light, vec3 L, float distance)
+{
+    float attenuation = 1.0 / (1.0 + 0.09 * distance + 0.032 * (distance * distance));
+    float ratio = distance / light.PosRadius.w;
+    float window = clamp(1.0 - ratio * ratio * ratio * ratio, 0.0, 1.0);
+
+    vec3 spotDir = (uViewportUBO.ViewMat * vec4(light.Dir.xyz, 0.0)).xyz;
+    float cosOuter = light.Dir.w;
+    float cosInner = light.Color.w;
+    float cone = clamp((dot(-L, spotDir) - cosOuter) / max(cosInner - cosOuter, 1e-4), 0.0, 1.0);
+
+    return attenuation * window * window * cone;
+}
+
 float DistributionGGX(float NdotH, float a)
 {
     float a2 = a * a;
@@ -118,22 +211,30 @@ vec3 CookTorranceBRDF(vec3 V, vec3 N, vec3 L, vec3 radiance, vec3 albedo, float
 
 void main()
 {
-	vec2 uv = vTexUV;
-#ifdef LD_VULKAN
-	uv.y = 1.0 - uv.y;
-#endif
+	vec2 uv = FrameBufferUV(vTexUV);
 
 	vec3 albedo = texture(uGBufferAlbedo, uv).rgb;
+	float occlusion = texture(uSSAOTexture, uv).r;
+#ifdef LD_GBUFFER_COMPACT
+	float depth = texture(uGBufferDepth, uv).r;
+	vec4 normalMaterial = texture(uGBufferNormal, uv);
+	vec3 position = ReconstructPosition(vTexUV, depth);
+	vec3 N = DecodeNormal(normalMaterial.xy);
+	float roughness = normalMaterial.z;
+	float metallic = normalMaterial.w;
+	bool hasGeometry = depth < 1.0;
+#else
 	vec4 posRoughness = texture(uGBufferPosition, uv);
     vec4 normalMetallic = texture(uGBufferNormal, uv);
     vec3 position = posRoughness.rgb;
 	vec3 N = normalMetallic.rgb;
-	float occlusion = texture(uSSAOTexture, uv).r;
     float roughness = posRoughness.a;
     float metallic = normalMetallic.a;
+	bool hasGeometry = length(N) >= 1e-5;
+#endif
 
     // if there is no geometry, return flat albedo color
-    if (length(N) < 1e-5)
+    if (!hasGeometry)
     {
         fColor = vec4(albedo, 1.0);
         return;
@@ -147,17 +248,20 @@ void main()
     vec3 H = normalize(L + V);
     vec3 Lo = CookTorranceBRDF(V, N, L, lightColor, albedo, roughness, metallic);
 
-    // point lights
-    for (int i = 0; i < uViewportUBO.PointLightCount; i++)
+    // point and spot lights of the cluster
+    uint record = GetLightClusterRecord(position);
+    uint offset = record & 0xFFFFu;
+    uint count = record >> 16;
+
+    for (uint i = 0u; i < count; i++)
     {
-        int idx = uViewportUBO.PointLightStart + i;
-        lightPos = (uViewportUBO.ViewMat * vec4(uLightingUBO.PointLights[idx].PosRadius.xyz, 1.0)).xyz;
-        lightColor = uLightingUBO.PointLights[idx].Color.rgb;
-        L = normalize(lightPos - position);
+        LightUBO light = uLightingUBO.Lights[GetLightIndex(offset + i)];
+        lightPos = (uViewportUBO.ViewMat * vec4(light.PosRadius.xyz, 1.0)).xyz;
+        lightColor = light.Color.rgb;
 
         float distance = length(lightPos - position);
-        float attenuation = 1.0 / (1.0 + 0.09 * distance + 0.032 * (distance * distance)); 
-        vec3 radiance = lightColor * attenuation;
+        L = (lightPos - position) / max(distance, 1e-5);
+        vec3 radiance = lightColor * LightAttenuation(light, L, distance);
 
         Lo += CookTorranceBRDF(V, N, L, radiance, albedo, roughness, metallic);
     }
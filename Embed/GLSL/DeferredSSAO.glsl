@@ -26,39 +26,93 @@ layout (group = 0, binding = 0, std140) uniform ViewportUBO
 	mat4 ViewProjMat;
 	vec3 viewP;
 	vec2 Extent;
-	int PointLightStart;
-	int PointLightCount;
+	mat4 InvProjMat;
 } uViewportUBO;
 
+#ifdef LD_GBUFFER_COMPACT
+layout (group = 0, binding = 1) uniform sampler2D uGBufferDepth;
+#else
 layout (group = 0, binding = 1) uniform sampler2D uGBufferPosition;
+#endif
 layout (group = 0, binding = 2) uniform sampler2D uGBufferNormal;
 
+// must match LD_SSAO_MAX_SAMPLES
 #define KERNEL_SIZE 64
 
 layout (group = 1, binding = 0, std140) uniform Kernel
 {
 	vec4 Samples[KERNEL_SIZE];
+	int SampleCount;
 } uKernel;
 
 layout (group = 1, binding = 1) uniform sampler2D uNoise;
 
-vec4 FrameBufferTexture(sampler2D fbt, vec2 uv)
+// framebuffer texture coordinates of uv, the rendered area may be smaller than the
+// framebuffer textures under dynamic resolution. Samples projected outside the viewport
+// are clamped to the texel centers of the rendered area.
+vec2 FrameBufferUV(vec2 uv)
 {
 #ifdef LD_VULKAN
 	uv.y = 1.0 - uv.y;
 #endif
-	return texture(fbt, uv);
+	vec2 extent = uViewportUBO.Extent;
+	return clamp(uv * extent, vec2(0.5), extent - 0.5) / vec2(textureSize(uGBufferNormal, 0));
+}
+
+#ifdef LD_GBUFFER_COMPACT
+// octahedral normal decoding, must match GBufferDecodeNormal in GBufferLayout.h
+vec3 DecodeNormal(vec2 e)
+{
+	vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+	float t = max(-n.z, 0.0);
+	n.x += n.x >= 0.0 ? -t : t;
+	n.y += n.y >= 0.0 ? -t : t;
+	return normalize(n);
+}
+
+// view space position from a depth attachment sample at viewport coordinates uv,
+// must match GBufferReconstructPosition in GBufferLayout.h
+vec3 ReconstructPosition(vec2 uv, float depth)
+{
+#ifdef LD_VULKAN
+	// Mat4::Perspective produces OpenGL NDC depth, which Vulkan stores as is
+	float ndcDepth = depth;
+#else
+	float ndcDepth = depth * 2.0 - 1.0;
+#endif
+	vec4 position = uViewportUBO.InvProjMat * vec4(uv * 2.0 - 1.0, ndcDepth, 1.0);
+	return position.xyz / position.w;
+}
+#endif
+
+// view space position of the GBuffer at viewport coordinates uv
+vec3 GBufferPosition(vec2 uv)
+{
+#ifdef LD_GBUFFER_COMPACT
+	return ReconstructPosition(uv, texture(uGBufferDepth, FrameBufferUV(uv)).r);
+#else
+	return texture(uGBufferPosition, FrameBufferUV(uv)).xyz;
+#endif
 }
 
 void main()
 {
-	vec2 noiseScale = uViewportUBO.Extent / 16.0;
-	vec3 noise = normalize(texture(uNoise, vTexUV * noiseScale).xyz * 2.0 - 1.0);
-	vec3 viewP = FrameBufferTexture(uGBufferPosition, vTexUV).xyz;
-	vec3 viewN = FrameBufferTexture(uGBufferNormal, vTexUV).xyz;
+	// tile the 16x16 noise texture once per 16 pixels of the SSAO target,
+	// which may be smaller than the viewport
+	vec3 noise = normalize(texture(uNoise, gl_FragCoord.xy / 16.0).xyz * 2.0 - 1.0);
+	vec2 uv = FrameBufferUV(vTexUV);
+	vec3 viewP = GBufferPosition(vTexUV);
+#ifdef LD_GBUFFER_COMPACT
+	vec3 viewN = DecodeNormal(texture(uGBufferNormal, uv).xy);
+
+	// GBuffer pass clears depth to the far plane
+	if (texture(uGBufferDepth, uv).r >= 1.0)
+#else
+	vec3 viewN = texture(uGBufferNormal, uv).xyz;
 
 	// assuming GBuffer pass uses black color to clear normal attachment
 	if (length(viewN) < 1e-5)
+#endif
 	{
 		fOcclusion = 1.0;
 		return;
@@ -75,7 +129,7 @@ void main()
 	const float bias = 0.025;
 	float occlusion = 0.0;
 
-	for (int i = 0; i < KERNEL_SIZE; ++i)
+	for (int i = 0; i < uKernel.SampleCount; ++i)
 	{
 		// depth of the sampled position in view space
 		vec3 sampleOffset = TBN * uKernel.Samples[i].xyz;
@@ -88,11 +142,11 @@ void main()
 		offset.xyz = offset.xyz * 0.5 + 0.5;
 
 		// compare actual and visible depth of sampled position
-		float visibleDepth = FrameBufferTexture(uGBufferPosition, offset.xy).z;
+		float visibleDepth = GBufferPosition(offset.xy).z;
 		float actualDepth = sampleP.z;
 		float rangeCheck = smoothstep(0.0, 1.0, radius / abs(viewP.z - visibleDepth));
 		occlusion += (visibleDepth >= actualDepth + bias ? 1.0 : 0.0) * rangeCheck; 
 	}
 
-	fOcclusion = 1.0 - (occlusion / KERNEL_SIZE);
+	fOcclusion = 1.0 - (occlusion / float(uKernel.SampleCount));
 }
\ No newline at end of file
@@ -4,10 +4,16 @@
 #ludens vertex
 
 #version 450 core
+#ifdef LD_VERTEX_QUANTIZED
+layout (location = 0) in vec3 aPos;           // unsigned normalized in the mesh bounds, folded into the model matrix
+layout (location = 1) in vec4 aNormalTangent; // signed normalized octahedral normal and tangent
+layout (location = 3) in vec2 aTexUV;         // 16 bit floats
+#else
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aNormal;
 layout (location = 2) in vec3 aTangent;
 layout (location = 3) in vec2 aTexUV;
+#endif
 layout (location = 4) in vec4 aModelMat[3];
 layout (location = 7) in vec4 aNormalMat[3];
 
@@ -25,8 +31,25 @@ layout (group = 0, binding = 0, std140) uniform Viewport
 	vec4 CameraPos;
 } uViewport;
 
+#ifdef LD_VERTEX_QUANTIZED
+// octahedral decoding, must match GBufferDecodeNormal in GBufferLayout.h
+vec3 DecodeOctahedral(vec2 e)
+{
+	vec3 n = vec3(e.xy, 1.0 - abs(e.x) - abs(e.y));
+	float t = max(-n.z, 0.0);
+	n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+
+	return normalize(n);
+}
+#endif
+
 void main()
 {
+#ifdef LD_VERTEX_QUANTIZED
+	vec3 aNormal = DecodeOctahedral(aNormalTangent.xy);
+	vec3 aTangent = DecodeOctahedral(aNormalTangent.zw);
+#endif
+
 	mat4 modelMat; 
 	modelMat[0] = vec4(aModelMat[0].x, aModelMat[1].x, aModelMat[2].x, 0.0);
 	modelMat[1] = vec4(aModelMat[0].y, aModelMat[1].y, aModelMat[2].y, 0.0);
@@ -56,9 +79,14 @@ layout (location = 1) in vec3 vNormal;
 layout (location = 2) in vec2 vTexUV;
 layout (location = 3) in mat3 vTBN;
 
+#ifdef LD_GBUFFER_COMPACT
+layout (location = 0) out vec4 fNormalRoughnessMetallic;
+layout (location = 1) out vec4 fAlbedo;
+#else
 layout (location = 0) out vec4 fPosRoughness;
 layout (location = 1) out vec4 fNormalMetallic;
 layout (location = 2) out vec4 fAlbedo;
+#endif
 
 layout (group = 0, binding = 0, std140) uniform Viewport
 {
@@ -83,6 +111,20 @@ layout (group = 1, binding = 2) uniform sampler2D uNormal;
 layout (group = 1, binding = 3) uniform sampler2D uMetallic;
 layout (group = 1, binding = 4) uniform sampler2D uRoughness;
 
+#ifdef LD_GBUFFER_COMPACT
+// octahedral normal encoding, must match GBufferEncodeNormal in GBufferLayout.h
+vec2 EncodeNormal(vec3 n)
+{
+	vec2 e = n.xy / (abs(n.x) + abs(n.y) + abs(n.z));
+
+	// fold the lower hemisphere over the diagonals
+	if (n.z < 0.0)
+		e = (1.0 - abs(e.yx)) * vec2(e.x >= 0.0 ? 1.0 : -1.0, e.y >= 0.0 ? 1.0 : -1.0);
+
+	return e;
+}
+#endif
+
 void main()
 {
 	vec4 albedo = uMaterial.Albedo;
@@ -124,7 +166,11 @@ void main()
 		break;
 	}
 
+#ifdef LD_GBUFFER_COMPACT
+	fNormalRoughnessMetallic = vec4(EncodeNormal(normal), roughness, metallic);
+#else
 	fPosRoughness = vec4(vPos, roughness);
 	fNormalMetallic = vec4(normal, metallic);
+#endif
 	fAlbedo = albedo;
 }
@@ -0,0 +1,195 @@
+#ludens group 0 Viewport
+#ludens group 1 BindlessMaterial
+
+#ludens vertex
+
+#version 450 core
+#ifdef LD_VERTEX_QUANTIZED
+layout (location = 0) in vec3 aPos;           // unsigned normalized in the mesh bounds, folded into the model matrix
+layout (location = 1) in vec4 aNormalTangent; // signed normalized octahedral normal and tangent
+layout (location = 3) in vec2 aTexUV;         // 16 bit floats
+#else
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec3 aTangent;
+layout (location = 3) in vec2 aTexUV;
+#endif
+layout (location = 4) in vec4 aModelMat[3];
+layout (location = 7) in vec4 aNormalMat[3];
+
+layout (location = 0) out vec3 vPos;
+layout (location = 1) out vec3 vNormal;
+layout (location = 2) out vec2 vTexUV;
+layout (location = 3) out mat3 vTBN;
+layout (location = 6) flat out int vMaterial;
+
+
+layout (group = 0, binding = 0, std140) uniform Viewport
+{
+	mat4 View;
+	mat4 Proj;
+	mat4 ViewProj;
+	vec4 CameraPos;
+} uViewport;
+
+#ifdef LD_VERTEX_QUANTIZED
+// octahedral decoding, must match GBufferDecodeNormal in GBufferLayout.h
+vec3 DecodeOctahedral(vec2 e)
+{
+	vec3 n = vec3(e.xy, 1.0 - abs(e.x) - abs(e.y));
+	float t = max(-n.z, 0.0);
+	n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+
+	return normalize(n);
+}
+#endif
+
+void main()
+{
+#ifdef LD_VERTEX_QUANTIZED
+	vec3 aNormal = DecodeOctahedral(aNormalTangent.xy);
+	vec3 aTangent = DecodeOctahedral(aNormalTangent.zw);
+#endif
+
+	mat4 modelMat;
+	modelMat[0] = vec4(aModelMat[0].x, aModelMat[1].x, aModelMat[2].x, 0.0);
+	modelMat[1] = vec4(aModelMat[0].y, aModelMat[1].y, aModelMat[2].y, 0.0);
+	modelMat[2] = vec4(aModelMat[0].z, aModelMat[1].z, aModelMat[2].z, 0.0);
+	modelMat[3] = vec4(aModelMat[0].w, aModelMat[1].w, aModelMat[2].w, 1.0);
+
+	mat3 normalMat = mat3(aNormalMat[0].xyz, aNormalMat[1].xyz, aNormalMat[2].xyz);
+
+	vPos = (uViewport.View * modelMat * vec4(aPos, 1.0)).xyz;   // view space position
+	vNormal = normalize(normalMat * aNormal);                   // view space normal
+	vTexUV = aTexUV;
+	vMaterial = int(aNormalMat[0].w);                           // per-instance material index
+
+	vec3 T = normalize(normalMat * aTangent);
+	vec3 N = vNormal;
+	vec3 B = cross(N, T);
+	vTBN = mat3(T, B, N);
+
+	gl_Position = uViewport.Proj * vec4(vPos, 1.0);
+}
+
+#ludens fragment
+
+
+#version 450 core
+#extension GL_EXT_nonuniform_qualifier : require
+
+layout (location = 0) in vec3 vPos;
+layout (location = 1) in vec3 vNormal;
+layout (location = 2) in vec2 vTexUV;
+layout (location = 3) in mat3 vTBN;
+layout (location = 6) flat in int vMaterial;
+
+#ifdef LD_GBUFFER_COMPACT
+layout (location = 0) out vec4 fNormalRoughnessMetallic;
+layout (location = 1) out vec4 fAlbedo;
+#else
+layout (location = 0) out vec4 fPosRoughness;
+layout (location = 1) out vec4 fNormalMetallic;
+layout (location = 2) out vec4 fAlbedo;
+#endif
+
+layout (group = 0, binding = 0, std140) uniform Viewport
+{
+	mat4 View;
+	mat4 Proj;
+	mat4 ViewProj;
+	vec4 CameraPos;
+} uViewport;
+
+// texture fields index into uTextures, -1 if not used
+struct Material
+{
+	vec4 Albedo;
+	float Roughness;
+	float Metallic;
+	int MetallicRoughnessLayout;
+	int AlbedoTexture;
+	int NormalTexture;
+	int MetallicTexture;
+	int RoughnessTexture;
+	int Reserved;
+};
+
+// array sizes must match MAX_BINDLESS_MATERIAL_COUNT and MAX_BINDLESS_TEXTURE_COUNT
+layout (group = 1, binding = 0, std430) readonly buffer Materials
+{
+	Material uMaterials[1024];
+};
+
+layout (group = 1, binding = 1) uniform sampler2D uTextures[512];
+
+vec4 SampleMaterialTexture(int textureIndex)
+{
+	// draws may be merged across materials, so the index is not dynamically uniform
+	return texture(uTextures[nonuniformEXT(textureIndex)], vTexUV);
+}
+
+#ifdef LD_GBUFFER_COMPACT
+// octahedral normal encoding, must match GBufferEncodeNormal in GBufferLayout.h
+vec2 EncodeNormal(vec3 n)
+{
+	vec2 e = n.xy / (abs(n.x) + abs(n.y) + abs(n.z));
+
+	// fold the lower hemisphere over the diagonals
+	if (n.z < 0.0)
+		e = (1.0 - abs(e.yx)) * vec2(e.x >= 0.0 ? 1.0 : -1.0, e.y >= 0.0 ? 1.0 : -1.0);
+
+	return e;
+}
+#endif
+
+void main()
+{
+	Material mat = uMaterials[vMaterial];
+	vec4 albedo = mat.Albedo;
+	vec3 normal = normalize(vNormal);
+
+	if (mat.AlbedoTexture >= 0)
+	{
+		albedo = SampleMaterialTexture(mat.AlbedoTexture);
+	}
+
+	if (mat.NormalTexture >= 0)
+	{
+		// normal mapping from tangent space to view space
+		normal = SampleMaterialTexture(mat.NormalTexture).rgb;
+		normal = normalize(normal * 2.0 - 1.0);
+		normal = normalize(vTBN * normal);
+	}
+
+	float metallic = mat.Metallic;
+	float roughness = mat.Roughness;
+
+	switch (mat.MetallicRoughnessLayout)
+	{
+	case 1: // separate textures
+		metallic = SampleMaterialTexture(mat.MetallicTexture).r;
+		roughness = SampleMaterialTexture(mat.RoughnessTexture).r;
+		break;
+	case 2: // single texture
+		metallic = SampleMaterialTexture(mat.MetallicTexture).b;
+		roughness = SampleMaterialTexture(mat.MetallicTexture).g;
+		break;
+	case 3: // metallic only
+		metallic = SampleMaterialTexture(mat.MetallicTexture).r;
+		break;
+	case 4: // roughness only
+		roughness = SampleMaterialTexture(mat.RoughnessTexture).r;
+		break;
+	default: // no textures
+		break;
+	}
+
+#ifdef LD_GBUFFER_COMPACT
+	fNormalRoughnessMetallic = vec4(EncodeNormal(normal), roughness, metallic);
+#else
+	fPosRoughness = vec4(vPos, roughness);
+	fNormalMetallic = vec4(normal, metallic);
+#endif
+	fAlbedo = albedo;
+}
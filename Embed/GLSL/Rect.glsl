@@ -5,8 +5,9 @@
 
 #version 450 core
 
-layout (location = 0) in vec2 aPos;
-layout (location = 1) in vec2 aTexUV;
+// per-instance RectInstance attributes
+layout (location = 0) in vec4 aRect;    // top left corner in xy, size in zw
+layout (location = 1) in vec4 aTexRect; // texture coordinates of the top left corner in xy, bottom right corner in zw
 layout (location = 2) in vec4 aColor;
 layout (location = 3) in float aTexID;
 
@@ -24,13 +25,26 @@ layout (group = 0, binding = 0, std140) uniform Viewport
 } uViewport;
 
 
+// two triangles of a rect, in units of the rect size from the top left corner
+const vec2 sCorners[6] = vec2[](
+	vec2(1.0, 1.0), vec2(1.0, 0.0), vec2(0.0, 0.0),
+	vec2(0.0, 0.0), vec2(0.0, 1.0), vec2(1.0, 1.0)
+);
+
 void main()
 {
-	vTexUV = aTexUV;
+#ifdef LD_VULKAN
+	vec2 corner = sCorners[gl_VertexIndex];
+#else
+	vec2 corner = sCorners[gl_VertexID];
+#endif
+	vec2 pos = aRect.xy + corner * aRect.zw;
+
+	vTexUV = mix(aTexRect.xy, aTexRect.zw, corner);
 	vColor = aColor;
 	vTexID = aTexID;
 
-	gl_Position = uViewport.ViewProj * vec4(aPos, 0.0, 1.0);
+	gl_Position = uViewport.ViewProj * vec4(pos, 0.0, 1.0);
 }
 
 #ludens fragment
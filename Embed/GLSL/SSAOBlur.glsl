@@ -20,8 +20,45 @@ void main()
 layout (location = 0) in vec2 vTexUV;
 layout (location = 0) out float fSSAOBlur;
 
+layout (group = 0, binding = 0, std140) uniform ViewportUBO
+{
+	mat4 ViewMat;
+	mat4 ProjMat;
+	mat4 ViewProjMat;
+	vec3 viewP;
+	vec2 Extent;
+	mat4 InvProjMat;
+} uViewportUBO;
+
+#ifdef LD_GBUFFER_COMPACT
+layout (group = 0, binding = 1) uniform sampler2D uGBufferDepth;
+#else
+layout (group = 0, binding = 1) uniform sampler2D uGBufferPosition;
+#endif
+
 layout (group = 1, binding = 2) uniform sampler2D uSSAOInput;
 
+// falloff of the depth weight, relative to the view depth of the output pixel
+#define DEPTH_SHARPNESS 32.0
+
+// view space depth of the GBuffer, uv is already flipped for the backend
+float GBufferViewDepth(vec2 uv)
+{
+#ifdef LD_GBUFFER_COMPACT
+	float depth = texture(uGBufferDepth, uv).r;
+#ifdef LD_VULKAN
+	float ndcDepth = depth;
+#else
+	float ndcDepth = depth * 2.0 - 1.0;
+#endif
+	// view depth of a perspective projection does not depend on NDC xy
+	vec4 position = uViewportUBO.InvProjMat * vec4(0.0, 0.0, ndcDepth, 1.0);
+	return position.z / position.w;
+#else
+	return texture(uGBufferPosition, uv).z;
+#endif
+}
+
 void main()
 {
 	vec2 uv = vTexUV;
@@ -29,25 +66,43 @@ void main()
 	uv.y = 1.0 - uv.y;
 #endif
 
-	vec2 texelSize = 1.0 / vec2(textureSize(uSSAOInput, 0));
+	// under dynamic resolution the rendered area covers the same fraction
+	// of the GBuffer, SSAO input and output textures
+#ifdef LD_GBUFFER_COMPACT
+	vec2 uvMax = uViewportUBO.Extent / vec2(textureSize(uGBufferDepth, 0));
+#else
+	vec2 uvMax = uViewportUBO.Extent / vec2(textureSize(uGBufferPosition, 0));
+#endif
+	uv *= uvMax;
+
+	// the SSAO input may be at a lower resolution than this target,
+	// blur the 4x4 input texels around the output pixel and reject texels
+	// across depth discontinuities so occlusion does not bleed over edges
+	vec2 inputSize = vec2(textureSize(uSSAOInput, 0));
+	vec2 base = floor(uv * inputSize - 0.5) - 1.0;
+	float centerDepth = GBufferViewDepth(uv);
+	float depthScale = DEPTH_SHARPNESS / max(abs(centerDepth), 1e-3);
 	float sum = 0.0;
-	vec2 offset;
+	float weightSum = 0.0;
 
-	// naive box blur by averaging 16 diagonal pixels
-	for (int x = 1; x <= 2; x++)
+	for (int y = 0; y < 4; y++)
 	{
-		for (int y = 1; y <= 2; y++)
+		for (int x = 0; x < 4; x++)
 		{
-			offset = vec2(float(x), float(y)) * texelSize;
-			sum += texture(uSSAOInput, uv + offset).r;
-			offset = vec2(float(x), float(-y)) * texelSize;
-			sum += texture(uSSAOInput, uv + offset).r;
-			offset = vec2(float(-x), float(y)) * texelSize;
-			sum += texture(uSSAOInput, uv + offset).r;
-			offset = vec2(float(-x), float(-y)) * texelSize;
-			sum += texture(uSSAOInput, uv + offset).r;
+			// sample at input texel centers, where the SSAO pass sampled the GBuffer
+			vec2 texelUV = (base + vec2(float(x), float(y)) + 0.5) / inputSize;
+			texelUV = clamp(texelUV, 0.5 / inputSize, uvMax - 0.5 / inputSize);
+			float texelDepth = GBufferViewDepth(texelUV);
+			float weight = exp(-abs(texelDepth - centerDepth) * depthScale);
+
+			sum += texture(uSSAOInput, texelUV).r * weight;
+			weightSum += weight;
 		}
 	}
 
-	fSSAOBlur = sum / 16.0;
-}
\ No newline at end of file
+	// every neighbour lies on another surface, fall back to the nearest input texel
+	if (weightSum < 1e-4)
+		fSSAOBlur = texture(uSSAOInput, uv).r;
+	else
+		fSSAOBlur = sum / weightSum;
+}
@@ -23,7 +23,20 @@ layout (location = 0) in vec2 vTexUV;
 layout (location = 0) out vec4 fColorLDR;
 
 // world viewport should be bound at group 1
+layout (group = 1, binding = 0, std140) uniform ViewportUBO
+{
+    mat4 ViewMat;
+    mat4 ProjMat;
+    mat4 ViewProjMat;
+    vec4 ViewPos;
+    vec2 Extent;
+    mat4 InvProjMat;
+} uWorldViewportUBO;
+
+// the compact GBuffer layout packs roughness and metallic with the normals
+#ifndef LD_GBUFFER_COMPACT
 layout (group = 1, binding = 1) uniform sampler2D uPosition;
+#endif
 layout (group = 1, binding = 2) uniform sampler2D uNormals;
 layout (group = 1, binding = 3) uniform sampler2D uAlbedo;
 
@@ -36,6 +49,28 @@ layout (group = 3, binding = 0) uniform Buffer
     int LDRResult;
 } uBuffer;
 
+#ifdef LD_GBUFFER_COMPACT
+// octahedral normal decoding, must match GBufferDecodeNormal in GBufferLayout.h
+vec3 DecodeNormal(vec2 e)
+{
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+#endif
+
+// world passes may render to a smaller area of their frame buffers under dynamic resolution,
+// scale uv to that area and keep bilinear taps inside it to upsample to the full viewport.
+// GBuffer and HDR frame buffers share the same size.
+vec2 WorldUV(vec2 uv)
+{
+    vec2 size = vec2(textureSize(uColorHDR, 0));
+    vec2 extent = uWorldViewportUBO.Extent;
+    return clamp(uv * extent, vec2(0.5), extent - 0.5) / size;
+}
+
 void main()
 {
     vec2 uv = vTexUV;
@@ -43,25 +78,34 @@ void main()
     uv.y = 1.0 - uv.y;
 #endif
 
+    vec2 worldUV = WorldUV(uv);
     vec3 color;
 
     switch (uBuffer.LDRResult)
     {
     case 2: // view space normals
-        color = texture(uNormals, uv).rgb;
+#ifdef LD_GBUFFER_COMPACT
+        color = DecodeNormal(texture(uNormals, worldUV).xy);
+#else
+        color = texture(uNormals, worldUV).rgb;
+#endif
         break;
     case 3: // albedo
-        color = texture(uAlbedo, uv).rgb;
+        color = texture(uAlbedo, worldUV).rgb;
         break;
     case 4: // metallic
-        color = texture(uNormals, uv).aaa;
+        color = texture(uNormals, worldUV).aaa;
         break;
     case 5: // roughness
-        color = texture(uPosition, uv).aaa;
+#ifdef LD_GBUFFER_COMPACT
+        color = texture(uNormals, worldUV).bbb;
+#else
+        color = texture(uPosition, worldUV).aaa;
+#endif
         break;
     case 0: // tone mapping with Reinhard operator
     default:
-        color = texture(uColorHDR, uv).rgb;
+        color = texture(uColorHDR, worldUV).rgb;
         color = color / (color + vec3(1.0));
     }
 
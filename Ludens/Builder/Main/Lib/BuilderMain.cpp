@@ -1,17 +1,19 @@
 #include <cstdio>
 #include <iostream>
+#include "Builder/Main/Lib/DoxygenBuild.h"
+#include "Builder/Main/Lib/PackBuild.h"
 #include "Builder/Main/Lib/Shaderc.h"
 #include "Core/CommandLine/Include/CommandLine.h"
 
 static void PrintUsage(const char* program)
 {
     std::cout << "usage: " << program << "Mode" << std::endl;
-    std::cout << "possible values for Mode are: shaderc" << std::endl;
+    std::cout << "possible values for Mode are: shaderc, doxygen, pack" << std::endl;
 }
 
 int main(int argc, const char** argv)
 {
-    const char* modes[] = { "shaderc" };
+    const char* modes[] = { "shaderc", "doxygen", "pack" };
 
     LD::CommandLineParser parser;
     LD::CommandLineResult result;
@@ -29,6 +31,16 @@ int main(int argc, const char** argv)
         LD::Shaderc shaderc;
         return shaderc.Main(argc - 1, argv + 1);
     }
+    else if (mode == "doxygen")
+    {
+        LD::DoxygenBuild doxygen;
+        return doxygen.Main(argc - 1, argv + 1);
+    }
+    else if (mode == "pack")
+    {
+        LD::PackBuild pack;
+        return pack.Main(argc - 1, argv + 1);
+    }
     else
     {
         std::cout << "unknown mode \"" << mode << "\"" << std::endl;
@@ -0,0 +1,327 @@
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <unordered_set>
+#include "Builder/Main/Lib/BuilderMain.h"
+#include "Builder/Main/Lib/DoxygenBuild.h"
+#include "Core/CommandLine/Include/CommandLine.h"
+#include "Core/Document/Include/DocumentCompiler.h"
+#include "Core/Serialize/Include/XMLReader.h"
+#include "Core/Math/Include/Hash.h"
+#include "Core/OS/Include/JobSystem.h"
+#include "Core/OS/Include/Time.h"
+
+#define DOXYGEN_CACHE_FILE "doxygen.cache"
+#define DOXYGEN_INDEX_FILE "index.md"
+
+namespace LD {
+
+// Doxygen writes one file per compound, named after the compound kind and ID.
+// Only classes and structs are compiled to Markdown, the Markdown file keeps the stem.
+static bool IsCompoundFile(const Path& path, const char* extension)
+{
+    if (path.Extension().ToString() != extension)
+        return false;
+
+    std::string stem = path.Stem().ToString();
+
+    return stem.rfind("class", 0) == 0 || stem.rfind("struct", 0) == 0;
+}
+
+DoxygenBuild::DoxygenBuild() : mRebuild(false)
+{
+}
+
+DoxygenBuild::~DoxygenBuild()
+{
+}
+
+int DoxygenBuild::Main(int argc, const char** argv)
+{
+    CommandLineArg argOutput;
+    argOutput.FullName = "output";
+    argOutput.Help = "output directory for Markdown files and the build cache";
+
+    CommandLineArg argRebuild;
+    argRebuild.FullName = "rebuild";
+    argRebuild.Help = "ignore the build cache and compile every compound";
+    argRebuild.IsFlag = true;
+
+    CommandLineArg argInput;
+    argInput.FullName = "input";
+    argInput.Help = "doxygen XML output directory";
+    argInput.IsPositional = true;
+
+    CommandLineParser parser;
+    CommandLineResult result;
+    int argOutputI = parser.AddArgument(argOutput);
+    int argRebuildI = parser.AddArgument(argRebuild);
+    int argInputI = parser.AddArgument(argInput);
+
+    result = parser.Parse(argc, argv);
+    if (result.Type != CommandLineResultType::Ok)
+    {
+        std::cout << result.Error << std::endl;
+        return 0;
+    }
+
+    std::string value;
+    std::string outputDir;
+    bool rebuild = parser.GetArgument(argRebuildI, value);
+
+    if (!parser.GetArgument(argOutputI, outputDir))
+        outputDir = "./";
+
+    parser.GetArgument(argInputI, value);
+    PrintLn("input dir: %s", value.c_str());
+    PrintLn("output dir: %s", outputDir.c_str());
+
+    DoxygenBuildStats stats = Build({ value }, { outputDir }, rebuild);
+    size_t files = stats.Compiled + stats.Skipped + stats.Failed;
+
+    PrintLn("%d compiled, %d skipped, %d failed", (int)stats.Compiled, (int)stats.Skipped, (int)stats.Failed);
+    PrintLn("%d files in %.3f seconds, %.1f files/second", (int)files, stats.Seconds,
+            stats.Seconds > 0.0 ? files / stats.Seconds : 0.0);
+
+    return stats.Failed > 0 ? 1 : 0;
+}
+
+DoxygenBuildStats DoxygenBuild::Build(const Path& inputDir, const Path& outputDir, bool rebuild)
+{
+    DoxygenBuildStats stats{};
+    Timer timer;
+    timer.Start();
+
+    mRebuild = rebuild;
+    mOutputDir = outputDir.ToString();
+    if (!mOutputDir.empty() && mOutputDir.back() != '/' && mOutputDir.back() != '\\')
+        mOutputDir += '/';
+
+    FileSystem fs;
+    std::vector<Path> files;
+
+    if (!fs.GetFiles(inputDir, files))
+    {
+        PrintLn("input directory not found: %s", inputDir.ToString().c_str());
+        return stats;
+    }
+
+    if (!File::Exists(outputDir))
+        fs.CreateDirectories(outputDir);
+
+    Path cachePath(mOutputDir + DOXYGEN_CACHE_FILE);
+    mCache.clear();
+    if (!mRebuild)
+        LoadCache(cachePath);
+
+    mCompounds.clear();
+
+    for (const Path& path : files)
+    {
+        if (!IsCompoundFile(path, ".xml"))
+            continue;
+
+        Compound compound{};
+        compound.InputPath = path;
+        compound.ID = mStrings.Intern(path.Stem().ToString());
+        compound.Status = CompoundStatus::Failed;
+        mCompounds.push_back(compound);
+    }
+
+    // one parse and compile job per compound, each job only writes to its own Compound
+    std::vector<CompileJobData> jobData(mCompounds.size());
+    JobSystem& js = JobSystem::GetSingleton();
+
+    for (size_t i = 0; i < mCompounds.size(); i++)
+    {
+        jobData[i].Build = this;
+        jobData[i].Index = i;
+
+        Job job;
+        job.Type = JobType::CompileDocument;
+        job.Main = &DoxygenBuild::CompileJob;
+        job.Data = jobData.data() + i;
+        js.Submit(job);
+    }
+
+    js.WaitType(JobType::CompileDocument);
+
+    for (const Compound& compound : mCompounds)
+    {
+        if (compound.Status == CompoundStatus::Compiled)
+            stats.Compiled++;
+        else if (compound.Status == CompoundStatus::Skipped)
+            stats.Skipped++;
+        else
+        {
+            stats.Failed++;
+            PrintLn("failed to compile %s", compound.InputPath.ToString().c_str());
+        }
+    }
+
+    RemoveStaleMarkdown();
+    SaveCache(cachePath);
+    WriteIndex({ mOutputDir + DOXYGEN_INDEX_FILE });
+
+    timer.Stop();
+    stats.Seconds = timer.GetSeconds();
+
+    return stats;
+}
+
+void DoxygenBuild::CompileJob(void* data)
+{
+    CompileJobData* job = (CompileJobData*)data;
+    DoxygenBuild& build = *job->Build;
+    Compound& compound = build.mCompounds[job->Index];
+
+    File xmlFile;
+    if (!xmlFile.Open(compound.InputPath, FileMode::Read))
+        return;
+
+    const char* xml = (const char*)xmlFile.Data();
+    size_t xmlSize = xmlFile.Size();
+    compound.Hash = DJB2<char>{}(xml, xmlSize);
+
+    Path mdPath = build.GetMarkdownPath(compound.ID);
+    auto cached = build.mCache.find(compound.ID);
+
+    if (cached != build.mCache.end() && cached->second.Hash == compound.Hash && File::Exists(mdPath))
+    {
+        compound.Name = cached->second.Name;
+        compound.Status = CompoundStatus::Skipped;
+        return;
+    }
+
+    XMLReader reader(xml, xmlSize);
+    DocumentCompiler compiler;
+    std::string md;
+    std::vector<std::string> names;
+
+    if (!compiler.CompileDoxygenXML(reader, md, &names) || names.empty())
+        return;
+
+    compound.Name = build.mStrings.Intern(names.front());
+
+    File mdFile;
+    if (!mdFile.Open(mdPath, FileMode::Write))
+        return;
+
+    bool isWritten = mdFile.Write((const u8*)md.data(), md.size()) && mdFile.Flush();
+    mdFile.Close();
+
+    // failed compounds are not cached, the partial file is compiled again by the next build
+    if (!isWritten)
+        return;
+
+    compound.Status = CompoundStatus::Compiled;
+}
+
+void DoxygenBuild::RemoveStaleMarkdown()
+{
+    FileSystem fs;
+    std::vector<Path> files;
+
+    if (!fs.GetFiles({ mOutputDir }, files))
+        return;
+
+    std::unordered_set<u32> ids;
+    for (const Compound& compound : mCompounds)
+        ids.insert(compound.ID);
+
+    // Markdown of compounds removed from the input since a previous build
+    for (const Path& path : files)
+    {
+        if (IsCompoundFile(path, ".md") && ids.find(mStrings.Intern(path.Stem().ToString())) == ids.end())
+            std::filesystem::remove(static_cast<const std::filesystem::path&>(path));
+    }
+}
+
+void DoxygenBuild::LoadCache(const Path& cachePath)
+{
+    if (!File::Exists(cachePath))
+        return;
+
+    File file;
+    std::string content;
+    file.Open(cachePath, FileMode::Read);
+    file.ReadString(content);
+
+    // one compound per line: content hash, ID, qualified name
+    std::istringstream lines(content);
+    std::string line;
+
+    while (std::getline(lines, line))
+    {
+        std::istringstream fields(line);
+        std::string id, name;
+        size_t hash;
+
+        if (!(fields >> std::hex >> hash >> id) || !std::getline(fields >> std::ws, name))
+            continue;
+
+        mCache[mStrings.Intern(id)] = { hash, mStrings.Intern(name) };
+    }
+}
+
+void DoxygenBuild::SaveCache(const Path& cachePath)
+{
+    std::ostringstream content;
+
+    for (const Compound& compound : mCompounds)
+    {
+        if (compound.Status == CompoundStatus::Failed)
+            continue;
+
+        content << std::hex << compound.Hash << ' ' << mStrings.Get(compound.ID) << ' ' << mStrings.Get(compound.Name)
+                << '\n';
+    }
+
+    std::string str = content.str();
+    File file;
+    file.Open(cachePath, FileMode::Write);
+    file.Write((const u8*)str.data(), str.size());
+    file.Close();
+}
+
+void DoxygenBuild::WriteIndex(const Path& indexPath)
+{
+    std::vector<const Compound*> compounds;
+
+    for (const Compound& compound : mCompounds)
+    {
+        if (compound.Status != CompoundStatus::Failed)
+            compounds.push_back(&compound);
+    }
+
+    std::sort(compounds.begin(), compounds.end(), [this](const Compound* lhs, const Compound* rhs) {
+        return mStrings.Get(lhs->Name) < mStrings.Get(rhs->Name);
+    });
+
+    std::string md = "# API Reference\n\n";
+
+    for (const Compound* compound : compounds)
+    {
+        md += "- [";
+        md += mStrings.Get(compound->Name);
+        md += "](";
+        md += mStrings.Get(compound->ID);
+        md += ".md)\n";
+    }
+
+    File file;
+    file.Open(indexPath, FileMode::Write);
+    file.Write((const u8*)md.data(), md.size());
+    file.Close();
+}
+
+Path DoxygenBuild::GetMarkdownPath(u32 id)
+{
+    std::string path = mOutputDir;
+    path += mStrings.Get(id);
+    path += ".md";
+
+    return { path };
+}
+
+} // namespace LD
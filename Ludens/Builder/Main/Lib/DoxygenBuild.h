@@ -0,0 +1,89 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "Builder/Main/Lib/StringTable.h"
+#include "Core/IO/Include/FileSystem.h"
+
+namespace LD
+{
+
+enum class CompoundStatus
+{
+    Failed = 0,
+    Compiled,
+    Skipped,
+};
+
+/// statistics of a single DoxygenBuild::Build
+struct DoxygenBuildStats
+{
+    size_t Compiled = 0;
+    size_t Skipped = 0;
+    size_t Failed = 0;
+    double Seconds = 0.0;
+};
+
+/// the builder's doxygen mode, compiles a doxygen XML output directory to Markdown,
+/// one job per compound file. Compounds whose XML content hash matches the cache
+/// from the previous build are skipped.
+class DoxygenBuild
+{
+public:
+    DoxygenBuild();
+    DoxygenBuild(const DoxygenBuild&) = delete;
+    ~DoxygenBuild();
+
+    DoxygenBuild& operator=(const DoxygenBuild&) = delete;
+
+    int Main(int argc, const char** argv);
+
+    /// @brief compile all class and struct compound files in the input directory to the output directory
+    /// @param rebuild if true, the cache is ignored and every compound is compiled
+    DoxygenBuildStats Build(const Path& inputDir, const Path& outputDir, bool rebuild);
+
+    /// compound names and IDs shared by all compile jobs
+    inline StringTable& GetStrings()
+    {
+        return mStrings;
+    }
+
+private:
+    struct Compound
+    {
+        Path InputPath;
+        u32 ID;                // interned file stem, also the stem of the Markdown file
+        u32 Name;              // interned qualified name
+        size_t Hash;           // hash of the XML content
+        CompoundStatus Status;
+    };
+
+    struct CachedCompound
+    {
+        size_t Hash;
+        u32 Name;
+    };
+
+    struct CompileJobData
+    {
+        DoxygenBuild* Build;
+        size_t Index;
+    };
+
+    static void CompileJob(void* data);
+
+    void RemoveStaleMarkdown();
+    void LoadCache(const Path& cachePath);
+    void SaveCache(const Path& cachePath);
+    void WriteIndex(const Path& indexPath);
+    Path GetMarkdownPath(u32 id);
+
+    StringTable mStrings;
+    std::vector<Compound> mCompounds;
+    std::unordered_map<u32, CachedCompound> mCache; // read only while jobs are running
+    std::string mOutputDir;
+    bool mRebuild;
+};
+
+} // namespace LD
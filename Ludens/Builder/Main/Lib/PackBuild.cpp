@@ -0,0 +1,119 @@
+#include <iostream>
+#include <algorithm>
+#include "Builder/Main/Lib/BuilderMain.h"
+#include "Builder/Main/Lib/PackBuild.h"
+#include "Core/CommandLine/Include/CommandLine.h"
+
+namespace LD {
+
+PackBuild::PackBuild()
+{
+}
+
+PackBuild::~PackBuild()
+{
+}
+
+int PackBuild::Main(int argc, const char** argv)
+{
+    CommandLineArg argOutput;
+    argOutput.FullName = "output";
+    argOutput.Help = "output pack file path";
+
+    CommandLineArg argLZ4;
+    argLZ4.FullName = "lz4";
+    argLZ4.Help = "compress entries with LZ4, entries that do not shrink are stored as is";
+    argLZ4.IsFlag = true;
+
+    CommandLineArg argInput;
+    argInput.FullName = "input";
+    argInput.Help = "asset directory";
+    argInput.IsPositional = true;
+
+    CommandLineParser parser;
+    CommandLineResult result;
+    int argOutputI = parser.AddArgument(argOutput);
+    int argLZ4I = parser.AddArgument(argLZ4);
+    int argInputI = parser.AddArgument(argInput);
+
+    result = parser.Parse(argc, argv);
+    if (result.Type != CommandLineResultType::Ok)
+    {
+        std::cout << result.Error << std::endl;
+        return 0;
+    }
+
+    std::string value;
+    std::string outputPath;
+    PackCompression compression = parser.GetArgument(argLZ4I, value) ? PackCompression::LZ4 : PackCompression::None;
+
+    if (!parser.GetArgument(argOutputI, outputPath))
+        outputPath = "assets.pack";
+
+    parser.GetArgument(argInputI, value);
+    PrintLn("input dir: %s", value.c_str());
+    PrintLn("output pack: %s", outputPath.c_str());
+
+    PackBuildStats stats = Build({ value }, { outputPath }, compression);
+
+    if (!stats.Success)
+        return 1;
+
+    PrintLn("%d entries, %d blobs", (int)stats.Entries, (int)stats.Blobs);
+    PrintLn("%zu input bytes, %zu pack bytes", stats.InputBytes, stats.PackBytes);
+
+    return 0;
+}
+
+PackBuildStats PackBuild::Build(const Path& inputDir, const Path& outputPath, PackCompression compression)
+{
+    PackBuildStats stats{};
+    FileSystem fs;
+    std::vector<Path> files;
+
+    if (!fs.GetFiles(inputDir, files, true))
+    {
+        PrintLn("input directory not found: %s", inputDir.ToString().c_str());
+        return stats;
+    }
+
+    // directory iteration order is unspecified, sort for reproducible packs
+    std::sort(files.begin(), files.end(), [](const Path& lhs, const Path& rhs) {
+        return lhs.ToString() < rhs.ToString();
+    });
+
+    auto& std_inputDir = static_cast<const std::filesystem::path&>(inputDir);
+    PackWriter writer;
+
+    for (const Path& path : files)
+    {
+        auto& std_path = static_cast<const std::filesystem::path&>(path);
+        std::string name = std_path.lexically_relative(std_inputDir).generic_string();
+
+        File file;
+        if (!file.Open(path, FileMode::Read))
+        {
+            PrintLn("failed to read: %s", path.ToString().c_str());
+            return stats;
+        }
+
+        writer.Add(name, file.Data(), file.Size(), compression);
+        stats.InputBytes += file.Size();
+    }
+
+    if (!writer.Write(outputPath))
+    {
+        PrintLn("failed to write: %s", outputPath.ToString().c_str());
+        return stats;
+    }
+
+    stats.Entries = writer.GetEntryCount();
+    stats.Blobs = writer.GetBlobCount();
+    std::error_code ec;
+    stats.PackBytes = (size_t)std::filesystem::file_size(static_cast<const std::filesystem::path&>(outputPath), ec);
+    stats.Success = true;
+
+    return stats;
+}
+
+} // namespace LD
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Core/IO/Include/FileSystem.h"
+#include "Core/IO/Include/Pack.h"
+
+namespace LD
+{
+
+/// statistics of a single PackBuild::Build
+struct PackBuildStats
+{
+    size_t Entries = 0;
+    size_t Blobs = 0;
+    size_t InputBytes = 0;
+    size_t PackBytes = 0;
+    bool Success = false;
+};
+
+/// the builder's pack mode, packs every file under an asset directory into a single
+/// pack file. Entries are named by their generic path relative to the asset directory.
+class PackBuild
+{
+public:
+    PackBuild();
+    PackBuild(const PackBuild&) = delete;
+    ~PackBuild();
+
+    PackBuild& operator=(const PackBuild&) = delete;
+
+    int Main(int argc, const char** argv);
+
+    /// @brief pack all files under the input directory
+    /// @param compression requested compression for every entry
+    PackBuildStats Build(const Path& inputDir, const Path& outputPath, PackCompression compression);
+};
+
+} // namespace LD
@@ -31,6 +31,14 @@ int Shaderc::Main(int argc, const char** argv)
     argOutput.FullName = "output";
     argOutput.Help = "output directory for spirv shaders";
 
+    CommandLineArg argDefine;
+    argDefine.FullName = "define";
+    argDefine.Help = "space separated preprocessor macros, used to compile shader variants";
+
+    CommandLineArg argSuffix;
+    argSuffix.FullName = "suffix";
+    argSuffix.Help = "appended to the stem of the output spirv file names, identifies a shader variant";
+
     CommandLineArg argInput;
     argInput.FullName = "input";
     argInput.Help = "one or more input shaders, written in Ludens GLSL";
@@ -41,6 +49,8 @@ int Shaderc::Main(int argc, const char** argv)
     int argOpenGLI = parser.AddArgument(argOpenGL);
     int argVulkanI = parser.AddArgument(argVulkan);
     int argOutputI = parser.AddArgument(argOutput);
+    int argDefineI = parser.AddArgument(argDefine);
+    int argSuffixI = parser.AddArgument(argSuffix);
     int argInputI = parser.AddArgument(argInput);
 
     result = parser.Parse(argc, argv);
@@ -61,6 +71,22 @@ int Shaderc::Main(int argc, const char** argv)
     if (!parser.GetArgument(argOutputI, mOutputDir))
         mOutputDir = "./";
     PrintLn("output dir: %s", mOutputDir.c_str());
+
+    mDefines.clear();
+    if (parser.GetArgument(argDefineI, value))
+    {
+        std::stringstream defines(value);
+        std::string define;
+
+        while (std::getline(defines, define, ' '))
+        {
+            if (!define.empty())
+                mDefines.push_back(define);
+        }
+    }
+
+    if (!parser.GetArgument(argSuffixI, mSuffix))
+        mSuffix.clear();
     
     while (std::getline(paths, value, ' '))
     {
@@ -92,6 +118,9 @@ void Shaderc::Compile(RBackend target, const Path& inputPath, const char* data,
 {
     RShaderCompiler compiler(target);
 
+    for (const std::string& define : mDefines)
+        compiler.AddDefine(define);
+
     std::string glsl(data, size);
     Vector<RShaderCompileResult> results;
     compiler.Compile(glsl, results);
@@ -100,7 +129,7 @@ void Shaderc::Compile(RBackend target, const Path& inputPath, const char* data,
 
     for (const RShaderCompileResult& result : results)
     {
-        std::string fileName = mOutputDir + inputPath.Stem().ToString();
+        std::string fileName = mOutputDir + inputPath.Stem().ToString() + mSuffix;
         fileName += target == RBackend::OpenGL ? "GL" : "VK";
         fileName += result.Type == RShaderType::VertexShader ? "VS" : "FS";
         fileName += ".spv";
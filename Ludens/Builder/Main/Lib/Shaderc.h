@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include "Core/DSA/Include/Vector.h"
 #include "Core/IO/Include/FileSystem.h"
 #include "Core/RenderBase/Include/RShader.h"
@@ -31,6 +32,8 @@ private:
     bool mOpenGL;
     bool mVulkan;
     std::string mOutputDir;
+    std::string mSuffix;
+    std::vector<std::string> mDefines;
 };
 
 } // namespace LD
\ No newline at end of file
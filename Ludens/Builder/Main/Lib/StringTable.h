@@ -0,0 +1,71 @@
+#pragma once
+
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include "Core/Header/Include/Types.h"
+#include "Core/OS/Include/Mutex.h"
+
+namespace LD
+{
+
+/// thread safe string interning, each distinct string is stored once and
+/// identified by an index that stays valid for the lifetime of the table
+class StringTable
+{
+public:
+    StringTable() = default;
+    StringTable(const StringTable&) = delete;
+
+    StringTable& operator=(const StringTable&) = delete;
+
+    /// @brief get the index of a string, adding it to the table if it is new
+    u32 Intern(std::string_view str)
+    {
+        mMutex.Lock();
+
+        auto ite = mIndices.find(str);
+        u32 index;
+
+        if (ite != mIndices.end())
+            index = ite->second;
+        else
+        {
+            // deque elements never move, the key views stay valid
+            index = (u32)mStrings.size();
+            const std::string& stored = mStrings.emplace_back(str);
+            mIndices[std::string_view(stored)] = index;
+        }
+
+        mMutex.Unlock();
+
+        return index;
+    }
+
+    /// @brief get an interned string, the view stays valid for the lifetime of the table
+    std::string_view Get(u32 index)
+    {
+        mMutex.Lock();
+        std::string_view str = mStrings[index];
+        mMutex.Unlock();
+
+        return str;
+    }
+
+    size_t Size()
+    {
+        mMutex.Lock();
+        size_t size = mStrings.size();
+        mMutex.Unlock();
+
+        return size;
+    }
+
+private:
+    Mutex mMutex;
+    std::deque<std::string> mStrings;
+    std::unordered_map<std::string_view, u32> mIndices;
+};
+
+} // namespace LD
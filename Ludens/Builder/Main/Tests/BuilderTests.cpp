@@ -1,4 +1,5 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <doctest.h>
 
-#include "Builder/Main/Tests/TestShaderc.h"
\ No newline at end of file
+#include "Builder/Main/Tests/TestShaderc.h"
+#include "Builder/Main/Tests/TestDoxygen.h"
\ No newline at end of file
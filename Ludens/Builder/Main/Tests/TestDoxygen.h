@@ -0,0 +1,124 @@
+#pragma once
+
+#include <string>
+#include <thread>
+#include <vector>
+#include <doctest.h>
+#include "Builder/Main/Lib/DoxygenBuild.h"
+#include "Builder/Main/Lib/StringTable.h"
+
+using namespace LD;
+
+static void WriteDoxygenCompound(const std::filesystem::path& dir, const char* id, const char* name)
+{
+    std::string xml = R"(<?xml version='1.0' encoding='UTF-8' standalone='no'?>
+<doxygen version="1.9.8">
+  <compounddef id=")";
+    xml += id;
+    xml += R"(" kind="class" language="C++" prot="public">
+    <compoundname>)";
+    xml += name;
+    xml += R"(</compoundname>
+    <briefdescription></briefdescription>
+    <detaileddescription></detaileddescription>
+  </compounddef>
+</doxygen>
+)";
+
+    File file;
+    file.Open({ (dir / (std::string(id) + ".xml")).string() }, FileMode::Write);
+    file.Write((const u8*)xml.data(), xml.size());
+}
+
+TEST_CASE("StringTable")
+{
+    StringTable table;
+
+    u32 foo = table.Intern("foo");
+    u32 bar = table.Intern("bar");
+    CHECK(foo != bar);
+    CHECK(table.Intern(std::string("foo")) == foo);
+    CHECK(table.Get(foo) == "foo");
+    CHECK(table.Get(bar) == "bar");
+    CHECK(table.Size() == 2);
+
+    // concurrent interning of overlapping strings yields one index per string
+    std::vector<std::thread> threads;
+    std::vector<std::vector<u32>> indices(4);
+
+    for (size_t t = 0; t < indices.size(); t++)
+    {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 1000; i++)
+                indices[t].push_back(table.Intern(std::to_string(i)));
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    CHECK(table.Size() == 1002);
+
+    for (size_t t = 1; t < indices.size(); t++)
+        CHECK(indices[t] == indices[0]);
+
+    for (int i = 0; i < 1000; i++)
+        CHECK(table.Get(indices[0][i]) == std::to_string(i));
+}
+
+TEST_CASE("Doxygen Incremental Build")
+{
+    std::filesystem::path root = std::filesystem::temp_directory_path() / "LudensBuilderTestDoxygen";
+    std::filesystem::path input = root / "xml";
+    std::filesystem::path output = root / "md";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(input);
+
+    WriteDoxygenCompound(input, "classLD_1_1Foo", "LD::Foo");
+    WriteDoxygenCompound(input, "structLD_1_1Bar", "LD::Bar");
+    WriteDoxygenCompound(input, "namespaceLD", "LD");
+
+    DoxygenBuildStats stats = DoxygenBuild{}.Build({ input }, { output }, false);
+    CHECK(stats.Compiled == 2);
+    CHECK(stats.Skipped == 0);
+    CHECK(stats.Failed == 0);
+    CHECK(File::Exists({ output / "classLD_1_1Foo.md" }));
+    CHECK(File::Exists({ output / "structLD_1_1Bar.md" }));
+    CHECK_FALSE(File::Exists({ output / "namespaceLD.md" }));
+
+    // unchanged compounds are skipped
+    stats = DoxygenBuild{}.Build({ input }, { output }, false);
+    CHECK(stats.Compiled == 0);
+    CHECK(stats.Skipped == 2);
+
+    // only the changed compound is compiled
+    WriteDoxygenCompound(input, "classLD_1_1Foo", "LD::Foo2");
+    stats = DoxygenBuild{}.Build({ input }, { output }, false);
+    CHECK(stats.Compiled == 1);
+    CHECK(stats.Skipped == 1);
+
+    // the index lists compounds sorted by name, including skipped ones
+    File index;
+    std::string md;
+    index.Open({ output / "index.md" }, FileMode::Read);
+    index.ReadString(md);
+    size_t bar = md.find("- [LD::Bar](structLD_1_1Bar.md)");
+    size_t foo = md.find("- [LD::Foo2](classLD_1_1Foo.md)");
+    CHECK(bar != std::string::npos);
+    CHECK(foo != std::string::npos);
+    CHECK(bar < foo);
+
+    stats = DoxygenBuild{}.Build({ input }, { output }, true);
+    CHECK(stats.Compiled == 2);
+    CHECK(stats.Skipped == 0);
+
+    // Markdown of removed compounds is removed as well
+    std::filesystem::remove(input / "structLD_1_1Bar.xml");
+    stats = DoxygenBuild{}.Build({ input }, { output }, false);
+    CHECK(stats.Skipped == 1);
+    CHECK(File::Exists({ output / "classLD_1_1Foo.md" }));
+    CHECK_FALSE(File::Exists({ output / "structLD_1_1Bar.md" }));
+    CHECK(File::Exists({ output / "index.md" }));
+
+    std::filesystem::remove_all(root);
+}
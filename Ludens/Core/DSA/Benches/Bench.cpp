@@ -1,7 +1,11 @@
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <iostream>
 #include "Core/DSA/Include/Vector.h"
 #include "Core/DSA/Include/String.h"
+#include "Core/DSA/Include/MPMCQueue.h"
+#include "Core/DSA/Include/SPSCQueue.h"
 #include "Core/OS/Include/Time.h"
 
 using namespace LD;
@@ -159,8 +163,118 @@ static void BenchStringHash()
     std::cout << "Long String Hash Cmp " << timeLongStrHash << std::endl;
 }
 
+// bounded ring buffer guarded by a mutex, the baseline for the lock-free queues
+template <typename T, size_t TCapacity>
+class MutexQueue
+{
+public:
+    bool TryEnqueue(const T& value)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (mSize == TCapacity)
+            return false;
+
+        mData[(mHead + mSize++) % TCapacity] = value;
+        return true;
+    }
+
+    bool TryDequeue(T& value)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (mSize == 0)
+            return false;
+
+        value = mData[mHead];
+        mHead = (mHead + 1) % TCapacity;
+        mSize--;
+        return true;
+    }
+
+    void Enqueue(const T& value)
+    {
+        while (!TryEnqueue(value))
+            std::this_thread::yield();
+    }
+
+    void Dequeue(T& value)
+    {
+        while (!TryDequeue(value))
+            std::this_thread::yield();
+    }
+
+private:
+    std::mutex mMutex;
+    size_t mHead = 0;
+    size_t mSize = 0;
+    T mData[TCapacity];
+};
+
+// time for producers to hand N values to consumers through the queue
+template <typename TQueue>
+static double BenchQueueThroughput(int producerCount, int consumerCount, size_t N)
+{
+    TQueue* queue = new TQueue();
+    std::vector<std::thread> threads;
+    std::atomic<size_t> sum(0);
+    double time;
+
+    {
+        ScopeTimer timer(&time);
+
+        for (int p = 0; p < producerCount; p++)
+        {
+            threads.emplace_back([=]() {
+                for (size_t i = 0; i < N / producerCount; i++)
+                    queue->Enqueue(i);
+            });
+        }
+
+        for (int c = 0; c < consumerCount; c++)
+        {
+            threads.emplace_back([=, &sum]() {
+                size_t value, localSum = 0;
+
+                for (size_t i = 0; i < N / consumerCount; i++)
+                {
+                    queue->Dequeue(value);
+                    localSum += value;
+                }
+
+                sum += localSum;
+            });
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+
+    // keep the consumers from being stripped in release build.
+    std::cout << sum << std::endl;
+
+    delete queue;
+    return time;
+}
+
+static void BenchQueue()
+{
+    const size_t N = 4000000;
+
+    double timeSPSC = BenchQueueThroughput<SPSCQueue<size_t, 1024>>(1, 1, N);
+    double timeMutex1 = BenchQueueThroughput<MutexQueue<size_t, 1024>>(1, 1, N);
+    double timeMPMC = BenchQueueThroughput<MPMCQueue<size_t, 1024>>(4, 4, N);
+    double timeMutex4 = BenchQueueThroughput<MutexQueue<size_t, 1024>>(4, 4, N);
+
+    std::cout << "SPSC  Queue 1P1C " << timeSPSC << std::endl;
+    std::cout << "Mutex Queue 1P1C " << timeMutex1 << std::endl;
+    std::cout << "MPMC  Queue 4P4C " << timeMPMC << std::endl;
+    std::cout << "Mutex Queue 4P4C " << timeMutex4 << std::endl;
+}
+
 int main()
 {
     BenchVector();
     BenchStringHash();
+    BenchQueue();
 }
\ No newline at end of file
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include "Core/Header/Include/Error.h"
+#include "Core/Header/Include/Platform.h"
+
+namespace LD {
+
+/// Bounded lock-free multi-producer multi-consumer ring buffer (Vyukov).
+/// Every cell carries a sequence number that tells producers and consumers whether
+/// the cell is ready for them, so each operation is a single CAS on the shared
+/// enqueue or dequeue position. All TCapacity cells are usable.
+template <typename T, size_t TCapacity>
+class MPMCQueue
+{
+    LD_STATIC_ASSERT(TCapacity >= 2 && (TCapacity & (TCapacity - 1)) == 0);
+
+public:
+    MPMCQueue()
+    {
+        for (size_t i = 0; i < TCapacity; i++)
+            mCells[i].Sequence.store(i, std::memory_order_relaxed);
+
+        mEnqueuePos.store(0, std::memory_order_relaxed);
+        mDequeuePos.store(0, std::memory_order_relaxed);
+    }
+
+    MPMCQueue(const MPMCQueue&) = delete;
+    ~MPMCQueue() = default;
+
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    /// enqueue a value, returns false if the queue is full
+    bool TryEnqueue(const T& value)
+    {
+        Cell* cell;
+        size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            cell = mCells + (pos & (TCapacity - 1));
+            size_t seq = cell->Sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+            if (diff == 0)
+            {
+                if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+                return false; // the cell still holds a value from the previous lap
+            else
+                pos = mEnqueuePos.load(std::memory_order_relaxed);
+        }
+
+        cell->Data = value;
+        cell->Sequence.store(pos + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /// dequeue a value, returns false if the queue is empty
+    bool TryDequeue(T& value)
+    {
+        Cell* cell;
+        size_t pos = mDequeuePos.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            cell = mCells + (pos & (TCapacity - 1));
+            size_t seq = cell->Sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+            if (diff == 0)
+            {
+                if (mDequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+                return false; // no producer has published this cell yet
+            else
+                pos = mDequeuePos.load(std::memory_order_relaxed);
+        }
+
+        value = std::move(cell->Data);
+        cell->Sequence.store(pos + TCapacity, std::memory_order_release);
+
+        return true;
+    }
+
+    /// enqueue a value, spins and then yields while the queue is full
+    void Enqueue(const T& value)
+    {
+        for (int attempt = 0; !TryEnqueue(value); attempt++)
+            Backoff(attempt);
+    }
+
+    /// dequeue a value, spins and then yields while the queue is empty
+    void Dequeue(T& value)
+    {
+        for (int attempt = 0; !TryDequeue(value); attempt++)
+            Backoff(attempt);
+    }
+
+    /// number of enqueued values, only a snapshot if other threads are using the queue
+    size_t Size() const
+    {
+        size_t dequeuePos = mDequeuePos.load(std::memory_order_acquire);
+        size_t enqueuePos = mEnqueuePos.load(std::memory_order_acquire);
+
+        return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+    }
+
+    inline bool IsEmpty() const
+    {
+        return Size() == 0;
+    }
+
+    static constexpr size_t Capacity()
+    {
+        return TCapacity;
+    }
+
+private:
+    static void Backoff(int attempt)
+    {
+        if (attempt < 64)
+            return;
+
+        std::this_thread::yield();
+    }
+
+    struct Cell
+    {
+        std::atomic<size_t> Sequence;
+        T Data;
+    };
+
+    // producers and consumers each hammer their own position, keep them on separate cache lines
+    alignas(LD_CACHE_LINE_SIZE) std::atomic<size_t> mEnqueuePos;
+    alignas(LD_CACHE_LINE_SIZE) std::atomic<size_t> mDequeuePos;
+    alignas(LD_CACHE_LINE_SIZE) Cell mCells[TCapacity];
+};
+
+} // namespace LD
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include "Core/Header/Include/Error.h"
+#include "Core/Header/Include/Platform.h"
+
+namespace LD {
+
+/// Bounded lock-free single-producer single-consumer ring buffer.
+/// Positions grow monotonically and are masked on access, so all TCapacity slots are usable.
+/// Each side keeps a cached copy of the other side's position and only reloads it
+/// when the queue looks full or empty, which keeps the shared cache lines mostly unshared.
+template <typename T, size_t TCapacity>
+class SPSCQueue
+{
+    LD_STATIC_ASSERT(TCapacity >= 2 && (TCapacity & (TCapacity - 1)) == 0);
+
+public:
+    SPSCQueue()
+    {
+        mWritePos.store(0, std::memory_order_relaxed);
+        mReadPos.store(0, std::memory_order_relaxed);
+    }
+
+    SPSCQueue(const SPSCQueue&) = delete;
+    ~SPSCQueue() = default;
+
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    /// from the producer thread, enqueue a value, returns false if the queue is full
+    bool TryEnqueue(const T& value)
+    {
+        size_t writePos = mWritePos.load(std::memory_order_relaxed);
+
+        if (writePos - mCachedReadPos == TCapacity)
+        {
+            mCachedReadPos = mReadPos.load(std::memory_order_acquire);
+
+            if (writePos - mCachedReadPos == TCapacity)
+                return false;
+        }
+
+        mData[writePos & (TCapacity - 1)] = value;
+        mWritePos.store(writePos + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /// from the consumer thread, dequeue a value, returns false if the queue is empty
+    bool TryDequeue(T& value)
+    {
+        size_t readPos = mReadPos.load(std::memory_order_relaxed);
+
+        if (readPos == mCachedWritePos)
+        {
+            mCachedWritePos = mWritePos.load(std::memory_order_acquire);
+
+            if (readPos == mCachedWritePos)
+                return false;
+        }
+
+        value = std::move(mData[readPos & (TCapacity - 1)]);
+        mReadPos.store(readPos + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /// from the producer thread, enqueue a value, spins and then yields while the queue is full
+    void Enqueue(const T& value)
+    {
+        for (int attempt = 0; !TryEnqueue(value); attempt++)
+            Backoff(attempt);
+    }
+
+    /// from the consumer thread, dequeue a value, spins and then yields while the queue is empty
+    void Dequeue(T& value)
+    {
+        for (int attempt = 0; !TryDequeue(value); attempt++)
+            Backoff(attempt);
+    }
+
+    /// number of enqueued values, only a snapshot if the other side is using the queue
+    size_t Size() const
+    {
+        size_t readPos = mReadPos.load(std::memory_order_acquire);
+        size_t writePos = mWritePos.load(std::memory_order_acquire);
+
+        return writePos > readPos ? writePos - readPos : 0;
+    }
+
+    inline bool IsEmpty() const
+    {
+        return Size() == 0;
+    }
+
+    static constexpr size_t Capacity()
+    {
+        return TCapacity;
+    }
+
+private:
+    static void Backoff(int attempt)
+    {
+        if (attempt < 64)
+            return;
+
+        std::this_thread::yield();
+    }
+
+    // written by the producer
+    alignas(LD_CACHE_LINE_SIZE) std::atomic<size_t> mWritePos;
+    size_t mCachedReadPos = 0;
+
+    // written by the consumer
+    alignas(LD_CACHE_LINE_SIZE) std::atomic<size_t> mReadPos;
+    size_t mCachedWritePos = 0;
+
+    alignas(LD_CACHE_LINE_SIZE) T mData[TCapacity];
+};
+
+} // namespace LD
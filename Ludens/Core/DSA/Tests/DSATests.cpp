@@ -9,6 +9,7 @@
 #include "Core/DSA/Tests/TestString.h"
 #include "Core/DSA/Tests/TestStringHash.h"
 #include "Core/DSA/Tests/TestOptional.h"
+#include "Core/DSA/Tests/TestQueue.h"
 
 int Foo::CtorCounter = 0;
 int Foo::DtorCounter = 0;
\ No newline at end of file
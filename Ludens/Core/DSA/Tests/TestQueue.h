@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <doctest.h>
+#include "Core/DSA/Include/MPMCQueue.h"
+#include "Core/DSA/Include/SPSCQueue.h"
+
+using namespace LD;
+
+TEST_CASE("MPMCQueue Single Thread")
+{
+	MPMCQueue<int, 4> q;
+	int value;
+
+	CHECK(q.IsEmpty());
+	CHECK(!q.TryDequeue(value));
+
+	for (int i = 0; i < 4; i++)
+		CHECK(q.TryEnqueue(i));
+
+	CHECK(q.Size() == 4);
+	CHECK(!q.TryEnqueue(4));
+
+	for (int lap = 0; lap < 3; lap++)
+	{
+		for (int i = 0; i < 4; i++)
+		{
+			CHECK(q.TryDequeue(value));
+			CHECK(value == i);
+			CHECK(q.TryEnqueue(i));
+		}
+	}
+
+	CHECK(q.Size() == 4);
+}
+
+TEST_CASE("SPSCQueue Single Thread")
+{
+	SPSCQueue<int, 4> q;
+	int value;
+
+	CHECK(q.IsEmpty());
+	CHECK(!q.TryDequeue(value));
+
+	for (int i = 0; i < 4; i++)
+		CHECK(q.TryEnqueue(i));
+
+	CHECK(q.Size() == 4);
+	CHECK(!q.TryEnqueue(4));
+
+	for (int lap = 0; lap < 3; lap++)
+	{
+		for (int i = 0; i < 4; i++)
+		{
+			CHECK(q.TryDequeue(value));
+			CHECK(value == i);
+			CHECK(q.TryEnqueue(i));
+		}
+	}
+
+	CHECK(q.Size() == 4);
+}
+
+TEST_CASE("MPMCQueue Stress")
+{
+	const int producerCount = 4;
+	const int consumerCount = 4;
+	const int valuesPerProducer = 100000;
+
+	MPMCQueue<int, 64> q;
+	std::atomic<long long> sum(0);
+	std::atomic<int> count(0);
+	std::vector<std::thread> threads;
+
+	for (int p = 0; p < producerCount; p++)
+	{
+		threads.emplace_back([&q, p]() {
+			for (int i = 0; i < valuesPerProducer; i++)
+				q.Enqueue(p * valuesPerProducer + i);
+		});
+	}
+
+	for (int c = 0; c < consumerCount; c++)
+	{
+		threads.emplace_back([&]() {
+			int value;
+			long long localSum = 0;
+
+			for (int i = 0; i < producerCount * valuesPerProducer / consumerCount; i++)
+			{
+				q.Dequeue(value);
+				localSum += value;
+			}
+
+			sum += localSum;
+			count += producerCount * valuesPerProducer / consumerCount;
+		});
+	}
+
+	for (std::thread& thread : threads)
+		thread.join();
+
+	long long n = (long long)producerCount * valuesPerProducer;
+	CHECK(count == n);
+	CHECK(sum == n * (n - 1) / 2);
+	CHECK(q.IsEmpty());
+}
+
+TEST_CASE("SPSCQueue Stress")
+{
+	const int valueCount = 1000000;
+
+	SPSCQueue<int, 64> q;
+	bool inOrder = true;
+
+	std::thread consumer([&]() {
+		int value;
+
+		for (int i = 0; i < valueCount; i++)
+		{
+			q.Dequeue(value);
+			if (value != i)
+				inOrder = false;
+		}
+	});
+
+	for (int i = 0; i < valueCount; i++)
+		q.Enqueue(i);
+
+	consumer.join();
+
+	CHECK(inOrder);
+	CHECK(q.IsEmpty());
+}
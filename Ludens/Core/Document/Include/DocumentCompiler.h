@@ -1,15 +1,24 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 namespace LD
 {
 
+class XMLReader;
+
 struct DocumentCompiler
 {
     /// @brief compile doxygen XML to Markdown accepted by Reader
     /// @return true on successful compilation, false otherwise
     bool CompileDoxygenXML(const char* xml, std::string& md);
+
+    /// @brief compile doxygen XML from a streaming reader, each compounddef is
+    ///        compiled and released before the next one is read
+    /// @param compoundNames if not null, receives the qualified name of each compiled compounddef
+    /// @return true on successful compilation, false otherwise
+    bool CompileDoxygenXML(XMLReader& reader, std::string& md, std::vector<std::string>* compoundNames = nullptr);
 };
 
 } // namespace LD
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "Core/Document/Include/DocumentCompiler.h"
 #include "Core/Serialize/Include/XML.h"
+#include "Core/Serialize/Include/XMLReader.h"
 
 namespace LD
 {
@@ -32,8 +33,6 @@ private:
 
 void CompoundDef::WriteMD(std::string& md)
 {
-    md.clear();
-
     md += "## " + std::string{ Name.Data(), Name.Size() } + "\n\n";
 
     if (!PublicFuncMembers.IsEmpty())
@@ -266,24 +265,65 @@ static bool OnCompoundDef(XMLElement* compounddef, CompoundDef& def)
 
 bool DocumentCompiler::CompileDoxygenXML(const char* xml, std::string& md)
 {
+    XMLReader reader(xml, strlen(xml));
+
+    return CompileDoxygenXML(reader, md);
+}
+
+bool DocumentCompiler::CompileDoxygenXML(XMLReader& reader, std::string& md, std::vector<std::string>* compoundNames)
+{
+    md.clear();
+
+    if (reader.Next() != XMLEvent::StartElement || !(reader.GetName() == "doxygen"))
+        return false;
+
     XMLParserConfig config;
-    config.SkipHeader = false;
+    config.SkipHeader = true;
 
     XMLParser parser(config);
-    Ref<XMLDocument> doc = parser.ParseString(xml, strlen(xml));
+    bool valid = true;
 
-    XMLNode* node = doc->GetChild();
-    XMLElement* doxygen = node->ToElement();
-    LD_DEBUG_ASSERT(doxygen);
+    while (valid)
+    {
+        XMLEvent event = reader.Next();
 
-    node = doxygen->GetChild();
-    XMLElement* compounddef = node->ToElement();
+        if (event == XMLEvent::Attribute)
+            continue;
 
-    Doxygen::CompoundDef def{};
-    bool valid = Doxygen::OnCompoundDef(node->ToElement(), def);
+        // closing </doxygen>
+        if (event == XMLEvent::EndElement)
+            break;
 
-    if (valid)
-        def.WriteMD(md);
+        if (event != XMLEvent::StartElement)
+            return false;
+
+        if (!(reader.GetName() == "compounddef"))
+        {
+            valid = reader.SkipElement();
+            continue;
+        }
+
+        // only the current compounddef is resident, its DOM is released before the next one is read
+        XMLString element = reader.ReadElement();
+        Ref<XMLDocument> doc = parser.ParseString(element.Data(), element.Size());
+
+        if (!doc || !doc->GetChild())
+            return false;
+
+        Doxygen::CompoundDef def{};
+        valid = Doxygen::OnCompoundDef(doc->GetChild()->ToElement(), def);
+
+        if (valid)
+        {
+            if (!md.empty())
+                md += '\n';
+
+            def.WriteMD(md);
+
+            if (compoundNames)
+                compoundNames->emplace_back(def.Name.Data(), def.Name.Size());
+        }
+    }
 
     return valid;
 }
@@ -11,4 +11,11 @@
 
 #ifdef __linux__
 # define LD_PLATFORM_LINUX
+#endif
+
+
+// Cache Line Size
+// - alignment used to keep data written by different threads on separate cache lines
+#ifndef LD_CACHE_LINE_SIZE
+# define LD_CACHE_LINE_SIZE 64
 #endif
\ No newline at end of file
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Core/Header/Include/Singleton.h"
+#include "Core/IO/Include/FileSystem.h"
+
+namespace LD
+{
+
+/// result of an asynchronous read, passed to the completion callback
+struct AsyncReadResult
+{
+    /// request buffer, or a buffer allocated with MemoryAlloc that the callback takes ownership of
+    u8* Data;
+
+    /// number of bytes read, less than requested if the read reached the end of the file or failed
+    size_t Size;
+
+    /// false if the file could not be opened or read
+    bool Success;
+
+    /// user data of the request
+    void* User;
+};
+
+/// @brief completion callback of an asynchronous read, invoked on an I/O thread.
+///        Keep it short, CPU heavy follow up work such as decoding should be submitted to the JobSystem.
+typedef void (*AsyncReadCallback)(const AsyncReadResult& result);
+
+struct AsyncReadRequest
+{
+    Path FilePath;
+
+    /// byte offset of the read in the file
+    size_t Offset = 0;
+
+    /// number of bytes to read, 0 reads from Offset to the end of the file
+    size_t Size = 0;
+
+    /// destination of at least Size bytes, if null a buffer is allocated
+    u8* Buffer = nullptr;
+
+    AsyncReadCallback Callback = nullptr;
+    void* User = nullptr;
+};
+
+enum class AsyncIOBackend
+{
+    /// a pool of I/O threads blocking in pread, available everywhere
+    Threads = 0,
+
+    /// a single io_uring shared by all requests, completions are reaped by one I/O thread
+    IOUring,
+};
+
+/// @brief Asynchronous file reads that never block the submitting thread on disk.
+///        On Linux the service is backed by io_uring, falling back to a thread pool if
+///        the kernel or sandbox does not allow it.
+class AsyncIO : public Singleton<AsyncIO>
+{
+    friend class Singleton<AsyncIO>;
+
+public:
+    /// @brief create a standalone service instead of using the singleton,
+    ///        io_uring falls back to the thread pool if it is not available
+    explicit AsyncIO(AsyncIOBackend backend);
+    AsyncIO(const AsyncIO&) = delete;
+    ~AsyncIO();
+
+    AsyncIO& operator=(const AsyncIO&) = delete;
+
+    AsyncIOBackend GetBackend();
+
+    /// @brief submit a single read, thread safe
+    /// @note with the io_uring backend the file is opened on the submitting thread,
+    ///       only the data transfer is asynchronous
+    void Read(const AsyncReadRequest& request);
+
+    /// @brief submit a batch of reads with a single kernel transition where the backend allows it, thread safe
+    void Read(const AsyncReadRequest* requests, size_t count);
+
+    /// @brief block until every submitted read has completed and its callback has returned
+    void WaitIdle();
+
+private:
+    AsyncIO();
+
+    struct AsyncIOImpl* mImpl;
+};
+
+} // namespace LD
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
 #include <string>
+#include <vector>
 #include "Core/Header/Include/Types.h"
 #include "Core/OS/Include/Memory.h"
 
@@ -43,8 +45,70 @@ private:
 enum class FileMode
 {
     None = 0,
+
+    /// the whole file is available through Data and Size,
+    /// large files are memory mapped instead of copied
     Read,
-    Write
+
+    /// only the handle is opened, read with caller supplied buffers through Read and ReadAt
+    ReadStream,
+
+    /// truncate or create the file, writes are buffered
+    Write,
+
+    /// append to the file or create it, writes are buffered
+    Append,
+};
+
+/// access pattern of a mapped file, used as a read-ahead hint
+enum class FileAccess
+{
+    Normal = 0,
+    Sequential,
+    Random,
+};
+
+/// @brief Read only memory mapping of a whole file. Pages are loaded on first access,
+///        the mapping shares the page cache so no copy of the file is made.
+/// @warning truncating the file while it is mapped is undefined behavior
+class MappedFile
+{
+public:
+    MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    ~MappedFile();
+
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// @brief map a file, an empty file maps successfully with a null Data
+    bool Map(const Path& path, FileAccess access = FileAccess::Normal);
+
+    void Unmap();
+
+    /// @brief start reading a range in the background before it is accessed
+    void WillNeed(size_t offset, size_t size);
+
+    /// @brief the range is not accessed again soon, its pages may be reclaimed
+    void DontNeed(size_t offset, size_t size);
+
+    inline bool IsMapped() const
+    {
+        return mData != nullptr;
+    }
+
+    inline const u8* Data() const
+    {
+        return mData;
+    }
+
+    inline size_t Size() const
+    {
+        return mSize;
+    }
+
+private:
+    u8* mData;
+    size_t mSize;
 };
 
 class File
@@ -58,16 +122,42 @@ public:
 
     static bool Exists(const Path& path);
 
+    /// @brief open a file, closing the file that is currently open
+    /// @return false if the file could not be opened
     bool Open(const Path& path, FileMode mode = FileMode::Read);
+
+    /// @brief flush pending writes and release the file
     void Close();
-    void Write(const u8* data, size_t size);
+
+    /// @brief append bytes to the file, in Write and Append modes
+    /// @return false if pending bytes could not be written to the file
+    bool Write(const u8* data, size_t size);
+
+    /// @brief write buffered bytes to the file
+    /// @return false if the bytes could not be written, they are discarded either way
+    bool Flush();
+
+    /// @brief read from the current position and advance it, in Read and ReadStream modes
+    /// @return number of bytes read, less than size at the end of the file
+    size_t Read(u8* dst, size_t size);
+
+    /// @brief read from an offset without moving the current position, in Read and ReadStream modes
+    /// @param error optional, set to true if the read failed before the end of the file
+    /// @return number of bytes read, less than size at the end of the file or on error
+    size_t ReadAt(size_t offset, u8* dst, size_t size, bool* error = nullptr);
+
+    /// @brief set the position of the next Read
+    void Seek(size_t offset);
+
     void ReadString(std::string& string);
 
+    /// whole file content in Read mode, null otherwise
     inline const u8* Data() const
     {
         return mData;
     }
 
+    /// file size in Read and ReadStream modes
     inline size_t Size() const
     {
         return mSize;
@@ -77,7 +167,11 @@ private:
     size_t mSize = 0;
     u8* mData = nullptr;
     FileMode mMode = FileMode::None;
-    Path mWritePath;
+    intptr_t mHandle = -1;      // native handle in ReadStream, Write and Append modes
+    size_t mCursor = 0;         // position of the next Read
+    u8* mBuffer = nullptr;      // pending writes
+    size_t mBufferSize = 0;     // number of pending bytes in mBuffer
+    MappedFile mMapping;        // backs mData for large files in Read mode
 };
 
 class FileSystem
@@ -87,6 +181,11 @@ public:
 
     Path GetWorkingDirectory();
     bool CreateDirectories(const Path& path);
+
+    /// @brief get the regular files under a directory
+    /// @param recursive if true, files in subdirectories are included as well
+    /// @return false if the path is not a directory
+    bool GetFiles(const Path& directory, std::vector<Path>& files, bool recursive = false);
 };
 
 } // namespace LD
\ No newline at end of file
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "Core/Header/Include/Types.h"
+#include "Core/IO/Include/FileSystem.h"
+
+// Pack File Layout, all integers are little endian
+// - PackHeader
+// - PackTOCEntry[EntryCount], sorted by name hash, then by name
+// - PackBlob[BlobCount]
+// - names, referenced by the TOC, not null terminated
+// - blobs, each aligned to PACK_BLOB_ALIGNMENT
+// Blobs are content addressed, entries with identical content share a single blob.
+
+#define PACK_MAGIC 0x4B50444C // "LDPK"
+#define PACK_VERSION 1
+#define PACK_BLOB_ALIGNMENT 64
+
+namespace LD
+{
+
+enum class PackCompression : u32
+{
+    None = 0,
+
+    /// LZ4 block format
+    LZ4 = 1,
+};
+
+struct PackHeader
+{
+    u32 Magic;
+    u32 Version;
+    u32 EntryCount;
+    u32 BlobCount;
+    u64 NamesSize;
+    u64 FileSize;
+};
+
+struct PackTOCEntry
+{
+    u64 NameHash;
+    u32 NameOffset; // from the start of the names
+    u32 NameSize;
+    u32 Blob;       // index into the blob table
+    u32 Reserved;
+};
+
+struct PackBlob
+{
+    u64 Offset;           // from the start of the file
+    u64 Size;             // stored size
+    u64 UncompressedSize;
+    u64 ContentHash;      // FNV-1a of the uncompressed content
+    PackCompression Compression;
+    u32 Reserved;
+};
+
+/// a pack entry, a view into the mapped pack file
+struct PackEntry
+{
+    const u8* Data;              // stored bytes, compressed unless Compression is None
+    size_t Size;                 // stored size
+    size_t UncompressedSize;
+    PackCompression Compression;
+};
+
+/// @brief Collects assets in memory and writes them as one pack file.
+class PackWriter
+{
+public:
+    PackWriter() = default;
+    PackWriter(const PackWriter&) = delete;
+    ~PackWriter() = default;
+
+    PackWriter& operator=(const PackWriter&) = delete;
+
+    /// @brief add an entry, data is copied
+    /// @param compression requested compression, blobs that do not shrink are stored uncompressed
+    /// @return false if an entry with the same name was already added
+    bool Add(std::string_view name, const u8* data, size_t size, PackCompression compression = PackCompression::None);
+
+    /// @brief write all entries to a pack file
+    /// @return false if the file could not be written, a partially written file is removed
+    bool Write(const Path& path);
+
+    inline size_t GetEntryCount() const
+    {
+        return mEntries.size();
+    }
+
+    /// number of distinct blobs after deduplication
+    inline size_t GetBlobCount() const
+    {
+        return mBlobs.size();
+    }
+
+private:
+    struct Entry
+    {
+        std::string Name;
+        u64 NameHash;
+        u32 Blob;
+    };
+
+    struct Blob
+    {
+        std::vector<u8> Data; // stored bytes
+        u64 UncompressedSize;
+        u64 ContentHash;
+        PackCompression Compression;
+    };
+
+    /// @brief find a blob with the same content
+    /// @return blob index, or -1
+    int FindBlob(const u8* data, size_t size, u64 contentHash);
+
+    std::vector<Entry> mEntries;
+    std::vector<Blob> mBlobs;
+    std::unordered_set<std::string> mNames;
+    std::unordered_multimap<u64, u32> mBlobsByHash;
+};
+
+/// @brief Maps a pack file once, lookups and entry views need no further syscalls.
+class PackReader
+{
+public:
+    PackReader() = default;
+    PackReader(const PackReader&) = delete;
+    ~PackReader() = default;
+
+    PackReader& operator=(const PackReader&) = delete;
+
+    /// @brief map a pack file and validate its tables
+    /// @return false if the file can not be mapped or is not a valid pack
+    bool Open(const Path& path);
+
+    void Close();
+
+    /// @brief find an entry by name with a binary search over the hashed table of contents
+    bool Find(std::string_view name, PackEntry& entry) const;
+
+    /// @brief copy or decompress an entry
+    /// @param dst destination of at least entry.UncompressedSize bytes
+    /// @return false if the stored bytes are corrupt
+    bool Read(const PackEntry& entry, u8* dst) const;
+
+    /// number of named entries
+    inline size_t GetEntryCount() const
+    {
+        return mHeader ? mHeader->EntryCount : 0;
+    }
+
+    /// name of an entry in table of contents order
+    std::string_view GetEntryName(size_t index) const;
+
+    /// entry in table of contents order
+    PackEntry GetEntry(size_t index) const;
+
+private:
+    MappedFile mFile;
+    const PackHeader* mHeader = nullptr;
+    const PackTOCEntry* mTOC = nullptr;
+    const PackBlob* mBlobs = nullptr;
+    const char* mNames = nullptr;
+};
+
+} // namespace LD
@@ -0,0 +1,661 @@
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <unordered_set>
+#include <vector>
+#include "Core/IO/Include/AsyncIO.h"
+#include "Core/OS/Include/Memory.h"
+#include "Core/OS/Include/Thread.h"
+#include "Core/OS/Include/Mutex.h"
+#include "Core/OS/Include/ConditionVariable.h"
+#include "Core/Header/Include/Platform.h"
+#include "Core/Header/Include/Error.h"
+
+#ifdef LD_PLATFORM_LINUX
+# include <cerrno>
+# include <fcntl.h>
+# include <linux/io_uring.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+// number of blocking I/O threads of the thread pool backend
+#define ASYNC_IO_THREAD_COUNT 4
+
+// submission queue size of the io_uring backend, also the limit of reads in flight
+#define ASYNC_IO_RING_ENTRIES 256
+
+// largest single read operation, larger requests are split
+#define ASYNC_IO_MAX_READ (1u << 30)
+
+namespace LD
+{
+
+/// a read in flight, owned by the service until its callback returns
+struct AsyncRead
+{
+    AsyncReadRequest Request;
+    u8* Buffer;     // Request.Buffer or an allocated buffer
+    size_t Size;    // bytes to read
+    size_t Done;    // bytes read so far
+    int Fd;         // io_uring backend only, -1 if the file could not be opened
+    bool OwnsBuffer;
+    bool Failed;    // a read returned an error
+};
+
+#ifdef LD_PLATFORM_LINUX
+struct IOUring
+{
+    int Fd = -1;
+    u32 Entries;
+    u32* SQHead;
+    u32* SQTail;
+    u32* SQMask;
+    u32* SQArray;
+    io_uring_sqe* SQEs;
+    u32* CQHead;
+    u32* CQTail;
+    u32* CQMask;
+    io_uring_cqe* CQEs;
+    void* SQRing;
+    void* CQRing;
+    size_t SQRingSize;
+    size_t CQRingSize;
+    size_t SQEsSize;
+    u32 Unsubmitted; // SQEs written since the last io_uring_enter
+};
+#endif
+
+struct AsyncIOImpl
+{
+    AsyncIOBackend Backend;
+
+    /// reads submitted whose callback has not returned yet
+    std::atomic<size_t> Pending;
+    Mutex IdleMutex;
+    ConditionVariable Idle;
+
+    // thread pool backend
+    Thread Workers[ASYNC_IO_THREAD_COUNT];
+    Mutex QueueMutex;
+    ConditionVariable QueuePending;
+    std::deque<AsyncRead*> Queue;
+    bool IsAlive;
+
+#ifdef LD_PLATFORM_LINUX
+    // io_uring backend
+    IOUring Ring;
+    Thread Reaper;
+    Mutex RingMutex;                       // guards the submission queue, Backlog, InRing and IsRingBroken
+    std::deque<AsyncRead*> Backlog;        // reads waiting for a free slot in the ring
+    std::unordered_set<AsyncRead*> InRing; // reads submitted to the ring and not completed
+    u32 InFlight;
+    bool IsRingBroken; // the reaper stopped on a ring error, later reads use the thread pool
+    std::vector<AsyncRead*> Completed;
+    std::vector<AsyncRead*> Resubmit;
+#endif
+};
+
+static AsyncRead* CreateRead(const AsyncReadRequest& request)
+{
+    AsyncRead* read = new AsyncRead();
+    read->Request = request;
+    read->Buffer = nullptr;
+    read->Size = 0;
+    read->Done = 0;
+    read->Fd = -1;
+    read->OwnsBuffer = false;
+    read->Failed = false;
+
+    return read;
+}
+
+/// @brief decide the read size and destination once the file size is known
+static void PrepareRead(AsyncRead* read, size_t fileSize)
+{
+    const AsyncReadRequest& request = read->Request;
+
+    if (request.Size > 0)
+        read->Size = request.Size;
+    else
+        read->Size = request.Offset < fileSize ? fileSize - request.Offset : 0;
+
+    read->Buffer = request.Buffer;
+
+    if (!read->Buffer && read->Size > 0)
+    {
+        read->Buffer = (u8*)MemoryAlloc(read->Size);
+        read->OwnsBuffer = true;
+    }
+}
+
+static void CompleteRead(AsyncIOImpl* impl, AsyncRead* read, bool success)
+{
+    AsyncReadResult result;
+    result.Data = read->Buffer;
+    result.Size = read->Done;
+    result.Success = success;
+    result.User = read->Request.User;
+
+    if (read->OwnsBuffer && (!success || !read->Request.Callback))
+    {
+        MemoryFree(read->Buffer);
+        result.Data = nullptr;
+    }
+
+#ifdef LD_PLATFORM_LINUX
+    if (read->Fd >= 0)
+        close(read->Fd);
+#endif
+
+    if (read->Request.Callback)
+        read->Request.Callback(result);
+
+    delete read;
+
+    if (impl->Pending.fetch_sub(1) == 1)
+    {
+        impl->IdleMutex.Lock();
+        impl->Idle.SignalAll();
+        impl->IdleMutex.Unlock();
+    }
+}
+
+//
+// thread pool backend, each worker blocks in pread for one read at a time
+//
+
+static int WorkerEntry(int, void* userdata)
+{
+    AsyncIOImpl* impl = (AsyncIOImpl*)userdata;
+
+    while (true)
+    {
+        impl->QueueMutex.Lock();
+
+        while (impl->IsAlive && impl->Queue.empty())
+            impl->QueuePending.Wait(impl->QueueMutex);
+
+        if (impl->Queue.empty())
+        {
+            impl->QueueMutex.Unlock();
+            break;
+        }
+
+        AsyncRead* read = impl->Queue.front();
+        impl->Queue.pop_front();
+        impl->QueueMutex.Unlock();
+
+        File file;
+        bool success = file.Open(read->Request.FilePath, FileMode::ReadStream);
+
+        if (success)
+        {
+            PrepareRead(read, file.Size());
+            read->Done = file.ReadAt(read->Request.Offset, read->Buffer, read->Size, &read->Failed);
+        }
+
+        CompleteRead(impl, read, success && !read->Failed);
+    }
+
+    return 0;
+}
+
+static void StartWorkers(AsyncIOImpl* impl)
+{
+    impl->IsAlive = true;
+
+    for (int i = 0; i < ASYNC_IO_THREAD_COUNT; i++)
+    {
+        impl->Workers[i].Run(&WorkerEntry, impl);
+
+        char name[16];
+        snprintf(name, sizeof(name), "LDAsyncIO%d", i);
+        impl->Workers[i].SetName(name);
+    }
+}
+
+static void StopWorkers(AsyncIOImpl* impl)
+{
+    impl->QueueMutex.Lock();
+    impl->IsAlive = false;
+    impl->QueuePending.SignalAll();
+    impl->QueueMutex.Unlock();
+
+    for (int i = 0; i < ASYNC_IO_THREAD_COUNT; i++)
+        impl->Workers[i].Stop();
+}
+
+static void SubmitWorkers(AsyncIOImpl* impl, AsyncRead** reads, size_t count)
+{
+    impl->QueueMutex.Lock();
+
+    for (size_t i = 0; i < count; i++)
+        impl->Queue.push_back(reads[i]);
+
+    if (count == 1)
+        impl->QueuePending.SignalOne();
+    else
+        impl->QueuePending.SignalAll();
+
+    impl->QueueMutex.Unlock();
+}
+
+#ifdef LD_PLATFORM_LINUX
+
+//
+// io_uring backend, reads are queued in a single ring and one reaper thread
+// blocks for completions, no thread waits on an individual read
+//
+
+static int UringEnter(int fd, u32 submit, u32 wait, u32 flags)
+{
+    return (int)syscall(__NR_io_uring_enter, fd, submit, wait, flags, nullptr, 0);
+}
+
+static bool UringSetup(IOUring& ring, u32 entries)
+{
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+
+    int fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (fd < 0)
+        return false;
+
+    ring.Fd = fd;
+    ring.Entries = params.sq_entries;
+    ring.Unsubmitted = 0;
+    ring.SQRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+    ring.CQRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    ring.SQEsSize = params.sq_entries * sizeof(io_uring_sqe);
+
+    // since Linux 5.4 both rings share a single mapping
+    bool singleMap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (singleMap)
+        ring.SQRingSize = ring.CQRingSize = ring.SQRingSize > ring.CQRingSize ? ring.SQRingSize : ring.CQRingSize;
+
+    int prot = PROT_READ | PROT_WRITE;
+    int flags = MAP_SHARED | MAP_POPULATE;
+    ring.SQRing = mmap(nullptr, ring.SQRingSize, prot, flags, fd, IORING_OFF_SQ_RING);
+    ring.CQRing = singleMap ? ring.SQRing : mmap(nullptr, ring.CQRingSize, prot, flags, fd, IORING_OFF_CQ_RING);
+    void* sqes = mmap(nullptr, ring.SQEsSize, prot, flags, fd, IORING_OFF_SQES);
+
+    if (ring.SQRing == MAP_FAILED || ring.CQRing == MAP_FAILED || sqes == MAP_FAILED)
+    {
+        if (ring.SQRing != MAP_FAILED)
+            munmap(ring.SQRing, ring.SQRingSize);
+        if (!singleMap && ring.CQRing != MAP_FAILED)
+            munmap(ring.CQRing, ring.CQRingSize);
+        if (sqes != MAP_FAILED)
+            munmap(sqes, ring.SQEsSize);
+
+        close(fd);
+        ring.Fd = -1;
+        return false;
+    }
+
+    u8* sq = (u8*)ring.SQRing;
+    u8* cq = (u8*)ring.CQRing;
+    ring.SQHead = (u32*)(sq + params.sq_off.head);
+    ring.SQTail = (u32*)(sq + params.sq_off.tail);
+    ring.SQMask = (u32*)(sq + params.sq_off.ring_mask);
+    ring.SQArray = (u32*)(sq + params.sq_off.array);
+    ring.SQEs = (io_uring_sqe*)sqes;
+    ring.CQHead = (u32*)(cq + params.cq_off.head);
+    ring.CQTail = (u32*)(cq + params.cq_off.tail);
+    ring.CQMask = (u32*)(cq + params.cq_off.ring_mask);
+    ring.CQEs = (io_uring_cqe*)(cq + params.cq_off.cqes);
+
+    return true;
+}
+
+static void UringDestroy(IOUring& ring)
+{
+    munmap(ring.SQEs, ring.SQEsSize);
+    if (ring.CQRing != ring.SQRing)
+        munmap(ring.CQRing, ring.CQRingSize);
+    munmap(ring.SQRing, ring.SQRingSize);
+    close(ring.Fd);
+    ring.Fd = -1;
+}
+
+/// @brief write a submission queue entry, the read is identified by user_data
+/// @note requires RingMutex, a null read is the stop request of the reaper
+static void UringPush(IOUring& ring, AsyncRead* read)
+{
+    u32 tail = *ring.SQTail;
+    u32 index = tail & *ring.SQMask;
+    io_uring_sqe* sqe = ring.SQEs + index;
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->user_data = (u64)(uintptr_t)read;
+
+    if (!read || read->Fd < 0)
+        sqe->opcode = IORING_OP_NOP;
+    else
+    {
+        size_t remain = read->Size - read->Done;
+        sqe->opcode = IORING_OP_READ;
+        sqe->fd = read->Fd;
+        sqe->addr = (u64)(uintptr_t)(read->Buffer + read->Done);
+        sqe->len = (u32)(remain > ASYNC_IO_MAX_READ ? ASYNC_IO_MAX_READ : remain);
+        sqe->off = (u64)(read->Request.Offset + read->Done);
+    }
+
+    ring.SQArray[index] = index;
+    __atomic_store_n(ring.SQTail, tail + 1, __ATOMIC_RELEASE);
+    ring.Unsubmitted++;
+}
+
+/// @note requires RingMutex
+/// @return false on a ring error other than an interruption or a full completion queue
+static bool UringSubmit(IOUring& ring)
+{
+    while (ring.Unsubmitted > 0)
+    {
+        int result = UringEnter(ring.Fd, ring.Unsubmitted, 0, 0);
+
+        if (result < 0)
+        {
+            if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+                continue;
+
+            return false;
+        }
+
+        ring.Unsubmitted -= (u32)result;
+    }
+
+    return true;
+}
+
+/// @note requires RingMutex, reads beyond the ring capacity wait in the backlog
+static void UringQueue(AsyncIOImpl* impl, AsyncRead* read)
+{
+    if (impl->InFlight < impl->Ring.Entries)
+    {
+        impl->InFlight++;
+        impl->InRing.insert(read);
+        UringPush(impl->Ring, read);
+    }
+    else
+        impl->Backlog.push_back(read);
+}
+
+/// @brief undo UringOpen, so the read can be handed to the thread pool
+static void UringClose(AsyncRead* read)
+{
+    if (read->Fd >= 0)
+        close(read->Fd);
+
+    if (read->OwnsBuffer)
+        MemoryFree(read->Buffer);
+
+    read->Fd = -1;
+    read->Buffer = nullptr;
+    read->Size = 0;
+    read->Done = 0;
+    read->OwnsBuffer = false;
+    read->Failed = false;
+}
+
+/// @brief stop using a ring that failed, reads in the ring or in the backlog complete as failed
+///        and later reads fall back to the thread pool
+static void UringFail(AsyncIOImpl* impl)
+{
+    impl->RingMutex.Lock();
+
+    impl->IsRingBroken = true;
+    StartWorkers(impl);
+
+    std::vector<AsyncRead*> failed(impl->InRing.begin(), impl->InRing.end());
+    failed.insert(failed.end(), impl->Backlog.begin(), impl->Backlog.end());
+    impl->InRing.clear();
+    impl->Backlog.clear();
+    impl->InFlight = 0;
+
+    impl->RingMutex.Unlock();
+
+    // the last completion signals Idle
+    for (AsyncRead* read : failed)
+        CompleteRead(impl, read, false);
+}
+
+static int ReaperEntry(int, void* userdata)
+{
+    AsyncIOImpl* impl = (AsyncIOImpl*)userdata;
+    IOUring& ring = impl->Ring;
+    bool isAlive = true;
+
+    while (isAlive)
+    {
+        if (UringEnter(ring.Fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR)
+        {
+            UringFail(impl);
+            break;
+        }
+
+        // the lock orders the submitter's writes to the reads before the reaper's accesses,
+        // the handoff through the kernel is invisible to thread sanitizers
+        impl->RingMutex.Lock();
+
+        u32 head = *ring.CQHead;
+        u32 tail = __atomic_load_n(ring.CQTail, __ATOMIC_ACQUIRE);
+
+        for (; head != tail; head++)
+        {
+            const io_uring_cqe& cqe = ring.CQEs[head & *ring.CQMask];
+            AsyncRead* read = (AsyncRead*)(uintptr_t)cqe.user_data;
+
+            if (!read)
+            {
+                isAlive = false;
+                continue;
+            }
+
+            if (read->Fd < 0)
+                impl->Completed.push_back(read);
+            else if (cqe.res == -EINTR || cqe.res == -EAGAIN)
+                impl->Resubmit.push_back(read);
+            else if (cqe.res <= 0)
+            {
+                read->Failed = cqe.res < 0;
+                impl->Completed.push_back(read);
+            }
+            else
+            {
+                // short reads are continued until the end of the file
+                read->Done += (size_t)cqe.res;
+
+                if (read->Done < read->Size)
+                    impl->Resubmit.push_back(read);
+                else
+                    impl->Completed.push_back(read);
+            }
+        }
+
+        __atomic_store_n(ring.CQHead, head, __ATOMIC_RELEASE);
+
+        impl->InFlight -= (u32)impl->Completed.size();
+
+        for (AsyncRead* read : impl->Completed)
+            impl->InRing.erase(read);
+
+        for (AsyncRead* read : impl->Resubmit)
+            UringPush(ring, read);
+
+        while (!impl->Backlog.empty() && impl->InFlight < ring.Entries)
+        {
+            impl->InFlight++;
+            impl->InRing.insert(impl->Backlog.front());
+            UringPush(ring, impl->Backlog.front());
+            impl->Backlog.pop_front();
+        }
+
+        bool isSubmitted = UringSubmit(ring);
+        impl->RingMutex.Unlock();
+
+        if (!isSubmitted)
+        {
+            // reads completed in this iteration are no longer in the ring and finish normally
+            for (AsyncRead* read : impl->Completed)
+                CompleteRead(impl, read, read->Fd >= 0 && !read->Failed);
+
+            impl->Completed.clear();
+            impl->Resubmit.clear();
+            UringFail(impl);
+            break;
+        }
+
+        for (AsyncRead* read : impl->Completed)
+            CompleteRead(impl, read, read->Fd >= 0 && !read->Failed);
+
+        impl->Completed.clear();
+        impl->Resubmit.clear();
+    }
+
+    return 0;
+}
+
+/// @brief open the file on the submitting thread, the data is read by the kernel
+static void UringOpen(AsyncRead* read)
+{
+    std::string path = read->Request.FilePath.ToString();
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat st;
+
+    if (fd >= 0 && fstat(fd, &st) != 0)
+    {
+        close(fd);
+        fd = -1;
+    }
+
+    // files that failed to open complete through a NOP on the reaper thread,
+    // so every callback runs on an I/O thread
+    read->Fd = fd;
+
+    if (fd >= 0)
+        PrepareRead(read, (size_t)st.st_size);
+}
+
+#endif // LD_PLATFORM_LINUX
+
+AsyncIO::AsyncIO() : AsyncIO(AsyncIOBackend::IOUring)
+{
+}
+
+AsyncIO::AsyncIO(AsyncIOBackend backend)
+{
+    mImpl = new AsyncIOImpl();
+    mImpl->Pending = 0;
+    mImpl->IsAlive = false;
+    mImpl->Backend = AsyncIOBackend::Threads;
+
+#ifdef LD_PLATFORM_LINUX
+    mImpl->InFlight = 0;
+    mImpl->IsRingBroken = false;
+
+    // io_uring may be missing from older kernels or blocked by seccomp in containers
+    if (backend == AsyncIOBackend::IOUring && UringSetup(mImpl->Ring, ASYNC_IO_RING_ENTRIES))
+    {
+        mImpl->Backend = AsyncIOBackend::IOUring;
+        mImpl->Reaper.Run(&ReaperEntry, mImpl);
+        mImpl->Reaper.SetName("LDAsyncIOUring");
+        return;
+    }
+#endif
+
+    StartWorkers(mImpl);
+}
+
+AsyncIO::~AsyncIO()
+{
+    WaitIdle();
+
+#ifdef LD_PLATFORM_LINUX
+    if (mImpl->Backend == AsyncIOBackend::IOUring)
+    {
+        // a reaper stopped by a ring error has already returned
+        mImpl->RingMutex.Lock();
+        if (!mImpl->IsRingBroken)
+        {
+            UringPush(mImpl->Ring, nullptr);
+            UringSubmit(mImpl->Ring);
+        }
+        mImpl->RingMutex.Unlock();
+
+        mImpl->Reaper.Stop();
+        UringDestroy(mImpl->Ring);
+    }
+#endif
+
+    if (mImpl->IsAlive)
+        StopWorkers(mImpl);
+
+    delete mImpl;
+}
+
+AsyncIOBackend AsyncIO::GetBackend()
+{
+    return mImpl->Backend;
+}
+
+void AsyncIO::Read(const AsyncReadRequest& request)
+{
+    Read(&request, 1);
+}
+
+void AsyncIO::Read(const AsyncReadRequest* requests, size_t count)
+{
+    if (count == 0)
+        return;
+
+    std::vector<AsyncRead*> reads(count);
+
+    for (size_t i = 0; i < count; i++)
+        reads[i] = CreateRead(requests[i]);
+
+    mImpl->Pending.fetch_add(count);
+
+#ifdef LD_PLATFORM_LINUX
+    if (mImpl->Backend == AsyncIOBackend::IOUring)
+    {
+        for (AsyncRead* read : reads)
+            UringOpen(read);
+
+        // the whole batch is submitted with a single io_uring_enter
+        mImpl->RingMutex.Lock();
+
+        if (!mImpl->IsRingBroken)
+        {
+            for (AsyncRead* read : reads)
+                UringQueue(mImpl, read);
+
+            UringSubmit(mImpl->Ring);
+            mImpl->RingMutex.Unlock();
+            return;
+        }
+
+        mImpl->RingMutex.Unlock();
+
+        for (AsyncRead* read : reads)
+            UringClose(read);
+    }
+#endif
+
+    SubmitWorkers(mImpl, reads.data(), count);
+}
+
+void AsyncIO::WaitIdle()
+{
+    mImpl->IdleMutex.Lock();
+
+    while (mImpl->Pending.load() > 0)
+        mImpl->Idle.Wait(mImpl->IdleMutex);
+
+    mImpl->IdleMutex.Unlock();
+}
+
+} // namespace LD
@@ -1,11 +1,204 @@
-#include <iostream>
-#include <fstream>
+#include <cstring>
 #include "Core/IO/Include/FileSystem.h"
 #include "Core/OS/Include/Memory.h"
+#include "Core/Header/Include/Platform.h"
 #include "Core/Header/Include/Error.h"
 
+#ifdef LD_PLATFORM_WIN32
+# include <windows.h>
+#elif defined(LD_PLATFORM_LINUX)
+# include <cerrno>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#else
+# error "not implemented yet"
+#endif
+
+// files at least this large are memory mapped in FileMode::Read instead of copied
+#define FILE_MAP_THRESHOLD (256 * 1024)
+
+// size of the write buffer, larger writes bypass it
+#define FILE_WRITE_BUFFER_SIZE (64 * 1024)
+
 namespace LD {
 
+#ifdef LD_PLATFORM_WIN32
+	static intptr_t NativeOpen(const Path& path, FileMode mode)
+	{
+		std::string str = path.ToString();
+		DWORD access = GENERIC_READ;
+		DWORD disposition = OPEN_EXISTING;
+		DWORD flags = FILE_ATTRIBUTE_NORMAL;
+
+		if (mode == FileMode::Write)
+		{
+			access = GENERIC_WRITE;
+			disposition = CREATE_ALWAYS;
+		}
+		else if (mode == FileMode::Append)
+		{
+			access = FILE_APPEND_DATA;
+			disposition = OPEN_ALWAYS;
+		}
+		else if (mode == FileMode::ReadStream)
+			flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+
+		HANDLE handle = CreateFileA(str.c_str(), access, FILE_SHARE_READ, nullptr, disposition, flags, nullptr);
+
+		return handle == INVALID_HANDLE_VALUE ? -1 : (intptr_t)handle;
+	}
+
+	static void NativeClose(intptr_t handle)
+	{
+		CloseHandle((HANDLE)handle);
+	}
+
+	static size_t NativeGetSize(intptr_t handle)
+	{
+		LARGE_INTEGER size;
+
+		return GetFileSizeEx((HANDLE)handle, &size) ? (size_t)size.QuadPart : 0;
+	}
+
+	static size_t NativeReadAt(intptr_t handle, size_t offset, u8* dst, size_t size, bool* error)
+	{
+		size_t total = 0;
+
+		while (total < size)
+		{
+			size_t remain = size - total;
+			DWORD request = remain > 0x40000000 ? 0x40000000 : (DWORD)remain;
+			DWORD bytes = 0;
+			OVERLAPPED overlapped{};
+			overlapped.Offset = (DWORD)((offset + total) & 0xFFFFFFFF);
+			overlapped.OffsetHigh = (DWORD)((u64)(offset + total) >> 32);
+
+			if (!ReadFile((HANDLE)handle, dst + total, request, &bytes, &overlapped))
+			{
+				if (error && GetLastError() != ERROR_HANDLE_EOF)
+					*error = true;
+
+				break;
+			}
+
+			if (bytes == 0)
+				break;
+
+			total += bytes;
+		}
+
+		return total;
+	}
+
+	static bool NativeWrite(intptr_t handle, const u8* data, size_t size)
+	{
+		while (size > 0)
+		{
+			DWORD request = size > 0x40000000 ? 0x40000000 : (DWORD)size;
+			DWORD bytes = 0;
+
+			if (!WriteFile((HANDLE)handle, data, request, &bytes, nullptr))
+				return false;
+
+			data += bytes;
+			size -= bytes;
+		}
+
+		return true;
+	}
+#elif defined(LD_PLATFORM_LINUX)
+	static intptr_t NativeOpen(const Path& path, FileMode mode)
+	{
+		std::string str = path.ToString();
+		int flags = O_RDONLY;
+
+		if (mode == FileMode::Write)
+			flags = O_WRONLY | O_CREAT | O_TRUNC;
+		else if (mode == FileMode::Append)
+			flags = O_WRONLY | O_CREAT | O_APPEND;
+
+		int fd;
+
+		do
+			fd = open(str.c_str(), flags | O_CLOEXEC, 0644);
+		while (fd < 0 && errno == EINTR);
+
+		if (fd >= 0 && mode == FileMode::ReadStream)
+			posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+		return fd;
+	}
+
+	static void NativeClose(intptr_t handle)
+	{
+		close((int)handle);
+	}
+
+	static size_t NativeGetSize(intptr_t handle)
+	{
+		struct stat st;
+
+		return fstat((int)handle, &st) == 0 ? (size_t)st.st_size : 0;
+	}
+
+	static size_t NativeReadAt(intptr_t handle, size_t offset, u8* dst, size_t size, bool* error)
+	{
+		size_t total = 0;
+
+		while (total < size)
+		{
+			ssize_t bytes = pread((int)handle, dst + total, size - total, (off_t)(offset + total));
+
+			if (bytes < 0 && errno == EINTR)
+				continue;
+
+			if (bytes < 0 && error)
+				*error = true;
+
+			if (bytes <= 0)
+				break;
+
+			total += (size_t)bytes;
+		}
+
+		return total;
+	}
+
+	static bool NativeWrite(intptr_t handle, const u8* data, size_t size)
+	{
+		while (size > 0)
+		{
+			ssize_t bytes = write((int)handle, data, size);
+
+			if (bytes < 0 && errno == EINTR)
+				continue;
+
+			if (bytes <= 0)
+				return false;
+
+			data += bytes;
+			size -= (size_t)bytes;
+		}
+
+		return true;
+	}
+
+	static void NativeAdvise(u8* data, size_t dataSize, size_t offset, size_t size, int advice)
+	{
+		if (!data || offset >= dataSize)
+			return;
+
+		// madvise takes page aligned addresses
+		size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+		size_t end = offset + size > dataSize ? dataSize : offset + size;
+		size_t begin = offset & ~(pageSize - 1);
+
+		madvise(data + begin, end - begin, advice);
+	}
+#endif
+
 	Path::Path(const std::string& str)
 		: mPath(str)
 	{
@@ -21,9 +214,100 @@ namespace LD {
 	{
 	}
 
+	MappedFile::MappedFile()
+		: mData(nullptr)
+		, mSize(0)
+	{
+	}
+
+	MappedFile::~MappedFile()
+	{
+		Unmap();
+	}
+
+	bool MappedFile::Map(const Path& path, FileAccess access)
+	{
+		Unmap();
+
+		intptr_t handle = NativeOpen(path, FileMode::Read);
+		if (handle < 0)
+			return false;
+
+		size_t size = NativeGetSize(handle);
+
+		if (size == 0)
+		{
+			NativeClose(handle);
+			return true;
+		}
+
+#ifdef LD_PLATFORM_WIN32
+		// the view keeps the mapping object alive, both handles can be closed right away
+		HANDLE mapping = CreateFileMappingA((HANDLE)handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		NativeClose(handle);
+
+		if (!mapping)
+			return false;
+
+		void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);
+
+		if (!data)
+			return false;
+
+		(void)access;
+#elif defined(LD_PLATFORM_LINUX)
+		// the mapping stays valid after the descriptor is closed
+		void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, (int)handle, 0);
+		NativeClose(handle);
+
+		if (data == MAP_FAILED)
+			return false;
+
+		if (access == FileAccess::Sequential)
+			madvise(data, size, MADV_SEQUENTIAL);
+		else if (access == FileAccess::Random)
+			madvise(data, size, MADV_RANDOM);
+#endif
+
+		mData = (u8*)data;
+		mSize = size;
+
+		return true;
+	}
+
+	void MappedFile::Unmap()
+	{
+		if (!mData)
+			return;
+
+#ifdef LD_PLATFORM_WIN32
+		UnmapViewOfFile(mData);
+#elif defined(LD_PLATFORM_LINUX)
+		munmap(mData, mSize);
+#endif
+
+		mData = nullptr;
+		mSize = 0;
+	}
+
+	void MappedFile::WillNeed(size_t offset, size_t size)
+	{
+#ifdef LD_PLATFORM_LINUX
+		NativeAdvise(mData, mSize, offset, size, MADV_WILLNEED);
+#endif
+	}
+
+	void MappedFile::DontNeed(size_t offset, size_t size)
+	{
+		// MADV_DONTNEED on a private read only mapping drops the pages,
+		// later accesses fault them back in from the page cache
+#ifdef LD_PLATFORM_LINUX
+		NativeAdvise(mData, mSize, offset, size, MADV_DONTNEED);
+#endif
+	}
+
 	File::File()
-		: mSize(0)
-		, mData(nullptr)
 	{
 	}
 
@@ -40,28 +324,64 @@ namespace LD {
 
 	bool File::Open(const Path& path, FileMode mode)
 	{
-		mMode = mode;
+		Close();
 
 		// TODO: currently only accepts ascii string path
 
-		if (mMode == FileMode::Read)
+		if (mode == FileMode::Read)
 		{
-			std::string str = static_cast<std::filesystem::path>(path).string();
-			std::ifstream stream(str.c_str(), std::ios::ate | std::ios::binary);
-			LD_DEBUG_ASSERT(stream.is_open());
+			std::error_code ec;
+			size_t size = (size_t)std::filesystem::file_size(static_cast<const std::filesystem::path&>(path), ec);
+
+			if (ec)
+				return false;
+
+			if (size >= FILE_MAP_THRESHOLD)
+			{
+				// zero copy view of the page cache
+				if (!mMapping.Map(path, FileAccess::Sequential))
+					return false;
+
+				mData = (u8*)mMapping.Data();
+				mSize = mMapping.Size();
+				mMode = mode;
+				return true;
+			}
+
+			// small files are cheaper to copy with a single read than to map
+			intptr_t handle = NativeOpen(path, mode);
+			if (handle < 0)
+				return false;
+
+			bool error = false;
 
-			mSize = stream.tellg();
-			mData = (u8*)MemoryAlloc(mSize);
+			if (size > 0)
+			{
+				mData = (u8*)MemoryAlloc(size);
+				mSize = NativeReadAt(handle, 0, mData, size, &error);
+			}
 
-			stream.seekg(0);
-			stream.read((char*)mData, mSize);
-			stream.close();
+			NativeClose(handle);
 
+			if (error)
+			{
+				Close();
+				return false;
+			}
+
+			mMode = mode;
 			return true;
 		}
-		else if (mMode == FileMode::Write)
+		else if (mode != FileMode::None)
 		{
-			mWritePath = path;
+			mHandle = NativeOpen(path, mode);
+			if (mHandle < 0)
+				return false;
+
+			if (mode == FileMode::ReadStream)
+				mSize = NativeGetSize(mHandle);
+
+			mMode = mode;
 			return true;
 		}
 
@@ -70,28 +390,108 @@ namespace LD {
 
 	void File::Close()
 	{
+		if (mMode == FileMode::Write || mMode == FileMode::Append)
+			Flush();
+
 		mMode = FileMode::None;
+		mCursor = 0;
+		mSize = 0;
 
-		if (mData)
+		if (mHandle >= 0)
 		{
-			MemoryFree((void*)mData);
-			mData = nullptr;
+			NativeClose(mHandle);
+			mHandle = -1;
 		}
+
+		if (mBuffer)
+		{
+			MemoryFree(mBuffer);
+			mBuffer = nullptr;
+		}
+
+		if (mMapping.IsMapped())
+			mMapping.Unmap();
+		else if (mData)
+			MemoryFree((void*)mData);
+
+		mData = nullptr;
+	}
+
+	bool File::Write(const u8* data, size_t size)
+	{
+		LD_DEBUG_ASSERT(mMode == FileMode::Write || mMode == FileMode::Append);
+
+		if (size == 0)
+			return true;
+
+		if (mBufferSize + size > FILE_WRITE_BUFFER_SIZE && !Flush())
+			return false;
+
+		if (size >= FILE_WRITE_BUFFER_SIZE)
+			return NativeWrite(mHandle, data, size);
+
+		if (!mBuffer)
+			mBuffer = (u8*)MemoryAlloc(FILE_WRITE_BUFFER_SIZE);
+
+		memcpy(mBuffer + mBufferSize, data, size);
+		mBufferSize += size;
+
+		return true;
 	}
 
-	void File::Write(const u8* data, size_t size)
+	bool File::Flush()
 	{
-		LD_DEBUG_ASSERT(mMode == FileMode::Write);
+		if (mBufferSize == 0)
+			return true;
+
+		bool result = NativeWrite(mHandle, mBuffer, mBufferSize);
+		mBufferSize = 0;
+
+		return result;
+	}
 
-		std::ofstream stream(mWritePath.ToString(), std::ios::binary);
-		LD_DEBUG_ASSERT(stream.is_open());
+	size_t File::Read(u8* dst, size_t size)
+	{
+		size_t bytes = ReadAt(mCursor, dst, size);
+		mCursor += bytes;
 
-		stream.write((const char*)data, size);
-		stream.close();
+		return bytes;
+	}
+
+	size_t File::ReadAt(size_t offset, u8* dst, size_t size, bool* error)
+	{
+		LD_DEBUG_ASSERT(mMode == FileMode::Read || mMode == FileMode::ReadStream);
+
+		if (error)
+			*error = false;
+
+		if (mMode == FileMode::ReadStream)
+			return NativeReadAt(mHandle, offset, dst, size, error);
+
+		if (offset >= mSize)
+			return 0;
+
+		if (size > mSize - offset)
+			size = mSize - offset;
+
+		memcpy(dst, mData + offset, size);
+		return size;
+	}
+
+	void File::Seek(size_t offset)
+	{
+		mCursor = offset;
 	}
 
 	void File::ReadString(std::string& string)
 	{
+		if (mMode == FileMode::ReadStream)
+		{
+			string.resize(mSize);
+			string.resize(ReadAt(0, (u8*)string.data(), mSize));
+			return;
+		}
+
 		string.resize(mSize);
 		
 		if (mSize > 0)
@@ -113,4 +513,32 @@ namespace LD {
 		return std::filesystem::create_directories(std_path);
 	}
 
+	bool FileSystem::GetFiles(const Path& directory, std::vector<Path>& files, bool recursive)
+	{
+		auto& std_path = static_cast<const std::filesystem::path&>(directory);
+		std::error_code ec;
+
+		if (!std::filesystem::is_directory(std_path, ec))
+			return false;
+
+		if (recursive)
+		{
+			for (const auto& entry : std::filesystem::recursive_directory_iterator(std_path, ec))
+			{
+				if (entry.is_regular_file(ec))
+					files.push_back({ entry.path() });
+			}
+
+			return true;
+		}
+
+		for (const auto& entry : std::filesystem::directory_iterator(std_path, ec))
+		{
+			if (entry.is_regular_file(ec))
+				files.push_back({ entry.path() });
+		}
+
+		return true;
+	}
+
 } // namespace LD
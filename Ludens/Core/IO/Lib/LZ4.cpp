@@ -0,0 +1,199 @@
+#include <cstring>
+#include "Core/IO/Lib/LZ4.h"
+
+#define LZ4_MIN_MATCH 4
+#define LZ4_LAST_LITERALS 5 // the last 5 bytes of a block are always literals
+#define LZ4_MF_LIMIT 12     // the last match starts at least 12 bytes before the end
+#define LZ4_MAX_OFFSET 65535
+#define LZ4_HASH_BITS 12
+
+namespace LD
+{
+
+static inline u32 Read32(const u8* p)
+{
+    u32 value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline u32 Hash32(u32 sequence)
+{
+    return (sequence * 2654435761u) >> (32 - LZ4_HASH_BITS);
+}
+
+/// write the length extension bytes of a literal or match length that overflowed its 4 bits
+static inline u8* WriteLength(u8* op, size_t length)
+{
+    for (; length >= 255; length -= 255)
+        *op++ = 255;
+
+    *op++ = (u8)length;
+    return op;
+}
+
+/// @brief emit one sequence, a match length of 0 emits the final literals only
+static u8* WriteSequence(u8* op, const u8* literals, size_t literalLength, size_t offset, size_t matchLength)
+{
+    u8* token = op++;
+    size_t matchCode = matchLength > 0 ? matchLength - LZ4_MIN_MATCH : 0;
+
+    *token = (u8)((literalLength < 15 ? literalLength : 15) << 4);
+    if (literalLength >= 15)
+        op = WriteLength(op, literalLength - 15);
+
+    memcpy(op, literals, literalLength);
+    op += literalLength;
+
+    if (matchLength == 0)
+        return op;
+
+    *op++ = (u8)(offset & 0xFF);
+    *op++ = (u8)(offset >> 8);
+
+    *token |= (u8)(matchCode < 15 ? matchCode : 15);
+    if (matchCode >= 15)
+        op = WriteLength(op, matchCode - 15);
+
+    return op;
+}
+
+size_t LZ4CompressBound(size_t size)
+{
+    return size + size / 255 + 16;
+}
+
+size_t LZ4Compress(const u8* src, size_t size, u8* dst)
+{
+    u8* op = dst;
+    size_t anchor = 0;
+
+    if (size > LZ4_MF_LIMIT)
+    {
+        // positions plus one, zero marks an empty slot
+        u32 table[1 << LZ4_HASH_BITS] = {};
+        size_t matchLimit = size - LZ4_LAST_LITERALS;
+        size_t ip = 0;
+
+        while (ip < size - LZ4_MF_LIMIT)
+        {
+            u32 sequence = Read32(src + ip);
+            u32 h = Hash32(sequence);
+            size_t ref = table[h];
+            table[h] = (u32)(ip + 1);
+
+            if (ref == 0 || ip - (ref - 1) > LZ4_MAX_OFFSET || Read32(src + ref - 1) != sequence)
+            {
+                ip++;
+                continue;
+            }
+
+            ref--;
+
+            // extend the match backwards into pending literals, then forwards
+            while (ip > anchor && ref > 0 && src[ip - 1] == src[ref - 1])
+            {
+                ip--;
+                ref--;
+            }
+
+            size_t length = LZ4_MIN_MATCH;
+            while (ip + length < matchLimit && src[ref + length] == src[ip + length])
+                length++;
+
+            op = WriteSequence(op, src + anchor, ip - anchor, ip - ref, length);
+            ip += length;
+            anchor = ip;
+        }
+    }
+
+    op = WriteSequence(op, src + anchor, size - anchor, 0, 0);
+
+    return (size_t)(op - dst);
+}
+
+bool LZ4Decompress(const u8* src, size_t size, u8* dst, size_t dstSize)
+{
+    const u8* ip = src;
+    const u8* ipEnd = src + size;
+    u8* op = dst;
+    u8* opEnd = dst + dstSize;
+
+    while (ip < ipEnd)
+    {
+        u8 token = *ip++;
+        size_t literalLength = token >> 4;
+
+        if (literalLength == 15)
+        {
+            u8 byte;
+
+            do
+            {
+                if (ip >= ipEnd)
+                    return false;
+
+                byte = *ip++;
+                literalLength += byte;
+            } while (byte == 255);
+        }
+
+        if (literalLength > (size_t)(ipEnd - ip) || literalLength > (size_t)(opEnd - op))
+            return false;
+
+        memcpy(op, ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        // the last sequence has no match
+        if (ip == ipEnd)
+            break;
+
+        if (ipEnd - ip < 2)
+            return false;
+
+        size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+
+        if (offset == 0 || offset > (size_t)(op - dst))
+            return false;
+
+        size_t matchLength = token & 15;
+
+        if (matchLength == 15)
+        {
+            u8 byte;
+
+            do
+            {
+                if (ip >= ipEnd)
+                    return false;
+
+                byte = *ip++;
+                matchLength += byte;
+            } while (byte == 255);
+        }
+
+        matchLength += LZ4_MIN_MATCH;
+
+        if (matchLength > (size_t)(opEnd - op))
+            return false;
+
+        const u8* match = op - offset;
+
+        // overlapping matches repeat the last offset bytes and must be copied forwards
+        if (offset >= matchLength)
+            memcpy(op, match, matchLength);
+        else
+        {
+            for (size_t i = 0; i < matchLength; i++)
+                op[i] = match[i];
+        }
+
+        op += matchLength;
+    }
+
+    return op == opEnd;
+}
+
+} // namespace LD
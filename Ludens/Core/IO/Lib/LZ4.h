@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include "Core/Header/Include/Types.h"
+
+// Compressor and decompressor for the LZ4 block format, compatible with the reference
+// implementation. The compressor is a single pass greedy matcher, which trades ratio
+// for speed the same way LZ4's default level does.
+// - block format:
+//   https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+
+namespace LD
+{
+
+/// worst case compressed size of size bytes
+size_t LZ4CompressBound(size_t size);
+
+/// @brief compress a block
+/// @param dst destination of at least LZ4CompressBound(size) bytes
+/// @return compressed size
+size_t LZ4Compress(const u8* src, size_t size, u8* dst);
+
+/// @brief decompress a block, malformed input never reads or writes out of bounds
+/// @return false if the block is malformed or does not decompress to exactly dstSize bytes
+bool LZ4Decompress(const u8* src, size_t size, u8* dst, size_t dstSize);
+
+} // namespace LD
@@ -0,0 +1,304 @@
+#include <algorithm>
+#include <cstring>
+#include "Core/IO/Include/Pack.h"
+#include "Core/IO/Lib/LZ4.h"
+#include "Core/Math/Include/Hash.h"
+#include "Core/Header/Include/Error.h"
+
+namespace LD
+{
+
+static_assert(sizeof(PackHeader) == 32, "pack header layout changed");
+static_assert(sizeof(PackTOCEntry) == 24, "pack TOC entry layout changed");
+static_assert(sizeof(PackBlob) == 40, "pack blob layout changed");
+
+static inline u64 AlignPack(u64 offset)
+{
+    return (offset + PACK_BLOB_ALIGNMENT - 1) & ~(u64)(PACK_BLOB_ALIGNMENT - 1);
+}
+
+static inline u64 HashName(std::string_view name)
+{
+    return FNV1a64{}(name.data(), name.size());
+}
+
+int PackWriter::FindBlob(const u8* data, size_t size, u64 contentHash)
+{
+    auto range = mBlobsByHash.equal_range(contentHash);
+    std::vector<u8> decompressed;
+
+    for (auto ite = range.first; ite != range.second; ite++)
+    {
+        const Blob& blob = mBlobs[ite->second];
+
+        if (blob.UncompressedSize != size)
+            continue;
+
+        // a matching hash is verified against the content
+        const u8* content = blob.Data.data();
+
+        if (blob.Compression == PackCompression::LZ4)
+        {
+            decompressed.resize(size);
+            LZ4Decompress(blob.Data.data(), blob.Data.size(), decompressed.data(), size);
+            content = decompressed.data();
+        }
+
+        if (size == 0 || memcmp(content, data, size) == 0)
+            return (int)ite->second;
+    }
+
+    return -1;
+}
+
+bool PackWriter::Add(std::string_view name, const u8* data, size_t size, PackCompression compression)
+{
+    if (!mNames.emplace(name).second)
+        return false;
+
+    u64 contentHash = FNV1a64{}(data, size);
+    int blobIndex = FindBlob(data, size, contentHash);
+
+    if (blobIndex < 0)
+    {
+        blobIndex = (int)mBlobs.size();
+        mBlobsByHash.emplace(contentHash, (u32)blobIndex);
+
+        Blob& blob = mBlobs.emplace_back();
+        blob.UncompressedSize = size;
+        blob.ContentHash = contentHash;
+        blob.Compression = PackCompression::None;
+
+        if (compression == PackCompression::LZ4 && size > 0)
+        {
+            blob.Data.resize(LZ4CompressBound(size));
+            size_t compressedSize = LZ4Compress(data, size, blob.Data.data());
+
+            if (compressedSize < size)
+            {
+                blob.Data.resize(compressedSize);
+                blob.Compression = PackCompression::LZ4;
+            }
+        }
+
+        if (blob.Compression == PackCompression::None)
+            blob.Data.assign(data, data + size);
+    }
+
+    Entry& entry = mEntries.emplace_back();
+    entry.Name = name;
+    entry.NameHash = HashName(name);
+    entry.Blob = (u32)blobIndex;
+
+    return true;
+}
+
+bool PackWriter::Write(const Path& path)
+{
+    std::sort(mEntries.begin(), mEntries.end(), [](const Entry& lhs, const Entry& rhs) {
+        return lhs.NameHash != rhs.NameHash ? lhs.NameHash < rhs.NameHash : lhs.Name < rhs.Name;
+    });
+
+    std::vector<PackTOCEntry> toc(mEntries.size());
+    std::string names;
+
+    for (size_t i = 0; i < mEntries.size(); i++)
+    {
+        toc[i].NameHash = mEntries[i].NameHash;
+        toc[i].NameOffset = (u32)names.size();
+        toc[i].NameSize = (u32)mEntries[i].Name.size();
+        toc[i].Blob = mEntries[i].Blob;
+        toc[i].Reserved = 0;
+        names += mEntries[i].Name;
+    }
+
+    // tables first, so opening a pack only touches its first pages
+    u64 offset = sizeof(PackHeader) + toc.size() * sizeof(PackTOCEntry) + mBlobs.size() * sizeof(PackBlob);
+    offset += names.size();
+
+    std::vector<PackBlob> blobs(mBlobs.size());
+
+    for (size_t i = 0; i < mBlobs.size(); i++)
+    {
+        offset = AlignPack(offset);
+        blobs[i].Offset = offset;
+        blobs[i].Size = mBlobs[i].Data.size();
+        blobs[i].UncompressedSize = mBlobs[i].UncompressedSize;
+        blobs[i].ContentHash = mBlobs[i].ContentHash;
+        blobs[i].Compression = mBlobs[i].Compression;
+        blobs[i].Reserved = 0;
+        offset += blobs[i].Size;
+    }
+
+    PackHeader header;
+    header.Magic = PACK_MAGIC;
+    header.Version = PACK_VERSION;
+    header.EntryCount = (u32)toc.size();
+    header.BlobCount = (u32)blobs.size();
+    header.NamesSize = names.size();
+    header.FileSize = offset;
+
+    File file;
+    if (!file.Open(path, FileMode::Write))
+        return false;
+
+    bool isWritten = file.Write((const u8*)&header, sizeof(header)) &&
+                     file.Write((const u8*)toc.data(), toc.size() * sizeof(PackTOCEntry)) &&
+                     file.Write((const u8*)blobs.data(), blobs.size() * sizeof(PackBlob)) &&
+                     file.Write((const u8*)names.data(), names.size());
+
+    const u8 padding[PACK_BLOB_ALIGNMENT] = {};
+    u64 written = sizeof(PackHeader) + toc.size() * sizeof(PackTOCEntry) + blobs.size() * sizeof(PackBlob) + names.size();
+
+    for (size_t i = 0; isWritten && i < mBlobs.size(); i++)
+    {
+        isWritten = file.Write(padding, (size_t)(blobs[i].Offset - written)) &&
+                    file.Write(mBlobs[i].Data.data(), mBlobs[i].Data.size());
+        written = blobs[i].Offset + blobs[i].Size;
+    }
+
+    isWritten = file.Flush() && isWritten;
+    file.Close();
+
+    // a partial pack is never left behind for a reader to find
+    if (!isWritten)
+    {
+        const std::filesystem::path& fsPath = static_cast<const std::filesystem::path&>(path);
+        std::error_code ec;
+
+        if (std::filesystem::is_regular_file(fsPath, ec))
+            std::filesystem::remove(fsPath, ec);
+        return false;
+    }
+
+    return true;
+}
+
+bool PackReader::Open(const Path& path)
+{
+    Close();
+
+    if (!mFile.Map(path))
+        return false;
+
+    const u8* data = mFile.Data();
+    size_t size = mFile.Size();
+
+    if (size < sizeof(PackHeader))
+    {
+        Close();
+        return false;
+    }
+
+    const PackHeader* header = (const PackHeader*)data;
+    u64 tablesSize = (u64)header->EntryCount * sizeof(PackTOCEntry) + (u64)header->BlobCount * sizeof(PackBlob);
+
+    // compare against the remaining size so a crafted NamesSize can not wrap the sum around
+    if (header->Magic != PACK_MAGIC || header->Version != PACK_VERSION || header->FileSize != size ||
+        tablesSize > size - sizeof(PackHeader) || header->NamesSize > size - sizeof(PackHeader) - tablesSize)
+    {
+        Close();
+        return false;
+    }
+
+    const PackTOCEntry* toc = (const PackTOCEntry*)(data + sizeof(PackHeader));
+    const PackBlob* blobs = (const PackBlob*)(toc + header->EntryCount);
+    const char* names = (const char*)(blobs + header->BlobCount);
+
+    // validate once so lookups can trust every offset
+    for (u32 i = 0; i < header->EntryCount; i++)
+    {
+        if (toc[i].Blob >= header->BlobCount || (u64)toc[i].NameOffset + toc[i].NameSize > header->NamesSize)
+        {
+            Close();
+            return false;
+        }
+    }
+
+    for (u32 i = 0; i < header->BlobCount; i++)
+    {
+        const PackBlob& blob = blobs[i];
+        bool compressionValid = blob.Compression == PackCompression::None || blob.Compression == PackCompression::LZ4;
+
+        if (blob.Offset > size || blob.Size > size - blob.Offset || !compressionValid ||
+            (blob.Compression == PackCompression::None && blob.Size != blob.UncompressedSize))
+        {
+            Close();
+            return false;
+        }
+    }
+
+    mHeader = header;
+    mTOC = toc;
+    mBlobs = blobs;
+    mNames = names;
+
+    return true;
+}
+
+void PackReader::Close()
+{
+    mFile.Unmap();
+    mHeader = nullptr;
+    mTOC = nullptr;
+    mBlobs = nullptr;
+    mNames = nullptr;
+}
+
+bool PackReader::Find(std::string_view name, PackEntry& entry) const
+{
+    if (!mHeader)
+        return false;
+
+    u64 hash = HashName(name);
+    const PackTOCEntry* end = mTOC + mHeader->EntryCount;
+    const PackTOCEntry* ite = std::lower_bound(mTOC, end, hash, [](const PackTOCEntry& toc, u64 hash) {
+        return toc.NameHash < hash;
+    });
+
+    for (; ite != end && ite->NameHash == hash; ite++)
+    {
+        if (std::string_view(mNames + ite->NameOffset, ite->NameSize) == name)
+        {
+            entry = GetEntry((size_t)(ite - mTOC));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool PackReader::Read(const PackEntry& entry, u8* dst) const
+{
+    if (entry.Compression == PackCompression::LZ4)
+        return LZ4Decompress(entry.Data, entry.Size, dst, entry.UncompressedSize);
+
+    if (entry.Size > 0)
+        memcpy(dst, entry.Data, entry.Size);
+
+    return true;
+}
+
+std::string_view PackReader::GetEntryName(size_t index) const
+{
+    LD_DEBUG_ASSERT(mHeader && index < mHeader->EntryCount);
+
+    return { mNames + mTOC[index].NameOffset, mTOC[index].NameSize };
+}
+
+PackEntry PackReader::GetEntry(size_t index) const
+{
+    LD_DEBUG_ASSERT(mHeader && index < mHeader->EntryCount);
+
+    const PackBlob& blob = mBlobs[mTOC[index].Blob];
+
+    PackEntry entry;
+    entry.Data = mFile.Data() + blob.Offset;
+    entry.Size = (size_t)blob.Size;
+    entry.UncompressedSize = (size_t)blob.UncompressedSize;
+    entry.Compression = blob.Compression;
+
+    return entry;
+}
+
+} // namespace LD
@@ -0,0 +1,6 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "Core/IO/Tests/TestFile.h"
+#include "Core/IO/Tests/TestAsyncIO.h"
+#include "Core/IO/Tests/TestPack.h"
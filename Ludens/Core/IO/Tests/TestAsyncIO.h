@@ -0,0 +1,222 @@
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <doctest.h>
+#include "Core/IO/Include/AsyncIO.h"
+#include "Core/OS/Include/Memory.h"
+#include "Core/OS/Include/JobSystem.h"
+
+using namespace LD;
+
+struct AsyncIOTestRead
+{
+    const std::vector<u8>* Expected;
+    size_t Offset;
+    size_t Size;
+    bool ExpectSuccess;
+    std::atomic<int>* Matches;
+};
+
+static void AsyncIOTestCallback(const AsyncReadResult& result)
+{
+    AsyncIOTestRead* read = (AsyncIOTestRead*)result.User;
+
+    bool match = result.Success == read->ExpectSuccess && result.Size == read->Size;
+
+    if (match && read->Size > 0)
+        match = memcmp(result.Data, read->Expected->data() + read->Offset, read->Size) == 0;
+
+    if (match)
+        read->Matches->fetch_add(1);
+}
+
+static void AsyncIOTestOwnedCallback(const AsyncReadResult& result)
+{
+    AsyncIOTestCallback(result);
+
+    if (result.Data)
+        MemoryFree(result.Data);
+}
+
+static void AsyncIOTestReads(AsyncIO& io)
+{
+    const int fileCount = 4;
+    std::vector<std::vector<u8>> contents(fileCount);
+    std::vector<Path> paths(fileCount);
+
+    for (int i = 0; i < fileCount; i++)
+    {
+        contents[i] = TestFileBytes(1000 + i * 70000);
+        paths[i] = TestFilePath(("LudensTestAsyncIO" + std::to_string(i) + ".bin").c_str());
+
+        File file;
+        file.Open(paths[i], FileMode::Write);
+        file.Write(contents[i].data(), contents[i].size());
+    }
+
+    // more reads than ring entries, mixing whole file, ranged and caller buffer reads
+    const int readCount = 600;
+    std::atomic<int> matches(0);
+    std::vector<AsyncIOTestRead> reads(readCount);
+    std::vector<AsyncReadRequest> requests(readCount);
+    std::vector<std::vector<u8>> buffers(readCount);
+
+    for (int i = 0; i < readCount; i++)
+    {
+        int f = i % fileCount;
+        const std::vector<u8>& expected = contents[f];
+        AsyncIOTestRead& read = reads[i];
+        AsyncReadRequest& request = requests[i];
+
+        read.Expected = &expected;
+        read.Matches = &matches;
+        read.ExpectSuccess = true;
+        request.FilePath = paths[f];
+        request.User = &read;
+
+        switch (i % 4)
+        {
+        case 0: // whole file into an allocated buffer
+            read.Offset = 0;
+            read.Size = expected.size();
+            request.Callback = &AsyncIOTestOwnedCallback;
+            break;
+        case 1: // range into a caller buffer
+            read.Offset = (size_t)i % expected.size();
+            read.Size = std::min<size_t>(777, expected.size() - read.Offset);
+            buffers[i].resize(777);
+            request.Offset = read.Offset;
+            request.Size = 777;
+            request.Buffer = buffers[i].data();
+            request.Callback = &AsyncIOTestCallback;
+            break;
+        case 2: // from an offset to the end of the file
+            read.Offset = expected.size() / 2;
+            read.Size = expected.size() - read.Offset;
+            request.Offset = read.Offset;
+            request.Callback = &AsyncIOTestOwnedCallback;
+            break;
+        default: // missing file
+            read.Offset = 0;
+            read.Size = 0;
+            read.ExpectSuccess = false;
+            request.FilePath = TestFilePath("LudensTestAsyncIOMissing.bin");
+            request.Callback = &AsyncIOTestOwnedCallback;
+            break;
+        }
+    }
+
+    io.Read(requests.data(), readCount / 2);
+
+    for (int i = readCount / 2; i < readCount; i++)
+        io.Read(requests[i]);
+
+    io.WaitIdle();
+    CHECK(matches.load() == readCount);
+
+#ifdef LD_PLATFORM_LINUX
+    // a directory opens but every read of it fails
+    std::vector<u8> empty;
+    std::atomic<int> failures(0);
+    AsyncIOTestRead failedRead{ &empty, 0, 0, false, &failures };
+    AsyncReadRequest failedRequest;
+    failedRequest.FilePath = std::filesystem::temp_directory_path();
+    failedRequest.Size = 16;
+    failedRequest.User = &failedRead;
+    failedRequest.Callback = &AsyncIOTestOwnedCallback;
+    io.Read(failedRequest);
+    io.WaitIdle();
+    CHECK(failures.load() == 1);
+#endif
+
+    // reads without a callback release their buffer
+    AsyncReadRequest request;
+    request.FilePath = paths[0];
+    io.Read(request);
+    io.WaitIdle();
+
+    for (const Path& path : paths)
+        std::filesystem::remove(static_cast<const std::filesystem::path&>(path));
+}
+
+TEST_CASE("AsyncIO Threads")
+{
+    AsyncIO io(AsyncIOBackend::Threads);
+    CHECK(io.GetBackend() == AsyncIOBackend::Threads);
+
+    AsyncIOTestReads(io);
+}
+
+TEST_CASE("AsyncIO IOUring")
+{
+    // falls back to the thread pool where io_uring is not available
+    AsyncIO io(AsyncIOBackend::IOUring);
+
+    AsyncIOTestReads(io);
+}
+
+struct AsyncIOTestDecode
+{
+    u8* Data;
+    size_t Size;
+    size_t Sum;
+    std::atomic<bool> Done;
+};
+
+static void AsyncIOTestDecodeJob(void* data)
+{
+    AsyncIOTestDecode* decode = (AsyncIOTestDecode*)data;
+
+    decode->Sum = 0;
+    for (size_t i = 0; i < decode->Size; i++)
+        decode->Sum += decode->Data[i];
+
+    MemoryFree(decode->Data);
+    decode->Done = true;
+}
+
+static void AsyncIOTestDecodeCallback(const AsyncReadResult& result)
+{
+    AsyncIOTestDecode* decode = (AsyncIOTestDecode*)result.User;
+    decode->Data = result.Data;
+    decode->Size = result.Size;
+
+    Job job;
+    job.Type = JobType::Misc;
+    job.Main = &AsyncIOTestDecodeJob;
+    job.Data = decode;
+    JobSystem::GetSingleton().Submit(job);
+}
+
+TEST_CASE("AsyncIO Completion Job")
+{
+    Path path = TestFilePath("LudensTestAsyncIOJob.bin");
+    std::vector<u8> bytes = TestFileBytes(300000);
+
+    File file;
+    file.Open(path, FileMode::Write);
+    file.Write(bytes.data(), bytes.size());
+    file.Close();
+
+    size_t expected = 0;
+    for (u8 byte : bytes)
+        expected += byte;
+
+    AsyncIOTestDecode decode{};
+    AsyncReadRequest request;
+    request.FilePath = path;
+    request.Callback = &AsyncIOTestDecodeCallback;
+    request.User = &decode;
+
+    AsyncIO::GetSingleton().Read(request);
+    AsyncIO::GetSingleton().WaitIdle();
+    JobSystem::GetSingleton().WaitAll();
+
+    CHECK(decode.Done);
+    CHECK(decode.Sum == expected);
+
+    std::filesystem::remove(static_cast<const std::filesystem::path&>(path));
+}
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <doctest.h>
+#include "Core/Header/Include/Platform.h"
+#include "Core/IO/Include/FileSystem.h"
+
+using namespace LD;
+
+static Path TestFilePath(const char* name)
+{
+    return { std::filesystem::temp_directory_path() / name };
+}
+
+static std::vector<u8> TestFileBytes(size_t size)
+{
+    std::vector<u8> bytes(size);
+
+    for (size_t i = 0; i < size; i++)
+        bytes[i] = (u8)(i * 31 + (i >> 8));
+
+    return bytes;
+}
+
+TEST_CASE("File Write and Read")
+{
+    Path path = TestFilePath("LudensTestFile.bin");
+
+    // small and large files take the copy and the mapped path
+    for (size_t size : { (size_t)0, (size_t)1000, (size_t)3 * 1024 * 1024 + 7 })
+    {
+        std::vector<u8> bytes = TestFileBytes(size);
+
+        File file;
+        CHECK(file.Open(path, FileMode::Write));
+        file.Write(bytes.data(), bytes.size());
+        file.Close();
+
+        CHECK(file.Open(path, FileMode::Read));
+        CHECK(file.Size() == size);
+        CHECK((size == 0 || memcmp(file.Data(), bytes.data(), size) == 0));
+        file.Close();
+    }
+
+    File file;
+    CHECK_FALSE(file.Open(TestFilePath("LudensTestFileMissing.bin"), FileMode::Read));
+    CHECK_FALSE(file.Open(TestFilePath("LudensTestFileMissing.bin"), FileMode::ReadStream));
+
+    std::filesystem::remove(static_cast<const std::filesystem::path&>(path));
+}
+
+TEST_CASE("File Buffered Append")
+{
+    Path path = TestFilePath("LudensTestFileAppend.bin");
+    std::vector<u8> bytes = TestFileBytes(200 * 1024);
+
+    File file;
+    CHECK(file.Open(path, FileMode::Write));
+
+    // mix of writes that fit the buffer and writes that bypass it
+    size_t offset = 0;
+    size_t step = 1;
+
+    while (offset < bytes.size())
+    {
+        size_t size = std::min(step, bytes.size() - offset);
+        CHECK(file.Write(bytes.data() + offset, size));
+        offset += size;
+        step = step * 3 + 1;
+    }
+
+    file.Close();
+
+    CHECK(file.Open(path, FileMode::Append));
+    file.Write(bytes.data(), 100);
+    file.Close();
+
+    CHECK(file.Open(path, FileMode::Read));
+    CHECK(file.Size() == bytes.size() + 100);
+    CHECK(memcmp(file.Data(), bytes.data(), bytes.size()) == 0);
+    CHECK(memcmp(file.Data() + bytes.size(), bytes.data(), 100) == 0);
+    file.Close();
+
+    // reopening in Write mode truncates
+    CHECK(file.Open(path, FileMode::Write));
+    file.Write(bytes.data(), 10);
+    CHECK(file.Open(path, FileMode::Read));
+    CHECK(file.Size() == 10);
+    file.Close();
+
+#ifdef LD_PLATFORM_LINUX
+    // bytes that can not be written are reported when they leave the buffer
+    CHECK(file.Open("/dev/full", FileMode::Write));
+    CHECK(file.Write(bytes.data(), 10));
+    CHECK_FALSE(file.Flush());
+    CHECK_FALSE(file.Write(bytes.data(), bytes.size()));
+    file.Close();
+#endif
+
+    std::filesystem::remove(static_cast<const std::filesystem::path&>(path));
+}
+
+TEST_CASE("File Ranged and Streaming Reads")
+{
+    Path path = TestFilePath("LudensTestFileStream.bin");
+    std::vector<u8> bytes = TestFileBytes(100000);
+
+    File file;
+    file.Open(path, FileMode::Write);
+    file.Write(bytes.data(), bytes.size());
+    file.Close();
+
+    for (FileMode mode : { FileMode::Read, FileMode::ReadStream })
+    {
+        CHECK(file.Open(path, mode));
+        CHECK(file.Size() == bytes.size());
+        CHECK((mode == FileMode::Read) == (file.Data() != nullptr));
+
+        u8 chunk[4096];
+        CHECK(file.ReadAt(5000, chunk, 100) == 100);
+        CHECK(memcmp(chunk, bytes.data() + 5000, 100) == 0);
+        CHECK(file.ReadAt(bytes.size() - 10, chunk, 100) == 10);
+        CHECK(file.ReadAt(bytes.size() + 10, chunk, 100) == 0);
+
+        // streaming reads in chunks reassemble the file, ReadAt does not move the position
+        std::vector<u8> streamed;
+        size_t bytesRead;
+
+        while ((bytesRead = file.Read(chunk, sizeof(chunk))) > 0)
+            streamed.insert(streamed.end(), chunk, chunk + bytesRead);
+
+        CHECK(streamed == bytes);
+
+        file.Seek(99990);
+        CHECK(file.Read(chunk, sizeof(chunk)) == 10);
+        CHECK(memcmp(chunk, bytes.data() + 99990, 10) == 0);
+
+        std::string str;
+        file.ReadString(str);
+        CHECK(str.size() == bytes.size());
+        CHECK(memcmp(str.data(), bytes.data(), bytes.size()) == 0);
+
+        file.Close();
+    }
+
+    // reaching the end of the file is not an error
+    u8 chunk[100];
+    bool error = true;
+    CHECK(file.Open(path, FileMode::ReadStream));
+    CHECK(file.ReadAt(bytes.size() - 10, chunk, sizeof(chunk), &error) == 10);
+    CHECK_FALSE(error);
+    file.Close();
+
+#ifdef LD_PLATFORM_LINUX
+    // a directory opens as a stream but every read fails
+    CHECK(file.Open(std::filesystem::temp_directory_path(), FileMode::ReadStream));
+    CHECK(file.ReadAt(0, chunk, sizeof(chunk), &error) == 0);
+    CHECK(error);
+    file.Close();
+#endif
+
+    std::filesystem::remove(static_cast<const std::filesystem::path&>(path));
+}
+
+TEST_CASE("MappedFile")
+{
+    Path path = TestFilePath("LudensTestFileMapped.bin");
+    std::vector<u8> bytes = TestFileBytes(1024 * 1024);
+
+    File file;
+    file.Open(path, FileMode::Write);
+    file.Write(bytes.data(), bytes.size());
+    file.Close();
+
+    MappedFile mapped;
+    CHECK_FALSE(mapped.IsMapped());
+    CHECK(mapped.Map(path, FileAccess::Random));
+    CHECK(mapped.IsMapped());
+    CHECK(mapped.Size() == bytes.size());
+
+    // hints never change the contents, out of range hints are ignored
+    mapped.WillNeed(4097, 8192);
+    mapped.DontNeed(0, 65536);
+    mapped.WillNeed(bytes.size() + 100, 10);
+    CHECK(memcmp(mapped.Data(), bytes.data(), bytes.size()) == 0);
+
+    mapped.Unmap();
+    CHECK_FALSE(mapped.IsMapped());
+    CHECK(mapped.Size() == 0);
+
+    // empty files map without a view
+    file.Open(path, FileMode::Write);
+    file.Close();
+    CHECK(mapped.Map(path));
+    CHECK(mapped.Data() == nullptr);
+    CHECK(mapped.Size() == 0);
+
+    CHECK_FALSE(mapped.Map(TestFilePath("LudensTestFileMissing.bin")));
+
+    std::filesystem::remove(static_cast<const std::filesystem::path&>(path));
+}
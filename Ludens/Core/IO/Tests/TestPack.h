@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <doctest.h>
+#include "Core/IO/Include/Pack.h"
+
+using namespace LD;
+
+static std::vector<u8> PackTestText(size_t size)
+{
+    const char* words[] = { "vertex ", "fragment ", "uniform ", "layout ", "sampler2D ", "location " };
+    std::vector<u8> text;
+    u32 state = 12345;
+
+    while (text.size() < size)
+    {
+        state = state * 1103515245 + 12345;
+        const char* word = words[(state >> 16) % 6];
+        text.insert(text.end(), word, word + strlen(word));
+    }
+
+    text.resize(size);
+    return text;
+}
+
+static std::vector<u8> PackTestNoise(size_t size)
+{
+    std::vector<u8> noise(size);
+    u32 state = 777;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        noise[i] = (u8)state;
+    }
+
+    return noise;
+}
+
+static bool PackTestEntry(const PackReader& reader, const char* name, const std::vector<u8>& expected)
+{
+    PackEntry entry;
+
+    if (!reader.Find(name, entry) || entry.UncompressedSize != expected.size())
+        return false;
+
+    std::vector<u8> content(entry.UncompressedSize);
+
+    if (!reader.Read(entry, content.data()))
+        return false;
+
+    return content == expected;
+}
+
+TEST_CASE("Pack Write and Read")
+{
+    Path path = TestFilePath("LudensTestPack.pack");
+
+    std::vector<u8> text = PackTestText(100000);
+    std::vector<u8> noise = PackTestNoise(5000);
+    std::vector<u8> runs(70000, 'a');
+    std::vector<u8> small = { 1, 2, 3 };
+    std::vector<u8> empty;
+
+    PackWriter writer;
+    CHECK(writer.Add("Shaders/ui.vert", text.data(), text.size(), PackCompression::LZ4));
+    CHECK(writer.Add("Textures/noise.bin", noise.data(), noise.size(), PackCompression::LZ4));
+    CHECK(writer.Add("runs.bin", runs.data(), runs.size(), PackCompression::LZ4));
+    CHECK(writer.Add("small.bin", small.data(), small.size()));
+    CHECK(writer.Add("empty.bin", empty.data(), empty.size(), PackCompression::LZ4));
+
+    // identical content shares a blob, compressed or not
+    CHECK(writer.Add("Shaders/ui_copy.vert", text.data(), text.size(), PackCompression::LZ4));
+    CHECK(writer.Add("small_copy.bin", small.data(), small.size()));
+    CHECK_FALSE(writer.Add("small.bin", noise.data(), noise.size()));
+    CHECK(writer.GetEntryCount() == 7);
+    CHECK(writer.GetBlobCount() == 5);
+    CHECK(writer.Write(path));
+
+    PackReader reader;
+    CHECK(reader.Open(path));
+    CHECK(reader.GetEntryCount() == 7);
+
+    CHECK(PackTestEntry(reader, "Shaders/ui.vert", text));
+    CHECK(PackTestEntry(reader, "Shaders/ui_copy.vert", text));
+    CHECK(PackTestEntry(reader, "Textures/noise.bin", noise));
+    CHECK(PackTestEntry(reader, "runs.bin", runs));
+    CHECK(PackTestEntry(reader, "small.bin", small));
+    CHECK(PackTestEntry(reader, "small_copy.bin", small));
+    CHECK(PackTestEntry(reader, "empty.bin", empty));
+
+    PackEntry entry;
+    CHECK_FALSE(reader.Find("missing.bin", entry));
+    CHECK_FALSE(reader.Find("Shaders/ui.ver", entry));
+
+    // compressible blobs are compressed, incompressible ones are stored as is
+    CHECK(reader.Find("Shaders/ui.vert", entry));
+    CHECK(entry.Compression == PackCompression::LZ4);
+    CHECK(entry.Size < text.size() / 2);
+    CHECK(reader.Find("runs.bin", entry));
+    CHECK(entry.Size < 1000);
+    CHECK(reader.Find("Textures/noise.bin", entry));
+    CHECK(entry.Compression == PackCompression::None);
+
+    // uncompressed entries are aligned views into the mapping
+    CHECK(reader.Find("small.bin", entry));
+    CHECK(entry.Compression == PackCompression::None);
+    CHECK(((uintptr_t)entry.Data % PACK_BLOB_ALIGNMENT) == 0);
+    CHECK(memcmp(entry.Data, small.data(), small.size()) == 0);
+
+    for (size_t i = 0; i < reader.GetEntryCount(); i++)
+    {
+        PackEntry byName;
+        CHECK(reader.Find(reader.GetEntryName(i), byName));
+        CHECK(byName.Data == reader.GetEntry(i).Data);
+    }
+
+    reader.Close();
+    CHECK(reader.GetEntryCount() == 0);
+
+#ifdef LD_PLATFORM_LINUX
+    // every write to /dev/full fails, the device itself is not removed
+    CHECK_FALSE(writer.Write("/dev/full"));
+    CHECK(std::filesystem::exists("/dev/full"));
+#endif
+
+    std::filesystem::remove(static_cast<const std::filesystem::path&>(path));
+}
+
+TEST_CASE("Pack Invalid")
+{
+    Path path = TestFilePath("LudensTestPackInvalid.pack");
+    std::vector<u8> text = PackTestText(4000);
+
+    PackWriter writer;
+    writer.Add("text", text.data(), text.size(), PackCompression::LZ4);
+    writer.Write(path);
+
+    File file;
+    file.Open(path, FileMode::Read);
+    std::vector<u8> bytes(file.Data(), file.Data() + file.Size());
+    file.Close();
+
+    PackReader reader;
+    CHECK(reader.Open(path));
+
+    // a corrupt compressed blob never decompresses to the original content or overruns the destination
+    std::vector<u8> corrupt = bytes;
+    const PackBlob* blob = (const PackBlob*)(corrupt.data() + sizeof(PackHeader) + sizeof(PackTOCEntry));
+
+    for (size_t i = 0; i < blob->Size; i += 7)
+        corrupt[blob->Offset + i] ^= 0x5A;
+
+    file.Open(path, FileMode::Write);
+    file.Write(corrupt.data(), corrupt.size());
+    file.Close();
+
+    CHECK(reader.Open(path));
+    PackEntry entry;
+    CHECK(reader.Find("text", entry));
+    std::vector<u8> content(entry.UncompressedSize);
+    CHECK_FALSE((reader.Read(entry, content.data()) && content == text));
+
+    // truncated packs and foreign files are rejected
+    file.Open(path, FileMode::Write);
+    file.Write(bytes.data(), bytes.size() - 1);
+    file.Close();
+    CHECK_FALSE(reader.Open(path));
+
+    // a names size that wraps the table bounds around is rejected
+    std::vector<u8> wrapped = bytes;
+    ((PackHeader*)wrapped.data())->NamesSize = ~(u64)0 - sizeof(PackHeader);
+    file.Open(path, FileMode::Write);
+    file.Write(wrapped.data(), wrapped.size());
+    file.Close();
+    CHECK_FALSE(reader.Open(path));
+
+    file.Open(path, FileMode::Write);
+    file.Write(text.data(), text.size());
+    file.Close();
+    CHECK_FALSE(reader.Open(path));
+
+    std::filesystem::remove(static_cast<const std::filesystem::path&>(path));
+}
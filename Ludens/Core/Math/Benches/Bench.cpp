@@ -0,0 +1,244 @@
+#include <vector>
+#include <iostream>
+#include "Core/Math/Include/Vec4.h"
+#include "Core/Math/Include/Mat4.h"
+#include "Core/Math/Include/Quat.h"
+#include "Core/Math/Include/Stream.h"
+#include "Core/OS/Include/Time.h"
+
+// This file is compiled twice, LDMathBenches uses the SIMD backend and
+// LDMathBenchesScalar defines LD_MATH_NO_SIMD, compare the output of both.
+#ifdef LD_MATH_SIMD
+# ifdef LD_MATH_AVX2
+#  define BENCH_BACKEND "AVX2"
+# else
+#  define BENCH_BACKEND "SSE4"
+# endif
+#else
+# define BENCH_BACKEND "Scalar"
+#endif
+
+using namespace LD;
+
+// number of elements in each input stream, sized to stay within L2
+#define BENCH_STREAM_SIZE 4096
+
+// number of passes over each stream
+#define BENCH_PASSES 2000
+
+// number of scene objects for the AoS against SoA comparison
+#define BENCH_SCENE_SIZE 50000
+
+// number of frames simulated over the scene
+#define BENCH_SCENE_FRAMES 100
+
+static std::vector<Mat4> sMats;
+static std::vector<Vec4> sVecs;
+static std::vector<Quat> sQuats;
+
+static void GenerateInputs()
+{
+    sMats.resize(BENCH_STREAM_SIZE);
+    sVecs.resize(BENCH_STREAM_SIZE);
+    sQuats.resize(BENCH_STREAM_SIZE);
+
+    for (int i = 0; i < BENCH_STREAM_SIZE; i++)
+    {
+        float f = (float)i;
+        sMats[i] = Mat4::Translate(Vec3(f, -f, 0.5f * f)) * Mat4::Rotate(Vec3(1.0f, f, 2.0f), Degrees(f));
+        sVecs[i] = Vec4(f, 1.0f, -f, 1.0f);
+        sQuats[i] = Quat::FromAxisRadians(Vec3(1.0f, f, 2.0f).Normalized(), 0.01f * f);
+    }
+}
+
+// accumulate results into a checksum to keep the loops from being stripped in release build.
+static void Report(const char* name, double time, float checksum)
+{
+    std::cout << BENCH_BACKEND << " " << name << " " << time << " (" << checksum << ")" << std::endl;
+}
+
+static void BenchMat4()
+{
+    double time;
+    Mat4 acc = Mat4::Zero;
+
+    {
+        ScopeTimer timer(&time);
+
+        for (int pass = 0; pass < BENCH_PASSES; pass++)
+            for (int i = 0; i + 1 < BENCH_STREAM_SIZE; i++)
+                acc[i & 3] = acc[i & 3] + (sMats[i] * sMats[i + 1])[pass & 3];
+    }
+    Report("Mat4 * Mat4", time, acc[0].x + acc[1].y + acc[2].z + acc[3].w);
+
+    Vec4 vacc;
+    {
+        ScopeTimer timer(&time);
+
+        for (int pass = 0; pass < BENCH_PASSES; pass++)
+            for (int i = 0; i < BENCH_STREAM_SIZE; i++)
+                vacc = vacc + sMats[i] * sVecs[i];
+    }
+    Report("Mat4 * Vec4", time, vacc.x + vacc.y + vacc.z + vacc.w);
+
+    acc = Mat4::Zero;
+    {
+        ScopeTimer timer(&time);
+
+        for (int pass = 0; pass < BENCH_PASSES / 4; pass++)
+            for (int i = 0; i < BENCH_STREAM_SIZE; i++)
+                acc[i & 3] = acc[i & 3] + Mat4::Inverse(sMats[i])[pass & 3];
+    }
+    Report("Mat4 Inverse", time, acc[0].x + acc[1].y + acc[2].z + acc[3].w);
+
+    acc = Mat4::Zero;
+    {
+        ScopeTimer timer(&time);
+
+        for (int pass = 0; pass < BENCH_PASSES / 4; pass++)
+            for (int i = 0; i < BENCH_STREAM_SIZE; i++)
+                acc[i & 3] = acc[i & 3] + Mat4::AffineInverse(sMats[i])[pass & 3];
+    }
+    Report("Mat4 AffineInverse", time, acc[0].x + acc[1].y + acc[2].z + acc[3].w);
+}
+
+static void BenchVec4Quat()
+{
+    double time;
+    float dot = 0.0f;
+
+    {
+        ScopeTimer timer(&time);
+
+        for (int pass = 0; pass < BENCH_PASSES; pass++)
+            for (int i = 0; i + 1 < BENCH_STREAM_SIZE; i++)
+                dot += Vec4::Dot(sVecs[i] * 0.5f + sVecs[i + 1], sVecs[i]);
+    }
+    Report("Vec4 Arith Dot", time, dot);
+
+    Quat q = Quat::Identity;
+    {
+        ScopeTimer timer(&time);
+
+        for (int pass = 0; pass < BENCH_PASSES; pass++)
+            for (int i = 0; i < BENCH_STREAM_SIZE; i++)
+                q = q * sQuats[i];
+    }
+    Report("Quat * Quat", time, q.x + q.y + q.z + q.w);
+}
+
+// per frame culling work for a scene: rotations to matrices, local to world and world bounds,
+// then a frustum test of each world bound. Done once on arrays of structs and once on streams.
+static void BenchScene()
+{
+    Mat4 view = Mat4::LookAt(Vec3(0.0f, 10.0f, 50.0f), Vec3(0.0f, -0.2f, -1.0f), Vec3(0.0f, 1.0f, 0.0f));
+    Mat4 proj = Mat4::Perspective(LD_MATH_PI / 3.0f, 16.0f / 9.0f, 0.1f, 500.0f);
+    Frustum frustum = Frustum::FromViewProj(proj * view);
+
+    std::vector<Quat> rotations(BENCH_SCENE_SIZE);
+    std::vector<Vec3> positions(BENCH_SCENE_SIZE);
+    std::vector<AABB> localBounds(BENCH_SCENE_SIZE);
+    std::vector<Mat4> worlds(BENCH_SCENE_SIZE);
+    std::vector<AABB> worldBounds(BENCH_SCENE_SIZE);
+    std::vector<u8> visible(BENCH_SCENE_SIZE);
+
+    for (int i = 0; i < BENCH_SCENE_SIZE; i++)
+    {
+        float f = (float)i;
+        rotations[i] = sQuats[i % BENCH_STREAM_SIZE];
+        positions[i] = Vec3((float)(i % 317) - 158.0f, (float)(i % 13), -(float)(i % 541));
+        localBounds[i] = AABB(Vec3(-0.5f, 0.0f, -0.5f), Vec3(0.5f, 1.0f + (i % 7), 0.5f + 0.001f * f));
+    }
+
+    double time;
+    int count = 0;
+    {
+        ScopeTimer timer(&time);
+
+        for (int frame = 0; frame < BENCH_SCENE_FRAMES; frame++)
+        {
+            for (int i = 0; i < BENCH_SCENE_SIZE; i++)
+            {
+                Mat4 rotation;
+                rotations[i].GetMat4(rotation);
+                worlds[i] = Mat4::Translate(positions[i]) * rotation;
+                worldBounds[i] = AABB::Transform(worlds[i], localBounds[i]);
+                visible[i] = frustum.Intersects(worldBounds[i]) ? 1 : 0;
+            }
+
+            for (int i = 0; i < BENCH_SCENE_SIZE; i++)
+                count += visible[i];
+        }
+    }
+    Report("Scene AoS", time, (float)count);
+
+    QuatStream rotationStream;
+    Vec3Stream positionStream;
+    AABBStream localBoundStream, worldBoundStream;
+    Mat4Stream worldStream;
+    rotationStream.Resize(BENCH_SCENE_SIZE);
+    positionStream.Resize(BENCH_SCENE_SIZE);
+    localBoundStream.Resize(BENCH_SCENE_SIZE);
+
+    for (int i = 0; i < BENCH_SCENE_SIZE; i++)
+    {
+        rotationStream.Set(i, rotations[i]);
+        positionStream.Set(i, positions[i]);
+        localBoundStream.Set(i, localBounds[i]);
+    }
+
+    count = 0;
+    {
+        ScopeTimer timer(&time);
+
+        for (int frame = 0; frame < BENCH_SCENE_FRAMES; frame++)
+        {
+            Mat4Stream::FromQuats(rotationStream, worldStream);
+
+            // the translation column of a rotation matrix is zero
+            for (int axis = 0; axis < 3; axis++)
+                std::copy(positionStream.Component(axis), positionStream.Component(axis) + positionStream.PaddedSize(),
+                          worldStream.Component(12 + axis));
+
+            AABBStream::Transform(worldStream, localBoundStream, worldBoundStream);
+            AABBStream::FrustumTest(frustum, worldBoundStream, visible.data());
+
+            for (int i = 0; i < BENCH_SCENE_SIZE; i++)
+                count += visible[i];
+        }
+    }
+    Report("Scene SoA", time, (float)count);
+
+    Mat4 vacc = Mat4::Zero;
+    {
+        ScopeTimer timer(&time);
+
+        for (int frame = 0; frame < BENCH_SCENE_FRAMES; frame++)
+            for (int i = 0; i < BENCH_SCENE_SIZE; i++)
+                vacc[i & 3] = vacc[i & 3] + (view * worlds[i])[frame & 3];
+    }
+    Report("Scene AoS View * World", time, vacc[0].x + vacc[1].y + vacc[2].z + vacc[3].w);
+
+    Mat4Stream viewStream;
+    vacc = Mat4::Zero;
+    {
+        ScopeTimer timer(&time);
+
+        for (int frame = 0; frame < BENCH_SCENE_FRAMES; frame++)
+        {
+            Mat4Stream::Multiply(view, worldStream, viewStream);
+
+            for (int i = 0; i < 4; i++)
+                vacc[i][i] += viewStream.Component(i * 4 + i)[frame];
+        }
+    }
+    Report("Scene SoA View * World", time, vacc[0].x + vacc[1].y + vacc[2].z + vacc[3].w);
+}
+
+int main()
+{
+    GenerateInputs();
+    BenchMat4();
+    BenchVec4Quat();
+    BenchScene();
+}
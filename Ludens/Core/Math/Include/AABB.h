@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Core/Header/Include/Types.h"
+#include "Core/Math/Include/Vec3.h"
+#include "Core/Math/Include/Mat4.h"
+
+namespace LD
+{
+
+template <typename T>
+struct TAABB;
+using AABB = TAABB<float>;
+
+/// 3D axis aligned bounding box
+template <typename T>
+struct TAABB
+{
+    TVec3<T> Min;
+    TVec3<T> Max;
+
+    TAABB() = default;
+    TAABB(const TVec3<T>& min, const TVec3<T>& max) : Min(min), Max(max)
+    {
+    }
+
+    inline TVec3<T> Center() const
+    {
+        return (Min + Max) / static_cast<T>(2);
+    }
+
+    /// half size along each axis
+    inline TVec3<T> Extent() const
+    {
+        return (Max - Min) / static_cast<T>(2);
+    }
+
+    inline bool Contains(const TVec3<T>& point) const
+    {
+        return Min.x <= point.x && point.x <= Max.x && Min.y <= point.y && point.y <= Max.y && Min.z <= point.z &&
+               point.z <= Max.z;
+    }
+
+    /// @brief bounds of the box after an affine transform (Arvo),
+    ///        the extent along each axis is the absolute upper 3x3 applied to the original extent
+    static TAABB<T> Transform(const TMat4<T>& mat, const TAABB<T>& box)
+    {
+        TVec3<T> c = box.Center();
+        TVec3<T> e = box.Extent();
+        TVec3<T> center, extent;
+
+        for (int row = 0; row < 3; row++)
+        {
+            center[row] = mat[0][row] * c.x + mat[1][row] * c.y + mat[2][row] * c.z + mat[3][row];
+            extent[row] = LD_MATH_ABS(mat[0][row]) * e.x + LD_MATH_ABS(mat[1][row]) * e.y + LD_MATH_ABS(mat[2][row]) * e.z;
+        }
+
+        return { center - extent, center + extent };
+    }
+};
+
+} // namespace LD
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Core/Math/Include/Vec4.h"
+#include "Core/Math/Include/Mat4.h"
+#include "Core/Math/Include/AABB.h"
+
+namespace LD
+{
+
+/// view frustum as six inward facing planes, each plane stores its normal
+/// in xyz and its distance in w, so a point p is inside when dot(n, p) + w >= 0
+struct Frustum
+{
+    enum PlaneIndex
+    {
+        Left = 0,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far,
+    };
+
+    Vec4 Planes[6];
+
+    /// @brief extract the planes from a view projection matrix (Gribb-Hartmann),
+    ///        assumes the clip space depth range [-w, w] produced by Mat4::Perspective
+    static Frustum FromViewProj(const Mat4& viewProj)
+    {
+        Frustum frustum;
+        Vec4 rows[4];
+
+        for (int row = 0; row < 4; row++)
+            rows[row] = Vec4(viewProj[0][row], viewProj[1][row], viewProj[2][row], viewProj[3][row]);
+
+        frustum.Planes[Left] = rows[3] + rows[0];
+        frustum.Planes[Right] = rows[3] - rows[0];
+        frustum.Planes[Bottom] = rows[3] + rows[1];
+        frustum.Planes[Top] = rows[3] - rows[1];
+        frustum.Planes[Near] = rows[3] + rows[2];
+        frustum.Planes[Far] = rows[3] - rows[2];
+
+        for (Vec4& plane : frustum.Planes)
+        {
+            float length = Vec3(plane.x, plane.y, plane.z).Length();
+            plane = plane / length;
+        }
+
+        return frustum;
+    }
+
+    /// @brief conservative box test, false only if the box lies entirely outside of a plane
+    bool Intersects(const AABB& box) const
+    {
+        Vec3 c = box.Center();
+        Vec3 e = box.Extent();
+
+        for (const Vec4& plane : Planes)
+        {
+            float d = plane.x * c.x + plane.y * c.y + plane.z * c.z + plane.w;
+            float r = LD_MATH_ABS(plane.x) * e.x + LD_MATH_ABS(plane.y) * e.y + LD_MATH_ABS(plane.z) * e.z;
+
+            if (d + r < 0.0f)
+                return false;
+        }
+
+        return true;
+    }
+};
+
+} // namespace LD
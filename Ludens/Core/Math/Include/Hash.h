@@ -1,11 +1,14 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 // A collection of some better knowh hashes online.
 // Note that these hashes are not ideal for cryptographic use.
 // - djb2 and other string hashes:
 //   http://www.cse.yorku.ca/~oz/hash.html
+// - FNV-1a:
+//   http://www.isthe.com/chongo/tech/comp/fnv/index.html
 // - hash combine from the boost library:
 //   https://www.boost.org/doc/libs/1_85_0/libs/container_hash/doc/html/hash.html#notes_hash_combine
 
@@ -28,6 +31,24 @@ struct DJB2
     }
 };
 
+/// 64-bit FNV-1a, the result does not depend on the platform, suitable for hashes written to disk
+struct FNV1a64
+{
+    uint64_t operator()(const void* data, size_t size)
+    {
+        const unsigned char* bytes = (const unsigned char*)data;
+        uint64_t hash = 0xcbf29ce484222325ull;
+
+        for (size_t i = 0; i < size; i++)
+        {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ull;
+        }
+
+        return hash;
+    }
+};
+
 template <typename... TArgs>
 inline void HashCombine(size_t& seed, size_t hash, TArgs... args)
 {
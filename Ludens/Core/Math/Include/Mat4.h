@@ -60,6 +60,13 @@ struct TMat4
     static TMat4<T> LookAt(const TVec3<T>& position, const TVec3<T>& direction, const TVec3<T>& worldUp);
     static TMat4<T> Perspective(T fovRadians, T aspect, T zNear, T zFar);
     static TMat4<T> Orthographic(T left, T right, T bottom, T top, T near, T far);
+
+    /// general inverse, the matrix must be invertible
+    static TMat4<T> Inverse(const TMat4<T>& mat);
+
+    /// @brief inverse of an affine transform, cheaper than the general inverse
+    /// @warning the last row must be (0, 0, 0, 1) and the upper 3x3 must be invertible
+    static TMat4<T> AffineInverse(const TMat4<T>& mat);
 };
 
 template <typename T>
@@ -161,6 +168,75 @@ TMat4<T> TMat4<T>::Orthographic(T left, T right, T bottom, T top, T near, T far)
     return ortho;
 }
 
+template <typename T>
+TMat4<T> TMat4<T>::Inverse(const TMat4<T>& mat)
+{
+    TMat4<T> inverse;
+    T* inv = inverse.GetData();
+    const T* m = mat.GetData();
+
+    // adjugate matrix by cofactor expansion
+    inv[0] = m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15] + m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10];
+    inv[4] = -m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15] - m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10];
+    inv[8] = m[4] * m[9] * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15] + m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9];
+    inv[12] = -m[4] * m[9] * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14] - m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9];
+    inv[1] = -m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15] - m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10];
+    inv[5] = m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15] + m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10];
+    inv[9] = -m[0] * m[9] * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15] - m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9];
+    inv[13] = m[0] * m[9] * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14] + m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9];
+    inv[2] = m[1] * m[6] * m[15] - m[1] * m[7] * m[14] - m[5] * m[2] * m[15] + m[5] * m[3] * m[14] + m[13] * m[2] * m[7] - m[13] * m[3] * m[6];
+    inv[6] = -m[0] * m[6] * m[15] + m[0] * m[7] * m[14] + m[4] * m[2] * m[15] - m[4] * m[3] * m[14] - m[12] * m[2] * m[7] + m[12] * m[3] * m[6];
+    inv[10] = m[0] * m[5] * m[15] - m[0] * m[7] * m[13] - m[4] * m[1] * m[15] + m[4] * m[3] * m[13] + m[12] * m[1] * m[7] - m[12] * m[3] * m[5];
+    inv[14] = -m[0] * m[5] * m[14] + m[0] * m[6] * m[13] + m[4] * m[1] * m[14] - m[4] * m[2] * m[13] - m[12] * m[1] * m[6] + m[12] * m[2] * m[5];
+    inv[3] = -m[1] * m[6] * m[11] + m[1] * m[7] * m[10] + m[5] * m[2] * m[11] - m[5] * m[3] * m[10] - m[9] * m[2] * m[7] + m[9] * m[3] * m[6];
+    inv[7] = m[0] * m[6] * m[11] - m[0] * m[7] * m[10] - m[4] * m[2] * m[11] + m[4] * m[3] * m[10] + m[8] * m[2] * m[7] - m[8] * m[3] * m[6];
+    inv[11] = -m[0] * m[5] * m[11] + m[0] * m[7] * m[9] + m[4] * m[1] * m[11] - m[4] * m[3] * m[9] - m[8] * m[1] * m[7] + m[8] * m[3] * m[5];
+    inv[15] = m[0] * m[5] * m[10] - m[0] * m[6] * m[9] - m[4] * m[1] * m[10] + m[4] * m[2] * m[9] + m[8] * m[1] * m[6] - m[8] * m[2] * m[5];
+
+    T det = m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12];
+
+    // any determinant that isn't exactly zero will pass
+    LD_DEBUG_ASSERT(det != (T)0);
+    T denominator = (T)1 / det;
+
+    // divide adjugate by determinant
+    for (int i = 0; i < 16; i++)
+    {
+        inv[i] *= denominator;
+    }
+
+    return inverse;
+}
+
+template <typename T>
+TMat4<T> TMat4<T>::AffineInverse(const TMat4<T>& mat)
+{
+    LD_DEBUG_ASSERT(mat[0][3] == (T)0 && mat[1][3] == (T)0 && mat[2][3] == (T)0 && mat[3][3] == (T)1);
+
+    // the rows of the inverse 3x3 are the cross products of its columns divided by the determinant
+    const TVec3<T> a(mat[0].x, mat[0].y, mat[0].z);
+    const TVec3<T> b(mat[1].x, mat[1].y, mat[1].z);
+    const TVec3<T> c(mat[2].x, mat[2].y, mat[2].z);
+    const TVec3<T> t(mat[3].x, mat[3].y, mat[3].z);
+
+    TVec3<T> r0 = TVec3<T>::Cross(b, c);
+    TVec3<T> r1 = TVec3<T>::Cross(c, a);
+    TVec3<T> r2 = TVec3<T>::Cross(a, b);
+    T det = TVec3<T>::Dot(a, r0);
+
+    LD_DEBUG_ASSERT(det != (T)0);
+    T denominator = (T)1 / det;
+    r0 = r0 * denominator;
+    r1 = r1 * denominator;
+    r2 = r2 * denominator;
+
+    // inverse translation is the inverse 3x3 applied to the negated translation
+    return TMat4<T>({ r0.x, r1.x, r2.x, (T)0 },
+                    { r0.y, r1.y, r2.y, (T)0 },
+                    { r0.z, r1.z, r2.z, (T)0 },
+                    { -TVec3<T>::Dot(r0, t), -TVec3<T>::Dot(r1, t), -TVec3<T>::Dot(r2, t), (T)1 });
+}
+
 template <typename T>
 const TMat4<T> TMat4<T>::Identity{ { (T)1.0f, (T)0.0f, (T)0.0f, (T)0.0f },
                                    { (T)0.0f, (T)1.0f, (T)0.0f, (T)0.0f },
@@ -185,4 +261,32 @@ inline TMat4<T> operator*(const TMat4<T>& lhs, const TMat4<T>& rhs)
     return TMat4<T>(lhs * rhs[0], lhs * rhs[1], lhs * rhs[2], lhs * rhs[3]);
 }
 
+#ifdef LD_MATH_SIMD
+
+// float specializations, non-template overloads take precedence over the scalar templates above
+
+inline Vec4 operator*(const Mat4& m, const Vec4& v)
+{
+    Vec4 result;
+    SIMD::Mat4MulVec4(m.GetData(), v.Data, result.Data);
+    return result;
+}
+
+inline Mat4 operator*(const Mat4& lhs, const Mat4& rhs)
+{
+    Mat4 result;
+    SIMD::Mat4Mul(lhs.GetData(), rhs.GetData(), result.GetData());
+    return result;
+}
+
+template <>
+inline Mat4 TMat4<float>::Inverse(const Mat4& mat)
+{
+    Mat4 inverse;
+    SIMD::Mat4Inverse(mat.GetData(), inverse.GetData());
+    return inverse;
+}
+
+#endif // LD_MATH_SIMD
+
 } // namespace LD
\ No newline at end of file
@@ -14,17 +14,17 @@ template <typename T>
 struct TQuat : public TVec4<T>
 {
     TQuat() = default;
-    TQuat(T x, T y, T z, T w) : TVec4(x, y, z, w)
+    TQuat(T x, T y, T z, T w) : TVec4<T>(x, y, z, w)
     {
     }
 
-    TQuat(const TVec3<T>& v, T w) : TVec4(v.x, v.y, v.z, w)
+    TQuat(const TVec3<T>& v, T w) : TVec4<T>(v.x, v.y, v.z, w)
     {
     }
 
     TQuat<T> Conjugated() const
     {
-        return { -x, -y, -z, w };
+        return { -this->x, -this->y, -this->z, this->w };
     }
 
     TQuat<T> Normalized() const
@@ -35,20 +35,20 @@ struct TQuat : public TVec4<T>
 
     TQuat<T> operator*(const TQuat<T>& other) const
     {
-        float lx = x;
-        float ly = y;
-        float lz = z;
-        float lw = w;
+        T lx = this->x;
+        T ly = this->y;
+        T lz = this->z;
+        T lw = this->w;
 
-        float rx = other.x;
-        float ry = other.y;
-        float rz = other.z;
-        float rw = other.w;
+        T rx = other.x;
+        T ry = other.y;
+        T rz = other.z;
+        T rw = other.w;
 
-        float x = lw * rx + lx * rw + ly * rz - lz * ry;
-        float y = lw * ry - lx * rz + ly * rw + lz * rx;
-        float z = lw * rz + lx * ry - ly * rx + lz * rw;
-        float w = lw * rw - lx * rx - ly * ry - lz * rz;
+        T x = lw * rx + lx * rw + ly * rz - lz * ry;
+        T y = lw * ry - lx * rz + ly * rw + lz * rx;
+        T z = lw * rz + lx * ry - ly * rx + lz * rw;
+        T w = lw * rw - lx * rx - ly * ry - lz * rz;
 
         return { x, y, z, w };
     }
@@ -57,7 +57,7 @@ struct TQuat : public TVec4<T>
     /// @warn quaternion must first be normalized
     TVec3<T> operator*(const TVec3<T>& vec) const
     {
-        LD_DEBUG_ASSERT(IsNormalized());
+        LD_DEBUG_ASSERT(this->IsNormalized());
 
         TQuat<T> p = *this * TQuat(vec, 0) * Conjugated();
         return { p.x, p.y, p.z };
@@ -65,10 +65,10 @@ struct TQuat : public TVec4<T>
 
     void GetAxisRadians(TVec3<T>& axis, TRadians<T>& rad) const
     {
-        LD_DEBUG_ASSERT(IsNormalized());
+        LD_DEBUG_ASSERT(this->IsNormalized());
 
         // positive real part
-        TQuat<T> q = (w > (T)0) ? TQuat<T>{ x, y, z, w } : TQuat<T>{ -x, -y, -z, -w };
+        TQuat<T> q = (this->w > (T)0) ? TQuat<T>{ this->x, this->y, this->z, this->w } : TQuat<T>{ -this->x, -this->y, -this->z, -this->w };
 
         if (q.w >= (T)1)
         {
@@ -84,7 +84,7 @@ struct TQuat : public TVec4<T>
 
     void GetMat4(TMat4<T>& mat) const
     {
-        LD_DEBUG_ASSERT(IsNormalized());
+        LD_DEBUG_ASSERT(this->IsNormalized());
 
         TVec3<T> axis;
         TRadians<T> rad;
@@ -109,4 +109,16 @@ const TQuat<T> TQuat<T>::Identity{ T(0), T(0), T(0), T(1) };
 
 using Quat = TQuat<float>;
 
+#ifdef LD_MATH_SIMD
+
+template <>
+inline Quat Quat::operator*(const Quat& other) const
+{
+    Quat result;
+    SIMD::QuatMul(Data, other.Data, result.Data);
+    return result;
+}
+
+#endif // LD_MATH_SIMD
+
 } // namespace LD
\ No newline at end of file
@@ -0,0 +1,281 @@
+#pragma once
+
+// SIMD Backend
+// - float vector and matrix types use SSE4.1 kernels, or AVX2 with FMA when compiled with AVX2 enabled
+// - define LD_MATH_NO_SIMD to force the scalar templates for all types
+// - the choice must be the same for every translation unit linked into a program
+#ifndef LD_MATH_NO_SIMD
+# if defined(__SSE4_1__) || defined(__AVX__) || defined(_M_X64)
+#  define LD_MATH_SIMD
+#  define LD_MATH_SSE
+#  include <smmintrin.h>
+# endif
+# if defined(LD_MATH_SIMD) && defined(__AVX2__)
+#  define LD_MATH_AVX2
+#  include <immintrin.h>
+# endif
+#endif
+
+#ifdef LD_MATH_SIMD
+
+// lane order for _mm_shuffle_ps, lane 0 is listed first
+#define LD_MATH_SHUFFLE(X, Y, Z, W) ((X) | ((Y) << 2) | ((Z) << 4) | ((W) << 6))
+
+namespace LD
+{
+namespace SIMD
+{
+
+/// a * b + c, fused on AVX2 targets
+inline __m128 MulAdd(__m128 a, __m128 b, __m128 c)
+{
+#ifdef LD_MATH_AVX2
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+inline __m128 Splat(__m128 v, int lane)
+{
+    switch (lane)
+    {
+    case 0:
+        return _mm_shuffle_ps(v, v, LD_MATH_SHUFFLE(0, 0, 0, 0));
+    case 1:
+        return _mm_shuffle_ps(v, v, LD_MATH_SHUFFLE(1, 1, 1, 1));
+    case 2:
+        return _mm_shuffle_ps(v, v, LD_MATH_SHUFFLE(2, 2, 2, 2));
+    default:
+        return _mm_shuffle_ps(v, v, LD_MATH_SHUFFLE(3, 3, 3, 3));
+    }
+}
+
+/// 4 component dot product
+inline float Vec4Dot(const float* lhs, const float* rhs)
+{
+    return _mm_cvtss_f32(_mm_dp_ps(_mm_loadu_ps(lhs), _mm_loadu_ps(rhs), 0xF1));
+}
+
+/// column major 4x4 matrix times column vector, out may alias v
+inline void Mat4MulVec4(const float* m, const float* v, float* out)
+{
+    __m128 vec = _mm_loadu_ps(v);
+    __m128 result = _mm_mul_ps(_mm_loadu_ps(m), Splat(vec, 0));
+    result = MulAdd(_mm_loadu_ps(m + 4), Splat(vec, 1), result);
+    result = MulAdd(_mm_loadu_ps(m + 8), Splat(vec, 2), result);
+    result = MulAdd(_mm_loadu_ps(m + 12), Splat(vec, 3), result);
+    _mm_storeu_ps(out, result);
+}
+
+/// column major 4x4 matrix product, out may alias lhs or rhs
+inline void Mat4Mul(const float* lhs, const float* rhs, float* out)
+{
+#ifdef LD_MATH_AVX2
+    // each lhs column duplicated into both 128-bit lanes, two result columns are computed per iteration
+    __m256 l0 = _mm256_broadcast_ps((const __m128*)(lhs + 0));
+    __m256 l1 = _mm256_broadcast_ps((const __m128*)(lhs + 4));
+    __m256 l2 = _mm256_broadcast_ps((const __m128*)(lhs + 8));
+    __m256 l3 = _mm256_broadcast_ps((const __m128*)(lhs + 12));
+
+    for (int col = 0; col < 4; col += 2)
+    {
+        __m256 r = _mm256_loadu_ps(rhs + col * 4);
+        __m256 result = _mm256_mul_ps(l0, _mm256_shuffle_ps(r, r, LD_MATH_SHUFFLE(0, 0, 0, 0)));
+        result = _mm256_fmadd_ps(l1, _mm256_shuffle_ps(r, r, LD_MATH_SHUFFLE(1, 1, 1, 1)), result);
+        result = _mm256_fmadd_ps(l2, _mm256_shuffle_ps(r, r, LD_MATH_SHUFFLE(2, 2, 2, 2)), result);
+        result = _mm256_fmadd_ps(l3, _mm256_shuffle_ps(r, r, LD_MATH_SHUFFLE(3, 3, 3, 3)), result);
+        _mm256_storeu_ps(out + col * 4, result);
+    }
+#else
+    __m128 l0 = _mm_loadu_ps(lhs + 0);
+    __m128 l1 = _mm_loadu_ps(lhs + 4);
+    __m128 l2 = _mm_loadu_ps(lhs + 8);
+    __m128 l3 = _mm_loadu_ps(lhs + 12);
+
+    for (int col = 0; col < 4; col++)
+    {
+        __m128 r = _mm_loadu_ps(rhs + col * 4);
+        __m128 result = _mm_mul_ps(l0, Splat(r, 0));
+        result = MulAdd(l1, Splat(r, 1), result);
+        result = MulAdd(l2, Splat(r, 2), result);
+        result = MulAdd(l3, Splat(r, 3), result);
+        _mm_storeu_ps(out + col * 4, result);
+    }
+#endif
+}
+
+// 2x2 matrices packed as (m00, m01, m10, m11) in one register, used by Mat4Inverse
+
+inline __m128 Mat2Mul(__m128 a, __m128 b)
+{
+    return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, LD_MATH_SHUFFLE(0, 3, 0, 3))),
+                      _mm_mul_ps(_mm_shuffle_ps(a, a, LD_MATH_SHUFFLE(1, 0, 3, 2)),
+                                 _mm_shuffle_ps(b, b, LD_MATH_SHUFFLE(2, 1, 2, 1))));
+}
+
+/// adjugate(a) * b
+inline __m128 Mat2AdjMul(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, LD_MATH_SHUFFLE(3, 3, 0, 0)), b),
+                      _mm_mul_ps(_mm_shuffle_ps(a, a, LD_MATH_SHUFFLE(1, 1, 2, 2)),
+                                 _mm_shuffle_ps(b, b, LD_MATH_SHUFFLE(2, 3, 0, 1))));
+}
+
+/// a * adjugate(b)
+inline __m128 Mat2MulAdj(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, LD_MATH_SHUFFLE(3, 0, 3, 0))),
+                      _mm_mul_ps(_mm_shuffle_ps(a, a, LD_MATH_SHUFFLE(1, 0, 3, 2)),
+                                 _mm_shuffle_ps(b, b, LD_MATH_SHUFFLE(2, 1, 2, 1))));
+}
+
+/// general 4x4 inverse by blockwise inversion of the four 2x2 sub matrices,
+/// the matrix must be invertible, out may alias m
+inline void Mat4Inverse(const float* m, float* out)
+{
+    // The algorithm is written for rows, feeding it columns inverts the transpose,
+    // whose rows are the columns of the inverse, so the output layout matches the input.
+    __m128 c0 = _mm_loadu_ps(m + 0);
+    __m128 c1 = _mm_loadu_ps(m + 4);
+    __m128 c2 = _mm_loadu_ps(m + 8);
+    __m128 c3 = _mm_loadu_ps(m + 12);
+
+    __m128 A = _mm_movelh_ps(c0, c1);
+    __m128 B = _mm_movehl_ps(c1, c0);
+    __m128 C = _mm_movelh_ps(c2, c3);
+    __m128 D = _mm_movehl_ps(c3, c2);
+
+    // determinants of the sub matrices as (|A|, |B|, |C|, |D|)
+    __m128 detSub = _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(c0, c2, LD_MATH_SHUFFLE(0, 2, 0, 2)), _mm_shuffle_ps(c1, c3, LD_MATH_SHUFFLE(1, 3, 1, 3))),
+        _mm_mul_ps(_mm_shuffle_ps(c0, c2, LD_MATH_SHUFFLE(1, 3, 1, 3)), _mm_shuffle_ps(c1, c3, LD_MATH_SHUFFLE(0, 2, 0, 2))));
+    __m128 detA = Splat(detSub, 0);
+    __m128 detB = Splat(detSub, 1);
+    __m128 detC = Splat(detSub, 2);
+    __m128 detD = Splat(detSub, 3);
+
+    __m128 DC = Mat2AdjMul(D, C);
+    __m128 AB = Mat2AdjMul(A, B);
+    __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), Mat2Mul(B, DC));
+    __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), Mat2Mul(C, AB));
+    __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), Mat2MulAdj(D, AB));
+    __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), Mat2MulAdj(A, DC));
+
+    // |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+    __m128 detM = _mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC));
+    __m128 trace = _mm_mul_ps(AB, _mm_shuffle_ps(DC, DC, LD_MATH_SHUFFLE(0, 2, 1, 3)));
+    trace = _mm_hadd_ps(trace, trace);
+    trace = _mm_hadd_ps(trace, trace);
+    detM = _mm_sub_ps(detM, trace);
+
+    __m128 invDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+    X = _mm_mul_ps(X, invDetM);
+    Y = _mm_mul_ps(Y, invDetM);
+    Z = _mm_mul_ps(Z, invDetM);
+    W = _mm_mul_ps(W, invDetM);
+
+    // adjugate shuffle combined with the store shuffle
+    _mm_storeu_ps(out + 0, _mm_shuffle_ps(X, Y, LD_MATH_SHUFFLE(3, 1, 3, 1)));
+    _mm_storeu_ps(out + 4, _mm_shuffle_ps(X, Y, LD_MATH_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(out + 8, _mm_shuffle_ps(Z, W, LD_MATH_SHUFFLE(3, 1, 3, 1)));
+    _mm_storeu_ps(out + 12, _mm_shuffle_ps(Z, W, LD_MATH_SHUFFLE(2, 0, 2, 0)));
+}
+
+/// Hamilton product of quaternions stored as (x, y, z, w), out may alias lhs or rhs
+inline void QuatMul(const float* lhs, const float* rhs, float* out)
+{
+    __m128 l = _mm_loadu_ps(lhs);
+    __m128 r = _mm_loadu_ps(rhs);
+
+    __m128 result = _mm_mul_ps(Splat(l, 3), r);
+    __m128 rx = _mm_mul_ps(_mm_shuffle_ps(r, r, LD_MATH_SHUFFLE(3, 2, 1, 0)), _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f));
+    __m128 ry = _mm_mul_ps(_mm_shuffle_ps(r, r, LD_MATH_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(1.0f, 1.0f, -1.0f, -1.0f));
+    __m128 rz = _mm_mul_ps(_mm_shuffle_ps(r, r, LD_MATH_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f));
+    result = MulAdd(Splat(l, 0), rx, result);
+    result = MulAdd(Splat(l, 1), ry, result);
+    result = MulAdd(Splat(l, 2), rz, result);
+
+    _mm_storeu_ps(out, result);
+}
+
+} // namespace SIMD
+} // namespace LD
+
+#endif // LD_MATH_SIMD
+
+// Wide Lanes
+// - batch kernels over structure-of-arrays data process LD_MATH_WIDE_COUNT elements per step
+// - 8 lanes on AVX2, 4 lanes on SSE4.1, a single float when SIMD is disabled
+#if defined(LD_MATH_AVX2)
+# define LD_MATH_WIDE_COUNT 8
+#elif defined(LD_MATH_SIMD)
+# define LD_MATH_WIDE_COUNT 4
+#else
+# include <cmath>
+# define LD_MATH_WIDE_COUNT 1
+#endif
+
+namespace LD
+{
+namespace SIMD
+{
+
+#if defined(LD_MATH_AVX2)
+
+using Wide = __m256;
+
+inline Wide WideLoad(const float* p) { return _mm256_loadu_ps(p); }
+inline void WideStore(float* p, Wide v) { _mm256_storeu_ps(p, v); }
+inline Wide WideSet(float s) { return _mm256_set1_ps(s); }
+inline Wide WideAdd(Wide a, Wide b) { return _mm256_add_ps(a, b); }
+inline Wide WideSub(Wide a, Wide b) { return _mm256_sub_ps(a, b); }
+inline Wide WideMul(Wide a, Wide b) { return _mm256_mul_ps(a, b); }
+inline Wide WideMulAdd(Wide a, Wide b, Wide c) { return _mm256_fmadd_ps(a, b, c); }
+inline Wide WideAbs(Wide a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+inline Wide WideMin(Wide a, Wide b) { return _mm256_min_ps(a, b); }
+inline Wide WideMax(Wide a, Wide b) { return _mm256_max_ps(a, b); }
+
+/// bit i is set if lane i of a is less than lane i of b
+inline int WideLessMask(Wide a, Wide b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ)); }
+
+#elif defined(LD_MATH_SIMD)
+
+using Wide = __m128;
+
+inline Wide WideLoad(const float* p) { return _mm_loadu_ps(p); }
+inline void WideStore(float* p, Wide v) { _mm_storeu_ps(p, v); }
+inline Wide WideSet(float s) { return _mm_set1_ps(s); }
+inline Wide WideAdd(Wide a, Wide b) { return _mm_add_ps(a, b); }
+inline Wide WideSub(Wide a, Wide b) { return _mm_sub_ps(a, b); }
+inline Wide WideMul(Wide a, Wide b) { return _mm_mul_ps(a, b); }
+inline Wide WideMulAdd(Wide a, Wide b, Wide c) { return MulAdd(a, b, c); }
+inline Wide WideAbs(Wide a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+inline Wide WideMin(Wide a, Wide b) { return _mm_min_ps(a, b); }
+inline Wide WideMax(Wide a, Wide b) { return _mm_max_ps(a, b); }
+
+/// bit i is set if lane i of a is less than lane i of b
+inline int WideLessMask(Wide a, Wide b) { return _mm_movemask_ps(_mm_cmplt_ps(a, b)); }
+
+#else
+
+using Wide = float;
+
+inline Wide WideLoad(const float* p) { return *p; }
+inline void WideStore(float* p, Wide v) { *p = v; }
+inline Wide WideSet(float s) { return s; }
+inline Wide WideAdd(Wide a, Wide b) { return a + b; }
+inline Wide WideSub(Wide a, Wide b) { return a - b; }
+inline Wide WideMul(Wide a, Wide b) { return a * b; }
+inline Wide WideMulAdd(Wide a, Wide b, Wide c) { return a * b + c; }
+inline Wide WideAbs(Wide a) { return std::fabs(a); }
+inline Wide WideMin(Wide a, Wide b) { return a < b ? a : b; }
+inline Wide WideMax(Wide a, Wide b) { return a > b ? a : b; }
+
+/// bit 0 is set if a is less than b
+inline int WideLessMask(Wide a, Wide b) { return a < b ? 1 : 0; }
+
+#endif
+
+} // namespace SIMD
+} // namespace LD
@@ -0,0 +1,414 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include "Core/Header/Include/Error.h"
+#include "Core/Header/Include/Types.h"
+#include "Core/Math/Include/SIMD.h"
+#include "Core/Math/Include/Vec3.h"
+#include "Core/Math/Include/Mat4.h"
+#include "Core/Math/Include/Quat.h"
+#include "Core/Math/Include/AABB.h"
+#include "Core/Math/Include/Frustum.h"
+
+// component arrays are padded to a multiple of this, so batch kernels never need a scalar tail.
+// Kernels process the padding lanes like any other lane, their contents are unspecified.
+#define LD_MATH_STREAM_PADDING 8
+
+namespace LD
+{
+
+/// Structure-of-arrays storage of float elements with TComponents components each.
+/// Every component lives in its own contiguous array, so batch kernels load the same
+/// component of LD_MATH_WIDE_COUNT consecutive elements with a single load.
+template <int TComponents>
+class TStream
+{
+    LD_STATIC_ASSERT(LD_MATH_STREAM_PADDING % LD_MATH_WIDE_COUNT == 0);
+
+public:
+    /// resize the stream, existing elements are kept and new elements are zero
+    void Resize(size_t size)
+    {
+        size_t stride = (size + LD_MATH_STREAM_PADDING - 1) / LD_MATH_STREAM_PADDING * LD_MATH_STREAM_PADDING;
+
+        if (stride != mStride)
+        {
+            std::vector<float> data(TComponents * stride, 0.0f);
+            size_t keep = std::min(mSize, size);
+
+            for (int c = 0; c < TComponents; c++)
+                std::copy(mData.data() + c * mStride, mData.data() + c * mStride + keep, data.data() + c * stride);
+
+            mData.swap(data);
+            mStride = stride;
+        }
+        else if (size > mSize)
+        {
+            // padding lanes may hold kernel results
+            for (int c = 0; c < TComponents; c++)
+                std::fill(mData.data() + c * mStride + mSize, mData.data() + c * mStride + size, 0.0f);
+        }
+
+        mSize = size;
+    }
+
+    inline size_t Size() const
+    {
+        return mSize;
+    }
+
+    /// number of elements including the padding, a multiple of LD_MATH_STREAM_PADDING
+    inline size_t PaddedSize() const
+    {
+        return mStride;
+    }
+
+    inline float* Component(int c)
+    {
+        LD_DEBUG_ASSERT(0 <= c && c < TComponents);
+        return mData.data() + c * mStride;
+    }
+
+    inline const float* Component(int c) const
+    {
+        LD_DEBUG_ASSERT(0 <= c && c < TComponents);
+        return mData.data() + c * mStride;
+    }
+
+protected:
+    std::vector<float> mData;
+    size_t mSize = 0;
+    size_t mStride = 0;
+};
+
+/// stream of 3D points or directions, components x, y, z
+class Vec3Stream : public TStream<3>
+{
+public:
+    inline Vec3 Get(size_t i) const
+    {
+        LD_DEBUG_ASSERT(i < mSize);
+        return { Component(0)[i], Component(1)[i], Component(2)[i] };
+    }
+
+    inline void Set(size_t i, const Vec3& v)
+    {
+        LD_DEBUG_ASSERT(i < mSize);
+        Component(0)[i] = v.x;
+        Component(1)[i] = v.y;
+        Component(2)[i] = v.z;
+    }
+
+    /// transform points by a single affine matrix, out may be the same stream as points
+    static void Transform(const Mat4& mat, const Vec3Stream& points, Vec3Stream& out);
+
+    /// transform each point by the matrix of the same index, out may be the same stream as points
+    static void Transform(const class Mat4Stream& mats, const Vec3Stream& points, Vec3Stream& out);
+};
+
+/// stream of quaternions, components x, y, z, w
+class QuatStream : public TStream<4>
+{
+public:
+    inline Quat Get(size_t i) const
+    {
+        LD_DEBUG_ASSERT(i < mSize);
+        return { Component(0)[i], Component(1)[i], Component(2)[i], Component(3)[i] };
+    }
+
+    inline void Set(size_t i, const Quat& q)
+    {
+        LD_DEBUG_ASSERT(i < mSize);
+        Component(0)[i] = q.x;
+        Component(1)[i] = q.y;
+        Component(2)[i] = q.z;
+        Component(3)[i] = q.w;
+    }
+};
+
+/// stream of column major 4x4 matrices, component (col * 4 + row) holds mat[col][row]
+class Mat4Stream : public TStream<16>
+{
+public:
+    inline Mat4 Get(size_t i) const
+    {
+        LD_DEBUG_ASSERT(i < mSize);
+        Mat4 mat;
+        float* data = mat.GetData();
+
+        for (int c = 0; c < 16; c++)
+            data[c] = Component(c)[i];
+
+        return mat;
+    }
+
+    inline void Set(size_t i, const Mat4& mat)
+    {
+        LD_DEBUG_ASSERT(i < mSize);
+        const float* data = mat.GetData();
+
+        for (int c = 0; c < 16; c++)
+            Component(c)[i] = data[c];
+    }
+
+    /// out[i] = lhs * mats[i], such as applying the view matrix to all instance matrices,
+    /// out may be the same stream as mats
+    static void Multiply(const Mat4& lhs, const Mat4Stream& mats, Mat4Stream& out);
+
+    /// rotation matrices from normalized quaternions
+    static void FromQuats(const QuatStream& quats, Mat4Stream& out);
+};
+
+/// stream of axis aligned bounding boxes, components min x, y, z and max x, y, z
+class AABBStream : public TStream<6>
+{
+public:
+    inline AABB Get(size_t i) const
+    {
+        LD_DEBUG_ASSERT(i < mSize);
+        return { { Component(0)[i], Component(1)[i], Component(2)[i] },
+                 { Component(3)[i], Component(4)[i], Component(5)[i] } };
+    }
+
+    inline void Set(size_t i, const AABB& box)
+    {
+        LD_DEBUG_ASSERT(i < mSize);
+        Component(0)[i] = box.Min.x;
+        Component(1)[i] = box.Min.y;
+        Component(2)[i] = box.Min.z;
+        Component(3)[i] = box.Max.x;
+        Component(4)[i] = box.Max.y;
+        Component(5)[i] = box.Max.z;
+    }
+
+    /// bounds of each box after the affine matrix of the same index, see AABB::Transform,
+    /// out may be the same stream as boxes
+    static void Transform(const Mat4Stream& mats, const AABBStream& boxes, AABBStream& out);
+
+    /// @brief conservative frustum test of all boxes, see Frustum::Intersects
+    /// @param visible receives 1 for boxes that may be visible and 0 for culled boxes, must hold boxes.Size() entries
+    static void FrustumTest(const Frustum& frustum, const AABBStream& boxes, u8* visible);
+};
+
+inline void Vec3Stream::Transform(const Mat4& mat, const Vec3Stream& points, Vec3Stream& out)
+{
+    using namespace SIMD;
+
+    out.Resize(points.Size());
+
+    Wide m[12];
+    for (int col = 0; col < 4; col++)
+        for (int row = 0; row < 3; row++)
+            m[col * 3 + row] = WideSet(mat[col][row]);
+
+    const float* inX = points.Component(0);
+    const float* inY = points.Component(1);
+    const float* inZ = points.Component(2);
+    float* outX = out.Component(0);
+    float* outY = out.Component(1);
+    float* outZ = out.Component(2);
+
+    for (size_t i = 0; i < points.PaddedSize(); i += LD_MATH_WIDE_COUNT)
+    {
+        Wide x = WideLoad(inX + i);
+        Wide y = WideLoad(inY + i);
+        Wide z = WideLoad(inZ + i);
+
+        WideStore(outX + i, WideMulAdd(m[0], x, WideMulAdd(m[3], y, WideMulAdd(m[6], z, m[9]))));
+        WideStore(outY + i, WideMulAdd(m[1], x, WideMulAdd(m[4], y, WideMulAdd(m[7], z, m[10]))));
+        WideStore(outZ + i, WideMulAdd(m[2], x, WideMulAdd(m[5], y, WideMulAdd(m[8], z, m[11]))));
+    }
+}
+
+inline void Vec3Stream::Transform(const Mat4Stream& mats, const Vec3Stream& points, Vec3Stream& out)
+{
+    using namespace SIMD;
+
+    LD_DEBUG_ASSERT(mats.Size() == points.Size());
+    out.Resize(points.Size());
+
+    for (size_t i = 0; i < points.PaddedSize(); i += LD_MATH_WIDE_COUNT)
+    {
+        Wide x = WideLoad(points.Component(0) + i);
+        Wide y = WideLoad(points.Component(1) + i);
+        Wide z = WideLoad(points.Component(2) + i);
+
+        for (int row = 0; row < 3; row++)
+        {
+            Wide result = WideLoad(mats.Component(12 + row) + i);
+            result = WideMulAdd(WideLoad(mats.Component(0 + row) + i), x, result);
+            result = WideMulAdd(WideLoad(mats.Component(4 + row) + i), y, result);
+            result = WideMulAdd(WideLoad(mats.Component(8 + row) + i), z, result);
+            WideStore(out.Component(row) + i, result);
+        }
+    }
+}
+
+inline void Mat4Stream::Multiply(const Mat4& lhs, const Mat4Stream& mats, Mat4Stream& out)
+{
+    using namespace SIMD;
+
+    out.Resize(mats.Size());
+
+    Wide l[16];
+    for (int c = 0; c < 16; c++)
+        l[c] = WideSet(lhs.GetData()[c]);
+
+    for (size_t i = 0; i < mats.PaddedSize(); i += LD_MATH_WIDE_COUNT)
+    {
+        for (int col = 0; col < 4; col++)
+        {
+            // the whole input column is loaded before the output column is written
+            Wide r0 = WideLoad(mats.Component(col * 4 + 0) + i);
+            Wide r1 = WideLoad(mats.Component(col * 4 + 1) + i);
+            Wide r2 = WideLoad(mats.Component(col * 4 + 2) + i);
+            Wide r3 = WideLoad(mats.Component(col * 4 + 3) + i);
+
+            for (int row = 0; row < 4; row++)
+            {
+                Wide result = WideMul(l[0 + row], r0);
+                result = WideMulAdd(l[4 + row], r1, result);
+                result = WideMulAdd(l[8 + row], r2, result);
+                result = WideMulAdd(l[12 + row], r3, result);
+                WideStore(out.Component(col * 4 + row) + i, result);
+            }
+        }
+    }
+}
+
+inline void Mat4Stream::FromQuats(const QuatStream& quats, Mat4Stream& out)
+{
+    using namespace SIMD;
+
+    out.Resize(quats.Size());
+
+    const Wide zero = WideSet(0.0f);
+    const Wide one = WideSet(1.0f);
+    const Wide two = WideSet(2.0f);
+
+    for (size_t i = 0; i < quats.PaddedSize(); i += LD_MATH_WIDE_COUNT)
+    {
+        Wide x = WideLoad(quats.Component(0) + i);
+        Wide y = WideLoad(quats.Component(1) + i);
+        Wide z = WideLoad(quats.Component(2) + i);
+        Wide w = WideLoad(quats.Component(3) + i);
+
+        Wide x2 = WideMul(x, two);
+        Wide y2 = WideMul(y, two);
+        Wide z2 = WideMul(z, two);
+        Wide xx = WideMul(x, x2);
+        Wide yy = WideMul(y, y2);
+        Wide zz = WideMul(z, z2);
+        Wide xy = WideMul(x, y2);
+        Wide xz = WideMul(x, z2);
+        Wide yz = WideMul(y, z2);
+        Wide wx = WideMul(w, x2);
+        Wide wy = WideMul(w, y2);
+        Wide wz = WideMul(w, z2);
+
+        WideStore(out.Component(0) + i, WideSub(one, WideAdd(yy, zz)));
+        WideStore(out.Component(1) + i, WideAdd(xy, wz));
+        WideStore(out.Component(2) + i, WideSub(xz, wy));
+        WideStore(out.Component(3) + i, zero);
+        WideStore(out.Component(4) + i, WideSub(xy, wz));
+        WideStore(out.Component(5) + i, WideSub(one, WideAdd(xx, zz)));
+        WideStore(out.Component(6) + i, WideAdd(yz, wx));
+        WideStore(out.Component(7) + i, zero);
+        WideStore(out.Component(8) + i, WideAdd(xz, wy));
+        WideStore(out.Component(9) + i, WideSub(yz, wx));
+        WideStore(out.Component(10) + i, WideSub(one, WideAdd(xx, yy)));
+        WideStore(out.Component(11) + i, zero);
+        WideStore(out.Component(12) + i, zero);
+        WideStore(out.Component(13) + i, zero);
+        WideStore(out.Component(14) + i, zero);
+        WideStore(out.Component(15) + i, one);
+    }
+}
+
+inline void AABBStream::Transform(const Mat4Stream& mats, const AABBStream& boxes, AABBStream& out)
+{
+    using namespace SIMD;
+
+    LD_DEBUG_ASSERT(mats.Size() == boxes.Size());
+    out.Resize(boxes.Size());
+
+    const Wide half = WideSet(0.5f);
+
+    for (size_t i = 0; i < boxes.PaddedSize(); i += LD_MATH_WIDE_COUNT)
+    {
+        Wide c[3], e[3];
+
+        for (int axis = 0; axis < 3; axis++)
+        {
+            Wide min = WideLoad(boxes.Component(axis) + i);
+            Wide max = WideLoad(boxes.Component(3 + axis) + i);
+            c[axis] = WideMul(WideAdd(min, max), half);
+            e[axis] = WideMul(WideSub(max, min), half);
+        }
+
+        for (int row = 0; row < 3; row++)
+        {
+            Wide m0 = WideLoad(mats.Component(0 + row) + i);
+            Wide m1 = WideLoad(mats.Component(4 + row) + i);
+            Wide m2 = WideLoad(mats.Component(8 + row) + i);
+
+            Wide center = WideLoad(mats.Component(12 + row) + i);
+            center = WideMulAdd(m0, c[0], center);
+            center = WideMulAdd(m1, c[1], center);
+            center = WideMulAdd(m2, c[2], center);
+
+            Wide extent = WideMul(WideAbs(m0), e[0]);
+            extent = WideMulAdd(WideAbs(m1), e[1], extent);
+            extent = WideMulAdd(WideAbs(m2), e[2], extent);
+
+            WideStore(out.Component(row) + i, WideSub(center, extent));
+            WideStore(out.Component(3 + row) + i, WideAdd(center, extent));
+        }
+    }
+}
+
+inline void AABBStream::FrustumTest(const Frustum& frustum, const AABBStream& boxes, u8* visible)
+{
+    using namespace SIMD;
+
+    const Wide half = WideSet(0.5f);
+    const Wide zero = WideSet(0.0f);
+
+    for (size_t i = 0; i < boxes.Size(); i += LD_MATH_WIDE_COUNT)
+    {
+        Wide c[3], e[3];
+
+        for (int axis = 0; axis < 3; axis++)
+        {
+            Wide min = WideLoad(boxes.Component(axis) + i);
+            Wide max = WideLoad(boxes.Component(3 + axis) + i);
+            c[axis] = WideMul(WideAdd(min, max), half);
+            e[axis] = WideMul(WideSub(max, min), half);
+        }
+
+        // bit set for each box that is entirely outside of any plane
+        int outside = 0;
+
+        for (const Vec4& plane : frustum.Planes)
+        {
+            Wide d = WideSet(plane.w);
+            d = WideMulAdd(WideSet(plane.x), c[0], d);
+            d = WideMulAdd(WideSet(plane.y), c[1], d);
+            d = WideMulAdd(WideSet(plane.z), c[2], d);
+
+            Wide r = WideMul(WideSet(LD_MATH_ABS(plane.x)), e[0]);
+            r = WideMulAdd(WideSet(LD_MATH_ABS(plane.y)), e[1], r);
+            r = WideMulAdd(WideSet(LD_MATH_ABS(plane.z)), e[2], r);
+
+            outside |= WideLessMask(WideAdd(d, r), zero);
+        }
+
+        // padded lanes are computed but not written
+        size_t count = std::min<size_t>(LD_MATH_WIDE_COUNT, boxes.Size() - i);
+        for (size_t lane = 0; lane < count; lane++)
+            visible[i + lane] = (outside >> lane) & 1 ? 0 : 1;
+    }
+}
+
+} // namespace LD
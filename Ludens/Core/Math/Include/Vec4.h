@@ -2,6 +2,7 @@
 
 #include "Core/Header/Include/Types.h"
 #include "Core/Math/Include/Math.h"
+#include "Core/Math/Include/SIMD.h"
 #include "Core/Math/Include/Vec3.h"
 #include "Core/Math/Include/Vec2.h"
 
@@ -163,4 +164,48 @@ struct TVec4
 template <typename T>
 const TVec4<T> TVec4<T>::Zero{ T(0), T(0), T(0), T(0) };
 
+#ifdef LD_MATH_SIMD
+
+// float specializations, non-template overloads take precedence over the scalar templates above
+
+#define LD_VEC4_SIMD_ARITH(OP, INTRINSIC)                                                                              \
+    inline Vec4 operator OP(const Vec4& lhs, const Vec4& rhs)                                                          \
+    {                                                                                                                  \
+        Vec4 result;                                                                                                   \
+        _mm_storeu_ps(result.Data, INTRINSIC(_mm_loadu_ps(lhs.Data), _mm_loadu_ps(rhs.Data)));                         \
+        return result;                                                                                                 \
+    }
+
+LD_VEC4_SIMD_ARITH(+, _mm_add_ps)
+LD_VEC4_SIMD_ARITH(-, _mm_sub_ps)
+LD_VEC4_SIMD_ARITH(*, _mm_mul_ps)
+LD_VEC4_SIMD_ARITH(/, _mm_div_ps)
+
+#define LD_VEC4_SIMD_SCALAR(OP, INTRINSIC)                                                                             \
+    inline Vec4 operator OP(const Vec4& v, float s)                                                                    \
+    {                                                                                                                  \
+        Vec4 result;                                                                                                   \
+        _mm_storeu_ps(result.Data, INTRINSIC(_mm_loadu_ps(v.Data), _mm_set1_ps(s)));                                   \
+        return result;                                                                                                 \
+    }
+
+LD_VEC4_SIMD_SCALAR(+, _mm_add_ps)
+LD_VEC4_SIMD_SCALAR(-, _mm_sub_ps)
+LD_VEC4_SIMD_SCALAR(*, _mm_mul_ps)
+LD_VEC4_SIMD_SCALAR(/, _mm_div_ps)
+
+template <>
+inline float TVec4<float>::Dot(const TVec4<float>& v1, const TVec4<float>& v2)
+{
+    return SIMD::Vec4Dot(v1.Data, v2.Data);
+}
+
+template <>
+inline float TVec4<float>::LengthSquared() const
+{
+    return SIMD::Vec4Dot(Data, Data);
+}
+
+#endif // LD_MATH_SIMD
+
 } // namespace LD
\ No newline at end of file
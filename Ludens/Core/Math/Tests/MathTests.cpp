@@ -7,4 +7,5 @@
 #include "Core/Math/Tests/TestVec4.h"
 #include "Core/Math/Tests/TestMat3.h"
 #include "Core/Math/Tests/TestMat4.h"
-#include "Core/Math/Tests/TestQuat.h"
\ No newline at end of file
+#include "Core/Math/Tests/TestQuat.h"
+#include "Core/Math/Tests/TestStream.h"
\ No newline at end of file
@@ -139,3 +139,104 @@ TEST_CASE("Mat4 Scale")
 		CHECK(p2.w == 1);
 	}
 }
+
+static bool Mat4Equal(const Mat4& lhs, const TMat4<double>& rhs, double tolerance = 1e-4)
+{
+	for (int i = 0; i < 4; i++)
+		for (int j = 0; j < 4; j++)
+			if (LD_MATH_ABS((double)lhs[i][j] - rhs[i][j]) > tolerance)
+				return false;
+
+	return true;
+}
+
+static TMat4<double> Mat4ToDouble(const Mat4& m)
+{
+	TMat4<double> d;
+
+	for (int i = 0; i < 4; i++)
+		for (int j = 0; j < 4; j++)
+			d[i][j] = (double)m[i][j];
+
+	return d;
+}
+
+// deterministic, well conditioned test matrices
+static Mat4 Mat4Sample(int seed)
+{
+	Mat4 m = Mat4::Rotate(Vec3(1.0f, (float)seed, 2.0f), Degrees(13.0f * seed + 7.0f));
+	m = Mat4::Scale(Vec3(1.5f, 0.5f + seed * 0.25f, 2.0f)) * m;
+	m = Mat4::Translate(Vec3((float)seed, -2.0f, 0.5f * seed)) * m;
+	return m;
+}
+
+TEST_CASE("Mat4 Multiply Reference")
+{
+	// float matrices may take the SIMD path, double matrices always use the scalar templates
+	for (int seed = 0; seed < 8; seed++)
+	{
+		Mat4 lhs = Mat4Sample(seed) + (float)seed;
+		Mat4 rhs = Mat4Sample(seed + 1) - 1.0f;
+		Vec4 v(1.0f, -2.0f, 3.0f, (float)seed);
+
+		Mat4 product = lhs * rhs;
+		TMat4<double> reference = Mat4ToDouble(lhs) * Mat4ToDouble(rhs);
+		CHECK(Mat4Equal(product, reference));
+
+		Vec4 mv = lhs * v;
+		TVec4<double> mvReference = Mat4ToDouble(lhs) * TVec4<double>(v.x, v.y, v.z, v.w);
+		CHECK(LD_MATH_ABS(mv.x - mvReference.x) < 1e-4);
+		CHECK(LD_MATH_ABS(mv.y - mvReference.y) < 1e-4);
+		CHECK(LD_MATH_ABS(mv.z - mvReference.z) < 1e-4);
+		CHECK(LD_MATH_ABS(mv.w - mvReference.w) < 1e-4);
+	}
+}
+
+TEST_CASE("Mat4 Inverse")
+{
+	{
+		Mat4 inv = Mat4::Inverse(Mat4::Identity);
+		CHECK(Mat4Equal(inv, TMat4<double>::Identity));
+	}
+
+	for (int seed = 0; seed < 8; seed++)
+	{
+		// general matrix with a non-trivial last row
+		Mat4 m = Mat4Sample(seed);
+		m[0][3] = 0.25f;
+		m[2][3] = -0.5f * seed;
+
+		Mat4 inv = Mat4::Inverse(m);
+		CHECK(Mat4Equal(inv * m, TMat4<double>::Identity));
+		CHECK(Mat4Equal(m * inv, TMat4<double>::Identity));
+		CHECK(Mat4Equal(inv, TMat4<double>::Inverse(Mat4ToDouble(m))));
+	}
+
+	{
+		Mat4 proj = Mat4::Perspective(1.2f, 16.0f / 9.0f, 0.1f, 100.0f);
+		Mat4 inv = Mat4::Inverse(proj);
+		CHECK(Mat4Equal(inv * proj, TMat4<double>::Identity));
+	}
+}
+
+TEST_CASE("Mat4 AffineInverse")
+{
+	for (int seed = 0; seed < 8; seed++)
+	{
+		Mat4 m = Mat4Sample(seed);
+		Mat4 inv = Mat4::AffineInverse(m);
+
+		CHECK(Mat4Equal(inv * m, TMat4<double>::Identity));
+		CHECK(Mat4Equal(inv, TMat4<double>::Inverse(Mat4ToDouble(m))));
+	}
+
+	{
+		Mat4 view = Mat4::LookAt(Vec3(3.0f, 2.0f, 1.0f), Vec3(-1.0f, -0.5f, -0.25f), Vec3(0.0f, 1.0f, 0.0f));
+		Mat4 inv = Mat4::AffineInverse(view);
+		Vec4 eye = inv * Vec4(0.0f, 0.0f, 0.0f, 1.0f);
+
+		CHECK(LD_MATH_ABS(eye.x - 3.0f) < 1e-4f);
+		CHECK(LD_MATH_ABS(eye.y - 2.0f) < 1e-4f);
+		CHECK(LD_MATH_ABS(eye.z - 1.0f) < 1e-4f);
+	}
+}
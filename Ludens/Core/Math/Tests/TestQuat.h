@@ -7,50 +7,74 @@ using namespace LD;
 
 static bool Equal(float lhs, float rhs)
 {
-    return LD_MATH_ABS(lhs - rhs) <= LD_MATH_TOLERANCE;
+	return LD_MATH_ABS(lhs - rhs) <= LD_MATH_TOLERANCE;
 }
 
 TEST_CASE("Identity")
 {
-    Quat q(Quat::Identity);
+	Quat q(Quat::Identity);
 
-    CHECK(q.IsNormalized());
-    CHECK(q.w == 1.0f);
+	CHECK(q.IsNormalized());
+	CHECK(q.w == 1.0f);
 
-    Vec3 axis;
-    Radians rad;
-    q.GetAxisRadians(axis, rad);
+	Vec3 axis;
+	Radians rad;
+	q.GetAxisRadians(axis, rad);
 
-    CHECK(Equal(rad, 0.0f));
-    CHECK(Equal(axis.x, 0.0f));
-    CHECK(Equal(axis.y, 0.0f));
-    CHECK(Equal(axis.z, 0.0f));
+	CHECK(Equal(rad, 0.0f));
+	CHECK(Equal(axis.x, 0.0f));
+	CHECK(Equal(axis.y, 0.0f));
+	CHECK(Equal(axis.z, 0.0f));
 }
 
 TEST_CASE("Quaternion Axis-Radian")
 {
-    {
-        Vec3 axis(0.0f, 1.0f, 0.0f);
-        Radians rad(LD_MATH_PI / 2.0f);
-        Quat q = Quat::FromAxisRadians(axis, rad);
-
-        q.GetAxisRadians(axis, rad);
-        CHECK(Equal(rad, LD_MATH_PI / 2.0f));
-        CHECK(Equal(axis.x, 0.0f));
-        CHECK(Equal(axis.y, 1.0f));
-        CHECK(Equal(axis.z, 0.0f));
-    }
-
-    {
-        Vec3 axis_ = Vec3(3.14f, 2.71f, 6.67f).Normalized();
-        Vec3 axis;
-        Radians rad(LD_MATH_PI / 8.0f);
-        Quat q = Quat::FromAxisRadians(axis_, rad);
-
-        q.GetAxisRadians(axis, rad);
-        CHECK(Equal(rad, LD_MATH_PI / 8.0f));
-        CHECK(Equal(axis.x, axis_.x));
-        CHECK(Equal(axis.y, axis_.y));
-        CHECK(Equal(axis.z, axis_.z));
-    }
-}
\ No newline at end of file
+	{
+		Vec3 axis(0.0f, 1.0f, 0.0f);
+		Radians rad(LD_MATH_PI / 2.0f);
+		Quat q = Quat::FromAxisRadians(axis, rad);
+
+		q.GetAxisRadians(axis, rad);
+		CHECK(Equal(rad, LD_MATH_PI / 2.0f));
+		CHECK(Equal(axis.x, 0.0f));
+		CHECK(Equal(axis.y, 1.0f));
+		CHECK(Equal(axis.z, 0.0f));
+	}
+
+	{
+		Vec3 axis_ = Vec3(3.14f, 2.71f, 6.67f).Normalized();
+		Vec3 axis;
+		Radians rad(LD_MATH_PI / 8.0f);
+		Quat q = Quat::FromAxisRadians(axis_, rad);
+
+		q.GetAxisRadians(axis, rad);
+		CHECK(Equal(rad, LD_MATH_PI / 8.0f));
+		CHECK(Equal(axis.x, axis_.x));
+		CHECK(Equal(axis.y, axis_.y));
+		CHECK(Equal(axis.z, axis_.z));
+	}
+}
+
+TEST_CASE("Quaternion Multiply")
+{
+	Quat q1 = Quat::FromAxisRadians(Vec3(1.0f, 2.0f, 3.0f).Normalized(), LD_MATH_PI / 3.0f);
+	Quat q2 = Quat::FromAxisRadians(Vec3(-2.0f, 0.5f, 1.0f).Normalized(), LD_MATH_PI / 5.0f);
+
+	// float quaternions may take the SIMD path, double quaternions always use the scalar template
+	Quat q = q1 * q2;
+	TQuat<double> d = TQuat<double>(q1.x, q1.y, q1.z, q1.w) * TQuat<double>(q2.x, q2.y, q2.z, q2.w);
+
+	CHECK(Equal(q.x, (float)d.x));
+	CHECK(Equal(q.y, (float)d.y));
+	CHECK(Equal(q.z, (float)d.z));
+	CHECK(Equal(q.w, (float)d.w));
+
+	// rotating by the product equals rotating by each in turn
+	Vec3 v(0.3f, -1.0f, 2.0f);
+	Vec3 v1 = q * v;
+	Vec3 v2 = q1 * (q2 * v);
+
+	CHECK(Equal(v1.x, v2.x));
+	CHECK(Equal(v1.y, v2.y));
+	CHECK(Equal(v1.z, v2.z));
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <doctest.h>
+#include <vector>
+#include "Core/Math/Include/Stream.h"
+
+using namespace LD;
+
+// an odd element count exercises the padded tail of each component array
+#define STREAM_TEST_SIZE 37
+
+static bool Vec3Near(const Vec3& lhs, const Vec3& rhs, float tolerance = 1e-3f)
+{
+	return LD_MATH_ABS(lhs.x - rhs.x) <= tolerance && LD_MATH_ABS(lhs.y - rhs.y) <= tolerance &&
+	       LD_MATH_ABS(lhs.z - rhs.z) <= tolerance;
+}
+
+static Vec3 StreamTransformPoint(const Mat4& mat, const Vec3& point)
+{
+	Vec4 p = mat * Vec4(point, 1.0f);
+	return Vec3(p.x, p.y, p.z);
+}
+
+static Mat4Stream StreamSampleMats()
+{
+	Mat4Stream mats;
+	mats.Resize(STREAM_TEST_SIZE);
+
+	for (int i = 0; i < STREAM_TEST_SIZE; i++)
+		mats.Set(i, Mat4Sample(i));
+
+	return mats;
+}
+
+TEST_CASE("Stream Resize")
+{
+	Vec3Stream points;
+	CHECK(points.Size() == 0);
+
+	points.Resize(3);
+	CHECK(points.Size() == 3);
+	CHECK(points.PaddedSize() % LD_MATH_STREAM_PADDING == 0);
+	CHECK(points.Get(2) == Vec3());
+
+	points.Set(0, Vec3(1.0f, 2.0f, 3.0f));
+	points.Set(2, Vec3(4.0f, 5.0f, 6.0f));
+	points.Resize(STREAM_TEST_SIZE);
+	CHECK(points.Get(0) == Vec3(1.0f, 2.0f, 3.0f));
+	CHECK(points.Get(2) == Vec3(4.0f, 5.0f, 6.0f));
+	CHECK(points.Get(STREAM_TEST_SIZE - 1) == Vec3());
+
+	// growing within the same padded size zeroes the new elements
+	points.Resize(1);
+	points.Resize(3);
+	CHECK(points.Get(0) == Vec3(1.0f, 2.0f, 3.0f));
+	CHECK(points.Get(2) == Vec3());
+}
+
+TEST_CASE("Stream Transform Points")
+{
+	Mat4 mat = Mat4Sample(3);
+	Mat4Stream mats = StreamSampleMats();
+	Vec3Stream points, out;
+	points.Resize(STREAM_TEST_SIZE);
+
+	for (int i = 0; i < STREAM_TEST_SIZE; i++)
+		points.Set(i, Vec3((float)i, 1.0f - i, 0.5f * i));
+
+	Vec3Stream::Transform(mat, points, out);
+	REQUIRE(out.Size() == points.Size());
+
+	for (int i = 0; i < STREAM_TEST_SIZE; i++)
+		CHECK(Vec3Near(out.Get(i), StreamTransformPoint(mat, points.Get(i))));
+
+	Vec3Stream::Transform(mats, points, out);
+
+	for (int i = 0; i < STREAM_TEST_SIZE; i++)
+		CHECK(Vec3Near(out.Get(i), StreamTransformPoint(mats.Get(i), points.Get(i))));
+
+	// in place
+	Vec3Stream::Transform(mats, points, points);
+
+	for (int i = 0; i < STREAM_TEST_SIZE; i++)
+		CHECK(points.Get(i) == out.Get(i));
+}
+
+TEST_CASE("Stream Multiply Mat4")
+{
+	Mat4 view = Mat4::LookAt(Vec3(3.0f, 4.0f, 5.0f), Vec3(-3.0f, -4.0f, -5.0f), Vec3(0.0f, 1.0f, 0.0f));
+	Mat4Stream mats = StreamSampleMats();
+	Mat4Stream out;
+
+	Mat4Stream::Multiply(view, mats, out);
+
+	for (int i = 0; i < STREAM_TEST_SIZE; i++)
+		CHECK(Mat4Equal(out.Get(i), Mat4ToDouble(view) * Mat4ToDouble(mats.Get(i))));
+
+	Mat4Stream::Multiply(view, mats, mats);
+
+	for (int i = 0; i < STREAM_TEST_SIZE; i++)
+		CHECK(Mat4Equal(mats.Get(i), Mat4ToDouble(out.Get(i)), 0.0));
+}
+
+TEST_CASE("Stream Quat To Mat4")
+{
+	QuatStream quats;
+	Mat4Stream out;
+	quats.Resize(STREAM_TEST_SIZE);
+
+	for (int i = 0; i < STREAM_TEST_SIZE; i++)
+		quats.Set(i, Quat::FromAxisRadians(Vec3(1.0f, (float)i, 2.0f).Normalized(), 0.1f * i));
+
+	Mat4Stream::FromQuats(quats, out);
+
+	for (int i = 0; i < STREAM_TEST_SIZE; i++)
+	{
+		Mat4 expected;
+		quats.Get(i).GetMat4(expected);
+		CHECK(Mat4Equal(out.Get(i), Mat4ToDouble(expected)));
+	}
+	// the kernel writes the padding lanes, elements added by Resize are still zero
+	out.Resize(STREAM_TEST_SIZE + 1);
+	CHECK(Mat4Equal(out.Get(STREAM_TEST_SIZE), Mat4ToDouble(Mat4::Zero), 0.0));
+}
+
+TEST_CASE("Stream Transform AABB")
+{
+	Mat4Stream mats = StreamSampleMats();
+	AABBStream boxes, out;
+	boxes.Resize(STREAM_TEST_SIZE);
+
+	for (int i = 0; i < STREAM_TEST_SIZE; i++)
+		boxes.Set(i, AABB(Vec3(-1.0f, -2.0f, -0.5f * i), Vec3(1.0f + i, 2.0f, 0.5f)));
+
+	AABBStream::Transform(mats, boxes, out);
+
+	for (int i = 0; i < STREAM_TEST_SIZE; i++)
+	{
+		AABB expected = AABB::Transform(mats.Get(i), boxes.Get(i));
+		CHECK(Vec3Near(out.Get(i).Min, expected.Min));
+		CHECK(Vec3Near(out.Get(i).Max, expected.Max));
+
+		// the transformed corners lie within the transformed box
+		AABB box = boxes.Get(i);
+		for (int corner = 0; corner < 8; corner++)
+		{
+			Vec3 p(corner & 1 ? box.Max.x : box.Min.x, corner & 2 ? box.Max.y : box.Min.y,
+			       corner & 4 ? box.Max.z : box.Min.z);
+			Vec3 q = StreamTransformPoint(mats.Get(i), p);
+			AABB bounds(out.Get(i).Min - 1e-3f, out.Get(i).Max + 1e-3f);
+			CHECK(bounds.Contains(q));
+		}
+	}
+}
+
+TEST_CASE("Stream Frustum Test")
+{
+	Mat4 view = Mat4::LookAt(Vec3(), Vec3(0.0f, 0.0f, -1.0f), Vec3(0.0f, 1.0f, 0.0f));
+	Mat4 proj = Mat4::Perspective(LD_MATH_PI / 2.0f, 1.0f, 0.1f, 100.0f);
+	Frustum frustum = Frustum::FromViewProj(proj * view);
+
+	// unit boxes along a line sweeping from behind the camera to past the far plane
+	AABBStream boxes;
+	boxes.Resize(STREAM_TEST_SIZE);
+
+	for (int i = 0; i < STREAM_TEST_SIZE; i++)
+	{
+		Vec3 center(0.0f, 0.0f, 20.0f - 4.0f * i);
+		boxes.Set(i, AABB(center - 0.5f, center + 0.5f));
+	}
+
+	std::vector<u8> visible(STREAM_TEST_SIZE, 2);
+	AABBStream::FrustumTest(frustum, boxes, visible.data());
+
+	for (int i = 0; i < STREAM_TEST_SIZE; i++)
+	{
+		bool expected = frustum.Intersects(boxes.Get(i));
+		CHECK(visible[i] == (expected ? 1 : 0));
+	}
+
+	CHECK(visible[0] == 0);
+	CHECK(visible[10] == 1);
+	CHECK(visible[STREAM_TEST_SIZE - 1] == 0);
+
+	// boxes to the side of the camera are culled
+	boxes.Set(10, AABB(Vec3(50.0f, -0.5f, -20.5f), Vec3(51.0f, 0.5f, -19.5f)));
+	AABBStream::FrustumTest(frustum, boxes, visible.data());
+	CHECK(visible[10] == 0);
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <utility>
 #include <string>
 #include "Core/Header/Include/Types.h"
@@ -10,6 +11,7 @@
 #include "Core/OS/Include/JobSystem.h"
 #include "Core/OS/Include/Memory.h"
 #include "Core/IO/Include/FileSystem.h"
+#include "Core/IO/Include/AsyncIO.h"
 #include "Core/Media/Include/Mesh.h"
 #include "Core/Media/Include/Image.h"
 
@@ -70,9 +72,15 @@ public:
 
     Ref<Model> LoadModel(const Path& path);
 
+    /// @brief load from file content already in memory
+    /// @param path file path, selects the format and locates referenced files such as textures
+    Ref<Model> LoadModel(const Path& path, const u8* data, size_t size);
+
 private:
 };
 
+/// @brief Loads a model without blocking a worker on disk. The file is read with AsyncIO,
+///        and the read completion submits the decode as a JobType::LoadModel job.
 class LoadModelJob
 {
 public:
@@ -90,11 +98,23 @@ public:
         return mLoadTimeMS;
     }
 
+    inline bool HasCompleted() const
+    {
+        return mHasCompleted;
+    }
+
+    /// @brief from the main thread, block until the model is loaded
+    /// @note JobSystem::WaitType(JobType::LoadModel) alone does not wait for reads in flight
+    void Wait();
+
 private:
+    static void OnRead(const AsyncReadResult& result);
     static void JobMain(void* data);
 
-    bool mHasCompleted = false;
+    std::atomic<bool> mHasCompleted = false;
     double mLoadTimeMS;
+    u8* mData;   // file content owned by the job until decoded
+    size_t mSize;
     Path mPath;
     Ref<Model>* mModel;
     ModelLoader mLoader;
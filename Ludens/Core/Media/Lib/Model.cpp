@@ -1,6 +1,7 @@
 #include <iostream>
 #include "Core/OS/Include/Time.h"
 #include "Core/IO/Include/FileSystem.h"
+#include "Core/IO/Include/AsyncIO.h"
 #include "Core/Media/Include/Model.h"
 #include "Core/Media/Lib/ModelOBJ.h"
 #include "Core/Media/Lib/ModelGLTF.h"
@@ -16,6 +17,18 @@ ModelLoader::~ModelLoader()
 {
 }
 
+static void PrintModelStats(const Path& path, const Model& model, double loadTime)
+{
+    size_t vertices = 0;
+    for (auto& mesh : model.Meshes)
+    {
+        vertices += mesh.first.Vertices.Size();
+    }
+
+    printf("ModelLoader::LoadModel [%s] %d meshes, %d vertices, %.3f ms\n", path.ToString().c_str(),
+           (int)model.Meshes.Size(), (int)vertices, loadTime);
+}
+
 Ref<Model> ModelLoader::LoadModel(const Path& path)
 {
     std::string ext = path.Extension().ToString();
@@ -50,40 +63,94 @@ Ref<Model> ModelLoader::LoadModel(const Path& path)
     }
 
     timer.Stop();
-    double loadTime = timer.GetMilliSeconds();
+    PrintModelStats(path, *model, timer.GetMilliSeconds());
 
-    size_t vertices = 0;
-    for (auto& mesh : model->Meshes)
+    return model;
+}
+
+Ref<Model> ModelLoader::LoadModel(const Path& path, const u8* data, size_t size)
+{
+    std::string ext = path.Extension().ToString();
+
+    Ref<Model> model = MakeRef<Model>();
+
+    Timer timer{};
+    timer.Start();
+
+    if (ext == ".obj")
     {
-        vertices += mesh.first.Vertices.Size();
+        LoadModelOBJ(path, data, size, *model);
+    }
+    else if (ext == ".gltf")
+    {
+        LoadModelGLTFAscii(path, data, size, *model);
+    }
+    else if (ext == ".glb")
+    {
+        LoadModelGLTFBinary(path, data, size, *model);
+    }
+    else
+    {
+        // TODO: error handling
+        LD_DEBUG_UNREACHABLE;
     }
 
-    printf("ModelLoader::LoadModel [%s] %d meshes, %d vertices, %.3f ms\n", path.ToString().c_str(),
-           (int)model->Meshes.Size(), (int)vertices, loadTime);
+    timer.Stop();
+    PrintModelStats(path, *model, timer.GetMilliSeconds());
 
     return model;
 }
 
-LoadModelJob::LoadModelJob(const Path& path, Ref<Model>* model) : mPath(path), mModel(model), mLoadTimeMS(-1.0)
+LoadModelJob::LoadModelJob(const Path& path, Ref<Model>* model)
+    : mLoadTimeMS(-1.0), mData(nullptr), mSize(0), mPath(path), mModel(model)
 {
-    Job LoadModelJob;
-    LoadModelJob.Data = this;
-    LoadModelJob.Main = &LoadModelJob::JobMain;
-    LoadModelJob.Type = JobType::LoadModel;
+    AsyncReadRequest request;
+    request.FilePath = path;
+    request.Callback = &LoadModelJob::OnRead;
+    request.User = this;
+
+    AsyncIO::GetSingleton().Read(request);
+}
 
-    JobSystem::GetSingleton().Submit(LoadModelJob);
+void LoadModelJob::Wait()
+{
+    // the decode job is only submitted once the read completes
+    AsyncIO::GetSingleton().WaitIdle();
+    JobSystem::GetSingleton().WaitType(JobType::LoadModel);
+}
+
+void LoadModelJob::OnRead(const AsyncReadResult& result)
+{
+    LoadModelJob& job = *static_cast<LoadModelJob*>(result.User);
+    job.mData = result.Data;
+    job.mSize = result.Size;
+
+    // runs on an I/O thread, decoding is CPU bound and belongs on a worker
+    Job decodeJob;
+    decodeJob.Data = &job;
+    decodeJob.Main = &LoadModelJob::JobMain;
+    decodeJob.Type = JobType::LoadModel;
+
+    JobSystem::GetSingleton().Submit(decodeJob);
 }
 
 void LoadModelJob::JobMain(void* data)
 {
     LoadModelJob& job = *static_cast<LoadModelJob*>(data);
 
-    job.mHasCompleted = false;
     {
         ScopeTimer timer(&job.mLoadTimeMS);
-        *job.mModel = job.mLoader.LoadModel(job.mPath);
+
+        if (job.mData)
+        {
+            *job.mModel = job.mLoader.LoadModel(job.mPath, job.mData, job.mSize);
+            MemoryFree(job.mData);
+            job.mData = nullptr;
+        }
+        else
+            *job.mModel = nullptr;
     }
     job.mHasCompleted = true;
 }
 
-} // namespace LD
\ No newline at end of file
+} // namespace LD
@@ -170,6 +170,46 @@ void LoadModelGLTFBinary(const Path& path, Model& model)
     ctx.ImportModel(model);
 }
 
+void LoadModelGLTFAscii(const Path& path, const u8* data, size_t size, Model& model)
+{
+    TinyGLTFContext ctx;
+
+    std::string err, warn;
+    std::string baseDir = static_cast<const std::filesystem::path&>(path).parent_path().string();
+
+    bool ok = ctx.Parser.LoadASCIIFromString(&ctx.GLTF, &err, &warn, (const char*)data, (unsigned int)size, baseDir);
+
+    if (!err.empty())
+        std::cout << "TinyGLTF::LoadASCIIFromString error: " << err << std::endl;
+
+    if (!warn.empty())
+        std::cout << "TinyGLTF::LoadASCIIFromString warning: " << warn << std::endl;
+
+    // TODO: error handling
+    LD_DEBUG_ASSERT(ok);
+}
+
+void LoadModelGLTFBinary(const Path& path, const u8* data, size_t size, Model& model)
+{
+    TinyGLTFContext ctx;
+
+    std::string err, warn;
+    std::string baseDir = static_cast<const std::filesystem::path&>(path).parent_path().string();
+
+    bool ok = ctx.Parser.LoadBinaryFromMemory(&ctx.GLTF, &err, &warn, data, (unsigned int)size, baseDir);
+
+    if (!err.empty())
+        std::cout << "TinyGLTF::LoadBinaryFromMemory error: " << err << std::endl;
+
+    if (!warn.empty())
+        std::cout << "TinyGLTF::LoadBinaryFromMemory warning: " << warn << std::endl;
+
+    // TODO: error handling
+    LD_DEBUG_ASSERT(ok);
+
+    ctx.ImportModel(model);
+}
+
 void Dump(const tinygltf::Model& model, String& str)
 {
     str << "asset_copyright: " << model.asset.copyright << '\n';
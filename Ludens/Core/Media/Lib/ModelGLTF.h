@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include "Core/Header/Include/Types.h"
+
 namespace LD
 {
 
@@ -9,4 +12,8 @@ class Model;
 void LoadModelGLTFAscii(const Path& path, Model& model);
 void LoadModelGLTFBinary(const Path& path, Model& model);
 
+/// load from file content already in memory, path locates external buffers and images
+void LoadModelGLTFAscii(const Path& path, const u8* data, size_t size, Model& model);
+void LoadModelGLTFBinary(const Path& path, const u8* data, size_t size, Model& model);
+
 } // namespace LD
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <istream>
 #include <tiny_obj_loader.h>
 #include <unordered_map>
 #include "Core/Math/Include/Hex.h"
@@ -19,6 +20,7 @@ struct TinyObjContext
     std::vector<tinyobj::material_t> Materials;
     std::unordered_map<int, int> MaterialRefMap;
     int FallbackMaterialIdx;
+    std::istream* Stream = nullptr; // OBJ text in memory, FilePath is read if null
 
     void ParseModel();
     void ParseShape(int obj_shape_idx);
@@ -32,8 +34,18 @@ void TinyObjContext::ParseModel()
     std::string warn, err;
 
     bool triangulate = true;
-    bool success = tinyobj::LoadObj(&Attrib, &Shapes, &Materials, &warn, &err, FilePath.c_str(), DirectoryPath.c_str(),
-                                    triangulate);
+    bool success;
+
+    if (Stream)
+    {
+        tinyobj::MaterialFileReader mtlReader(DirectoryPath);
+        success = tinyobj::LoadObj(&Attrib, &Shapes, &Materials, &warn, &err, Stream, &mtlReader, triangulate);
+    }
+    else
+    {
+        success = tinyobj::LoadObj(&Attrib, &Shapes, &Materials, &warn, &err, FilePath.c_str(), DirectoryPath.c_str(),
+                                   triangulate);
+    }
 
     if (!warn.empty())
         std::cout << warn << std::endl;
@@ -254,4 +266,30 @@ void LoadModelOBJ(const Path& path, Model& model)
     obj.ParseModel();
 }
 
+/// read only stream buffer over bytes in memory, avoids copying the OBJ text into a stringstream
+struct MemoryStreamBuf : std::streambuf
+{
+    MemoryStreamBuf(const u8* data, size_t size)
+    {
+        char* begin = (char*)data;
+        setg(begin, begin, begin + size);
+    }
+};
+
+void LoadModelOBJ(const Path& path, const u8* data, size_t size, Model& model)
+{
+    const auto& fs_path = static_cast<const std::filesystem::path&>(path);
+
+    MemoryStreamBuf buf(data, size);
+    std::istream stream(&buf);
+
+    TinyObjContext obj{};
+    obj.Target = &model;
+    obj.DirectoryPath = fs_path.parent_path().string() + "/";
+    obj.FilePath = fs_path.string();
+    obj.FallbackMaterialIdx = -1;
+    obj.Stream = &stream;
+    obj.ParseModel();
+}
+
 } // namespace LD
\ No newline at end of file
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include "Core/Header/Include/Types.h"
+
 namespace LD
 {
 
@@ -8,4 +11,7 @@ class Model;
 
 void LoadModelOBJ(const Path& path, Model& model);
 
+/// load from OBJ text already in memory, path locates the MTL files and textures
+void LoadModelOBJ(const Path& path, const u8* data, size_t size, Model& model);
+
 } // namespace LD
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include "Core/OS/Include/Mutex.h"
+#include "Core/OS/Include/Time.h"
+
+using namespace LD;
+
+// number of lock-increment-unlock operations per thread
+#define CONTENTION_ITERATIONS 1000000
+
+// work done while holding the lock, short critical sections like the job queues
+#define CONTENTION_CRITICAL_WORK 8
+
+template <typename TMutex>
+static double BenchContention(int threadCount)
+{
+    TMutex mutex;
+    volatile size_t counter = 0;
+    double time;
+
+    {
+        ScopeTimer timer(&time);
+        std::vector<std::thread> threads;
+
+        for (int t = 0; t < threadCount; t++)
+        {
+            threads.emplace_back([&]() {
+                for (int i = 0; i < CONTENTION_ITERATIONS; i++)
+                {
+                    mutex.lock();
+                    for (int w = 0; w < CONTENTION_CRITICAL_WORK; w++)
+                        counter = counter + 1;
+                    mutex.unlock();
+                }
+            });
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+
+    if (counter != (size_t)threadCount * CONTENTION_ITERATIONS * CONTENTION_CRITICAL_WORK)
+        std::cout << "counter mismatch " << counter << std::endl;
+
+    return time;
+}
+
+// adapts LD::Mutex to the interface used by BenchContention
+struct LDMutex
+{
+    Mutex Handle;
+
+    inline void lock()
+    {
+        Handle.Lock();
+    }
+
+    inline void unlock()
+    {
+        Handle.Unlock();
+    }
+};
+
+// compare Mutex against std::mutex under increasing contention
+static void BenchMutex()
+{
+    int maxThreads = (int)std::thread::hardware_concurrency();
+    if (maxThreads < 1)
+        maxThreads = 1;
+
+    for (int threadCount = 1; threadCount <= 2 * maxThreads; threadCount *= 2)
+    {
+        double timeMutex = BenchContention<LDMutex>(threadCount);
+        double timeStdMutex = BenchContention<std::mutex>(threadCount);
+
+        std::cout << "Threads " << threadCount << std::endl;
+        std::cout << "LD  Mutex " << timeMutex << std::endl;
+        std::cout << "STD Mutex " << timeStdMutex << std::endl;
+    }
+}
+
+int main()
+{
+    BenchMutex();
+}
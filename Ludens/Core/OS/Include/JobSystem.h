@@ -15,7 +15,11 @@ enum class JobType
     Misc = 0,
     Physics = 1,
     LoadModel = 2,
-    NUM_TYPES = 3,
+    CompilePipeline = 3,
+    RecordCommands = 4,
+    CompileDocument = 5,
+    LightCulling = 6,
+    NUM_TYPES = 7,
 };
 
 struct Job
@@ -7,6 +7,13 @@ namespace LD
 
 typedef int (*ThreadFunction)(int tid, void* userdata);
 
+enum class ThreadPriority
+{
+    Low = 0,
+    Normal,
+    High,
+};
+
 class Thread
 {
 public:
@@ -27,6 +34,16 @@ public:
     /// get OS assigned thread ID 
     int GetID();
 
+    /// set the thread name shown in debuggers and profilers, Linux truncates it to 15 characters
+    bool SetName(const char* name);
+
+    /// pin the running thread to a single logical CPU
+    bool SetAffinity(int cpu);
+
+    /// adjust the scheduling priority of the running thread,
+    /// on Linux raising above Normal requires CAP_SYS_NICE and fails otherwise
+    bool SetPriority(ThreadPriority priority);
+
 private:
     struct ThreadImpl* mImpl;
     alignas(16) u8 mImplData[128];
@@ -6,6 +6,8 @@
 
 #ifdef LD_PLATFORM_WIN32
 # include <Windows.h>
+#elif defined(LD_PLATFORM_LINUX)
+# include "Core/OS/Lib/Futex.h"
 #else
 # error "not implemented yet"
 #endif
@@ -17,6 +19,12 @@ struct ConditionVariableImpl
 {
 #ifdef LD_PLATFORM_WIN32
     CONDITION_VARIABLE CV;
+#elif defined(LD_PLATFORM_LINUX)
+    /// bumped on every signal, waiters park until it changes
+    std::atomic<u32> Sequence;
+
+    /// number of threads inside Wait, signals skip the syscall if there are none
+    std::atomic<u32> Waiters;
 #endif
 };
 
@@ -29,6 +37,9 @@ ConditionVariable::ConditionVariable()
 
 #ifdef LD_PLATFORM_WIN32
     InitializeConditionVariable(&mImpl->CV);
+#elif defined(LD_PLATFORM_LINUX)
+    mImpl->Sequence.store(0, std::memory_order_relaxed);
+    mImpl->Waiters.store(0, std::memory_order_relaxed);
 #endif
 }
 
@@ -36,6 +47,8 @@ ConditionVariable::~ConditionVariable()
 {
 #ifdef LD_PLATFORM_WIN32
     // NOP
+#elif defined(LD_PLATFORM_LINUX)
+    LD_DEBUG_ASSERT(mImpl->Waiters.load(std::memory_order_relaxed) == 0);
 #endif
     
     mImpl->~ConditionVariableImpl();
@@ -45,6 +58,16 @@ void ConditionVariable::Wait(Mutex& mutex)
 {
 #ifdef LD_PLATFORM_WIN32
     SleepConditionVariableCS(&mImpl->CV, (CRITICAL_SECTION*)mutex.GetNativeHandle(), INFINITE);
+#elif defined(LD_PLATFORM_LINUX)
+    // The sequence is sampled while the mutex is still held, a signal issued after we
+    // unlock changes the sequence and the futex wait returns immediately instead of being lost.
+    mImpl->Waiters.fetch_add(1, std::memory_order_seq_cst);
+    u32 sequence = mImpl->Sequence.load(std::memory_order_seq_cst);
+
+    mutex.Unlock();
+    FutexWait(&mImpl->Sequence, sequence);
+    mImpl->Waiters.fetch_sub(1, std::memory_order_relaxed);
+    mutex.Lock();
 #endif
 }
 
@@ -52,6 +75,11 @@ void ConditionVariable::SignalOne()
 {
 #ifdef LD_PLATFORM_WIN32
     WakeConditionVariable(&mImpl->CV);
+#elif defined(LD_PLATFORM_LINUX)
+    mImpl->Sequence.fetch_add(1, std::memory_order_seq_cst);
+
+    if (mImpl->Waiters.load(std::memory_order_seq_cst) > 0)
+        FutexWake(&mImpl->Sequence, 1);
 #endif
 }
 
@@ -59,7 +87,12 @@ void ConditionVariable::SignalAll()
 {
 #ifdef LD_PLATFORM_WIN32
     WakeAllConditionVariable(&mImpl->CV);
+#elif defined(LD_PLATFORM_LINUX)
+    mImpl->Sequence.fetch_add(1, std::memory_order_seq_cst);
+
+    if (mImpl->Waiters.load(std::memory_order_seq_cst) > 0)
+        FutexWakeAll(&mImpl->Sequence);
 #endif
 }
 
-} // namespace LD
\ No newline at end of file
+} // namespace LD
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Core/Header/Include/Platform.h"
+#include "Core/Header/Include/Types.h"
+#include "Core/Header/Include/Error.h"
+
+#ifdef LD_PLATFORM_LINUX
+# include <atomic>
+# include <climits>
+# include <linux/futex.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+
+namespace LD
+{
+
+LD_STATIC_ASSERT(sizeof(std::atomic<u32>) == sizeof(u32));
+
+/// block while the 32-bit word still holds the expected value, may return spuriously
+inline void FutexWait(std::atomic<u32>* word, u32 expected)
+{
+    syscall(SYS_futex, reinterpret_cast<u32*>(word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+}
+
+/// wake up to count threads blocked on the 32-bit word
+inline void FutexWake(std::atomic<u32>* word, int count)
+{
+    syscall(SYS_futex, reinterpret_cast<u32*>(word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+}
+
+/// wake all threads blocked on the 32-bit word
+inline void FutexWakeAll(std::atomic<u32>* word)
+{
+    FutexWake(word, INT_MAX);
+}
+
+/// hint to the CPU that we are inside a spin loop
+inline void SpinPause()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+} // namespace LD
+
+#endif // LD_PLATFORM_LINUX
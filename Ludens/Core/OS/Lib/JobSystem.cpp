@@ -1,6 +1,8 @@
 #include <thread>
+#include <cstdio>
 #include <iostream>
 #include "Core/DSA/Include/Optional.h"
+#include "Core/DSA/Include/MPMCQueue.h"
 #include "Core/OS/Include/JobSystem.h"
 #include "Core/OS/Include/Mutex.h"
 
@@ -9,59 +11,8 @@
 namespace LD
 {
 
-/// thread safe ring buffer to store Job info
-class JobQueue
-{
-public:
-    inline bool Enqueue(const Job& job)
-    {
-        bool success = false;
-        mMutex.Lock();
-
-        LD_DEBUG_ASSERT(job.Main);
-
-        size_t next = (mHead + 1) % JOB_QUEUE_CAPACITY;
-        if (next != mTail)
-        {
-            mArray[mHead] = job;
-            mHead = next;
-            mSize.fetch_add(1);
-            success = true;
-        }
-
-        mMutex.Unlock();
-        return success;
-    }
-
-    inline bool Dequeue(Job& job)
-    {
-        bool success = false;
-        mMutex.Lock();
-
-        if (mHead != mTail)
-        {
-            job = mArray[mTail];
-            mTail = (mTail + 1) % JOB_QUEUE_CAPACITY;
-            mSize.fetch_sub(1);
-            success = true;
-        }
-
-        mMutex.Unlock();
-        return success;
-    }
-
-    inline size_t GetSize()
-    {
-        return mSize;
-    }
-
-private:
-    std::atomic<size_t> mSize;
-    size_t mHead;
-    size_t mTail;
-    Mutex mMutex;
-    Job mArray[JOB_QUEUE_CAPACITY];
-};
+/// lock-free ring buffer to store Job info, one per job type
+using JobQueue = MPMCQueue<Job, JOB_QUEUE_CAPACITY>;
 
 static ConditionVariable sJobPending;
 static JobQueue sJobQueues[(int)JobType::NUM_TYPES];
@@ -78,13 +29,13 @@ static bool AcquireJob(Job& job)
     size_t numTypes = (size_t)JobType::NUM_TYPES;
 
     if (sUsePriorityIdx)
-        return sJobQueues[sJobQueuePriorityIdx].Dequeue(job);
+        return sJobQueues[sJobQueuePriorityIdx].TryDequeue(job);
 
     size_t idx = sJobQueueIdx.fetch_add(1) % numTypes;
 
     for (int i = 0; i < numTypes; i++)
     {
-        if (sJobQueues[(idx + i) % numTypes].Dequeue(job))
+        if (sJobQueues[(idx + i) % numTypes].TryDequeue(job))
             return true;
     }
 
@@ -138,9 +89,18 @@ JobSystem::JobSystem()
     sIsAlive = true;
     mThreads.Resize(mWorkerThreadCount);
 
-    for (JobThread& thread : mThreads)
+    for (int i = 0; i < mWorkerThreadCount; i++)
     {
+        JobThread& thread = mThreads[i];
         thread.Run(&JobThreadEntry, (void*)&thread);
+
+        char name[16];
+        snprintf(name, sizeof(name), "LDJob%d", i);
+        thread.SetName(name);
+
+        // logical CPU 0 is left to the main thread, pinning keeps worker caches warm
+        // across jobs; failures such as a restricted cpuset are not fatal
+        thread.SetAffinity(i + 1);
     }
 
     std::this_thread::sleep_for(std::chrono::microseconds(100));
@@ -176,10 +136,13 @@ void JobSystem::Submit(const Job& job)
 
     auto& queue = sJobQueues[(size_t)job.Type];
 
-    while (!queue.Enqueue(job))
+    while (!queue.TryEnqueue(job))
     {
         sJobPending.SignalOne();
     }
+
+    // wake up an idle worker so the job starts before the next Wait call
+    sJobPending.SignalOne();
 }
 
 void JobSystem::WaitType(JobType type)
@@ -190,7 +153,7 @@ void JobSystem::WaitType(JobType type)
     sUsePriorityIdx = true;
     sJobQueuePriorityIdx = (size_t)type;
 
-    while (sJobQueues[(size_t)type].GetSize() > 0)
+    while (sJobQueues[(size_t)type].Size() > 0)
     {
         sJobPending.SignalOne();
     }
@@ -227,7 +190,7 @@ void JobSystem::WaitAll()
 
         for (size_t i = 0; i < (size_t)JobType::NUM_TYPES; i++)
         {
-            if (sJobQueues[i].GetSize() > 0)
+            if (sJobQueues[i].Size() > 0)
             {
                 allQueuesEmpty = false;
                 sJobPending.SignalOne();
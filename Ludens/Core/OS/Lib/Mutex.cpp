@@ -1,14 +1,20 @@
 #include <memory>
+#include <algorithm>
 #include "Core/OS/Include/Mutex.h"
 #include "Core/Header/Include/Platform.h"
 #include "Core/Header/Include/Error.h"
 
 #ifdef LD_PLATFORM_WIN32
 # include <windows.h>
+#elif defined(LD_PLATFORM_LINUX)
+# include "Core/OS/Lib/Futex.h"
 #else
 # error "not implemented yet"
 #endif
 
+// upper bound of spin iterations before a contended Lock parks the thread
+#define MUTEX_SPIN_LIMIT 100
+
 namespace LD
 {
 
@@ -16,6 +22,12 @@ struct MutexImpl
 {
 #ifdef LD_PLATFORM_WIN32
     CRITICAL_SECTION CS;
+#elif defined(LD_PLATFORM_LINUX)
+    /// 0: unlocked, 1: locked, 2: locked and there may be parked threads
+    std::atomic<u32> State;
+
+    /// running average of spin iterations needed to acquire the lock
+    std::atomic<i32> SpinCount;
 #endif
 };
 
@@ -28,6 +40,9 @@ Mutex::Mutex()
 
 #ifdef LD_PLATFORM_WIN32
     InitializeCriticalSection(&mImpl->CS);
+#elif defined(LD_PLATFORM_LINUX)
+    mImpl->State.store(0, std::memory_order_relaxed);
+    mImpl->SpinCount.store(0, std::memory_order_relaxed);
 #endif
 }
 
@@ -35,6 +50,8 @@ Mutex::~Mutex()
 {
 #ifdef LD_PLATFORM_WIN32
     DeleteCriticalSection(&mImpl->CS);
+#elif defined(LD_PLATFORM_LINUX)
+    LD_DEBUG_ASSERT(mImpl->State.load(std::memory_order_relaxed) == 0);
 #endif
 
     mImpl->~MutexImpl();
@@ -44,6 +61,42 @@ void Mutex::Lock()
 {
 #ifdef LD_PLATFORM_WIN32
     EnterCriticalSection(&mImpl->CS);
+#elif defined(LD_PLATFORM_LINUX)
+    u32 state = 0;
+
+    if (mImpl->State.compare_exchange_strong(state, 1, std::memory_order_acquire, std::memory_order_relaxed))
+        return;
+
+    // Adaptive spinning: critical sections in the engine are short, so a contended lock is
+    // usually released within a few hundred cycles. Spin for about twice the recent average
+    // before paying for a futex syscall, the average shrinks again if spinning stops paying off.
+    i32 spinCount = mImpl->SpinCount.load(std::memory_order_relaxed);
+    i32 maxSpin = std::min(MUTEX_SPIN_LIMIT, spinCount * 2 + 10);
+
+    for (i32 spin = 0; spin < maxSpin; spin++)
+    {
+        SpinPause();
+
+        state = mImpl->State.load(std::memory_order_relaxed);
+        if (state == 0 && mImpl->State.compare_exchange_weak(state, 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            mImpl->SpinCount.store(spinCount + (spin - spinCount) / 8, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    mImpl->SpinCount.store(spinCount + (maxSpin - spinCount) / 8, std::memory_order_relaxed);
+
+    // Park: mark the lock as contended so that the owner wakes us up on Unlock.
+    // We may not know whether other threads are still parked, so we keep the contended state
+    // once we acquire the lock, costing at most one spurious wake up.
+    state = mImpl->State.exchange(2, std::memory_order_acquire);
+
+    while (state != 0)
+    {
+        FutexWait(&mImpl->State, 2);
+        state = mImpl->State.exchange(2, std::memory_order_acquire);
+    }
 #endif
 }
 
@@ -51,6 +104,12 @@ void Mutex::Unlock()
 {
 #ifdef LD_PLATFORM_WIN32
     LeaveCriticalSection(&mImpl->CS);
+#elif defined(LD_PLATFORM_LINUX)
+    LD_DEBUG_ASSERT(mImpl->State.load(std::memory_order_relaxed) != 0);
+
+    // only pay for the syscall if some thread has parked
+    if (mImpl->State.exchange(0, std::memory_order_release) == 2)
+        FutexWake(&mImpl->State, 1);
 #endif
 }
 
@@ -58,7 +117,9 @@ void* Mutex::GetNativeHandle()
 {
 #ifdef LD_PLATFORM_WIN32
     return (void*)&mImpl->CS;
+#elif defined(LD_PLATFORM_LINUX)
+    return (void*)&mImpl->State;
 #endif
 }
 
-} // namespace LD
\ No newline at end of file
+} // namespace LD
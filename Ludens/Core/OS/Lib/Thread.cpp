@@ -7,6 +7,12 @@
 #ifdef LD_PLATFORM_WIN32
 #include <windows.h>
 #include <process.h>
+#elif defined(LD_PLATFORM_LINUX)
+#include <cstring>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include "Core/OS/Lib/Futex.h"
 #else
 #error "not implemented"
 #endif
@@ -23,6 +29,11 @@ struct ThreadImpl
     void* UserData;
 #ifdef LD_PLATFORM_WIN32
     HANDLE Handle;
+#elif defined(LD_PLATFORM_LINUX)
+    pthread_t Handle;
+
+    /// set by the new thread once ID is valid
+    std::atomic<u32> HasID;
 #endif
 };
 
@@ -33,6 +44,20 @@ static DWORD WINAPI ThreadFunctionImpl(void* arg)
 
     return (DWORD)impl->Entry(impl->ID, impl->UserData);
 }
+#elif defined(LD_PLATFORM_LINUX)
+static void* ThreadFunctionImpl(void* arg)
+{
+    ThreadImpl* impl = (ThreadImpl*)arg;
+
+    // the kernel thread ID is only observable from the thread itself
+    impl->ID = (int)syscall(SYS_gettid);
+    impl->HasID.store(1, std::memory_order_release);
+    FutexWakeAll(&impl->HasID);
+
+    impl->ExitCode = impl->Entry(impl->ID, impl->UserData);
+
+    return nullptr;
+}
 #endif
 
 Thread::Thread()
@@ -47,6 +72,8 @@ Thread::Thread()
     mImpl->Entry = nullptr;
 #ifdef LD_PLATFORM_WIN32
     mImpl->Handle = INVALID_HANDLE_VALUE;
+#elif defined(LD_PLATFORM_LINUX)
+    mImpl->HasID.store(0, std::memory_order_relaxed);
 #endif
 }
 
@@ -77,6 +104,19 @@ void Thread::Run(ThreadFunction entry, void* userdata)
         std::cerr << "Win32 GetThreadID failed: GetLastError() = " << GetLastError() << std::endl;
         return;
     }
+#elif defined(LD_PLATFORM_LINUX)
+    mImpl->HasID.store(0, std::memory_order_relaxed);
+
+    int error = pthread_create(&mImpl->Handle, nullptr, ThreadFunctionImpl, mImpl);
+    if (error != 0)
+    {
+        std::cerr << "Linux pthread_create failed: " << strerror(error) << std::endl;
+        return;
+    }
+
+    // block until the new thread publishes its ID, so GetID and the setters below are valid after Run
+    while (mImpl->HasID.load(std::memory_order_acquire) == 0)
+        FutexWait(&mImpl->HasID, 0);
 #endif
 
     mImpl->IsRunning = true;
@@ -94,6 +134,8 @@ void Thread::Stop()
     GetExitCodeThread(mImpl->Handle, (DWORD*)&mImpl->ExitCode);
     CloseHandle(mImpl->Handle);
     mImpl->Handle = INVALID_HANDLE_VALUE;
+#elif defined(LD_PLATFORM_LINUX)
+    pthread_join(mImpl->Handle, nullptr);
 #endif
 
     mImpl->IsRunning = false;
@@ -111,5 +153,87 @@ int Thread::GetID()
     return mImpl->ID;
 }
 
+bool Thread::SetName(const char* name)
+{
+    LD_DEBUG_ASSERT(mImpl->IsRunning && name);
+
+#ifdef LD_PLATFORM_WIN32
+    wchar_t wname[64];
+    if (MultiByteToWideChar(CP_UTF8, 0, name, -1, wname, 64) == 0)
+        return false;
+
+    return SUCCEEDED(SetThreadDescription(mImpl->Handle, wname));
+#elif defined(LD_PLATFORM_LINUX)
+    // the kernel limits names to 16 bytes including the null terminator
+    char shortName[16];
+    strncpy(shortName, name, sizeof(shortName) - 1);
+    shortName[sizeof(shortName) - 1] = '\0';
+
+    return pthread_setname_np(mImpl->Handle, shortName) == 0;
+#endif
+}
+
+bool Thread::SetAffinity(int cpu)
+{
+    LD_DEBUG_ASSERT(mImpl->IsRunning && cpu >= 0);
+
+#ifdef LD_PLATFORM_WIN32
+    if (cpu >= 64)
+        return false;
+
+    return SetThreadAffinityMask(mImpl->Handle, (DWORD_PTR)1 << cpu) != 0;
+#elif defined(LD_PLATFORM_LINUX)
+    if (cpu >= CPU_SETSIZE)
+        return false;
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu, &cpuSet);
+
+    // fails with EINVAL if the CPU is outside of the cpuset the process is allowed to run on
+    return pthread_setaffinity_np(mImpl->Handle, sizeof(cpuSet), &cpuSet) == 0;
+#endif
+}
+
+bool Thread::SetPriority(ThreadPriority priority)
+{
+    LD_DEBUG_ASSERT(mImpl->IsRunning);
+
+#ifdef LD_PLATFORM_WIN32
+    int winPriority = THREAD_PRIORITY_NORMAL;
+
+    switch (priority)
+    {
+    case ThreadPriority::Low:
+        winPriority = THREAD_PRIORITY_BELOW_NORMAL;
+        break;
+    case ThreadPriority::High:
+        winPriority = THREAD_PRIORITY_ABOVE_NORMAL;
+        break;
+    default:
+        break;
+    }
+
+    return SetThreadPriority(mImpl->Handle, winPriority) != 0;
+#elif defined(LD_PLATFORM_LINUX)
+    // Under SCHED_OTHER the only per-thread knob is the nice value of the kernel thread,
+    // real-time policies are avoided since a spinning worker could starve the whole system.
+    int nice = 0;
+
+    switch (priority)
+    {
+    case ThreadPriority::Low:
+        nice = 10;
+        break;
+    case ThreadPriority::High:
+        nice = -5;
+        break;
+    default:
+        break;
+    }
+
+    return setpriority(PRIO_PROCESS, (id_t)mImpl->ID, nice) == 0;
+#endif
+}
 
-} // namespace LD
\ No newline at end of file
+} // namespace LD
@@ -4,4 +4,5 @@
 #include "Core/OS/Tests/TestPoolAllocator.h"
 #include "Core/OS/Tests/TestStackAllocator.h"
 #include "Core/OS/Tests/TestMemory.h"
-#include "Core/OS/Tests/TestUID.h"
\ No newline at end of file
+#include "Core/OS/Tests/TestUID.h"
+#include "Core/OS/Tests/TestThread.h"
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <doctest.h>
+#include "Core/OS/Include/Thread.h"
+#include "Core/OS/Include/Mutex.h"
+#include "Core/OS/Include/ConditionVariable.h"
+
+using namespace LD;
+
+namespace {
+
+	struct Counter
+	{
+		Mutex Lock;
+		int Value = 0;
+		int Iterations = 0;
+	};
+
+	int IncrementCounter(int tid, void* userdata)
+	{
+		Counter* counter = (Counter*)userdata;
+
+		for (int i = 0; i < counter->Iterations; i++)
+		{
+			counter->Lock.Lock();
+			counter->Value++;
+			counter->Lock.Unlock();
+		}
+
+		return 0;
+	}
+
+	struct PingPong
+	{
+		Mutex Lock;
+		ConditionVariable CV;
+		int Turn = 0;
+		int Rounds = 0;
+	};
+
+	int Pong(int tid, void* userdata)
+	{
+		PingPong* pp = (PingPong*)userdata;
+
+		for (int i = 0; i < pp->Rounds; i++)
+		{
+			pp->Lock.Lock();
+			while (pp->Turn != 1)
+				pp->CV.Wait(pp->Lock);
+			pp->Turn = 0;
+			pp->CV.SignalAll();
+			pp->Lock.Unlock();
+		}
+
+		return 0;
+	}
+
+}
+
+TEST_CASE("Mutex Contention")
+{
+	const int threadCount = 8;
+	Counter counter;
+	counter.Iterations = 20000;
+
+	Thread threads[threadCount];
+
+	for (Thread& thread : threads)
+		thread.Run(&IncrementCounter, &counter);
+
+	for (Thread& thread : threads)
+		thread.Stop();
+
+	CHECK(counter.Value == threadCount * counter.Iterations);
+}
+
+TEST_CASE("ConditionVariable PingPong")
+{
+	PingPong pp;
+	pp.Rounds = 1000;
+
+	Thread thread;
+	thread.Run(&Pong, &pp);
+	CHECK(thread.IsRunning());
+	CHECK(thread.GetID() > 0);
+
+	for (int i = 0; i < pp.Rounds; i++)
+	{
+		pp.Lock.Lock();
+		pp.Turn = 1;
+		pp.CV.SignalAll();
+		while (pp.Turn != 0)
+			pp.CV.Wait(pp.Lock);
+		pp.Lock.Unlock();
+	}
+
+	thread.Stop();
+	CHECK(!thread.IsRunning());
+	CHECK(pp.Turn == 0);
+}
+
+TEST_CASE("Thread Attributes")
+{
+	PingPong pp;
+	pp.Rounds = 1;
+
+	Thread thread;
+	thread.Run(&Pong, &pp);
+
+	CHECK(thread.SetName("LDTestThreadWithLongName"));
+	CHECK(thread.SetAffinity(0));
+	CHECK(thread.SetPriority(ThreadPriority::Low));
+
+	pp.Lock.Lock();
+	pp.Turn = 1;
+	pp.CV.SignalAll();
+	pp.Lock.Unlock();
+
+	thread.Stop();
+	CHECK(pp.Turn == 0);
+}
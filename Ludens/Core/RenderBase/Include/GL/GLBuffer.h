@@ -14,6 +14,10 @@ struct GLVertexBufferInfo
     GLenum Usage;
     u32 Size = 0;
     const void* Data = nullptr;
+
+    /// allocate immutable storage with one persistent coherent mapped region per frame in flight,
+    /// the buffer is expected to be written every frame and SetData becomes a memcpy.
+    bool PersistentMap = false;
 };
 
 class GLVertexBuffer
@@ -30,6 +34,9 @@ public:
     void Bind();
     void SetData(u32 offset, u32 size, const void* data);
 
+    /// @brief byte offset of the region that should be sourced in the current frame
+    u32 GetFrameOffset() const;
+
     inline UID GetHandle() const
     {
         return (UID)mHandle;
@@ -50,6 +57,8 @@ private:
     GLContext* mContext = nullptr;
     GLuint mVBO;
     u32 mSize = 0;
+    u32 mRegionSize = 0;
+    u8* mMap = nullptr;
 };
 
 using GLIndexBufferInfo = GLVertexBufferInfo;
@@ -91,6 +100,10 @@ struct GLUniformBufferInfo
     GLenum Usage = GL_STATIC_DRAW;
     u32 Size;
     const void* Data = nullptr;
+
+    /// allocate immutable storage with one persistent coherent mapped region per frame in flight,
+    /// the buffer is expected to be written every frame and SetData becomes a memcpy.
+    bool PersistentMap = false;
 };
 
 class GLUniformBuffer
@@ -108,6 +121,14 @@ public:
     void BindBase(int binding);
     void SetData(u32 offset, u32 size, const void* data);
 
+    /// @brief byte offset of the region that should be bound in the current frame
+    u32 GetFrameOffset() const;
+
+    inline u32 GetSize() const
+    {
+        return mSize;
+    }
+
     inline UID GetHandle() const
     {
         return (UID)mHandle;
@@ -126,6 +147,8 @@ private:
     GLContext* mContext = nullptr;
     GLuint mUBO;
     u32 mSize = 0;
+    u32 mRegionSize = 0;
+    u8* mMap = nullptr;
 };
 
 } // namespace LD
\ No newline at end of file
@@ -3,8 +3,13 @@
 #include <set>
 #include <string>
 #include <glad/glad.h>
+#include "Core/DSA/Include/Vector.h"
 #include "Core/OS/Include/UID.h"
 
+// number of frames the CPU may record ahead of the GPU, persistent mapped
+// buffers keep one region per frame in flight.
+#define CONTEXT_FRAMES_IN_FLIGHT 3
+
 namespace LD
 {
 
@@ -29,10 +34,24 @@ struct GLContextLimits
     int MaxColorAttachments;
     int MaxUniformBufferBindings;
     int MaxUniformBlockSize;
+    int UniformBufferOffsetAlignment;
+};
+
+/// blend factors and equations, only meaningful if blending is enabled
+struct GLBlendState
+{
+    GLenum ColorSrcFactor = GL_ONE;
+    GLenum ColorDstFactor = GL_ZERO;
+    GLenum ColorOp = GL_FUNC_ADD;
+    GLenum AlphaSrcFactor = GL_ONE;
+    GLenum AlphaDstFactor = GL_ZERO;
+    GLenum AlphaOp = GL_FUNC_ADD;
 };
 
 // currently not enforced as a singleton class, but the general use case
 // involves using a single context which out-lives all other GL resources.
+// The context shadows bound objects and fixed function state, redundant
+// bindings and state changes are skipped without calling into the driver.
 class GLContext
 {
 public:
@@ -45,21 +64,58 @@ public:
     void Startup();
     void Cleanup();
 
+    /// @brief fence the commands of the current frame and advance to the next frame,
+    ///        blocks until the GPU has finished the last frame that used the same index.
+    void EndFrame();
+
+    /// @brief index of the current frame in flight
+    inline u32 GetFrameIndex() const
+    {
+        return mFrameIndex;
+    }
+
     bool HasExtension(const char* name);
 
     void BindVAO(GLVertexArray* vao);
     void BindVBO(GLVertexBuffer& vbo);
     void BindIBO(GLIndexBuffer& ibo);
     void BindUBO(GLUniformBuffer& ubo);
-    void BindTextureUnit(int unit);
-    void BindTexture2D(GLTexture2D& texture);
-    void BindTexture2DArray(GLTexture2DArray& textureArray);
-    void BindTextureCube(GLTextureCube& textureCube);
+    void BindUBOBase(int base, GLUniformBuffer& ubo);
+    void BindTextureUnit(int unit, GLuint texture);
     void BindProgram(GLProgram& program);
     void BindFrameBuffer(GLFrameBuffer& frameBuffer);
     void UnbindProgram();
     void UnbindFrameBuffer();
 
+    /// invalidate shadowed texture unit bindings before the texture name is deleted
+    void ReleaseTexture(GLuint texture);
+
+    /// invalidate shadowed indexed buffer bindings before the buffer name is deleted
+    void ReleaseBuffer(GLuint buffer);
+
+    /// @brief set face culling, GL_NONE disables culling
+    void SetCullMode(GLenum cullMode);
+    void SetPolygonMode(GLenum polygonMode);
+    void SetDepthTest(bool enabled, GLenum depthFunc);
+    void SetDepthMask(bool enabled);
+    void SetBlend(bool enabled, const GLBlendState& state);
+    void SetScissorTest(bool enabled);
+
+    /// @brief set the viewport to cover a render target of the given size
+    void SetViewport(GLsizei width, GLsizei height);
+
+    /// @brief count driver calls issued outside of the context, such as draw calls
+    inline void CountCalls(u32 count)
+    {
+        mCallCount += count;
+    }
+
+    /// @brief total number of driver calls issued since context startup
+    inline u64 GetCallCount() const
+    {
+        return mCallCount;
+    }
+
     inline GLuint GetVersion() const
     {
         return mVersion;
@@ -104,11 +160,23 @@ private:
     UID mBoundVBO = 0;
     UID mBoundUBO = 0;
     UID mBoundProgram = 0;
-    UID mBoundTexture2D = 0;
-    UID mBoundTexture2DArray = 0;
-    UID mBoundTextureCube = 0;
     UID mBoundFrameBuffer = 0;
-    int mBoundTextureUnit = 0;
+    Vector<GLuint> mBoundTextureUnits; // texture name bound at each unit
+    Vector<GLuint> mBoundUBOBases;     // uniform buffer name bound at each base
+    Vector<GLintptr> mBoundUBOOffsets; // uniform buffer range offset at each base
+    GLsync mFrameFences[CONTEXT_FRAMES_IN_FLIGHT] = {};
+    u32 mFrameIndex = 0;
+    GLBlendState mBlendState;
+    GLenum mCullMode = GL_NONE;
+    GLenum mPolygonMode = GL_FILL;
+    GLenum mDepthFunc = GL_LESS;
+    bool mDepthTestEnabled = false;
+    bool mDepthMaskEnabled = true;
+    bool mBlendEnabled = false;
+    bool mScissorTestEnabled = false;
+    GLsizei mViewportWidth = -1;
+    GLsizei mViewportHeight = -1;
+    u64 mCallCount = 0;
     GLint mDefaultFrameBufferDepthBits;
     GLint mDefaultFrameBufferStencilBits;
     GLint mDefaultFrameBufferDepthType;
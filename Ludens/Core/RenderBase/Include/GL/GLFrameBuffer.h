@@ -41,7 +41,6 @@ public:
     void Startup(GLContext& context, const GLFrameBufferInfo& info);
     void Cleanup();
     void Bind();
-    void BindDrawBuffers();
 
     inline bool HasDepthBits() const
     {
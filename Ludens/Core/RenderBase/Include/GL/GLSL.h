@@ -13,6 +13,10 @@ enum class GLSLType
     Vec2,
     Vec3,
     Vec4,
+    UShort4,
+    Byte4,
+    UByte4,
+    Half2,
 };
 
 bool GetGLSLTypeVertexAttribute(GLSLType type, GLint* componentCount, GLenum* componentType, u32* byteSize);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <glad/glad.h>
+#include "Core/DSA/Include/Vector.h"
 #include "Core/OS/Include/UID.h"
 
 namespace LD
@@ -8,6 +9,7 @@ namespace LD
 
 class GLContext;
 class GLIndexBuffer;
+class GLVertexBuffer;
 
 class GLVertexArray
 {
@@ -23,6 +25,7 @@ public:
 
     void Bind();
     void BindIBO(GLIndexBuffer& ibo);
+    void BindVBO(u32 slot, GLVertexBuffer& vbo, u32 stride);
 
     inline UID GetHandle() const
     {
@@ -44,6 +47,8 @@ private:
     GLContext* mContext = nullptr;
     GLuint mVAO;
     UID mBoundIBO = 0;
+    Vector<UID> mBoundVBOs;       // vertex buffer at each binding slot
+    Vector<u32> mBoundVBOOffsets; // vertex buffer byte offset at each binding slot
 };
 
 } // namespace LD
\ No newline at end of file
@@ -23,6 +23,7 @@ enum class RBindingType : u8
 {
     Texture = 0,
     UniformBuffer,
+    StorageBuffer,
 };
 
 /// Binding group handle and interface.
@@ -35,6 +36,7 @@ class RBindingGroup : public RHandle<RBindingGroupBase>
 public:
     RResult BindTexture(u32 binding, RTexture& textureH, int arrayIndex = 0);
     RResult BindUniformBuffer(u32 binding, RBuffer& bufferH);
+    RResult BindStorageBuffer(u32 binding, RBuffer& bufferH);
 
 private:
     RBackend mBackend;
@@ -50,6 +52,11 @@ struct RBindingInfo
 {
     RBindingType Type;
     int Count = 1;
+
+    /// Array elements may be left unbound and may be bound while the group is in use by frames in flight,
+    /// as long as those elements are not accessed by them. Shaders index such arrays dynamically.
+    /// Requires RDevice::HasBindlessSupport.
+    bool Bindless = false;
 };
 
 // Info to create a binding group.
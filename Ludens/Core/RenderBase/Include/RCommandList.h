@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Core/Header/Include/Types.h"
+#include "Core/OS/Include/UID.h"
+#include "Core/RenderBase/Include/RTypes.h"
+#include "Core/RenderBase/Include/RResult.h"
+#include "Core/RenderBase/Include/RPass.h"
+#include "Core/RenderBase/Include/RFrameBuffer.h"
+#include "Core/RenderBase/Include/RBuffer.h"
+#include "Core/RenderBase/Include/RBinding.h"
+#include "Core/RenderBase/Include/RPipeline.h"
+
+namespace LD
+{
+
+struct RCommandListInfo
+{
+    const char* Name = nullptr;
+};
+
+// the render pass instance a command list is recorded for,
+// must match the RPassBeginInfo of the pass it is executed in.
+struct RCommandListBeginInfo
+{
+    RPass RenderPass;
+    RFrameBuffer FrameBuffer;
+
+    // same as the RPassBeginInfo render extent of the pass this list executes in
+    u32 RenderWidth = 0;
+    u32 RenderHeight = 0;
+};
+
+struct RCommandListBase;
+
+// A list of draw commands recorded outside of the device, to be executed later within a render pass
+// that is begun with RPassBeginInfo::UseCommandLists. Each command list tracks its own bound pipeline,
+// so different command lists may be recorded concurrently from worker threads, but a single command list
+// must only be recorded by one thread at a time. Command lists are recorded once per frame, between
+// RDevice::BeginFrame and the RDevice::ExecuteCommandLists call that consumes them. Pipelines are
+// compiled by JobType::CompilePipeline jobs, the main thread waits for them before recording starts.
+class RCommandList : public RHandle<RCommandListBase>
+{
+public:
+    RResult Begin(const RCommandListBeginInfo& info);
+    RResult End();
+
+    RResult SetPipeline(RPipeline& pipeline);
+    RResult SetBindingGroup(u32 slot, RBindingGroup& group);
+    RResult SetVertexBuffer(u32 slot, RBuffer& buffer);
+    RResult SetIndexBuffer(RBuffer& buffer, RIndexType indexType);
+
+    RResult DrawVertex(const RDrawVertexInfo& info);
+    RResult DrawIndexed(const RDrawIndexedInfo& info);
+};
+
+} // namespace LD
@@ -4,6 +4,7 @@
 #include "Core/Math/Include/Rect2D.h"
 #include "Core/OS/Include/UID.h"
 #include "Core/DSA/Include/Optional.h"
+#include "Core/DSA/Include/View.h"
 #include "Core/RenderBase/Include/RTypes.h"
 #include "Core/RenderBase/Include/RResult.h"
 
@@ -19,6 +20,7 @@ class RBindingGroup;
 class RPass;
 class RFrameBuffer;
 class RPipeline;
+class RCommandList;
 struct RDeviceBase;
 struct RTextureInfo;
 struct RBufferInfo;
@@ -29,6 +31,7 @@ struct RPassInfo;
 struct RPassBeginInfo;
 struct RFrameBufferInfo;
 struct RPipelineInfo;
+struct RCommandListInfo;
 enum class RTextureFormat;
 
 using RResultCallback = void (*)(const RResult&);
@@ -37,11 +40,18 @@ struct RDeviceInfo
 {
     RBackend Backend;
     RResultCallback Callback = nullptr;
+
+    // Directory for backend caches persisted across runs, usually the same as RShaderCacheInfo::CacheDirectory.
+    // The Vulkan backend stores its pipeline cache here, a null directory disables persistence.
+    const char* CacheDirectory = nullptr;
 };
 
 RResult CreateRenderDevice(RDevice& device, const RDeviceInfo& info);
 RResult DeleteRenderDevice(RDevice& device);
 
+// levels of detail counted separately by RDrawStats, higher levels are counted as the last level
+#define LD_DRAW_STATS_MAX_LODS 8
+
 struct RDrawStats
 {
     u32 DrawVertexCalls;
@@ -51,6 +61,13 @@ struct RDrawStats
     // Note that per-instance vertices are *NOT* included.
     u32 TotalVertices;
 
+    // Number of graphics API calls issued between BeginDrawStats and EndDrawStats,
+    // currently only tracked by the OpenGL backend.
+    u32 DriverCalls;
+
+    // Number of indexed draw calls at each level of detail, see RDrawIndexedInfo::LOD.
+    u32 LODDrawCalls[LD_DRAW_STATS_MAX_LODS];
+
     inline u32 DrawCalls() const
     {
         return DrawVertexCalls + DrawIndexedCalls;
@@ -89,6 +106,9 @@ public:
     RResult CreatePipeline(RPipeline& pipeline, const RPipelineInfo& info);
     RResult DeletePipeline(RPipeline& pipeline);
 
+    RResult CreateCommandList(RCommandList& list, const RCommandListInfo& info);
+    RResult DeleteCommandList(RCommandList& list);
+
     RResult GetSwapChainTextureFormat(RTextureFormat& format);
     RResult GetSwapChainRenderPass(RPass& renderPass);
     RResult GetSwapChainFrameBuffer(RFrameBuffer& frameBuffer);
@@ -113,6 +133,11 @@ public:
     RResult PushScissor(const Rect2D& scissor);
     RResult PopScissor();
 
+    /// @brief execute recorded command lists in order, within a render pass begun with UseCommandLists
+    /// @param lists command lists recorded for the current render pass, all recording must be complete
+    /// @return execution result, the device has no bound pipeline afterwards
+    RResult ExecuteCommandLists(View<RCommandList> lists);
+
     RResult DrawVertex(const RDrawVertexInfo& info);
     RResult DrawIndexed(const RDrawIndexedInfo& info);
 
@@ -124,6 +149,10 @@ public:
 
     void WaitIdle();
 
+    /// @brief whether storage buffers and bindless binding arrays (RBindingInfo::Bindless) are supported,
+    ///        currently only by the Vulkan backend on devices with descriptor indexing
+    bool HasBindlessSupport() const;
+
     inline RBackend GetBackend() const
     {
         return mBackend;
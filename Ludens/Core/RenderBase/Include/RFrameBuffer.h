@@ -54,6 +54,15 @@ struct RPassBeginInfo
     RPass RenderPass;
     RFrameBuffer FrameBuffer;
     View<RClearValue> ClearValues;
+
+    // the pass contents are recorded in RCommandLists and submitted with RDevice::ExecuteCommandLists,
+    // no draw commands may be issued directly through the device until the pass ends.
+    bool UseCommandLists = false;
+
+    // extent of the rendered area, starting at frame buffer texture coordinates (0, 0).
+    // zero uses the frame buffer extent, a smaller area renders at a reduced resolution.
+    u32 RenderWidth = 0;
+    u32 RenderHeight = 0;
 };
 
 } // namespace LD
@@ -55,6 +55,11 @@ class RPass : public RHandle<RPassBase>
 public:
 
     bool HasDepthStencilAttachment();
+
+    u32 GetAttachmentCount();
+
+    /// attachment description and state transitions baked at creation
+    RPassAttachment GetAttachment(u32 index);
 };
 
 } // namespace LD
@@ -8,6 +8,7 @@ enum class RBufferType
     VertexBuffer = 0,
     IndexBuffer,
     UniformBuffer,
+    StorageBuffer,
 };
 
 enum class RShaderType
@@ -29,6 +30,8 @@ enum class RResultType
     BindingMismatch,
     PassBeginError,
     ScissorStackEmpty,
+    CommandListStateError,
+    FeatureUnsupported,
 };
 
 enum class RResourceType
@@ -41,6 +44,7 @@ enum class RResourceType
     BindingGroupLayout,
     BindingGroup,
     Pipeline,
+    CommandList,
 };
 
 struct RResourceMissing
@@ -25,6 +25,13 @@ enum class RDataType
     Vec2,
     Vec3,
     Vec4,
+
+    // packed vertex attribute formats, read as float vectors in the vertex shader,
+    // integer components are converted to [0, 1] or [-1, 1] if the attribute is normalized
+    UShort4, // four 16 bit unsigned integers, read as vec4
+    Byte4,   // four 8 bit signed integers, read as vec4
+    UByte4,  // four 8 bit unsigned integers, read as vec4
+    Half2,   // two 16 bit floats, read as vec2
 };
 
 struct RShaderInfo
@@ -21,7 +21,13 @@ enum class RMemoryUsage
     Immutable = 0,
 
     // memory that is expected to be written by CPU every frame.
+    // backends may keep one copy per frame in flight, contents not written
+    // during the current frame are undefined unless supplied at creation.
     FrameDynamic,
+
+    // memory that is written by CPU occasionally and keeps its contents across frames.
+    // the CPU must not overwrite any region that frames in flight may still be reading.
+    Persistent,
 };
 
 struct RDrawVertexInfo
@@ -44,6 +50,7 @@ struct RDrawIndexedInfo
     u32 IndexStart = 0;
     u32 InstanceCount = 1;
     u32 InstanceStart = 0;
+    u32 LOD = 0; // level of detail of the geometry, only counted by RDrawStats
 };
 
 using RClearColorValue = Vec4;
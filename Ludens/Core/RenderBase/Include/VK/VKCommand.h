@@ -57,13 +57,16 @@ public:
     }
 
     void BeginRecord(VkCommandBufferUsageFlags usage);
+    void BeginRecord(VkCommandBufferUsageFlags usage, const VkCommandBufferInheritanceInfo& inheritance);
     void EndRecord();
     void Submit(VkQueue queue);
     void Reset(VkCommandBufferResetFlags flags);
 
     // below API are only available between BeginRecord() and EndRecord()
-    void CmdBeginRenderPass(const VkRenderPassBeginInfo& renderPassBI);
+    void CmdBeginRenderPass(const VkRenderPassBeginInfo& renderPassBI,
+                            VkSubpassContents contents = VK_SUBPASS_CONTENTS_INLINE);
     void CmdEndRenderPass();
+    void CmdExecuteCommands(u32 count, const VkCommandBuffer* secondaries);
 
     void CmdBindVertexBuffers(u32 firstBinding, u32 bindingCount, const VkBuffer* buffers, const VkDeviceSize* offsets);
     void CmdBindVertexBuffer(u32 binding, VkBuffer buffer, VkDeviceSize offset);
@@ -73,8 +76,8 @@ public:
     void CmdSetViewport(VkViewport viewport);
     void CmdSetScissor(VkRect2D scissor);
 
-    void CmdDrawVertex(u32 vertexCount, u32 instanceCount);
-    void CmdDrawIndexed(u32 indexCount, u32 instanceCount, u32 indexStart);
+    void CmdDrawVertex(u32 vertexCount, u32 instanceCount, u32 instanceStart = 0);
+    void CmdDrawIndexed(u32 indexCount, u32 instanceCount, u32 indexStart, u32 instanceStart = 0);
 
     void CmdImageLayoutTransition(VKImage& image, VkImageSubresourceRange range, VkImageLayout oldLayout,
                                   VkImageLayout newLayout);
@@ -109,6 +112,21 @@ inline void VKCommandBuffer::BeginRecord(VkCommandBufferUsageFlags usage)
     mIsRecording = true;
 }
 
+// secondary command buffers continuing a render pass must know which pass and frame buffer they are executed in
+inline void VKCommandBuffer::BeginRecord(VkCommandBufferUsageFlags usage,
+                                         const VkCommandBufferInheritanceInfo& inheritance)
+{
+    LD_DEBUG_ASSERT(mIsAllocated);
+
+    VkCommandBufferBeginInfo bufferBI{};
+    bufferBI.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    bufferBI.pInheritanceInfo = &inheritance;
+    bufferBI.flags = usage;
+
+    VK_ASSERT(vkBeginCommandBuffer(mHandle, &bufferBI));
+    mIsRecording = true;
+}
+
 inline void VKCommandBuffer::EndRecord()
 {
     LD_DEBUG_ASSERT(mIsAllocated);
@@ -136,9 +154,9 @@ inline void VKCommandBuffer::Reset(VkCommandBufferResetFlags flags)
     VK_ASSERT(vkResetCommandBuffer(mHandle, flags));
 }
 
-inline void VKCommandBuffer::CmdBeginRenderPass(const VkRenderPassBeginInfo& renderPassBI)
+inline void VKCommandBuffer::CmdBeginRenderPass(const VkRenderPassBeginInfo& renderPassBI, VkSubpassContents contents)
 {
-    vkCmdBeginRenderPass(mHandle, &renderPassBI, VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdBeginRenderPass(mHandle, &renderPassBI, contents);
 }
 
 inline void VKCommandBuffer::CmdEndRenderPass()
@@ -146,6 +164,11 @@ inline void VKCommandBuffer::CmdEndRenderPass()
     vkCmdEndRenderPass(mHandle);
 }
 
+inline void VKCommandBuffer::CmdExecuteCommands(u32 count, const VkCommandBuffer* secondaries)
+{
+    vkCmdExecuteCommands(mHandle, count, secondaries);
+}
+
 //
 // Binding Commands
 //
@@ -190,14 +213,14 @@ inline void VKCommandBuffer::CmdSetScissor(VkRect2D scissor)
 // Draw Calls
 //
 
-inline void VKCommandBuffer::CmdDrawVertex(u32 vertexCount, u32 instanceCount)
+inline void VKCommandBuffer::CmdDrawVertex(u32 vertexCount, u32 instanceCount, u32 instanceStart)
 {
-    vkCmdDraw(mHandle, vertexCount, instanceCount, 0, 0);
+    vkCmdDraw(mHandle, vertexCount, instanceCount, 0, instanceStart);
 }
 
-inline void VKCommandBuffer::CmdDrawIndexed(u32 indexCount, u32 instanceCount, u32 indexStart)
+inline void VKCommandBuffer::CmdDrawIndexed(u32 indexCount, u32 instanceCount, u32 indexStart, u32 instanceStart)
 {
-    vkCmdDrawIndexed(mHandle, indexCount, instanceCount, indexStart, 0, 0);
+    vkCmdDrawIndexed(mHandle, indexCount, instanceCount, indexStart, 0, instanceStart);
 }
 
 } // namespace LD
\ No newline at end of file
@@ -47,7 +47,7 @@ public:
 
     VKDescriptorSetLayout& operator=(const VKDescriptorSetLayout&) = delete;
 
-    VKDescriptorSetLayout& AddBinding(const VkDescriptorSetLayoutBinding& binding);
+    VKDescriptorSetLayout& AddBinding(const VkDescriptorSetLayoutBinding& binding, VkDescriptorBindingFlags flags = 0);
 
     void Startup(const VKDevice& device);
     void Cleanup();
@@ -61,6 +61,7 @@ private:
     VkDevice mDevice = VK_NULL_HANDLE;
     VkDescriptorSetLayout mHandle = VK_NULL_HANDLE;
     Vector<VkDescriptorSetLayoutBinding> mBindings;
+    Vector<VkDescriptorBindingFlags> mBindingFlags;
 };
 
 class VKDescriptorSet
@@ -81,7 +82,8 @@ public:
     void Free(VKDevice& device, VKDescriptorPool& pool);
 
     /// @brief single set write for buffer
-    void Write(VKDevice& device, VKBuffer& buffer, u32 binding, u32 index);
+    void Write(VKDevice& device, VKBuffer& buffer, u32 binding, u32 index,
+               VkDescriptorType type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
 
     /// @brief single set write for image sampler
     void Write(VKDevice& device, VKSampler& sampler, VKImageView& imageView, u32 binding, u32 index);
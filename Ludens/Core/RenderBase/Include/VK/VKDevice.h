@@ -77,11 +77,16 @@ public:
         return mQueueFamilyProperties;
     }
 
+    /// @brief whether the device supports the descriptor indexing subset used by bindless binding groups:
+    ///        non-uniform indexing into sampled image arrays, partially bound and update-after-bind descriptors.
+    bool HasBindlessSupport() const;
+
 private:
     VkPhysicalDevice mHandle = VK_NULL_HANDLE;
     VkPhysicalDeviceProperties mProperties;
     VkPhysicalDeviceMemoryProperties mMemoryProperties;
     VkPhysicalDeviceFeatures mFeatures;
+    VkPhysicalDeviceDescriptorIndexingFeatures mDescriptorIndexingFeatures;
     Vector<VkExtensionProperties> mExtensionProperties;
     Vector<VkQueueFamilyProperties> mQueueFamilyProperties;
     Optional<u32> mGraphicsIndex; // the index of a queue family capable of graphics ops, if has value
@@ -152,6 +157,12 @@ public:
         return mPresentQueue;
     }
 
+    /// @brief whether descriptor indexing features for bindless binding groups were enabled during Startup
+    inline bool HasBindlessSupport() const
+    {
+        return mHasBindlessSupport;
+    }
+
     // returns true and writes to typeIndex if we find a memory type that satisfies the given requirements
     bool GetMemoryType(u32 typeFilter, VkMemoryPropertyFlags typeFlags, u32* typeIndex);
 
@@ -161,6 +172,7 @@ private:
     VkQueue mGraphicsQueue;
     VkQueue mTransferQueue;
     VkQueue mPresentQueue;
+    bool mHasBindlessSupport = false;
 };
 
 } // namespace LD
\ No newline at end of file
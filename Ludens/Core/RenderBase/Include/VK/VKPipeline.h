@@ -62,7 +62,10 @@ public:
     VKPipeline& SetRasterizationState(const VkPipelineRasterizationStateCreateInfo& rasterizationState);
     VKPipeline& SetDepthStencilState(const VkPipelineDepthStencilStateCreateInfo& depthStencilState);
     VKPipeline& SetBlendState(const VkPipelineColorBlendAttachmentState& colorBlendState);
-    void Startup(const VKDevice& device);
+
+    /// compile the pipeline from the recorded states, this is safe to call from a worker thread
+    /// once all Set* calls are done, the pipeline cache is internally synchronized by the driver
+    void Startup(const VKDevice& device, VkPipelineCache cache = VK_NULL_HANDLE);
     void Cleanup();
 
     inline VkPipeline GetHandle() const
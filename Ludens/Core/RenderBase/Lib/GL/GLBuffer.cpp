@@ -1,3 +1,4 @@
+#include <cstring>
 #include "Core/RenderBase/Include/GL/GLBuffer.h"
 #include "Core/RenderBase/Include/GL/GLContext.h"
 #include "Core/Header/Include/Error.h"
@@ -5,6 +6,31 @@
 namespace LD
 {
 
+// Allocates immutable storage with one region per frame in flight and maps it persistently.
+// The initial data is copied to every region so buffers that are never updated stay valid.
+static u8* StartupPersistentMap(GLuint buffer, u32 regionSize, u32 size, const void* data)
+{
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    const GLsizeiptr storageSize = (GLsizeiptr)regionSize * CONTEXT_FRAMES_IN_FLIGHT;
+
+    glNamedBufferStorage(buffer, storageSize, nullptr, flags);
+    u8* map = (u8*)glMapNamedBufferRange(buffer, 0, storageSize, flags);
+    LD_DEBUG_ASSERT(map != nullptr);
+
+    if (data)
+    {
+        for (u32 frame = 0; frame < CONTEXT_FRAMES_IN_FLIGHT; frame++)
+            memcpy(map + frame * regionSize, data, size);
+    }
+
+    return map;
+}
+
+static inline u32 AlignRegionSize(u32 size, u32 alignment)
+{
+    return (size + alignment - 1) / alignment * alignment;
+}
+
 GLVertexBuffer::GLVertexBuffer() : mContext(nullptr)
 {
 }
@@ -21,15 +47,28 @@ void GLVertexBuffer::Startup(GLContext& context, const GLVertexBufferInfo& info)
     mSize = info.Size;
 
     glCreateBuffers(1, &mVBO);
-    if (info.Size > 0)
+
+    if (info.PersistentMap)
     {
-        context.BindVBO(*this);
-        glBufferData(GL_ARRAY_BUFFER, info.Size, info.Data, info.Usage);
+        LD_DEBUG_ASSERT(info.Size > 0);
+
+        // vertex buffer offsets only need to be a multiple of the attribute component size
+        mRegionSize = AlignRegionSize(info.Size, 16);
+        mMap = StartupPersistentMap(mVBO, mRegionSize, info.Size, info.Data);
     }
+    else if (info.Size > 0)
+        glNamedBufferData(mVBO, info.Size, info.Data, info.Usage);
 }
 
 void GLVertexBuffer::Cleanup()
 {
+    if (mMap)
+    {
+        glUnmapNamedBuffer(mVBO);
+        mMap = nullptr;
+    }
+
+    mContext->ReleaseBuffer(mVBO);
     glDeleteBuffers(1, &mVBO);
 
     mHandle.Reset();
@@ -56,8 +95,20 @@ void GLVertexBuffer::SetData(u32 offset, u32 size, const void* data)
 {
     LD_DEBUG_ASSERT(offset + size <= mSize);
 
-    Bind();
-    glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+    if (mMap)
+    {
+        // the region of the current frame is no longer read by the GPU, see GLContext::EndFrame
+        memcpy(mMap + GetFrameOffset() + offset, data, size);
+        return;
+    }
+
+    glNamedBufferSubData(mVBO, offset, size, data);
+    mContext->CountCalls(1);
+}
+
+u32 GLVertexBuffer::GetFrameOffset() const
+{
+    return mMap ? mContext->GetFrameIndex() * mRegionSize : 0;
 }
 
 void GLIndexBuffer::Startup(GLContext& context, const GLIndexBufferInfo& info)
@@ -68,17 +119,12 @@ void GLIndexBuffer::Startup(GLContext& context, const GLIndexBufferInfo& info)
     glCreateBuffers(1, &mIBO);
 
     if (info.Size > 0)
-    {
-        GLint oldIBO;
-        glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &oldIBO);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, info.Size, info.Data, info.Usage);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, oldIBO);
-    }
+        glNamedBufferData(mIBO, info.Size, info.Data, info.Usage);
 }
 
 void GLIndexBuffer::Cleanup()
 {
+    mContext->ReleaseBuffer(mIBO);
     glDeleteBuffers(1, &mIBO);
 
     mHandle.Reset();
@@ -110,13 +156,27 @@ void GLUniformBuffer::Startup(GLContext& context, const GLUniformBufferInfo& inf
     LD_DEBUG_ASSERT(mSize > 0);
 
     glCreateBuffers(1, &mUBO);
-    Bind();
 
-    glBufferData(GL_UNIFORM_BUFFER, mSize, info.Data, info.Usage);
+    if (info.PersistentMap)
+    {
+        // each region must start at a valid glBindBufferRange offset
+        u32 alignment = (u32)context.GetLimits().UniformBufferOffsetAlignment;
+        mRegionSize = AlignRegionSize(mSize, alignment);
+        mMap = StartupPersistentMap(mUBO, mRegionSize, mSize, info.Data);
+    }
+    else
+        glNamedBufferData(mUBO, mSize, info.Data, info.Usage);
 }
 
 void GLUniformBuffer::Cleanup()
 {
+    if (mMap)
+    {
+        glUnmapNamedBuffer(mUBO);
+        mMap = nullptr;
+    }
+
+    mContext->ReleaseBuffer(mUBO);
     glDeleteBuffers(1, &mUBO);
 
     mHandle.Reset();
@@ -133,16 +193,29 @@ void GLUniformBuffer::Bind()
 
 void GLUniformBuffer::BindBase(int binding)
 {
-    Bind();
-    glBindBufferBase(GL_UNIFORM_BUFFER, binding, mUBO);
+    LD_DEBUG_ASSERT(mContext != nullptr);
+
+    mContext->BindUBOBase(binding, *this);
 }
 
 void GLUniformBuffer::SetData(u32 offset, u32 size, const void* data)
 {
     LD_DEBUG_ASSERT(offset + size <= mSize);
 
-    Bind();
-    glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+    if (mMap)
+    {
+        // the region of the current frame is no longer read by the GPU, see GLContext::EndFrame
+        memcpy(mMap + GetFrameOffset() + offset, data, size);
+        return;
+    }
+
+    glNamedBufferSubData(mUBO, offset, size, data);
+    mContext->CountCalls(1);
+}
+
+u32 GLUniformBuffer::GetFrameOffset() const
+{
+    return mMap ? mContext->GetFrameIndex() * mRegionSize : 0;
 }
 
 } // namespace LD
\ No newline at end of file
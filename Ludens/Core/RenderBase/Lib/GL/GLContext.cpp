@@ -68,12 +68,69 @@ void GLContext::Startup()
     glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_STENCIL, GL_FRAMEBUFFER_ATTACHMENT_COMPONENT_TYPE,
                                           &mDefaultFrameBufferStencilType);
 
+    // textures are bound with glBindTextureUnit, the active texture unit is never changed after startup
     glActiveTexture(GL_TEXTURE0);
-    mBoundTextureUnit = 0;
+    mBoundTextureUnits.Resize((size_t)sLimits.MaxCombinedTextureImageUnits);
+    mBoundUBOBases.Resize((size_t)sLimits.MaxUniformBufferBindings);
+    mBoundUBOOffsets.Resize((size_t)sLimits.MaxUniformBufferBindings);
+
+    // establish known fixed function state for the shadow copies
+    glDisable(GL_CULL_FACE);
+    glFrontFace(GL_CCW);
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    glDisable(GL_DEPTH_TEST);
+    glDepthFunc(GL_LESS);
+    glDepthMask(GL_TRUE);
+    glDisable(GL_BLEND);
+    glBlendFuncSeparate(GL_ONE, GL_ZERO, GL_ONE, GL_ZERO);
+    glBlendEquationSeparate(GL_FUNC_ADD, GL_FUNC_ADD);
+    glDisable(GL_SCISSOR_TEST);
+    mCullMode = GL_NONE;
+    mPolygonMode = GL_FILL;
+    mDepthTestEnabled = false;
+    mDepthFunc = GL_LESS;
+    mDepthMaskEnabled = true;
+    mBlendEnabled = false;
+    mBlendState = {};
+    mScissorTestEnabled = false;
 }
 
 void GLContext::Cleanup()
 {
+    for (GLsync& fence : mFrameFences)
+    {
+        if (fence)
+        {
+            glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+}
+
+void GLContext::EndFrame()
+{
+    mFrameFences[mFrameIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    mFrameIndex = (mFrameIndex + 1) % CONTEXT_FRAMES_IN_FLIGHT;
+    mCallCount++;
+
+    GLsync fence = mFrameFences[mFrameIndex];
+    if (!fence)
+        return;
+
+    // the regions of the next frame in persistent mapped buffers are free once this fence signals
+    GLenum status;
+    do
+    {
+        status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+        mCallCount++;
+    } while (status == GL_TIMEOUT_EXPIRED);
+
+    LD_DEBUG_ASSERT(status != GL_WAIT_FAILED);
+
+    glDeleteSync(fence);
+    mFrameFences[mFrameIndex] = nullptr;
+    mCallCount++;
 }
 
 bool GLContext::HasExtension(const char* name)
@@ -103,6 +160,7 @@ void GLContext::BindVAO(GLVertexArray* vao)
 
     glBindVertexArray((GLuint)*vao);
     mBoundVAO = vao;
+    mCallCount++;
 }
 
 void GLContext::BindVBO(GLVertexBuffer& vbo)
@@ -121,6 +179,7 @@ void GLContext::BindVBO(GLVertexBuffer& vbo)
 
     glBindBuffer(GL_ARRAY_BUFFER, (GLuint)vbo);
     mBoundVBO = (UID)vbo;
+    mCallCount++;
 }
 
 void GLContext::BindIBO(GLIndexBuffer& ibo)
@@ -146,44 +205,48 @@ void GLContext::BindUBO(GLUniformBuffer& ubo)
 
     glBindBuffer(GL_UNIFORM_BUFFER, (GLuint)ubo);
     mBoundUBO = (UID)ubo;
+    mCallCount++;
 }
 
-void GLContext::BindTextureUnit(int unit)
+void GLContext::BindUBOBase(int base, GLUniformBuffer& ubo)
 {
-    if (mBoundTextureUnit == unit)
+    LD_DEBUG_ASSERT(0 <= base && base < (int)mBoundUBOBases.Size());
+
+    // persistent mapped uniform buffers are bound at the region of the current frame
+    GLintptr offset = (GLintptr)ubo.GetFrameOffset();
+
+    if (mBoundUBOBases[base] == (GLuint)ubo && mBoundUBOOffsets[base] == offset)
     {
         LD_DEBUG_ASSERT(
             [&]()
             {
                 GLint actual;
-                glGetIntegerv(GL_ACTIVE_TEXTURE, &actual);
-                return actual == (GL_TEXTURE0 + unit);
+                glGetIntegeri_v(GL_UNIFORM_BUFFER_BINDING, base, &actual);
+                return actual == (GLuint)ubo;
             }());
         return;
     }
 
-    glActiveTexture(GL_TEXTURE0 + unit);
-    mBoundTextureUnit = unit;
+    // NOTE: glBindBufferRange also binds to the generic GL_UNIFORM_BUFFER target
+    glBindBufferRange(GL_UNIFORM_BUFFER, base, (GLuint)ubo, offset, (GLsizeiptr)ubo.GetSize());
+    mBoundUBOBases[base] = (GLuint)ubo;
+    mBoundUBOOffsets[base] = offset;
+    mBoundUBO = (UID)ubo;
+    mCallCount++;
 }
 
-void GLContext::BindTexture2D(GLTexture2D& texture)
+void GLContext::BindTextureUnit(int unit, GLuint texture)
 {
-    // NOTE: OpenGL texture units supports bindings to all targets, here we don't cache which texture unit we bind to,
-    //       only the last texture bound for each texture target.
-    glBindTexture(GL_TEXTURE_2D, (GLuint)texture);
-    mBoundTexture2D = (UID)texture;
-}
+    LD_DEBUG_ASSERT(0 <= unit && unit < (int)mBoundTextureUnits.Size());
 
-void GLContext::BindTexture2DArray(GLTexture2DArray& texture)
-{
-    glBindTexture(GL_TEXTURE_2D_ARRAY, (GLuint)texture);
-    mBoundTexture2DArray = (UID)texture;
-}
+    // NOTE: OpenGL texture units support bindings to all targets, but a program may only sample a
+    //       single target from each unit, so we shadow the last texture name bound at each unit.
+    if (mBoundTextureUnits[unit] == texture)
+        return;
 
-void GLContext::BindTextureCube(GLTextureCube& textureCube)
-{
-    glBindTexture(GL_TEXTURE_CUBE_MAP, (GLuint)textureCube);
-    mBoundTextureCube = (UID)textureCube;
+    glBindTextureUnit((GLuint)unit, texture);
+    mBoundTextureUnits[unit] = texture;
+    mCallCount++;
 }
 
 void GLContext::BindProgram(GLProgram& shader)
@@ -201,6 +264,7 @@ void GLContext::BindProgram(GLProgram& shader)
     }
     glUseProgram((GLuint)shader);
     mBoundProgram = (UID)shader;
+    mCallCount++;
 }
 
 void GLContext::BindFrameBuffer(GLFrameBuffer& frameBuffer)
@@ -228,18 +292,168 @@ void GLContext::BindFrameBuffer(GLFrameBuffer& frameBuffer)
     // be the same.
     glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)frameBuffer);
     mBoundFrameBuffer = (UID)frameBuffer;
+    mCallCount++;
 }
 
 void GLContext::UnbindProgram()
 {
     glUseProgram(0);
     mBoundProgram = 0;
+    mCallCount++;
 }
 
 void GLContext::UnbindFrameBuffer()
 {
+    if (mBoundFrameBuffer == 0)
+        return;
+
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
     mBoundFrameBuffer = 0;
+    mCallCount++;
+}
+
+void GLContext::ReleaseTexture(GLuint texture)
+{
+    // deleting a texture reverts its bindings to zero
+    for (size_t unit = 0; unit < mBoundTextureUnits.Size(); unit++)
+    {
+        if (mBoundTextureUnits[unit] == texture)
+            mBoundTextureUnits[unit] = 0;
+    }
+}
+
+void GLContext::ReleaseBuffer(GLuint buffer)
+{
+    // deleting a buffer reverts its indexed bindings to zero
+    for (size_t base = 0; base < mBoundUBOBases.Size(); base++)
+    {
+        if (mBoundUBOBases[base] == buffer)
+            mBoundUBOBases[base] = 0;
+    }
+}
+
+void GLContext::SetCullMode(GLenum cullMode)
+{
+    if (mCullMode == cullMode)
+        return;
+
+    if (cullMode == GL_NONE)
+    {
+        glDisable(GL_CULL_FACE);
+        mCallCount++;
+    }
+    else
+    {
+        if (mCullMode == GL_NONE)
+        {
+            glEnable(GL_CULL_FACE);
+            mCallCount++;
+        }
+
+        glCullFace(cullMode);
+        mCallCount++;
+    }
+
+    mCullMode = cullMode;
+}
+
+void GLContext::SetPolygonMode(GLenum polygonMode)
+{
+    if (mPolygonMode == polygonMode)
+        return;
+
+    // NOTE: core profile only accepts GL_FRONT_AND_BACK, culled faces are discarded anyways.
+    glPolygonMode(GL_FRONT_AND_BACK, polygonMode);
+    mPolygonMode = polygonMode;
+    mCallCount++;
+}
+
+void GLContext::SetDepthTest(bool enabled, GLenum depthFunc)
+{
+    if (mDepthTestEnabled != enabled)
+    {
+        if (enabled)
+            glEnable(GL_DEPTH_TEST);
+        else
+            glDisable(GL_DEPTH_TEST);
+
+        mDepthTestEnabled = enabled;
+        mCallCount++;
+    }
+
+    if (enabled && mDepthFunc != depthFunc)
+    {
+        glDepthFunc(depthFunc);
+        mDepthFunc = depthFunc;
+        mCallCount++;
+    }
+}
+
+void GLContext::SetDepthMask(bool enabled)
+{
+    if (mDepthMaskEnabled == enabled)
+        return;
+
+    glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+    mDepthMaskEnabled = enabled;
+    mCallCount++;
+}
+
+void GLContext::SetBlend(bool enabled, const GLBlendState& state)
+{
+    if (mBlendEnabled != enabled)
+    {
+        if (enabled)
+            glEnable(GL_BLEND);
+        else
+            glDisable(GL_BLEND);
+
+        mBlendEnabled = enabled;
+        mCallCount++;
+    }
+
+    if (!enabled)
+        return;
+
+    if (mBlendState.ColorSrcFactor != state.ColorSrcFactor || mBlendState.ColorDstFactor != state.ColorDstFactor ||
+        mBlendState.AlphaSrcFactor != state.AlphaSrcFactor || mBlendState.AlphaDstFactor != state.AlphaDstFactor)
+    {
+        glBlendFuncSeparate(state.ColorSrcFactor, state.ColorDstFactor, state.AlphaSrcFactor, state.AlphaDstFactor);
+        mCallCount++;
+    }
+
+    if (mBlendState.ColorOp != state.ColorOp || mBlendState.AlphaOp != state.AlphaOp)
+    {
+        glBlendEquationSeparate(state.ColorOp, state.AlphaOp);
+        mCallCount++;
+    }
+
+    mBlendState = state;
+}
+
+void GLContext::SetScissorTest(bool enabled)
+{
+    if (mScissorTestEnabled == enabled)
+        return;
+
+    if (enabled)
+        glEnable(GL_SCISSOR_TEST);
+    else
+        glDisable(GL_SCISSOR_TEST);
+
+    mScissorTestEnabled = enabled;
+    mCallCount++;
+}
+
+void GLContext::SetViewport(GLsizei width, GLsizei height)
+{
+    if (mViewportWidth == width && mViewportHeight == height)
+        return;
+
+    glViewport(0, 0, width, height);
+    mViewportWidth = width;
+    mViewportHeight = height;
+    mCallCount++;
 }
 
 void GLContext::QueryLimits()
@@ -251,6 +465,7 @@ void GLContext::QueryLimits()
     glGetIntegerv(GL_MAX_COLOR_ATTACHMENTS, &sLimits.MaxColorAttachments);
     glGetIntegerv(GL_MAX_UNIFORM_BLOCK_SIZE, &sLimits.MaxUniformBlockSize);
     glGetIntegerv(GL_MAX_UNIFORM_BUFFER_BINDINGS, &sLimits.MaxUniformBufferBindings);
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &sLimits.UniformBufferOffsetAlignment);
 }
 
 std::string GLContextLimits::ToString() const
@@ -264,6 +479,7 @@ std::string GLContextLimits::ToString() const
     ss << "GL_MAX_COLOR_ATTACHMENTS:\t" << MaxColorAttachments << '\n';
     ss << "GL_MAX_UNIFORM_BLOCK_SIZE:\t" << MaxUniformBlockSize << '\n';
     ss << "GL_MAX_UNIFORM_BUFFER_BINDINGS:\t" << MaxUniformBufferBindings << '\n';
+    ss << "GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:\t" << UniformBufferOffsetAlignment << '\n';
 
     return ss.str();
 }
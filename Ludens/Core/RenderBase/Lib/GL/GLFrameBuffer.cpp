@@ -20,7 +20,6 @@ void GLFrameBuffer::Startup(GLContext& context, const GLFrameBufferInfo& info)
     mInfo = info;
 
     glCreateFramebuffers(1, &mFrameBuffer);
-    mContext->BindFrameBuffer(*this);
 
     mColorAttachmentCount = info.ColorAttachmentCount;
 
@@ -28,10 +27,19 @@ void GLFrameBuffer::Startup(GLContext& context, const GLFrameBufferInfo& info)
     {
         GLTexture2D& attachment = *info.ColorAttachments[i];
 
-        attachment.Bind(0);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, GL_TEXTURE_2D, (GLuint)attachment, 0);
+        glNamedFramebufferTexture(mFrameBuffer, GL_COLOR_ATTACHMENT0 + i, (GLuint)attachment, 0);
+    }
+
+    // draw buffers are frame buffer object state, specify once instead of every render pass
+    Vector<GLenum> drawBuffers(mColorAttachmentCount);
+
+    for (size_t i = 0; i < mColorAttachmentCount; i++)
+    {
+        drawBuffers[i] = GL_COLOR_ATTACHMENT0 + i;
     }
 
+    glNamedFramebufferDrawBuffers(mFrameBuffer, drawBuffers.Size(), drawBuffers.Data());
+
     if (info.DepthStencilAttachment)
     {
         GLTexture2D& attachment = *info.DepthStencilAttachment;
@@ -53,8 +61,7 @@ void GLFrameBuffer::Startup(GLContext& context, const GLFrameBufferInfo& info)
         else
             LD_DEBUG_UNREACHABLE;
 
-        attachment.Bind(0);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, attachmentType, GL_TEXTURE_2D, (GLuint)attachment, 0);
+        glNamedFramebufferTexture(mFrameBuffer, attachmentType, (GLuint)attachment, 0);
     }
     else
     {
@@ -62,9 +69,7 @@ void GLFrameBuffer::Startup(GLContext& context, const GLFrameBufferInfo& info)
         mHasStencilBits = false;
     }
 
-    LD_DEBUG_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
-
-    mContext->UnbindFrameBuffer();
+    LD_DEBUG_ASSERT(glCheckNamedFramebufferStatus(mFrameBuffer, GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
 }
 
 void GLFrameBuffer::Cleanup()
@@ -80,16 +85,4 @@ void GLFrameBuffer::Bind()
     mContext->BindFrameBuffer(*this);
 }
 
-void GLFrameBuffer::BindDrawBuffers()
-{
-    Vector<GLenum> drawBuffers(mColorAttachmentCount);
-
-    for (size_t i = 0; i < mColorAttachmentCount; i++)
-    {
-        drawBuffers[i] = GL_COLOR_ATTACHMENT0 + i;
-    }
-
-    glDrawBuffers(drawBuffers.Size(), drawBuffers.Data());
-}
-
 } // namespace LD
\ No newline at end of file
@@ -32,6 +32,26 @@ bool GetGLSLTypeVertexAttribute(GLSLType glslType, GLint* componentCount, GLenum
         type = GL_FLOAT;
         size = 16;
         break;
+    case GLSLType::UShort4:
+        count = 4;
+        type = GL_UNSIGNED_SHORT;
+        size = 8;
+        break;
+    case GLSLType::Byte4:
+        count = 4;
+        type = GL_BYTE;
+        size = 4;
+        break;
+    case GLSLType::UByte4:
+        count = 4;
+        type = GL_UNSIGNED_BYTE;
+        size = 4;
+        break;
+    case GLSLType::Half2:
+        count = 2;
+        type = GL_HALF_FLOAT;
+        size = 4;
+        break;
     default:
         return false;
     }
@@ -5,6 +5,21 @@
 namespace LD
 {
 
+// number of levels in a full mipmap chain
+static GLsizei GetMipLevels(u32 width, u32 height)
+{
+    u32 extent = width > height ? width : height;
+    GLsizei levels = 1;
+
+    while (extent > 1)
+    {
+        extent >>= 1;
+        levels++;
+    }
+
+    return levels;
+}
+
 GLTexture2D::GLTexture2D() : mContext(nullptr)
 {
 }
@@ -23,20 +38,27 @@ void GLTexture2D::Startup(GLContext& context, const GLTexture2DInfo& info)
     mDataType = info.DataType;
 
     glCreateTextures(GL_TEXTURE_2D, 1, &mTexture);
-    Bind(0);
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, info.AddressModeS);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, info.AddressModeT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, info.MinFilter);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, info.MagFilter);
+    glTextureParameteri(mTexture, GL_TEXTURE_WRAP_S, info.AddressModeS);
+    glTextureParameteri(mTexture, GL_TEXTURE_WRAP_T, info.AddressModeT);
+    glTextureParameteri(mTexture, GL_TEXTURE_MIN_FILTER, info.MinFilter);
+    glTextureParameteri(mTexture, GL_TEXTURE_MAG_FILTER, info.MagFilter);
 
-    glTexImage2D(GL_TEXTURE_2D, 0, mInternalFormat, (GLsizei)info.Width, (GLsizei)info.Height, 0, mDataFormat,
-                 mDataType, info.Data);
-    glGenerateMipmap(GL_TEXTURE_2D);
+    // textures without initial data are render targets and only allocate the base level
+    GLsizei levels = info.Data ? GetMipLevels(info.Width, info.Height) : 1;
+    glTextureStorage2D(mTexture, levels, mInternalFormat, (GLsizei)info.Width, (GLsizei)info.Height);
+
+    if (info.Data)
+    {
+        glTextureSubImage2D(mTexture, 0, 0, 0, (GLsizei)info.Width, (GLsizei)info.Height, mDataFormat, mDataType,
+                            info.Data);
+        glGenerateTextureMipmap(mTexture);
+    }
 }
 
 void GLTexture2D::Cleanup()
 {
+    mContext->ReleaseTexture(mTexture);
     glDeleteTextures(1, &mTexture);
 
     mHandle.Reset();
@@ -47,8 +69,7 @@ void GLTexture2D::Bind(int unit)
 {
     LD_DEBUG_ASSERT(mContext != nullptr);
 
-    mContext->BindTextureUnit(unit);
-    mContext->BindTexture2D(*this);
+    mContext->BindTextureUnit(unit, mTexture);
 }
 
 GLTexture2DArray::GLTexture2DArray() : mContext(nullptr)
@@ -71,17 +92,16 @@ void GLTexture2DArray::Startup(GLContext& context, const GLTexture2DArrayInfo& i
     LD_DEBUG_ASSERT(info.Data != nullptr);
 
     glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &mTexture);
-    Bind(0);
 
     // TODO: mipmap levels
-    glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, info.InternalFormat, mWidth, mHeight, mLayers);
-    glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, mWidth, mHeight, mLayers, info.DataFormat, info.DataType,
-                    info.Data);
-    glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+    glTextureStorage3D(mTexture, 1, info.InternalFormat, mWidth, mHeight, mLayers);
+    glTextureSubImage3D(mTexture, 0, 0, 0, 0, mWidth, mHeight, mLayers, info.DataFormat, info.DataType, info.Data);
+    glGenerateTextureMipmap(mTexture);
 }
 
 void GLTexture2DArray::Cleanup()
 {
+    mContext->ReleaseTexture(mTexture);
     glDeleteTextures(1, &mTexture);
 
     mHandle.Reset();
@@ -92,8 +112,7 @@ void GLTexture2DArray::Bind(int unit)
 {
     LD_DEBUG_ASSERT(mContext != nullptr);
 
-    mContext->BindTextureUnit(unit);
-    mContext->BindTexture2DArray(*this);
+    mContext->BindTextureUnit(unit, mTexture);
 }
 
 GLTextureCube::GLTextureCube() : mContext(nullptr), mTexture(0)
@@ -113,31 +132,23 @@ void GLTextureCube::Startup(GLContext& context, const GLTextureCubeInfo& info)
     LD_DEBUG_ASSERT(info.Data != nullptr);
 
     glCreateTextures(GL_TEXTURE_CUBE_MAP, 1, &mTexture);
-    Bind(0);
-
-    glTexStorage2D(GL_TEXTURE_CUBE_MAP, 1, info.InternalFormat, info.Resolution, info.Resolution);
+    glTextureStorage2D(mTexture, 1, info.InternalFormat, info.Resolution, info.Resolution);
 
-    // TODO: pixel byte size from internal format, relax this constraint for cube maps
-    LD_DEBUG_ASSERT(info.InternalFormat == GL_RGBA8);
-    int faceSize = info.Resolution * info.Resolution * 4;
-
-    for (int i = 0; i < 6; i++)
-    {
-        const char* data = (const char*)info.Data + faceSize * i;
-        glTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, 0, 0, info.Resolution, info.Resolution, info.DataFormat,
-                        info.DataType, data);
-    }
+    // with DSA, cube map faces are addressed as layers of a 3D sub image in +X, -X, +Y, -Y, +Z, -Z order
+    glTextureSubImage3D(mTexture, 0, 0, 0, 0, info.Resolution, info.Resolution, 6, info.DataFormat, info.DataType,
+                        info.Data);
 
     // hard coded sampler properties for cube maps, parameterize later if necessary.
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    glTextureParameteri(mTexture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTextureParameteri(mTexture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTextureParameteri(mTexture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTextureParameteri(mTexture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTextureParameteri(mTexture, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
 }
 
 void GLTextureCube::Cleanup()
 {
+    mContext->ReleaseTexture(mTexture);
     glDeleteTextures(1, &mTexture);
 
     mHandle.Reset();
@@ -148,8 +159,7 @@ void GLTextureCube::Bind(int unit)
 {
     LD_DEBUG_ASSERT(mContext != nullptr);
 
-    mContext->BindTextureUnit(unit);
-    mContext->BindTextureCube(*this);
+    mContext->BindTextureUnit(unit, mTexture);
 }
 
 } // namespace LD
\ No newline at end of file
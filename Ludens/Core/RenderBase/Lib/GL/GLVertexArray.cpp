@@ -54,14 +54,36 @@ void GLVertexArray::BindIBO(GLIndexBuffer& ibo)
             [&]()
             {
                 GLint actual;
-                glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &actual);
+                glGetVertexArrayiv(mVAO, GL_ELEMENT_ARRAY_BUFFER_BINDING, &actual);
                 return actual == (GLuint)ibo;
             }());
         return;
     }
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, (GLuint)ibo);
+    glVertexArrayElementBuffer(mVAO, (GLuint)ibo);
     mBoundIBO = (UID)ibo;
+    mContext->CountCalls(1);
+}
+
+void GLVertexArray::BindVBO(u32 slot, GLVertexBuffer& vbo, u32 stride)
+{
+    if (slot >= mBoundVBOs.Size())
+    {
+        mBoundVBOs.Resize(slot + 1);
+        mBoundVBOOffsets.Resize(slot + 1);
+    }
+
+    // persistent mapped vertex buffers are sourced from the region of the current frame
+    u32 offset = vbo.GetFrameOffset();
+
+    // NOTE: the stride of a slot is fixed by the pipeline that owns this VAO
+    if (mBoundVBOs[slot] == (UID)vbo && mBoundVBOOffsets[slot] == offset)
+        return;
+
+    glVertexArrayVertexBuffer(mVAO, slot, (GLuint)vbo, (GLintptr)offset, (GLsizei)stride);
+    mBoundVBOs[slot] = (UID)vbo;
+    mBoundVBOOffsets[slot] = offset;
+    mContext->CountCalls(1);
 }
 
 } // namespace LD
\ No newline at end of file
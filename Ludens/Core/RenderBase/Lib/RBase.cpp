@@ -339,4 +339,39 @@ void RPipelineBase::Cleanup(RPipeline& pipelineH)
     pipelineH.ResetHandle();
 }
 
+///
+/// Command List Base
+///
+
+RCommandListBase::~RCommandListBase()
+{
+    LD_DEBUG_ASSERT(ID == 0);
+}
+
+void RCommandListBase::Startup(RCommandList& listH, const RCommandListInfo& info, RDeviceBase* device)
+{
+    ID = CUID<RCommandListBase>::Get();
+    Device = device;
+    Stats = {};
+    IsRecording = false;
+
+    if (info.Name)
+        Name = { info.Name, strlen(info.Name) };
+
+    listH.SetHandle(ID, this);
+}
+
+void RCommandListBase::Cleanup(RCommandList& listH)
+{
+    LD_DEBUG_ASSERT(!IsRecording);
+
+    ID.Reset();
+    Device = nullptr;
+
+    BoundPipelineH.ResetHandle();
+    PassH.ResetHandle();
+
+    listH.ResetHandle();
+}
+
 } // namespace LD
\ No newline at end of file
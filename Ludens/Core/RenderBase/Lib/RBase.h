@@ -10,6 +10,7 @@
 #include "Core/RenderBase/Include/RPass.h"
 #include "Core/RenderBase/Include/RFrameBuffer.h"
 #include "Core/RenderBase/Include/RPipeline.h"
+#include "Core/RenderBase/Include/RCommandList.h"
 
 // TODO: randomly hard coded values here, consolidate with graphihcs API backend to determine actual limit
 #define MAX_TEXTURE_COUNT 1024
@@ -20,6 +21,8 @@
 #define MAX_RENDER_PASS_COUNT 256
 #define MAX_FRAME_BUFFER_COUNT 256
 #define MAX_PIPELINE_COUNT 512
+#define MAX_COMMAND_LIST_COUNT 64
+#define MAX_STORAGE_BUFFER_DESCRIPTOR_COUNT 64
 
 namespace LD
 {
@@ -32,14 +35,17 @@ inline TBase& Unwrap(const THandle& handle)
     return *static_cast<TBase*>(handle);
 }
 
+// a device only ever creates objects of its own backend, so the derived type is known
+// statically and no run time type check is needed outside of debug builds.
 template <typename TDerived, typename THandle, typename TBase = typename THandle::Base>
 inline TDerived& Derive(const THandle& handle)
 {
     LD_DEBUG_ASSERT((bool)handle);
 
-    TDerived* derived = dynamic_cast<TDerived*>((TBase*)handle);
+    TBase* base = (TBase*)handle;
+    TDerived* derived = static_cast<TDerived*>(base);
 
-    LD_DEBUG_ASSERT(derived != nullptr);
+    LD_DEBUG_ASSERT(dynamic_cast<TDerived*>(base) == derived);
     return *derived;
 }
 
@@ -78,6 +84,9 @@ struct RDeviceBase
     virtual RResult CreatePipeline(RPipeline& pipeline, const RPipelineInfo& info) = 0;
     virtual RResult DeletePipeline(RPipeline& pipeline) = 0;
 
+    virtual RResult CreateCommandList(RCommandList& list, const RCommandListInfo& info) = 0;
+    virtual RResult DeleteCommandList(RCommandList& list) = 0;
+
     virtual RResult GetSwapChainTextureFormat(RTextureFormat& format) = 0;
     virtual RResult GetSwapChainRenderPass(RPass& renderPass) = 0;
     virtual RResult GetSwapChainFrameBuffer(RFrameBuffer& frameBuffer) = 0;
@@ -95,6 +104,8 @@ struct RDeviceBase
     virtual RResult PushScissor(const Rect2D& scissor) = 0;
     virtual RResult PopScissor() = 0;
 
+    virtual RResult ExecuteCommandLists(View<RCommandList> lists) = 0;
+
     virtual RResult DrawVertex(const RDrawVertexInfo& info) = 0;
     virtual RResult DrawIndexed(const RDrawIndexedInfo& info) = 0;
 
@@ -102,13 +113,18 @@ struct RDeviceBase
 
     virtual void WaitIdle() {}
 
+    /// total number of graphics API calls issued by backends that track them
+    virtual u64 GetDriverCallCount() { return 0; }
+
     CUID<RDeviceBase> ID;
     Stack<Rect2D> Scissors;
     Vec2 ViewportExtent;
     RDrawStats* Stats = nullptr;
+    u64 StatsDriverCallBase = 0;
     RResultCallback Callback;
     RPipeline BoundPipelineH;
     RPass CurrentPassH;
+    bool BindlessSupport = false; // storage buffers and bindless binding arrays are available
 };
 
 struct RTextureBase
@@ -184,7 +200,7 @@ struct RBindingGroupLayoutBase
             return false;
 
         for (size_t i = 0; i < Bindings.Size(); i++)
-            if (Bindings[i].Type != other.Bindings[i].Type)
+            if (Bindings[i].Type != other.Bindings[i].Type || Bindings[i].Bindless != other.Bindings[i].Bindless)
                 return false;
 
         return true;
@@ -208,6 +224,7 @@ struct RBindingGroupBase
 
     virtual RResult BindTexture(u32 binding, RTexture& textureH, int arrayIndex) = 0;
     virtual RResult BindUniformBuffer(u32 binding, RBuffer& bufferH) = 0;
+    virtual RResult BindStorageBuffer(u32 binding, RBuffer& bufferH) = 0;
 
     struct Binding
     {
@@ -292,4 +309,37 @@ struct RPipelineBase
     RPolygonMode PolygonMode;
 };
 
+// Recording state is owned by the command list instead of the device, the backend
+// implementations must not touch device state that is shared with other threads.
+struct RCommandListBase
+{
+    RCommandListBase() = default;
+    RCommandListBase(const RCommandListBase&) = delete;
+    virtual ~RCommandListBase();
+
+    RCommandListBase& operator=(const RCommandListBase&) = delete;
+
+    void Startup(RCommandList& listH, const RCommandListInfo& info, RDeviceBase* device);
+    void Cleanup(RCommandList& listH);
+
+    virtual RResult Begin(const RCommandListBeginInfo& info) = 0;
+    virtual RResult End() = 0;
+
+    virtual RResult SetPipeline(RPipeline& pipeline) = 0;
+    virtual RResult SetBindingGroup(u32 slot, RBindingGroup& group) = 0;
+    virtual RResult SetVertexBuffer(u32 slot, RBuffer& buffer) = 0;
+    virtual RResult SetIndexBuffer(RBuffer& buffer, RIndexType indexType) = 0;
+
+    virtual RResult DrawVertex(const RDrawVertexInfo& info) = 0;
+    virtual RResult DrawIndexed(const RDrawIndexedInfo& info) = 0;
+
+    CUID<RCommandListBase> ID;
+    RDeviceBase* Device = nullptr;
+    std::string Name;
+    RPipeline BoundPipelineH;
+    RPass PassH;
+    RDrawStats Stats; // draws of the latest recording, merged into the device stats on execution
+    bool IsRecording = false;
+};
+
 } // namespace LD
\ No newline at end of file
@@ -14,4 +14,9 @@ RResult RBindingGroup::BindUniformBuffer(u32 bindingIdx, RBuffer& bufferH)
     return mBase->BindUniformBuffer(bindingIdx, bufferH);
 }
 
+RResult RBindingGroup::BindStorageBuffer(u32 bindingIdx, RBuffer& bufferH)
+{
+    return mBase->BindStorageBuffer(bindingIdx, bufferH);
+}
+
 } // namespace LD
\ No newline at end of file
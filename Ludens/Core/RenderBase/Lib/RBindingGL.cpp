@@ -77,4 +77,14 @@ RResult RBindingGroupGL::BindUniformBuffer(u32 binding, RBuffer& bufferH)
     return {};
 }
 
+RResult RBindingGroupGL::BindStorageBuffer(u32 binding, RBuffer& bufferH)
+{
+    // RDevice rejects layouts with storage buffers, the OpenGL backend has no bindless support
+    LD_DEBUG_UNREACHABLE;
+
+    RResult result;
+    result.Type = RResultType::FeatureUnsupported;
+    return result;
+}
+
 } // namespace LD
\ No newline at end of file
@@ -34,6 +34,7 @@ struct RBindingGroupGL : RBindingGroupBase
 
     virtual RResult BindTexture(u32 binding, RTexture& textureH, int arrayIndex) override;
     virtual RResult BindUniformBuffer(u32 binding, RBuffer& bufferH) override;
+    virtual RResult BindStorageBuffer(u32 binding, RBuffer& bufferH) override;
 };
 
 } // namespace LD
\ No newline at end of file
@@ -27,7 +27,14 @@ void RBindingGroupLayoutVK::Startup(RBindingGroupLayout& layoutH, const RBinding
         VkDescriptorSetLayoutBinding setLayoutBinding =
             VKInfo::DescriptorSetLayoutBinding(bindingIdx, DeriveVKDescriptorType(binding.Type), binding.Count,
                                                VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT);
-        DescriptorSetLayout.AddBinding(setLayoutBinding);
+
+        // bindless arrays are sparsely populated and written while earlier frames are still in flight
+        VkDescriptorBindingFlags bindingFlags = 0;
+        if (binding.Bindless)
+            bindingFlags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+                           VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
+
+        DescriptorSetLayout.AddBinding(setLayoutBinding, bindingFlags);
     }
 
     DescriptorSetLayout.Startup(context.GetDevice());
@@ -96,4 +103,14 @@ RResult RBindingGroupVK::BindUniformBuffer(u32 binding, RBuffer& bufferH)
     return {};
 }
 
+RResult RBindingGroupVK::BindStorageBuffer(u32 binding, RBuffer& bufferH)
+{
+    VKContext& vkContext = Device->Context;
+    VKBuffer& vkBuffer = Derive<RBufferVK>(bufferH).Buffer;
+
+    DescriptorSet.Write(vkContext.GetDevice(), vkBuffer, binding, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+
+    return {};
+}
+
 } // namespace LD
\ No newline at end of file
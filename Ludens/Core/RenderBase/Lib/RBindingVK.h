@@ -36,6 +36,7 @@ struct RBindingGroupVK : RBindingGroupBase
 
     virtual RResult BindTexture(u32 binding, RTexture& textureH, int arrayIndex) override;
     virtual RResult BindUniformBuffer(u32 binding, RBuffer& bufferH) override;
+    virtual RResult BindStorageBuffer(u32 binding, RBuffer& bufferH) override;
 
     VKDescriptorSet DescriptorSet;
     RDeviceVK* Device = nullptr;
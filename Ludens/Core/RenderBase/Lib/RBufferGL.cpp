@@ -29,6 +29,7 @@ void RBufferGL::Startup(RBuffer& handle, const RBufferInfo& info, RDeviceGL& dev
         vboInfo.Usage = GL_STATIC_DRAW;
         vboInfo.Data = info.Data;
         vboInfo.Size = info.Size;
+        vboInfo.PersistentMap = info.MemoryUsage == RMemoryUsage::FrameDynamic;
         VBO.Startup(device.Context, vboInfo);
         break;
     }
@@ -47,6 +48,7 @@ void RBufferGL::Startup(RBuffer& handle, const RBufferInfo& info, RDeviceGL& dev
         uboInfo.Usage = GL_STATIC_DRAW;
         uboInfo.Size = info.Size;
         uboInfo.Data = info.Data;
+        uboInfo.PersistentMap = info.MemoryUsage == RMemoryUsage::FrameDynamic;
         UBO.Startup(device.Context, uboInfo);
         break;
     }
@@ -95,8 +97,7 @@ void RBufferGL::Bind()
 
 RResult RBufferGL::SetData(u32 offset, u32 size, const void* data)
 {
-    Bind();
-
+    // buffer updates use direct state access and do not disturb bindings
     switch (Target)
     {
     case GL_ARRAY_BUFFER:
@@ -32,6 +32,9 @@ void RBufferVK::Startup(RBuffer& bufferH, const RBufferInfo& info, RDeviceVK& de
     case RBufferType::UniformBuffer:
         bufferUsage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
         break;
+    case RBufferType::StorageBuffer:
+        bufferUsage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        break;
     default:
         LD_DEBUG_UNREACHABLE;
     }
@@ -43,6 +46,7 @@ void RBufferVK::Startup(RBuffer& bufferH, const RBufferInfo& info, RDeviceVK& de
         memoryProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
         break;
     case RMemoryUsage::FrameDynamic:
+    case RMemoryUsage::Persistent:
         memoryProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
         break;
     default:
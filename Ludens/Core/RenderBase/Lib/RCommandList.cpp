@@ -0,0 +1,203 @@
+#include <algorithm>
+#include "Core/RenderBase/Include/RCommandList.h"
+#include "Core/RenderBase/Lib/RBase.h"
+
+namespace LD
+{
+
+// command lists may be recorded from worker threads, results are still reported through the device callback
+// so it must be safe to invoke concurrently.
+static inline RResult Report(RCommandListBase* list, const RResult& result)
+{
+    list->Device->Callback(result);
+    return result;
+}
+
+static inline bool NotRecording(RCommandListBase* list, RResult& result)
+{
+    if (!list->IsRecording)
+    {
+        result.Type = RResultType::CommandListStateError;
+        return true;
+    }
+
+    return false;
+}
+
+static inline bool MissingPipeline(RCommandListBase* list, RResult& result)
+{
+    if (!list->BoundPipelineH)
+    {
+        result.Type = RResultType::ResourceMissing;
+        result.ResourceMissing.MissingType = RResourceType::Pipeline;
+        return true;
+    }
+
+    return false;
+}
+
+static inline bool BufferTypeMismatch(RBufferType expect, RBufferType actual, RResult& result)
+{
+    if (expect != actual)
+    {
+        result.Type = RResultType::BufferTypeMismatch;
+        result.BufferTypeMismatch.Expect = expect;
+        result.BufferTypeMismatch.Actual = actual;
+        return true;
+    }
+
+    return false;
+}
+
+RResult RCommandList::Begin(const RCommandListBeginInfo& info)
+{
+    RResult result;
+
+    if (!info.RenderPass || !info.FrameBuffer)
+    {
+        result.Type = RResultType::InvalidHandle;
+        return Report(mBase, result);
+    }
+
+    LD_DEBUG_ASSERT(!mBase->IsRecording);
+
+    mBase->Stats = {};
+    mBase->PassH = info.RenderPass;
+    mBase->BoundPipelineH.ResetHandle();
+    mBase->IsRecording = true;
+
+    result = mBase->Begin(info);
+    return Report(mBase, result);
+}
+
+RResult RCommandList::End()
+{
+    RResult result;
+
+    if (NotRecording(mBase, result))
+        return Report(mBase, result);
+
+    result = mBase->End();
+    mBase->IsRecording = false;
+
+    return Report(mBase, result);
+}
+
+RResult RCommandList::SetPipeline(RPipeline& pipelineH)
+{
+    RResult result;
+
+    if (NotRecording(mBase, result))
+        return Report(mBase, result);
+
+    RPipelineBase& pipeline = Unwrap(pipelineH);
+    LD_DEBUG_ASSERT(!(pipeline.DepthTestEnabled && !mBase->PassH.HasDepthStencilAttachment()));
+
+    mBase->BoundPipelineH = pipelineH;
+    result = mBase->SetPipeline(pipelineH);
+    return Report(mBase, result);
+}
+
+RResult RCommandList::SetBindingGroup(u32 slot, RBindingGroup& groupH)
+{
+    RResult result;
+
+    if (NotRecording(mBase, result) || MissingPipeline(mBase, result))
+        return Report(mBase, result);
+
+    RPipelineBase& pipeline = Unwrap(mBase->BoundPipelineH);
+    RBindingGroupBase& group = Unwrap(groupH);
+    RBindingGroupLayoutBase& layout = Unwrap(group.GroupLayoutH);
+
+    if (slot >= pipeline.GroupLayoutsH.Size())
+    {
+        result.Type = RResultType::InvalidIndex;
+        return Report(mBase, result);
+    }
+
+    if (!layout.HasSameLayout(Unwrap(pipeline.GroupLayoutsH[slot])))
+    {
+        result.Type = RResultType::BindingGroupMismatch;
+        return Report(mBase, result);
+    }
+
+    result = mBase->SetBindingGroup(slot, groupH);
+    return Report(mBase, result);
+}
+
+RResult RCommandList::SetVertexBuffer(u32 slot, RBuffer& bufferH)
+{
+    RResult result;
+
+    if (NotRecording(mBase, result) || MissingPipeline(mBase, result))
+        return Report(mBase, result);
+
+    RBufferBase& buffer = Unwrap(bufferH);
+
+    if (BufferTypeMismatch(RBufferType::VertexBuffer, buffer.Type, result))
+        return Report(mBase, result);
+
+    RPipelineBase& pipeline = Unwrap(mBase->BoundPipelineH);
+
+    if (slot >= pipeline.VertexLayout.Slots.Size())
+    {
+        result.Type = RResultType::InvalidIndex;
+        return Report(mBase, result);
+    }
+
+    result = mBase->SetVertexBuffer(slot, bufferH);
+    return Report(mBase, result);
+}
+
+RResult RCommandList::SetIndexBuffer(RBuffer& bufferH, RIndexType indexType)
+{
+    RResult result;
+
+    if (NotRecording(mBase, result) || MissingPipeline(mBase, result))
+        return Report(mBase, result);
+
+    RBufferBase& buffer = Unwrap(bufferH);
+
+    if (BufferTypeMismatch(RBufferType::IndexBuffer, buffer.Type, result))
+        return Report(mBase, result);
+
+    result = mBase->SetIndexBuffer(bufferH, indexType);
+    return Report(mBase, result);
+}
+
+RResult RCommandList::DrawVertex(const RDrawVertexInfo& info)
+{
+    RResult result;
+
+    if (NotRecording(mBase, result) || MissingPipeline(mBase, result))
+        return Report(mBase, result);
+
+    result = mBase->DrawVertex(info);
+    if (result)
+    {
+        mBase->Stats.DrawVertexCalls++;
+        mBase->Stats.TotalVertices += info.InstanceCount * info.VertexCount;
+    }
+
+    return Report(mBase, result);
+}
+
+RResult RCommandList::DrawIndexed(const RDrawIndexedInfo& info)
+{
+    RResult result;
+
+    if (NotRecording(mBase, result) || MissingPipeline(mBase, result))
+        return Report(mBase, result);
+
+    result = mBase->DrawIndexed(info);
+    if (result)
+    {
+        mBase->Stats.DrawIndexedCalls++;
+        mBase->Stats.TotalVertices += info.InstanceCount * info.IndexCount;
+        mBase->Stats.LODDrawCalls[std::min<u32>(info.LOD, LD_DRAW_STATS_MAX_LODS - 1)]++;
+    }
+
+    return Report(mBase, result);
+}
+
+} // namespace LD
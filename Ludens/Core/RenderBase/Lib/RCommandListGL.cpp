@@ -0,0 +1,103 @@
+#include "Core/RenderBase/Lib/RCommandListGL.h"
+#include "Core/RenderBase/Lib/RDeviceGL.h"
+
+namespace LD
+{
+
+RCommandListGL::RCommandListGL()
+{
+}
+
+RCommandListGL::~RCommandListGL()
+{
+    LD_DEBUG_ASSERT(ID == 0);
+}
+
+void RCommandListGL::Startup(RCommandList& listH, const RCommandListInfo& info, RDeviceGL& device)
+{
+    RCommandListBase::Startup(listH, info, (RDeviceBase*)&device);
+}
+
+void RCommandListGL::Cleanup(RCommandList& listH)
+{
+    RCommandListBase::Cleanup(listH);
+
+    Commands.Clear();
+}
+
+RResult RCommandListGL::Begin(const RCommandListBeginInfo& info)
+{
+    Commands.Clear();
+
+    return {};
+}
+
+RResult RCommandListGL::End()
+{
+    return {};
+}
+
+RResult RCommandListGL::SetPipeline(RPipeline& pipeline)
+{
+    RCommandGL cmd{};
+    cmd.CommandType = RCommandGL::Type::SetPipeline;
+    cmd.Pipeline = pipeline;
+    Commands.PushBack(cmd);
+
+    return {};
+}
+
+RResult RCommandListGL::SetBindingGroup(u32 slot, RBindingGroup& group)
+{
+    RCommandGL cmd{};
+    cmd.CommandType = RCommandGL::Type::SetBindingGroup;
+    cmd.Slot = slot;
+    cmd.BindingGroup = group;
+    Commands.PushBack(cmd);
+
+    return {};
+}
+
+RResult RCommandListGL::SetVertexBuffer(u32 slot, RBuffer& buffer)
+{
+    RCommandGL cmd{};
+    cmd.CommandType = RCommandGL::Type::SetVertexBuffer;
+    cmd.Slot = slot;
+    cmd.Buffer = buffer;
+    Commands.PushBack(cmd);
+
+    return {};
+}
+
+RResult RCommandListGL::SetIndexBuffer(RBuffer& buffer, RIndexType indexType)
+{
+    RCommandGL cmd{};
+    cmd.CommandType = RCommandGL::Type::SetIndexBuffer;
+    cmd.IndexType = indexType;
+    cmd.Buffer = buffer;
+    Commands.PushBack(cmd);
+
+    return {};
+}
+
+RResult RCommandListGL::DrawVertex(const RDrawVertexInfo& info)
+{
+    RCommandGL cmd{};
+    cmd.CommandType = RCommandGL::Type::DrawVertex;
+    cmd.DrawVertex = info;
+    Commands.PushBack(cmd);
+
+    return {};
+}
+
+RResult RCommandListGL::DrawIndexed(const RDrawIndexedInfo& info)
+{
+    RCommandGL cmd{};
+    cmd.CommandType = RCommandGL::Type::DrawIndexed;
+    cmd.DrawIndexed = info;
+    Commands.PushBack(cmd);
+
+    return {};
+}
+
+} // namespace LD
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Core/DSA/Include/Vector.h"
+#include "Core/RenderBase/Lib/RBase.h"
+
+namespace LD
+{
+
+struct RDeviceGL;
+
+// OpenGL has no command buffers and the context is bound to a single thread,
+// commands are stored and replayed by RDeviceGL::ExecuteCommandLists.
+struct RCommandGL
+{
+    enum class Type
+    {
+        SetPipeline = 0,
+        SetBindingGroup,
+        SetVertexBuffer,
+        SetIndexBuffer,
+        DrawVertex,
+        DrawIndexed,
+    };
+
+    Type CommandType;
+    u32 Slot;
+    RIndexType IndexType;
+    RPipeline Pipeline;
+    RBindingGroup BindingGroup;
+    RBuffer Buffer;
+    RDrawVertexInfo DrawVertex;
+    RDrawIndexedInfo DrawIndexed;
+};
+
+struct RCommandListGL : RCommandListBase
+{
+    RCommandListGL();
+    RCommandListGL(const RCommandListGL&) = delete;
+    ~RCommandListGL();
+
+    RCommandListGL& operator=(const RCommandListGL&) = delete;
+
+    void Startup(RCommandList& listH, const RCommandListInfo& info, RDeviceGL& device);
+    void Cleanup(RCommandList& listH);
+
+    virtual RResult Begin(const RCommandListBeginInfo& info) override;
+    virtual RResult End() override;
+
+    virtual RResult SetPipeline(RPipeline& pipeline) override;
+    virtual RResult SetBindingGroup(u32 slot, RBindingGroup& group) override;
+    virtual RResult SetVertexBuffer(u32 slot, RBuffer& buffer) override;
+    virtual RResult SetIndexBuffer(RBuffer& buffer, RIndexType indexType) override;
+
+    virtual RResult DrawVertex(const RDrawVertexInfo& info) override;
+    virtual RResult DrawIndexed(const RDrawIndexedInfo& info) override;
+
+    // keeps its capacity across frames, so steady state recording does not allocate
+    Vector<RCommandGL> Commands;
+};
+
+} // namespace LD
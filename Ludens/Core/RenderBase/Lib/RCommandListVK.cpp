@@ -0,0 +1,153 @@
+#include "Core/RenderBase/Include/VK/VKInfo.h"
+#include "Core/RenderBase/Lib/RCommandListVK.h"
+#include "Core/RenderBase/Lib/RDeviceVK.h"
+#include "Core/RenderBase/Lib/RDeriveVK.h"
+
+namespace LD
+{
+
+RCommandListVK::RCommandListVK()
+{
+}
+
+RCommandListVK::~RCommandListVK()
+{
+    LD_DEBUG_ASSERT(ID == 0);
+}
+
+void RCommandListVK::Startup(RCommandList& listH, const RCommandListInfo& info, RDeviceVK& device)
+{
+    RCommandListBase::Startup(listH, info, (RDeviceBase*)&device);
+
+    VKDevice& vkDevice = device.Context.GetDevice();
+
+    VkCommandPoolCreateInfo commandPoolCI =
+        VKInfo::CommandPoolCreate(VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, vkDevice.GetGraphicsIndex());
+    CommandPool.Startup(vkDevice, commandPoolCI);
+
+    CommandBuffers.Resize(DEVICE_CONCURRENT_FRAMES);
+    for (VKCommandBuffer& commandBuffer : CommandBuffers)
+        commandBuffer.AllocateSecondary(vkDevice, CommandPool, 1);
+}
+
+void RCommandListVK::Cleanup(RCommandList& listH)
+{
+    RDeviceVK& device = *(RDeviceVK*)Device;
+    VKDevice& vkDevice = device.Context.GetDevice();
+
+    RCommandListBase::Cleanup(listH);
+
+    for (VKCommandBuffer& commandBuffer : CommandBuffers)
+        commandBuffer.Free(vkDevice);
+
+    CommandBuffers.Clear();
+    CommandPool.Cleanup();
+}
+
+VKCommandBuffer& RCommandListVK::GetCommandBuffer()
+{
+    RDeviceVK& device = *(RDeviceVK*)Device;
+
+    return CommandBuffers[device.FrameIndex];
+}
+
+RResult RCommandListVK::Begin(const RCommandListBeginInfo& info)
+{
+    VKRenderPass& pass = Derive<RPassVK>(info.RenderPass).RenderPass;
+    RFrameBufferVK& frameBufferVK = Derive<RFrameBufferVK>(info.FrameBuffer);
+    VKFrameBuffer& frameBuffer = frameBufferVK.FrameBuffer;
+    VKCommandBuffer& commandBuffer = GetCommandBuffer();
+
+    RenderExtent.width = info.RenderWidth > 0 ? info.RenderWidth : frameBufferVK.Width;
+    RenderExtent.height = info.RenderHeight > 0 ? info.RenderHeight : frameBufferVK.Height;
+
+    VkCommandBufferInheritanceInfo inheritance{};
+    inheritance.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritance.renderPass = pass.GetHandle();
+    inheritance.subpass = 0;
+    inheritance.framebuffer = frameBuffer.GetHandle();
+
+    // the frame fence waited in RDeviceVK::BeginFrame guarantees this buffer is no longer in use
+    commandBuffer.Reset(0);
+    commandBuffer.BeginRecord(VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT, inheritance);
+
+    return {};
+}
+
+RResult RCommandListVK::End()
+{
+    GetCommandBuffer().EndRecord();
+
+    return {};
+}
+
+RResult RCommandListVK::SetPipeline(RPipeline& pipelineH)
+{
+    RPipelineVK& pipelineVK = Derive<RPipelineVK>(pipelineH);
+    VKCommandBuffer& commandBuffer = GetCommandBuffer();
+
+    // JobSystem waits are reserved for the main thread, which waits for compile jobs before recording
+    LD_DEBUG_ASSERT(pipelineVK.IsCompiled);
+
+    // secondary command buffers do not inherit dynamic state from the primary
+    VkRect2D scissor = VKInfo::Rect2D(RenderExtent);
+    VkViewport viewport;
+    viewport.x = 0.0f;
+    viewport.y = (float)RenderExtent.height;
+    viewport.width = (float)RenderExtent.width;
+    viewport.height = -(float)RenderExtent.height;
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+
+    commandBuffer.CmdBindGraphicsPipeline(pipelineVK.Pipeline.GetHandle());
+    commandBuffer.CmdSetViewport(viewport);
+    commandBuffer.CmdSetScissor(scissor);
+
+    return {};
+}
+
+RResult RCommandListVK::SetBindingGroup(u32 groupIdx, RBindingGroup& groupH)
+{
+    VkDescriptorSet descriptorSet = Derive<RBindingGroupVK>(groupH).DescriptorSet.GetHandle();
+    VkPipelineLayout pipelineLayout = Derive<RPipelineVK>(BoundPipelineH).PipelineLayout.GetHandle();
+
+    vkCmdBindDescriptorSets(GetCommandBuffer().GetHandle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, groupIdx,
+                            1, &descriptorSet, 0, nullptr);
+
+    return {};
+}
+
+RResult RCommandListVK::SetVertexBuffer(u32 slot, RBuffer& bufferH)
+{
+    VKBuffer& buffer = Derive<RBufferVK>(bufferH).Buffer;
+
+    GetCommandBuffer().CmdBindVertexBuffer(slot, buffer.GetHandle(), 0);
+
+    return {};
+}
+
+RResult RCommandListVK::SetIndexBuffer(RBuffer& bufferH, RIndexType indexType)
+{
+    VKBuffer& buffer = Derive<RBufferVK>(bufferH).Buffer;
+
+    GetCommandBuffer().CmdBindIndexBuffer(buffer.GetHandle(), 0, DeriveVKIndexType(indexType));
+
+    return {};
+}
+
+RResult RCommandListVK::DrawVertex(const RDrawVertexInfo& info)
+{
+    LD_DEBUG_ASSERT(info.VertexStart == 0);
+    GetCommandBuffer().CmdDrawVertex(info.VertexCount, info.InstanceCount, info.InstanceStart);
+
+    return {};
+}
+
+RResult RCommandListVK::DrawIndexed(const RDrawIndexedInfo& info)
+{
+    GetCommandBuffer().CmdDrawIndexed(info.IndexCount, info.InstanceCount, info.IndexStart, info.InstanceStart);
+
+    return {};
+}
+
+} // namespace LD
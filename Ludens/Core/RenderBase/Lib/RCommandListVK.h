@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Core/DSA/Include/Vector.h"
+#include "Core/RenderBase/Include/VK/VKCommand.h"
+#include "Core/RenderBase/Lib/RBase.h"
+
+namespace LD
+{
+
+struct RDeviceVK;
+
+// Each command list owns a command pool, so recording on different worker threads never
+// contends on pool allocation. One secondary command buffer is kept per frame in flight,
+// the buffer of the current frame is reset and re-recorded every time the list is begun.
+struct RCommandListVK : RCommandListBase
+{
+    RCommandListVK();
+    RCommandListVK(const RCommandListVK&) = delete;
+    ~RCommandListVK();
+
+    RCommandListVK& operator=(const RCommandListVK&) = delete;
+
+    void Startup(RCommandList& listH, const RCommandListInfo& info, RDeviceVK& device);
+    void Cleanup(RCommandList& listH);
+
+    virtual RResult Begin(const RCommandListBeginInfo& info) override;
+    virtual RResult End() override;
+
+    virtual RResult SetPipeline(RPipeline& pipeline) override;
+    virtual RResult SetBindingGroup(u32 slot, RBindingGroup& group) override;
+    virtual RResult SetVertexBuffer(u32 slot, RBuffer& buffer) override;
+    virtual RResult SetIndexBuffer(RBuffer& buffer, RIndexType indexType) override;
+
+    virtual RResult DrawVertex(const RDrawVertexInfo& info) override;
+    virtual RResult DrawIndexed(const RDrawIndexedInfo& info) override;
+
+    /// the secondary command buffer recorded for the current frame
+    VKCommandBuffer& GetCommandBuffer();
+
+    VKCommandPool CommandPool;
+    Vector<VKCommandBuffer> CommandBuffers;
+    VkExtent2D RenderExtent{}; // viewport and scissor extent of the current recording
+};
+
+} // namespace LD
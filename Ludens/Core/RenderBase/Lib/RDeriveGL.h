@@ -70,6 +70,14 @@ inline GLSLType DeriveGLSLType(RDataType type)
         return GLSLType::Vec3;
     case RDataType::Vec4:
         return GLSLType::Vec4;
+    case RDataType::UShort4:
+        return GLSLType::UShort4;
+    case RDataType::Byte4:
+        return GLSLType::Byte4;
+    case RDataType::UByte4:
+        return GLSLType::UByte4;
+    case RDataType::Half2:
+        return GLSLType::Half2;
     }
 
     LD_DEBUG_UNREACHABLE;
@@ -25,7 +25,7 @@ static const TextureFormatMap sTextureFormatMap[]{
 
 LD_STATIC_ASSERT(sizeof(sTextureFormatMap) / sizeof(*sTextureFormatMap) == (size_t)RTextureFormat::EnumCount);
 
-static VkFormat DeriveVKVertexAttributeFormat(RDataType type, u32* size)
+static VkFormat DeriveVKVertexAttributeFormat(RDataType type, bool isNormalized, u32* size)
 {
     VkFormat attrFormat;
     u32 attrSize;
@@ -48,6 +48,23 @@ static VkFormat DeriveVKVertexAttributeFormat(RDataType type, u32* size)
         attrFormat = VK_FORMAT_R32G32B32A32_SFLOAT;
         attrSize = 16;
         break;
+    case RDataType::UShort4:
+        // scaled formats convert integers to floats without normalizing, as OpenGL does
+        attrFormat = isNormalized ? VK_FORMAT_R16G16B16A16_UNORM : VK_FORMAT_R16G16B16A16_USCALED;
+        attrSize = 8;
+        break;
+    case RDataType::Byte4:
+        attrFormat = isNormalized ? VK_FORMAT_R8G8B8A8_SNORM : VK_FORMAT_R8G8B8A8_SSCALED;
+        attrSize = 4;
+        break;
+    case RDataType::UByte4:
+        attrFormat = isNormalized ? VK_FORMAT_R8G8B8A8_UNORM : VK_FORMAT_R8G8B8A8_USCALED;
+        attrSize = 4;
+        break;
+    case RDataType::Half2:
+        attrFormat = VK_FORMAT_R16G16_SFLOAT;
+        attrSize = 4;
+        break;
     default:
         LD_DEBUG_UNREACHABLE;
     }
@@ -177,7 +194,7 @@ void DeriveVKVertexLayout(const RVertexLayout& inLayout, VKVertexLayout& outLayo
         for (const RVertexAttribute& attr : slot.Attributes)
         {
             u32 attrSize;
-            VkFormat format = DeriveVKVertexAttributeFormat(attr.Type, &attrSize);
+            VkFormat format = DeriveVKVertexAttributeFormat(attr.Type, attr.IsNormalized, &attrSize);
 
             VkVertexInputAttributeDescription inputAttr{};
             inputAttr.binding = slotIdx;
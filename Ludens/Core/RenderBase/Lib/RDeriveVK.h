@@ -32,6 +32,8 @@ inline VkDescriptorType DeriveVKDescriptorType(RBindingType type)
         return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     case RBindingType::UniformBuffer:
         return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    case RBindingType::StorageBuffer:
+        return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
     default:
         break;
     }
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <algorithm>
 #include <iostream>
 #include "Core/RenderBase/Include/RDevice.h"
 #include "Core/RenderBase/Include/RShader.h"
 #include "Core/RenderBase/Include/RBuffer.h"
 #include "Core/RenderBase/Include/RBinding.h"
 #include "Core/RenderBase/Include/RPass.h"
+#include "Core/RenderBase/Include/RCommandList.h"
 #include "Core/RenderBase/Lib/RDeviceGL.h"
 #include "Core/RenderBase/Lib/RDeviceVK.h"
 #include "Core/RenderBase/Lib/RBindingGL.h"
@@ -25,6 +27,17 @@ static inline bool MissingPipeline(RDeviceBase* device, RResult& result)
     return false;
 }
 
+static inline bool RequiresBindlessSupport(const RBindingGroupLayoutInfo& info)
+{
+    for (const RBindingInfo& binding : info.Bindings)
+    {
+        if (binding.Bindless || binding.Type == RBindingType::StorageBuffer)
+            return true;
+    }
+
+    return false;
+}
+
 static inline bool BufferTypeMismatch(RBufferType expect, RBufferType actual, RResult& result)
 {
     if (expect != actual)
@@ -139,6 +152,8 @@ RResult RDevice::CreateBuffer(RBuffer& buffer, const RBufferInfo& info)
 
     if (buffer)
         result.Type = RResultType::InvalidHandle;
+    else if (info.Type == RBufferType::StorageBuffer && !mBase->BindlessSupport)
+        result.Type = RResultType::FeatureUnsupported;
     else
         result = mBase->CreateBuffer(buffer, info);
 
@@ -191,6 +206,8 @@ RResult RDevice::CreateBindingGroupLayout(RBindingGroupLayout& layout, const RBi
 
     if (layout)
         result.Type = RResultType::InvalidHandle;
+    else if (RequiresBindlessSupport(info) && !mBase->BindlessSupport)
+        result.Type = RResultType::FeatureUnsupported;
     else
         result = mBase->CreateBindingGroupLayout(layout, info);
 
@@ -347,6 +364,38 @@ RResult RDevice::DeletePipeline(RPipeline& pipeline)
     return result;
 }
 
+RResult RDevice::CreateCommandList(RCommandList& list, const RCommandListInfo& info)
+{
+    RResult result;
+
+    if (list)
+    {
+        result.Type = RResultType::InvalidHandle;
+        mBase->Callback(result);
+        return result;
+    }
+
+    result = mBase->CreateCommandList(list, info);
+    mBase->Callback(result);
+    return result;
+}
+
+RResult RDevice::DeleteCommandList(RCommandList& list)
+{
+    RResult result;
+
+    if (!list)
+    {
+        result.Type = RResultType::InvalidHandle;
+        mBase->Callback(result);
+        return result;
+    }
+
+    result = mBase->DeleteCommandList(list);
+    mBase->Callback(result);
+    return result;
+}
+
 RResult RDevice::GetSwapChainTextureFormat(RTextureFormat& format)
 {
     RResult result;
@@ -448,6 +497,10 @@ RResult RDevice::BeginRenderPass(const RPassBeginInfo& info)
 
     // TODO: check if framebuffer color attachments are in the ShaderResource state
 
+    // a reduced render area must fit in the frame buffer
+    RFrameBufferBase& frameBuffer = Unwrap(info.FrameBuffer);
+    LD_DEBUG_ASSERT(info.RenderWidth <= frameBuffer.Width && info.RenderHeight <= frameBuffer.Height);
+
     mBase->CurrentPassH = info.RenderPass;
     result = mBase->BeginRenderPass(info);
 
@@ -582,8 +635,13 @@ RResult RDevice::BeginDrawStats(RDrawStats* stats)
     stats->TotalVertices = 0;
     stats->DrawVertexCalls = 0;
     stats->DrawIndexedCalls = 0;
+    stats->DriverCalls = 0;
+
+    for (u32& count : stats->LODDrawCalls)
+        count = 0;
 
     mBase->Stats = stats;
+    mBase->StatsDriverCallBase = mBase->GetDriverCallCount();
     mBase->Callback(result);
     return result;
 }
@@ -592,6 +650,9 @@ RResult RDevice::EndDrawStats()
 {
     RResult result;
 
+    if (mBase->Stats)
+        mBase->Stats->DriverCalls = (u32)(mBase->GetDriverCallCount() - mBase->StatsDriverCallBase);
+
     mBase->Stats = nullptr;
     mBase->Callback(result);
     return result;
@@ -621,6 +682,47 @@ RResult RDevice::PopScissor()
     return result;
 }
 
+RResult RDevice::ExecuteCommandLists(View<RCommandList> lists)
+{
+    RResult result;
+
+    for (const RCommandList& listH : lists)
+    {
+        RCommandListBase& list = Unwrap(listH);
+
+        if (list.IsRecording)
+        {
+            result.Type = RResultType::CommandListStateError;
+            mBase->Callback(result);
+            return result;
+        }
+
+        LD_DEBUG_ASSERT(list.PassH == mBase->CurrentPassH && "command list recorded for another render pass");
+    }
+
+    result = mBase->ExecuteCommandLists(lists);
+
+    if (result && mBase->Stats)
+    {
+        for (const RCommandList& listH : lists)
+        {
+            RCommandListBase& list = Unwrap(listH);
+            mBase->Stats->DrawVertexCalls += list.Stats.DrawVertexCalls;
+            mBase->Stats->DrawIndexedCalls += list.Stats.DrawIndexedCalls;
+            mBase->Stats->TotalVertices += list.Stats.TotalVertices;
+
+            for (int i = 0; i < LD_DRAW_STATS_MAX_LODS; i++)
+                mBase->Stats->LODDrawCalls[i] += list.Stats.LODDrawCalls[i];
+        }
+    }
+
+    // pipeline and bindings recorded in command lists do not carry over to the device
+    mBase->BoundPipelineH.ResetHandle();
+
+    mBase->Callback(result);
+    return result;
+}
+
 RResult RDevice::DrawVertex(const RDrawVertexInfo& info)
 {
     RResult result;
@@ -657,6 +759,7 @@ RResult RDevice::DrawIndexed(const RDrawIndexedInfo& info)
     {
         mBase->Stats->DrawIndexedCalls++;
         mBase->Stats->TotalVertices += info.IndexCount * info.InstanceCount;
+        mBase->Stats->LODDrawCalls[std::min<u32>(info.LOD, LD_DRAW_STATS_MAX_LODS - 1)]++;
     }
 
     mBase->Callback(result);
@@ -676,4 +779,9 @@ void RDevice::WaitIdle()
     mBase->WaitIdle();
 }
 
+bool RDevice::HasBindlessSupport() const
+{
+    return mBase->BindlessSupport;
+}
+
 } // namespace LD
\ No newline at end of file
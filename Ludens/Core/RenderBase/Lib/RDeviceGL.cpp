@@ -40,6 +40,7 @@ void RDeviceGL::Startup(RDevice& handle, const RDeviceInfo& info)
     RenderPassAllocator.Startup(MAX_RENDER_PASS_COUNT);
     FrameBufferAllocator.Startup(MAX_FRAME_BUFFER_COUNT);
     PipelineAllocator.Startup(MAX_PIPELINE_COUNT);
+    CommandListAllocator.Startup(MAX_COMMAND_LIST_COUNT);
 
     Context.Startup();
 
@@ -71,6 +72,7 @@ void RDeviceGL::Cleanup(RDevice& handle)
 
     Context.Cleanup();
 
+    CommandListAllocator.Cleanup();
     PipelineAllocator.Cleanup();
     FrameBufferAllocator.Cleanup();
     RenderPassAllocator.Cleanup();
@@ -131,11 +133,11 @@ RResult RDeviceGL::CreateBuffer(RBuffer& bufferH, const RBufferInfo& info)
 
 RResult RDeviceGL::DeleteBuffer(RBuffer& bufferH)
 {
-    RBufferGL* buffer = dynamic_cast<RBufferGL*>((RBufferBase*)bufferH);
+    RBufferGL& buffer = Derive<RBufferGL>(bufferH);
 
-    buffer->Cleanup(bufferH);
-    buffer->~RBufferGL();
-    BufferAllocator.Free(buffer);
+    buffer.Cleanup(bufferH);
+    buffer.~RBufferGL();
+    BufferAllocator.Free(&buffer);
 
     return {};
 }
@@ -151,11 +153,11 @@ RResult RDeviceGL::CreateShader(RShader& shaderH, const RShaderInfo& info)
 
 RResult RDeviceGL::DeleteShader(RShader& shaderH)
 {
-    RShaderGL* shader = dynamic_cast<RShaderGL*>((RShaderBase*)shaderH);
+    RShaderGL& shader = Derive<RShaderGL>(shaderH);
 
-    shader->Cleanup(shaderH);
-    shader->~RShaderGL();
-    ShaderAllocator.Free(shader);
+    shader.Cleanup(shaderH);
+    shader.~RShaderGL();
+    ShaderAllocator.Free(&shader);
 
     return {};
 }
@@ -172,11 +174,11 @@ RResult RDeviceGL::CreateBindingGroupLayout(RBindingGroupLayout& layoutH, const
 
 RResult RDeviceGL::DeleteBindingGroupLayout(RBindingGroupLayout& layoutH)
 {
-    RBindingGroupLayoutGL* layout = dynamic_cast<RBindingGroupLayoutGL*>((RBindingGroupLayoutBase*)layoutH);
+    RBindingGroupLayoutGL& layout = Derive<RBindingGroupLayoutGL>(layoutH);
 
-    layout->Cleanup(layoutH);
-    layout->~RBindingGroupLayoutGL();
-    BindingGroupLayoutAllocator.Free(layout);
+    layout.Cleanup(layoutH);
+    layout.~RBindingGroupLayoutGL();
+    BindingGroupLayoutAllocator.Free(&layout);
 
     return {};
 }
@@ -192,11 +194,11 @@ RResult RDeviceGL::CreateBindingGroup(RBindingGroup& groupH, const RBindingGroup
 
 RResult RDeviceGL::DeleteBindingGroup(RBindingGroup& groupH)
 {
-    RBindingGroupGL* group = dynamic_cast<RBindingGroupGL*>((RBindingGroupBase*)groupH);
+    RBindingGroupGL& group = Derive<RBindingGroupGL>(groupH);
 
-    group->Cleanup(groupH);
-    group->~RBindingGroupGL();
-    BindingGroupAllocator.Free(group);
+    group.Cleanup(groupH);
+    group.~RBindingGroupGL();
+    BindingGroupAllocator.Free(&group);
 
     return {};
 }
@@ -251,11 +253,31 @@ RResult RDeviceGL::CreatePipeline(RPipeline& pipelineH, const RPipelineInfo& inf
 
 RResult RDeviceGL::DeletePipeline(RPipeline& pipelineH)
 {
-    RPipelineGL* pipeline = dynamic_cast<RPipelineGL*>((RPipelineBase*)pipelineH);
+    RPipelineGL& pipeline = Derive<RPipelineGL>(pipelineH);
+
+    pipeline.Cleanup(pipelineH);
+    pipeline.~RPipelineGL();
+    PipelineAllocator.Free(&pipeline);
+
+    return {};
+}
+
+RResult RDeviceGL::CreateCommandList(RCommandList& listH, const RCommandListInfo& info)
+{
+    RCommandListGL* list = (RCommandListGL*)CommandListAllocator.Alloc(sizeof(RCommandListGL));
+    new (list) RCommandListGL{};
+    list->Startup(listH, info, *this);
 
-    pipeline->Cleanup(pipelineH);
-    pipeline->~RPipelineGL();
-    PipelineAllocator.Free(pipeline);
+    return {};
+}
+
+RResult RDeviceGL::DeleteCommandList(RCommandList& listH)
+{
+    RCommandListGL& list = Derive<RCommandListGL>(listH);
+
+    list.Cleanup(listH);
+    list.~RCommandListGL();
+    CommandListAllocator.Free(&list);
 
     return {};
 }
@@ -292,6 +314,9 @@ RResult RDeviceGL::BeginFrame()
 
 RResult RDeviceGL::EndFrame()
 {
+    // FrameDynamic buffers written after this point go to the region of the next frame
+    Context.EndFrame();
+
     return {};
 }
 
@@ -303,6 +328,7 @@ RResult RDeviceGL::BeginRenderPass(const RPassBeginInfo& info)
     if (frameBuffer.IsDefaultFrameBuffer)
     {
         Context.UnbindFrameBuffer();
+        Context.SetViewport((GLsizei)ViewportExtent.x, (GLsizei)ViewportExtent.y);
 
         GLenum clearMask = 0;
 
@@ -316,6 +342,7 @@ RResult RDeviceGL::BeginRenderPass(const RPassBeginInfo& info)
 
                 clearMask |= GL_COLOR_BUFFER_BIT;
                 glClearColor(color.r, color.g, color.b, color.a);
+                Context.CountCalls(1);
             }
             if (clearValue.DepthStencil.HasValue())
             {
@@ -328,18 +355,26 @@ RResult RDeviceGL::BeginRenderPass(const RPassBeginInfo& info)
 
                 clearMask |= GL_STENCIL_BUFFER_BIT;
                 glClearStencil(depthStencil.Stencil);
+                Context.CountCalls(2);
             }
         }
 
         // clear the default framebuffer attachments
         if (clearMask != 0)
+        {
             glClear(clearMask);
+            Context.CountCalls(1);
+        }
 
         return {};
     }
 
     Context.BindFrameBuffer(frameBuffer.FBO);
-    frameBuffer.FBO.BindDrawBuffers();
+
+    // offscreen framebuffers may be smaller than the viewport
+    GLsizei renderWidth = info.RenderWidth > 0 ? (GLsizei)info.RenderWidth : (GLsizei)frameBuffer.Width;
+    GLsizei renderHeight = info.RenderHeight > 0 ? (GLsizei)info.RenderHeight : (GLsizei)frameBuffer.Height;
+    Context.SetViewport(renderWidth, renderHeight);
 
     // clear individual framebuffer attachments
     for (size_t i = 0; i < info.ClearValues.Size(); i++)
@@ -350,6 +385,7 @@ RResult RDeviceGL::BeginRenderPass(const RPassBeginInfo& info)
         {
             const RClearColorValue& colorValue = clearValue.Color.Value();
             glClearBufferfv(GL_COLOR, i, colorValue.Data);
+            Context.CountCalls(1);
         }
         else if (clearValue.DepthStencil.HasValue())
         {
@@ -357,12 +393,14 @@ RResult RDeviceGL::BeginRenderPass(const RPassBeginInfo& info)
             {
                 GLfloat depthValue = (GLfloat)clearValue.DepthStencil.Value().Depth;
                 glClearBufferfv(GL_DEPTH, 0, &depthValue);
+                Context.CountCalls(1);
             }
 
             if (frameBuffer.FBO.HasStencilBits())
             {
                 GLint stencilValue = (GLint)clearValue.DepthStencil.Value().Stencil;
                 glClearBufferiv(GL_STENCIL, 0, &stencilValue);
+                Context.CountCalls(1);
             }
         }
     }
@@ -379,51 +417,22 @@ RResult RDeviceGL::SetPipeline(RPipeline& pipelineH)
 {
     LD_DEBUG_ASSERT(BoundPipelineH && BoundPipelineH == pipelineH);
 
+    // the context skips any binding or state change that is already in effect,
+    // so consecutive draws with the same pipeline do not reach the driver.
     RPipelineGL& pipeline = Derive<RPipelineGL>(BoundPipelineH);
     pipeline.VAO.Bind();
     pipeline.Program.Bind();
 
     // set rasterization states
-    if (pipeline.GLCullMode == GL_NONE)
-    {
-        glDisable(GL_CULL_FACE);
-        glPolygonMode(GL_FRONT_AND_BACK, pipeline.GLPolygonMode);
-    }
-    else
-    {
-        GLenum rasterizeFace = pipeline.GLCullMode == GL_BACK ? GL_FRONT : GL_BACK;
-
-        glEnable(GL_CULL_FACE);
-        glFrontFace(GL_CCW);
-        glCullFace(pipeline.GLCullMode);
-        glPolygonMode(rasterizeFace, pipeline.GLPolygonMode);
-    }
+    Context.SetCullMode(pipeline.GLCullMode);
+    Context.SetPolygonMode(pipeline.GLPolygonMode);
 
     // set depth stencil states
-    if (pipeline.DepthTestEnabled)
-    {
-        glEnable(GL_DEPTH_TEST);
-        glDepthFunc(DeriveGLDepthFunc(pipeline.DepthCompareMode));
-    }
-    else
-    {
-        glDisable(GL_DEPTH_TEST);
-    }
-
-    glDepthMask(pipeline.DepthWriteEnabled);
+    Context.SetDepthTest(pipeline.DepthTestEnabled, pipeline.GLDepthFunc);
+    Context.SetDepthMask(pipeline.DepthWriteEnabled);
 
     // set blend states
-    if (pipeline.BlendEnabled)
-    {
-        glEnable(GL_BLEND);
-        glBlendFuncSeparate(pipeline.GLColorBlendSrcFactor, pipeline.GLColorBlendDstFactor,
-                            pipeline.GLAlphaBlendSrcFactor, pipeline.GLAlphaBlendDstFactor);
-        glBlendEquationSeparate(pipeline.GLColorBlendOp, pipeline.GLAlphaBlendOp);
-    }
-    else
-    {
-        glDisable(GL_BLEND);
-    }
+    Context.SetBlend(pipeline.BlendEnabled, pipeline.GLBlend);
 
     return {};
 }
@@ -435,12 +444,10 @@ RResult RDeviceGL::SetBindingGroup(u32 groupIdx, RBindingGroup& groupH)
     RBindingGroupGL& group = Derive<RBindingGroupGL>(groupH);
     RPipelineGL& pipeline = Derive<RPipelineGL>(BoundPipelineH);
 
-    // look up table that maps binding qualifiers to OpenGL texture units or buffer bases
-    std::unordered_map<u32, u32>& textureUnitBinding = pipeline.TextureUnitBinding[groupIdx];
-    std::unordered_map<u32, u32>& uniformBufferBinding = pipeline.UniformBufferBinding[groupIdx];
-
-    // TODO: compare with bound pipeline layout
-    pipeline.Program.Bind();
+    // look up table that maps binding qualifiers to OpenGL texture units or buffer bases,
+    // texture units and buffer bases are context state and do not require the program to be bound.
+    const Vector<u32>& textureUnitBinding = pipeline.TextureUnitBinding[groupIdx];
+    const Vector<u32>& uniformBufferBinding = pipeline.UniformBufferBinding[groupIdx];
 
     for (size_t bindingIdx = 0; bindingIdx < group.Bindings.Size(); bindingIdx++)
     {
@@ -492,20 +499,19 @@ RResult RDeviceGL::SetVertexBuffer(u32 slot, RBuffer& bufferH)
 
     LD_DEBUG_ASSERT(buffer.Target == GL_ARRAY_BUFFER && "binding a non vertex buffer");
 
-    pipeline.VAO.Bind();
-
-    glBindVertexBuffer(slot, (GLuint)buffer.VBO, 0, pipeline.VertexStrides[slot]);
+    pipeline.VAO.BindVBO(slot, buffer.VBO, pipeline.VertexStrides[slot]);
 
     return {};
 }
 
 RResult RDeviceGL::SetIndexBuffer(RBuffer& bufferH, RIndexType indexType)
 {
+    RPipelineGL& pipeline = Derive<RPipelineGL>(BoundPipelineH);
     RBufferGL& buffer = Derive<RBufferGL>(bufferH);
 
     LD_DEBUG_ASSERT(buffer.Target == GL_ELEMENT_ARRAY_BUFFER && "binding a non index buffer");
 
-    buffer.Bind();
+    pipeline.VAO.BindIBO(buffer.IBO);
     IndexType = DeriveGLIndexType(indexType);
 
     return {};
@@ -513,16 +519,13 @@ RResult RDeviceGL::SetIndexBuffer(RBuffer& bufferH, RIndexType indexType)
 
 RResult RDeviceGL::PushScissor(const Rect2D& scissor)
 {
-    if (Scissors.IsEmpty())
-    {
-        glEnable(GL_SCISSOR_TEST);
-    }
-
+    Context.SetScissorTest(true);
     Scissors.Push(scissor);
 
     GLint sx = scissor.x;
     GLint sy = ViewportExtent.y - scissor.h - scissor.y;
     glScissor(sx, sy, (GLsizei)scissor.w, (GLsizei)scissor.h);
+    Context.CountCalls(1);
 
     return {};
 }
@@ -535,7 +538,7 @@ RResult RDeviceGL::PopScissor()
 
     if (Scissors.IsEmpty())
     {
-        glDisable(GL_SCISSOR_TEST);
+        Context.SetScissorTest(false);
     }
     else
     {
@@ -543,6 +546,46 @@ RResult RDeviceGL::PopScissor()
         GLint sx = scissor.x;
         GLint sy = ViewportExtent.y - scissor.h - scissor.y;
         glScissor(sx, sy, (GLsizei)scissor.w, (GLsizei)scissor.h);
+        Context.CountCalls(1);
+    }
+
+    return {};
+}
+
+RResult RDeviceGL::ExecuteCommandLists(View<RCommandList> lists)
+{
+    // replay on the context thread, recording only captured handles and arguments
+    for (const RCommandList& listH : lists)
+    {
+        RCommandListGL& list = Derive<RCommandListGL>(listH);
+
+        for (RCommandGL& cmd : list.Commands)
+        {
+            switch (cmd.CommandType)
+            {
+            case RCommandGL::Type::SetPipeline:
+                BoundPipelineH = cmd.Pipeline;
+                SetPipeline(cmd.Pipeline);
+                break;
+            case RCommandGL::Type::SetBindingGroup:
+                SetBindingGroup(cmd.Slot, cmd.BindingGroup);
+                break;
+            case RCommandGL::Type::SetVertexBuffer:
+                SetVertexBuffer(cmd.Slot, cmd.Buffer);
+                break;
+            case RCommandGL::Type::SetIndexBuffer:
+                SetIndexBuffer(cmd.Buffer, cmd.IndexType);
+                break;
+            case RCommandGL::Type::DrawVertex:
+                DrawVertex(cmd.DrawVertex);
+                break;
+            case RCommandGL::Type::DrawIndexed:
+                DrawIndexed(cmd.DrawIndexed);
+                break;
+            default:
+                LD_DEBUG_UNREACHABLE;
+            }
+        }
     }
 
     return {};
@@ -557,6 +600,7 @@ RResult RDeviceGL::DrawVertex(const RDrawVertexInfo& info)
 
     GLCommand::DrawArraysInstanced(pipeline.GLPrimitiveTopology, info.VertexCount, info.InstanceCount,
                                    info.InstanceStart);
+    Context.CountCalls(1);
 
     return {};
 }
@@ -569,6 +613,7 @@ RResult RDeviceGL::DrawIndexed(const RDrawIndexedInfo& info)
 
     GLCommand::DrawElementsInstanced(pipeline.GLPrimitiveTopology, info.IndexCount, IndexType, info.InstanceCount,
                                      info.IndexStart, info.InstanceStart);
+    Context.CountCalls(1);
 
     return {};
 }
@@ -577,11 +622,16 @@ RResult RDeviceGL::ResizeViewport(int width, int height)
 {
     ViewportExtent.x = width;
     ViewportExtent.y = height;
-    glViewport(0, 0, width, height);
+    Context.SetViewport(width, height);
 
     return {};
 }
 
+u64 RDeviceGL::GetDriverCallCount()
+{
+    return Context.GetCallCount();
+}
+
 RResult RDeviceGL::CreateDefaultFrameBuffer(RFrameBuffer& frameBufferH)
 {
     RFrameBufferGL* frameBuffer = (RFrameBufferGL*)FrameBufferAllocator.Alloc(sizeof(RFrameBufferGL));
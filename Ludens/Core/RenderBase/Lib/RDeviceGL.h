@@ -12,6 +12,7 @@
 #include "Core/RenderBase/Lib/RPassGL.h"
 #include "Core/RenderBase/Lib/RFrameBufferGL.h"
 #include "Core/RenderBase/Lib/RPipelineGL.h"
+#include "Core/RenderBase/Lib/RCommandListGL.h"
 #include "Core/RenderBase/Lib/RBase.h"
 
 namespace LD
@@ -56,6 +57,9 @@ struct RDeviceGL : RDeviceBase
     virtual RResult CreatePipeline(RPipeline& pipeline, const RPipelineInfo& info) override;
     virtual RResult DeletePipeline(RPipeline& pipeline) override;
 
+    virtual RResult CreateCommandList(RCommandList& list, const RCommandListInfo& info) override;
+    virtual RResult DeleteCommandList(RCommandList& list) override;
+
     virtual RResult GetSwapChainTextureFormat(RTextureFormat& format) override;
     virtual RResult GetSwapChainRenderPass(RPass& renderPass) override;
     virtual RResult GetSwapChainFrameBuffer(RFrameBuffer& frameBuffer) override;
@@ -73,11 +77,15 @@ struct RDeviceGL : RDeviceBase
     virtual RResult PushScissor(const Rect2D& scissor) override;
     virtual RResult PopScissor() override;
 
+    virtual RResult ExecuteCommandLists(View<RCommandList> lists) override;
+
     virtual RResult DrawVertex(const RDrawVertexInfo& info) override;
     virtual RResult DrawIndexed(const RDrawIndexedInfo& info) override;
 
     virtual RResult ResizeViewport(int width, int height) override;
 
+    virtual u64 GetDriverCallCount() override;
+
     /// create a handle referencing the default frame buffer created along OpenGL context
     RResult CreateDefaultFrameBuffer(RFrameBuffer& frameBufferH);
 
@@ -92,6 +100,7 @@ struct RDeviceGL : RDeviceBase
     PoolAllocator<sizeof(RPassGL)> RenderPassAllocator;
     PoolAllocator<sizeof(RFrameBufferGL)> FrameBufferAllocator;
     PoolAllocator<sizeof(RPipelineGL)> PipelineAllocator;
+    PoolAllocator<sizeof(RCommandListGL)> CommandListAllocator;
     GLContext Context;
     GLenum IndexType;
 
@@ -4,13 +4,113 @@
 #include "Core/RenderBase/Lib/RDeriveVK.h"
 #include "Core/DSA/Include/Vector.h"
 #include "Core/OS/Include/Time.h"
+#include "Core/OS/Include/JobSystem.h"
 #include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <cstring>
+
+#define PIPELINE_CACHE_FILE_NAME "vk_pipeline_cache.bin"
+#define PIPELINE_CACHE_FILE_MAGIC 0x4344504C // "LPDC"
 
 namespace LD
 {
 
 static RDeviceVK sDevice;
 
+/// written in front of the driver cache blob, the blob is only reused
+/// if it was produced by the same physical device and driver version
+struct PipelineCacheFileHeader
+{
+    u32 Magic;
+    u32 VendorID;
+    u32 DeviceID;
+    u32 DriverVersion;
+    u8 PipelineCacheUUID[VK_UUID_SIZE];
+    u64 DataSize;
+};
+
+static bool LoadPipelineCacheData(const std::string& path, const VkPhysicalDeviceProperties& properties,
+                                  Vector<u8>& data)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open())
+        return false;
+
+    PipelineCacheFileHeader header;
+    if (!stream.read((char*)&header, sizeof(header)))
+        return false;
+
+    if (header.Magic != PIPELINE_CACHE_FILE_MAGIC || header.VendorID != properties.vendorID ||
+        header.DeviceID != properties.deviceID || header.DriverVersion != properties.driverVersion ||
+        memcmp(header.PipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+        return false;
+
+    data.Resize((size_t)header.DataSize);
+    if (!stream.read((char*)data.Data(), (std::streamsize)header.DataSize))
+    {
+        data.Clear();
+        return false;
+    }
+
+    // the driver performs the same check on its own header, reject early so a stale blob is never handed over
+    VkPipelineCacheHeaderVersionOne driverHeader;
+    if (data.Size() < sizeof(driverHeader))
+    {
+        data.Clear();
+        return false;
+    }
+
+    memcpy(&driverHeader, data.Data(), sizeof(driverHeader));
+    if (driverHeader.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+        memcmp(driverHeader.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+    {
+        data.Clear();
+        return false;
+    }
+
+    return true;
+}
+
+static void SavePipelineCacheData(const std::string& path, const VkPhysicalDeviceProperties& properties,
+                                  VkDevice device, VkPipelineCache cache)
+{
+    size_t dataSize = 0;
+    if (vkGetPipelineCacheData(device, cache, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0)
+        return;
+
+    Vector<u8> data(dataSize);
+    if (vkGetPipelineCacheData(device, cache, &dataSize, data.Data()) != VK_SUCCESS)
+        return;
+
+    PipelineCacheFileHeader header;
+    header.Magic = PIPELINE_CACHE_FILE_MAGIC;
+    header.VendorID = properties.vendorID;
+    header.DeviceID = properties.deviceID;
+    header.DriverVersion = properties.driverVersion;
+    header.DataSize = (u64)dataSize;
+    memcpy(header.PipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    if (!stream.is_open())
+        return;
+
+    stream.write((const char*)&header, sizeof(header));
+    stream.write((const char*)data.Data(), (std::streamsize)dataSize);
+}
+
+/// Job::Main for pipeline compilation, vkCreateGraphicsPipelines is
+/// free threaded and the shared VkPipelineCache is internally synchronized.
+static void CompilePipelineJob(void* data)
+{
+    RPipelineVK* pipeline = (RPipelineVK*)data;
+
+    pipeline->Pipeline.Startup(sDevice.Context.GetDevice(), sDevice.PipelineCache);
+    pipeline->IsCompiled = true;
+
+    sDevice.PendingPipelineCount.fetch_sub(1);
+}
+
 RDeviceVK::RDeviceVK()
 {
 }
@@ -52,6 +152,7 @@ void RDeviceVK::Startup(RDevice& deviceH, const RDeviceInfo& info)
     RenderPassAllocator.Startup(MAX_RENDER_PASS_COUNT);
     FrameBufferAllocator.Startup(MAX_FRAME_BUFFER_COUNT);
     PipelineAllocator.Startup(MAX_PIPELINE_COUNT);
+    CommandListAllocator.Startup(MAX_COMMAND_LIST_COUNT);
 
     Context.Startup(VKContextInfo{});
     VKDevice& vkDevice = Context.GetDevice();
@@ -63,6 +164,24 @@ void RDeviceVK::Startup(RDevice& deviceH, const RDeviceInfo& info)
     // see RDeviceVK::OnObserverNotify
     vkSwapChain.AddObserver(this);
 
+    // pipeline cache from the previous run, discarded if the device or driver has changed
+    {
+        Vector<u8> cacheData;
+
+        if (info.CacheDirectory)
+        {
+            PipelineCachePath = std::string(info.CacheDirectory) + "/" + PIPELINE_CACHE_FILE_NAME;
+            LoadPipelineCacheData(PipelineCachePath, vkDevice.GetPhysicalDevice().GetProperties(), cacheData);
+        }
+
+        VkPipelineCacheCreateInfo pipelineCacheCI{};
+        pipelineCacheCI.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        pipelineCacheCI.initialDataSize = cacheData.Size();
+        pipelineCacheCI.pInitialData = cacheData.IsEmpty() ? nullptr : cacheData.Data();
+
+        VK_ASSERT(vkCreatePipelineCache(vkDevice.GetHandle(), &pipelineCacheCI, nullptr, &PipelineCache));
+    }
+
     // create depth stencil image
     {
         RTextureFormat depthStencilFormat = DeriveRTextureFormat(vkDepthStencilFormat);
@@ -81,15 +200,22 @@ void RDeviceVK::Startup(RDevice& deviceH, const RDeviceInfo& info)
     {
         // NOTE: overkill and inaccurate
 
-        Array<VkDescriptorPoolSize, 2> poolSizes = {
+        Array<VkDescriptorPoolSize, 3> poolSizes = {
             VKInfo::DescriptorPoolSize(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, DEVICE_CONCURRENT_FRAMES * MAX_BUFFER_COUNT),
             VKInfo::DescriptorPoolSize(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
                                        DEVICE_CONCURRENT_FRAMES * MAX_TEXTURE_COUNT),
+            VKInfo::DescriptorPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, MAX_STORAGE_BUFFER_DESCRIPTOR_COUNT),
         };
 
+        // bindless binding groups must be allocated from an update-after-bind pool
+        VkDescriptorPoolCreateFlags poolFlags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+        BindlessSupport = vkDevice.HasBindlessSupport();
+
+        if (BindlessSupport)
+            poolFlags |= VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+
         VkDescriptorPoolCreateInfo descriptorPoolCI = VKInfo::DescriptorPoolCreate(
-            poolSizes.Size(), poolSizes.Data(), DEVICE_CONCURRENT_FRAMES * MAX_BINDING_GROUP_COUNT,
-            VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT);
+            poolSizes.Size(), poolSizes.Data(), DEVICE_CONCURRENT_FRAMES * MAX_BINDING_GROUP_COUNT, poolFlags);
 
         DescriptorPool.Startup(vkDevice, descriptorPoolCI);
     }
@@ -153,6 +279,22 @@ void RDeviceVK::Cleanup(RDevice& deviceH)
 
     VKDevice& vkDevice = Context.GetDevice();
 
+    WaitPipelines();
+
+    if (!PipelineCachePath.empty())
+    {
+        std::filesystem::path cacheDirectory = std::filesystem::path(PipelineCachePath).parent_path();
+        std::error_code ec;
+        std::filesystem::create_directories(cacheDirectory, ec);
+
+        SavePipelineCacheData(PipelineCachePath, vkDevice.GetPhysicalDevice().GetProperties(), vkDevice.GetHandle(),
+                              PipelineCache);
+    }
+
+    vkDestroyPipelineCache(vkDevice.GetHandle(), PipelineCache, nullptr);
+    PipelineCache = VK_NULL_HANDLE;
+    PipelineCachePath.clear();
+
     for (FrameData& frame : Frames)
     {
         frame.CommandBuffer.Free(vkDevice);
@@ -185,6 +327,7 @@ void RDeviceVK::Cleanup(RDevice& deviceH)
 
     Context.Cleanup();
 
+    CommandListAllocator.Cleanup();
     PipelineAllocator.Cleanup();
     FrameBufferAllocator.Cleanup();
     RenderPassAllocator.Cleanup();
@@ -260,6 +403,15 @@ RResult RDeviceVK::DeleteShader(RShader& shaderH)
 {
     RShaderVK& shader = Derive<RShaderVK>(shaderH);
 
+    // shaders are usually deleted right after CreatePipeline, keep the
+    // module alive until the compile jobs referencing it are complete
+    if (PendingPipelineCount > 0)
+    {
+        DeferredShaders.PushBack(&shader);
+        shaderH.ResetHandle();
+        return {};
+    }
+
     shader.Cleanup(shaderH);
     shader.~RShaderVK();
     ShaderAllocator.Free(&shader);
@@ -321,6 +473,8 @@ RResult RDeviceVK::DeleteRenderPass(RPass& passH)
 {
     RPassVK& pass = Derive<RPassVK>(passH);
 
+    WaitPipelines();
+
     pass.Cleanup(passH);
     pass.~RPassVK();
     RenderPassAllocator.Free(&pass);
@@ -354,6 +508,14 @@ RResult RDeviceVK::CreatePipeline(RPipeline& pipelineH, const RPipelineInfo& inf
     new (pipeline) RPipelineVK{};
     pipeline->Startup(pipelineH, info, *this);
 
+    PendingPipelineCount.fetch_add(1);
+
+    Job job;
+    job.Type = JobType::CompilePipeline;
+    job.Main = &CompilePipelineJob;
+    job.Data = pipeline;
+    JobSystem::GetSingleton().Submit(job);
+
     return {};
 }
 
@@ -361,6 +523,8 @@ RResult RDeviceVK::DeletePipeline(RPipeline& pipelineH)
 {
     RPipelineVK& pipeline = Derive<RPipelineVK>(pipelineH);
 
+    WaitPipeline(pipeline);
+
     VKDevice& vkDevice = Context.GetDevice();
     vkDeviceWaitIdle(vkDevice.GetHandle());
 
@@ -371,6 +535,29 @@ RResult RDeviceVK::DeletePipeline(RPipeline& pipelineH)
     return {};
 }
 
+RResult RDeviceVK::CreateCommandList(RCommandList& listH, const RCommandListInfo& info)
+{
+    RCommandListVK* list = (RCommandListVK*)CommandListAllocator.Alloc(sizeof(RCommandListVK));
+    new (list) RCommandListVK{};
+    list->Startup(listH, info, *this);
+
+    return {};
+}
+
+RResult RDeviceVK::DeleteCommandList(RCommandList& listH)
+{
+    RCommandListVK& list = Derive<RCommandListVK>(listH);
+
+    VKDevice& vkDevice = Context.GetDevice();
+    vkDeviceWaitIdle(vkDevice.GetHandle());
+
+    list.Cleanup(listH);
+    list.~RCommandListVK();
+    CommandListAllocator.Free(&list);
+
+    return {};
+}
+
 RResult RDeviceVK::GetSwapChainTextureFormat(RTextureFormat& format)
 {
     VKSwapChain& vkSwapChain = Context.GetSwapChain();
@@ -404,6 +591,9 @@ RResult RDeviceVK::BeginFrame()
 
     frame.Fence.FrameComplete.Wait(UINT64_MAX);
 
+    if (!DeferredShaders.IsEmpty() && PendingPipelineCount == 0)
+        WaitPipelines();
+
     double swapChainWaitTime;
     {
         ScopeTimer timer(&swapChainWaitTime);
@@ -458,10 +648,14 @@ RResult RDeviceVK::EndFrame()
 RResult RDeviceVK::BeginRenderPass(const RPassBeginInfo& info)
 {
     VKRenderPass& pass = Derive<RPassVK>(info.RenderPass).RenderPass;
-    VKFrameBuffer& frameBuffer = Derive<RFrameBufferVK>(info.FrameBuffer).FrameBuffer;
-    VKSwapChain& vkSwapChain = Context.GetSwapChain();
+    RFrameBufferVK& frameBufferVK = Derive<RFrameBufferVK>(info.FrameBuffer);
+    VKFrameBuffer& frameBuffer = frameBufferVK.FrameBuffer;
     FrameData& frame = Frames[FrameIndex];
 
+    // offscreen framebuffers may be smaller than the swap chain
+    PassExtent.width = info.RenderWidth > 0 ? info.RenderWidth : frameBufferVK.Width;
+    PassExtent.height = info.RenderHeight > 0 ? info.RenderHeight : frameBufferVK.Height;
+
     Vector<VkClearValue> vkClearValues(info.ClearValues.Size());
     for (size_t i = 0; i < info.ClearValues.Size(); i++)
     {
@@ -481,9 +675,11 @@ RResult RDeviceVK::BeginRenderPass(const RPassBeginInfo& info)
     }
 
     VkRenderPassBeginInfo beginInfo = VKInfo::RenderPassBegin(
-        pass.GetHandle(), frameBuffer.GetHandle(), vkSwapChain.GetExtent(), vkClearValues.Size(), vkClearValues.Data());
+        pass.GetHandle(), frameBuffer.GetHandle(), PassExtent, vkClearValues.Size(), vkClearValues.Data());
 
-    frame.CommandBuffer.CmdBeginRenderPass(beginInfo);
+    VkSubpassContents contents =
+        info.UseCommandLists ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE;
+    frame.CommandBuffer.CmdBeginRenderPass(beginInfo, contents);
 
     return {};
 }
@@ -500,15 +696,17 @@ RResult RDeviceVK::EndRenderPass()
 RResult RDeviceVK::SetPipeline(RPipeline& pipelineH)
 {
     FrameData& frame = Frames[FrameIndex];
-    VKPipeline& pipeline = Derive<RPipelineVK>(pipelineH).Pipeline;
-    VkExtent2D swapChainExtent = Context.GetSwapChain().GetExtent();
-    VkRect2D scissor = VKInfo::Rect2D(swapChainExtent);
+    RPipelineVK& pipelineVK = Derive<RPipelineVK>(pipelineH);
+    WaitPipeline(pipelineVK);
+
+    VKPipeline& pipeline = pipelineVK.Pipeline;
+    VkRect2D scissor = VKInfo::Rect2D(PassExtent);
     VkViewport viewport;
 
     viewport.x = 0.0f;
-    viewport.y = (float)swapChainExtent.height;
-    viewport.width = (float)swapChainExtent.width;
-    viewport.height = -(float)swapChainExtent.height;
+    viewport.y = (float)PassExtent.height;
+    viewport.width = (float)PassExtent.width;
+    viewport.height = -(float)PassExtent.height;
     viewport.minDepth = 0.0f;
     viewport.maxDepth = 1.0f;
 
@@ -598,13 +796,29 @@ RResult RDeviceVK::PopScissor()
     return {};
 }
 
+RResult RDeviceVK::ExecuteCommandLists(View<RCommandList> lists)
+{
+    FrameData& frame = Frames[FrameIndex];
+
+    Vector<VkCommandBuffer> secondaries(lists.Size());
+    for (size_t i = 0; i < lists.Size(); i++)
+    {
+        RCommandListVK& list = Derive<RCommandListVK>(lists[i]);
+        secondaries[i] = list.GetCommandBuffer().GetHandle();
+    }
+
+    if (!secondaries.IsEmpty())
+        frame.CommandBuffer.CmdExecuteCommands((u32)secondaries.Size(), secondaries.Data());
+
+    return {};
+}
+
 RResult RDeviceVK::DrawVertex(const RDrawVertexInfo& info)
 {
     FrameData& frame = Frames[FrameIndex];
 
     LD_DEBUG_ASSERT(info.VertexStart == 0);
-    LD_DEBUG_ASSERT(info.InstanceStart == 0);
-    frame.CommandBuffer.CmdDrawVertex(info.VertexCount, info.InstanceCount);
+    frame.CommandBuffer.CmdDrawVertex(info.VertexCount, info.InstanceCount, info.InstanceStart);
 
     return {};
 }
@@ -613,8 +827,7 @@ RResult RDeviceVK::DrawIndexed(const RDrawIndexedInfo& info)
 {
     FrameData& frame = Frames[FrameIndex];
 
-    LD_DEBUG_ASSERT(info.InstanceStart == 0);
-    frame.CommandBuffer.CmdDrawIndexed(info.IndexCount, info.InstanceCount, info.IndexStart);
+    frame.CommandBuffer.CmdDrawIndexed(info.IndexCount, info.InstanceCount, info.IndexStart, info.InstanceStart);
 
     return {};
 }
@@ -666,4 +879,30 @@ void RDeviceVK::OnObserverNotify(Observable<VKSwapChainInvalidation>* swapchain,
     }
 }
 
+void RDeviceVK::WaitPipeline(RPipelineVK& pipeline)
+{
+    if (!pipeline.IsCompiled)
+        JobSystem::GetSingleton().WaitType(JobType::CompilePipeline);
+
+    LD_DEBUG_ASSERT(pipeline.IsCompiled);
+}
+
+void RDeviceVK::WaitPipelines()
+{
+    if (PendingPipelineCount > 0)
+        JobSystem::GetSingleton().WaitType(JobType::CompilePipeline);
+
+    LD_DEBUG_ASSERT(PendingPipelineCount == 0);
+
+    for (RShaderVK* shader : DeferredShaders)
+    {
+        RShader shaderH{};
+        shader->Cleanup(shaderH);
+        shader->~RShaderVK();
+        ShaderAllocator.Free(shader);
+    }
+
+    DeferredShaders.Clear();
+}
+
 } // namespace LD
\ No newline at end of file
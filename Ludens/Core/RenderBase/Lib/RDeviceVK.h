@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <string>
 #include "Core/Header/Include/Observer.h"
 #include "Core/DSA/Include/Array.h"
 #include "Core/RenderBase/Include/VK/VKContext.h"
@@ -13,6 +15,7 @@
 #include "Core/RenderBase/Lib/RPassVK.h"
 #include "Core/RenderBase/Lib/RFrameBufferVK.h"
 #include "Core/RenderBase/Lib/RPipelineVK.h"
+#include "Core/RenderBase/Lib/RCommandListVK.h"
 #include "Core/RenderBase/Lib/RBase.h"
 
 #define DEVICE_CONCURRENT_FRAMES 2
@@ -61,6 +64,9 @@ struct RDeviceVK : RDeviceBase, public Observer<VKSwapChainInvalidation>
     virtual RResult CreatePipeline(RPipeline& pipeline, const RPipelineInfo& info) override;
     virtual RResult DeletePipeline(RPipeline& pipeline) override;
 
+    virtual RResult CreateCommandList(RCommandList& list, const RCommandListInfo& info) override;
+    virtual RResult DeleteCommandList(RCommandList& list) override;
+
     virtual RResult GetSwapChainTextureFormat(RTextureFormat& format) override;
     virtual RResult GetSwapChainRenderPass(RPass& renderPass) override;
     virtual RResult GetSwapChainFrameBuffer(RFrameBuffer& frameBuffer) override;
@@ -78,6 +84,8 @@ struct RDeviceVK : RDeviceBase, public Observer<VKSwapChainInvalidation>
     virtual RResult PushScissor(const Rect2D& scissor) override;
     virtual RResult PopScissor() override;
 
+    virtual RResult ExecuteCommandLists(View<RCommandList> lists) override;
+
     virtual RResult DrawVertex(const RDrawVertexInfo& info) override;
     virtual RResult DrawIndexed(const RDrawIndexedInfo& info) override;
 
@@ -88,12 +96,28 @@ struct RDeviceVK : RDeviceBase, public Observer<VKSwapChainInvalidation>
     virtual void OnObserverNotify(Observable<VKSwapChainInvalidation>* swapchain,
                                   const VKSwapChainInvalidation& newConfig) override;
 
+    /// block until the pipeline has been compiled by a worker thread
+    void WaitPipeline(RPipelineVK& pipeline);
+
+    /// block until all pipeline compile jobs are complete, then release deferred shader modules
+    void WaitPipelines();
+
     // TODO: this assumes a single device on a single thread, needs refactoring later for multi-threading
     VKContext Context;
     VKDescriptorPool DescriptorPool;
     VKCommandPool GraphicsCommandPool;
     VKCommandPool TransferCommandPool;
 
+    // shared by all pipeline compile jobs, loaded from and saved to PipelineCachePath if non-empty
+    VkPipelineCache PipelineCache = VK_NULL_HANDLE;
+    std::string PipelineCachePath;
+
+    // pipeline compile jobs submitted to the JobSystem that have not completed yet
+    std::atomic<u32> PendingPipelineCount{ 0 };
+
+    // shaders deleted while a compile job may still reference their modules
+    Vector<RShaderVK*> DeferredShaders;
+
     // depth stencil attachment needs to be explicitly created
     RTexture DepthStencilAttachment;
 
@@ -120,6 +144,7 @@ struct RDeviceVK : RDeviceBase, public Observer<VKSwapChainInvalidation>
     Array<FrameData, DEVICE_CONCURRENT_FRAMES> Frames;
     int FrameIndex;
     int ImageIndex;
+    VkExtent2D PassExtent{}; // extent of the frame buffer in the current render pass
 
     PoolAllocator<sizeof(RTextureVK)> TextureAllocator;
     PoolAllocator<sizeof(RBufferVK)> BufferAllocator;
@@ -129,6 +154,7 @@ struct RDeviceVK : RDeviceBase, public Observer<VKSwapChainInvalidation>
     PoolAllocator<sizeof(RPassVK)> RenderPassAllocator;
     PoolAllocator<sizeof(RFrameBufferVK)> FrameBufferAllocator;
     PoolAllocator<sizeof(RPipelineVK)> PipelineAllocator;
+    PoolAllocator<sizeof(RCommandListVK)> CommandListAllocator;
 };
 
 } // namespace LD
\ No newline at end of file
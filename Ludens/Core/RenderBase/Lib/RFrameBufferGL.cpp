@@ -46,7 +46,7 @@ void RFrameBufferGL::Cleanup(RFrameBuffer& frameBufferH)
 
 void RFrameBufferGL::StartupGLAttachments()
 {
-    RDeviceGL* deviceGL = dynamic_cast<RDeviceGL*>(Device);
+    RDeviceGL* deviceGL = static_cast<RDeviceGL*>(Device);
 
     Vector<GLTexture2D*> glColorAttachments(ColorAttachments.Size());
     for (size_t i = 0; i < glColorAttachments.Size(); i++)
@@ -9,4 +9,16 @@ bool RPass::HasDepthStencilAttachment()
     return mBase->HasDepthStencilAttachment();
 }
 
+u32 RPass::GetAttachmentCount()
+{
+    return (u32)mBase->Attachments.Size();
+}
+
+RPassAttachment RPass::GetAttachment(u32 index)
+{
+    LD_DEBUG_ASSERT(index < (u32)mBase->Attachments.Size());
+
+    return mBase->Attachments[index];
+}
+
 } // namespace LD
\ No newline at end of file
@@ -23,16 +23,17 @@ void RPipelineGL::Startup(RPipeline& pipelineH, const RPipelineInfo& info, RDevi
     GLPolygonMode =
         PolygonMode == RPolygonMode::Fill ? GL_FILL : (PolygonMode == RPolygonMode::Line ? GL_LINE : GL_POINT);
     GLCullMode = CullMode == RCullMode::BackFace ? GL_BACK : (CullMode == RCullMode::FrontFace ? GL_FRONT : GL_NONE);
+    GLDepthFunc = DeriveGLDepthFunc(DepthCompareMode);
 
     BlendEnabled = info.BlendState.BlendEnabled;
     if (BlendEnabled)
     {
-        GLColorBlendSrcFactor = DeriveGLBlendFactor(info.BlendState.ColorSrcFactor);
-        GLColorBlendDstFactor = DeriveGLBlendFactor(info.BlendState.ColorDstFactor);
-        GLColorBlendOp = DeriveGLBlendOp(info.BlendState.ColorBlendMode);
-        GLAlphaBlendSrcFactor = DeriveGLBlendFactor(info.BlendState.AlphaSrcFactor);
-        GLAlphaBlendDstFactor = DeriveGLBlendFactor(info.BlendState.AlphaDstFactor);
-        GLAlphaBlendOp = DeriveGLBlendOp(info.BlendState.AlphaBlendMode);
+        GLBlend.ColorSrcFactor = DeriveGLBlendFactor(info.BlendState.ColorSrcFactor);
+        GLBlend.ColorDstFactor = DeriveGLBlendFactor(info.BlendState.ColorDstFactor);
+        GLBlend.ColorOp = DeriveGLBlendOp(info.BlendState.ColorBlendMode);
+        GLBlend.AlphaSrcFactor = DeriveGLBlendFactor(info.BlendState.AlphaSrcFactor);
+        GLBlend.AlphaDstFactor = DeriveGLBlendFactor(info.BlendState.AlphaDstFactor);
+        GLBlend.AlphaOp = DeriveGLBlendOp(info.BlendState.AlphaBlendMode);
     }
 
     RShaderGL& vertexShader = Derive<RShaderGL>(VertexShaderH);
@@ -52,6 +53,8 @@ void RPipelineGL::Startup(RPipeline& pipelineH, const RPipelineInfo& info, RDevi
         for (size_t groupIdx = 0; groupIdx < groupCount; groupIdx++)
         {
             RBindingGroupLayoutGL& groupLayout = Derive<RBindingGroupLayoutGL>(GroupLayoutsH[groupIdx]);
+            TextureUnitBinding[groupIdx].Resize(groupLayout.Bindings.Size());
+            UniformBufferBinding[groupIdx].Resize(groupLayout.Bindings.Size());
 
             for (size_t bindingIdx = 0; bindingIdx < groupLayout.Bindings.Size(); bindingIdx++)
             {
@@ -2,6 +2,7 @@
 
 #include <glad/glad.h>
 #include "Core/DSA/Include/Vector.h"
+#include "Core/RenderBase/Include/GL/GLContext.h"
 #include "Core/RenderBase/Include/GL/GLVertexArray.h"
 #include "Core/RenderBase/Include/GL/GLProgram.h"
 #include "Core/RenderBase/Include/RPipeline.h"
@@ -40,20 +41,16 @@ struct RPipelineGL : RPipelineBase
     GLenum GLPrimitiveTopology;
     GLenum GLPolygonMode;
     GLenum GLCullMode;
-    GLenum GLColorBlendOp;
-    GLenum GLColorBlendSrcFactor;
-    GLenum GLColorBlendDstFactor;
-    GLenum GLAlphaBlendOp;
-    GLenum GLAlphaBlendSrcFactor;
-    GLenum GLAlphaBlendDstFactor;
+    GLenum GLDepthFunc;
+    GLBlendState GLBlend;
     bool BlendEnabled;
     Vector<u32> VertexStrides; // vertex byte size at each vertex buffer slot
 
-    // for each binding group, map RTexture binding to OpenGL Texture Unit
-    Vector<std::unordered_map<u32, u32>> TextureUnitBinding;
+    // for each binding group, indexed by binding, the base OpenGL Texture Unit of a texture binding
+    Vector<Vector<u32>> TextureUnitBinding;
 
-    // for each binding group, map uniform RBuffer binding to OpenGL Buffer Base
-    Vector<std::unordered_map<u32, u32>> UniformBufferBinding;
+    // for each binding group, indexed by binding, the OpenGL Buffer Base of a uniform buffer binding
+    Vector<Vector<u32>> UniformBufferBinding;
 };
 
 } // namespace LD
\ No newline at end of file
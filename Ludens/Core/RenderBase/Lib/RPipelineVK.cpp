@@ -105,8 +105,10 @@ void RPipelineVK::Startup(RPipeline& pipelineH, const RPipelineInfo& info, RDevi
         .SetRasterizationState(rasterizerStateCI)
         .SetDepthStencilState(depthStencilStateCI)
         .SetBlendState(colorBlendAttachment)
-        .SetRenderPass(vkRenderPass, 0)
-        .Startup(vkContext.GetDevice());
+        .SetRenderPass(vkRenderPass, 0);
+
+    // the actual vkCreateGraphicsPipelines call is issued by RDeviceVK on a worker thread
+    IsCompiled = false;
 }
 
 void RPipelineVK::Cleanup(RPipeline& pipelineH)
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include "Core/RenderBase/Include/RPipeline.h"
 #include "Core/RenderBase/Include/VK/VKPipeline.h"
 #include "Core/RenderBase/Lib/RBase.h"
@@ -13,11 +14,9 @@ struct RPipelineVK : RPipelineBase
 {
     RPipelineVK();
     RPipelineVK(const RPipelineVK&) = delete;
-    RPipelineVK(RPipelineVK&&) = default;
     ~RPipelineVK();
 
     RPipelineVK& operator=(const RPipelineVK&) = delete;
-    RPipelineVK& operator=(RPipelineVK&&) noexcept = default;
 
     inline bool operator==(const RPipelineVK& other) const
     {
@@ -34,6 +33,9 @@ struct RPipelineVK : RPipelineBase
 
     VKPipeline Pipeline;
     VKPipelineLayout PipelineLayout;
+
+    /// set by the worker thread once the VkPipeline handle is created
+    std::atomic<bool> IsCompiled{ false };
 };
 
 } // namespace LD
\ No newline at end of file
@@ -22,6 +22,8 @@ const char* RResourceTypeString(RResourceType type)
         return "RBindingGroup";
     case RResourceType::Pipeline:
         return "RPipeline";
+    case RResourceType::CommandList:
+        return "RCommandList";
     }
 
     LD_DEBUG_UNREACHABLE;
@@ -87,7 +87,7 @@ void VKContext::StartupInstance()
     appI.applicationVersion = VK_MAKE_VERSION(0, 0, 1);
     appI.pEngineName = "No Engine";
     appI.engineVersion = VK_MAKE_VERSION(0, 0, 1);
-    appI.apiVersion = VK_API_VERSION_1_0;
+    appI.apiVersion = VK_API_VERSION_1_2;
 
     // GLFW may require some instance extensions
     u32 glfwExtensionCount = 0;
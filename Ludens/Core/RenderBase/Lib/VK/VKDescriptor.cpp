@@ -41,9 +41,11 @@ VKDescriptorSetLayout::~VKDescriptorSetLayout()
     LD_DEBUG_ASSERT(mDevice == VK_NULL_HANDLE);
 }
 
-VKDescriptorSetLayout& VKDescriptorSetLayout::AddBinding(const VkDescriptorSetLayoutBinding& binding)
+VKDescriptorSetLayout& VKDescriptorSetLayout::AddBinding(const VkDescriptorSetLayoutBinding& binding,
+                                                         VkDescriptorBindingFlags flags)
 {
     mBindings.PushBack(binding);
+    mBindingFlags.PushBack(flags);
     return *this;
 }
 
@@ -58,6 +60,21 @@ void VKDescriptorSetLayout::Startup(const VKDevice& device)
     layoutCI.bindingCount = mBindings.Size();
     layoutCI.pBindings = mBindings.Data();
 
+    // binding flags are only chained if some binding requires descriptor indexing
+    VkDescriptorSetLayoutBindingFlagsCreateInfo flagsCI{};
+    flagsCI.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+    flagsCI.bindingCount = mBindingFlags.Size();
+    flagsCI.pBindingFlags = mBindingFlags.Data();
+
+    for (VkDescriptorBindingFlags flags : mBindingFlags)
+    {
+        if (flags & VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT)
+            layoutCI.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+
+        if (flags)
+            layoutCI.pNext = &flagsCI;
+    }
+
     VK_ASSERT(vkCreateDescriptorSetLayout(mDevice, &layoutCI, nullptr, &mHandle));
 }
 
@@ -97,7 +114,7 @@ void VKDescriptorSet::Free(VKDevice& device, VKDescriptorPool& pool)
     vkFreeDescriptorSets(device.GetHandle(), pool.GetHandle(), 1, &mHandle);
 }
 
-void VKDescriptorSet::Write(VKDevice& device, VKBuffer& buffer, u32 binding, u32 index)
+void VKDescriptorSet::Write(VKDevice& device, VKBuffer& buffer, u32 binding, u32 index, VkDescriptorType type)
 {
     VkDescriptorBufferInfo bufferInfo{};
     bufferInfo.buffer = buffer.GetHandle();
@@ -109,7 +126,7 @@ void VKDescriptorSet::Write(VKDevice& device, VKBuffer& buffer, u32 binding, u32
     setWrite.dstSet = mHandle;
     setWrite.dstBinding = binding;
     setWrite.dstArrayElement = index;
-    setWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    setWrite.descriptorType = type;
     setWrite.descriptorCount = 1;
     setWrite.pBufferInfo = &bufferInfo;
     setWrite.pImageInfo = nullptr;
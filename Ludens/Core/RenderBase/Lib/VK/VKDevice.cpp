@@ -17,6 +17,19 @@ VKPhysicalDevice::VKPhysicalDevice(VkPhysicalDevice handle, VkSurfaceKHR surface
     vkGetPhysicalDeviceMemoryProperties(mHandle, &mMemoryProperties);
     vkGetPhysicalDeviceFeatures(mHandle, &mFeatures);
 
+    // descriptor indexing is core since Vulkan 1.2
+    mDescriptorIndexingFeatures = {};
+    mDescriptorIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+
+    if (mProperties.apiVersion >= VK_API_VERSION_1_2)
+    {
+        VkPhysicalDeviceFeatures2 features2{};
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features2.pNext = &mDescriptorIndexingFeatures;
+        vkGetPhysicalDeviceFeatures2(mHandle, &features2);
+        mDescriptorIndexingFeatures.pNext = nullptr;
+    }
+
     u32 extensionCount;
     VK_ASSERT(vkEnumerateDeviceExtensionProperties(mHandle, nullptr, &extensionCount, nullptr));
     mExtensionProperties.Resize(extensionCount);
@@ -73,6 +86,14 @@ bool VKPhysicalDevice::HasExtensionSupport(const Vector<const char*>& desiredExt
     return true;
 }
 
+bool VKPhysicalDevice::HasBindlessSupport() const
+{
+    const VkPhysicalDeviceDescriptorIndexingFeatures& features = mDescriptorIndexingFeatures;
+
+    return features.shaderSampledImageArrayNonUniformIndexing && features.descriptorBindingPartiallyBound &&
+           features.descriptorBindingSampledImageUpdateAfterBind && features.descriptorBindingUpdateUnusedWhilePending;
+}
+
 VKDeviceSurfaceSpec VKPhysicalDevice::GetDeviceSurfaceSpec(VkSurfaceKHR surface) const
 {
     VKDeviceSurfaceSpec spec{};
@@ -130,6 +151,19 @@ void VKDevice::Startup(const VKContext& context, const VKDeviceSpec& spec)
 
     enabledFeatures.samplerAnisotropy = VK_TRUE;
 
+    // enable the descriptor indexing subset for bindless binding groups if available
+    VkPhysicalDeviceDescriptorIndexingFeatures indexingFeatures{};
+    indexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+    mHasBindlessSupport = mPhysical.HasBindlessSupport();
+
+    if (mHasBindlessSupport)
+    {
+        indexingFeatures.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+        indexingFeatures.descriptorBindingPartiallyBound = VK_TRUE;
+        indexingFeatures.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+        indexingFeatures.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+    }
+
     // create one device queue from each unique queue family
     Vector<VkDeviceQueueCreateInfo> deviceQueueCIs{};
     std::set<u32> uniqueQueueFamilyIndices{
@@ -157,6 +191,7 @@ void VKDevice::Startup(const VKContext& context, const VKDeviceSpec& spec)
     deviceCI.queueCreateInfoCount = deviceQueueCIs.Size();
     deviceCI.pQueueCreateInfos = deviceQueueCIs.Data();
     deviceCI.pEnabledFeatures = &enabledFeatures;
+    deviceCI.pNext = mHasBindlessSupport ? &indexingFeatures : nullptr;
     deviceCI.enabledExtensionCount = desiredExtensionNames.Size();
     deviceCI.ppEnabledExtensionNames = desiredExtensionNames.Data();
     if (context.HasValidationSupport())
@@ -160,7 +160,7 @@ VKPipeline& VKPipeline::SetRenderPass(const VKRenderPass& renderPass, int subPas
     return *this;
 }
 
-void VKPipeline::Startup(const VKDevice& device)
+void VKPipeline::Startup(const VKDevice& device, VkPipelineCache cache)
 {
     LD_DEBUG_ASSERT(!mShaderStages.IsEmpty());
     LD_DEBUG_ASSERT(!mViewports.IsEmpty());
@@ -239,7 +239,7 @@ void VKPipeline::Startup(const VKDevice& device)
     pipelineCI.renderPass = mRenderPass;
     pipelineCI.subpass = mSubPass;
 
-    VK_ASSERT(vkCreateGraphicsPipelines(mDevice, VK_NULL_HANDLE, 1, &pipelineCI, nullptr, &mHandle));
+    VK_ASSERT(vkCreateGraphicsPipelines(mDevice, cache, 1, &pipelineCI, nullptr, &mHandle));
 }
 
 void VKPipeline::Cleanup()
@@ -491,6 +491,45 @@ static void TestShaderTypeMismatch(RBackend backend)
     test.Cleanup(true);
 }
 
+// storage buffers and bindless bindings are optional device features
+// - creating a storage buffer on a device without bindless support
+// - creating a binding group layout with storage buffer or bindless bindings on such device
+static void TestFeatureUnsupported(RBackend backend)
+{
+    RResult result;
+    TestResources test;
+    test.Startup(backend);
+
+    if (!test.Device.HasBindlessSupport())
+    {
+        RBuffer buffer;
+        RBufferInfo bufferI{};
+        bufferI.Type = RBufferType::StorageBuffer;
+        bufferI.MemoryUsage = RMemoryUsage::Persistent;
+        bufferI.Size = 64;
+
+        result = test.Device.CreateBuffer(buffer, bufferI);
+        CHECK(result.Type == RResultType::FeatureUnsupported);
+        CHECK(!buffer);
+
+        RBindingGroupLayout layout;
+        RBindingInfo binding{ RBindingType::Texture, 16, true };
+        RBindingGroupLayoutInfo layoutI;
+        layoutI.Bindings = { 1, &binding };
+
+        result = test.Device.CreateBindingGroupLayout(layout, layoutI);
+        CHECK(result.Type == RResultType::FeatureUnsupported);
+        CHECK(!layout);
+
+        binding = { RBindingType::StorageBuffer };
+        result = test.Device.CreateBindingGroupLayout(layout, layoutI);
+        CHECK(result.Type == RResultType::FeatureUnsupported);
+        CHECK(!layout);
+    }
+
+    test.Cleanup(true);
+}
+
 // test when we fail to begin a render pass
 // - the number of clear values don't match the number of attachments
 // - missing a clear value for an attachment with load op Clear
@@ -518,6 +557,7 @@ void RResultTestLayer::OnAttach(const Application& app)
     TestTextureSizeMismatch(backend);
     TestBufferTypeMismatch(backend);
     TestShaderTypeMismatch(backend);
+    TestFeatureUnsupported(backend);
 }
 
 void RResultTestLayer::OnDeltaUpdate(DeltaTime dt)
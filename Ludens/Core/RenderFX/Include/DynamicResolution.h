@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Core/DSA/Include/Array.h"
+
+// Dynamic Resolution
+// - world passes render into a sub-area of targets allocated at the viewport size,
+//   the tone mapping pass upscales the sub-area to the viewport
+// - frame times are averaged over a window of frames, the window restarts after every scale change
+//   so measurements at the old scale never drive the next decision
+// - the cost of a frame is assumed to grow with the pixel count, which is the square of the scale
+// - under vertical sync an idle frame measures the same as a frame that just meets the target,
+//   so the controller probes one step up after a number of stable windows and backs off the probe
+//   interval whenever a probe misses the target
+
+#define LD_DYNAMIC_RESOLUTION_WINDOW 16
+
+namespace LD
+{
+
+struct DynamicResolutionInfo
+{
+    float TargetFrameTime = 1.0f / 60.0f; // seconds
+    float MinScale = 0.5f;                // lower bound of the render scale
+    float MaxScale = 1.0f;                // upper bound of the render scale
+    float ScaleStep = 0.05f;              // render scales are multiples of this step
+};
+
+/// @brief Chooses the render scale of the world passes from measured frame times.
+class DynamicResolution
+{
+public:
+    DynamicResolution();
+
+    /// @brief reset the controller to the maximum scale
+    void Startup(const DynamicResolutionInfo& info);
+
+    /// @brief measure a frame
+    /// @param frameTime duration of the last frame in seconds
+    /// @return render scale for the next frame
+    float Update(float frameTime);
+
+    /// @brief render scale for the next frame, in [MinScale, MaxScale]
+    inline float GetScale() const
+    {
+        return mScale;
+    }
+
+    /// @brief scale a viewport dimension, at least one pixel
+    int GetScaledSize(int size) const;
+
+private:
+    float Quantize(float scale) const;
+    void SetScale(float scale);
+
+    DynamicResolutionInfo mInfo;
+    Array<float, LD_DYNAMIC_RESOLUTION_WINDOW> mFrameTimes;
+    int mFrameCount;      // frames measured in the current window
+    int mStableWindows;   // consecutive windows that met the target
+    int mProbeWindows;    // stable windows before probing a larger scale
+    bool mIsProbing;      // the current scale was reached by a probe
+    float mProbeOrigin;   // scale before the current probe
+    float mScale;
+};
+
+} // namespace LD
@@ -5,6 +5,7 @@
 #include "Core/RenderBase/Include/RFrameBuffer.h"
 #include "Core/RenderBase/Include/RPass.h"
 #include "Core/RenderFX/Include/PrefabFrameBuffer.h"
+#include "Core/RenderFX/Include/GBufferLayout.h"
 
 namespace LD
 {
@@ -15,6 +16,7 @@ struct GBufferInfo
     u32 Width;
     u32 Height;
     RPass RenderPass;
+    GBufferLayout Layout = GBufferLayout::Standard;
     RTextureFormat PositionFormat = RTextureFormat::RGBA16F;
     RTextureFormat NormalsFormat = RTextureFormat::RGBA16F;
     RTextureFormat AlbedoFormat = RTextureFormat::RGBA8;
@@ -25,6 +27,8 @@ struct GBufferInfo
 // - default RGBA16F Position
 // - default RGBA16F Normals
 // - default RGBA8 Albedo Color
+// the compact layout has no position attachment and keeps the depth attachment
+// for position reconstruction, see GBufferLayout
 class GBuffer : public PrefabFrameBuffer
 {
 public:
@@ -34,6 +38,11 @@ public:
     void Startup(const GBufferInfo& info);
     void Cleanup();
 
+    inline GBufferLayout GetLayout() const
+    {
+        return mLayout;
+    }
+
     inline RTexture GetPosition() const
     {
         LD_DEBUG_ASSERT(mPosition);
@@ -60,6 +69,7 @@ public:
 
 private:
     RDevice mDevice;
+    GBufferLayout mLayout;
     RTexture mPosition;
     RTexture mNormals;
     RTexture mAlbedo;
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Core/Math/Include/Math.h"
+#include "Core/Math/Include/Vec2.h"
+#include "Core/Math/Include/Vec3.h"
+#include "Core/Math/Include/Vec4.h"
+#include "Core/Math/Include/Mat4.h"
+
+namespace LD
+{
+
+/// attachment layout of the geometry pass
+enum class GBufferLayout
+{
+    /// - RGBA16F view space position and roughness
+    /// - RGBA16F view space normal and metallic
+    /// - RGBA8 albedo
+    /// - depth, discarded after the pass
+    Standard = 0,
+
+    /// - RGBA16F octahedral view space normal in xy, roughness in z, metallic in w
+    /// - RGBA8 albedo
+    /// - depth, sampled to reconstruct the view space position
+    /// shaders for this layout are compiled with LD_GBUFFER_COMPACT defined
+    Compact,
+};
+
+// CPU reference of the compact layout encoding, the GLSL helpers under
+// LD_GBUFFER_COMPACT must stay in sync with these functions.
+
+/// @brief octahedral encoding of a unit vector
+/// @return coordinates in [-1, 1]
+inline Vec2 GBufferEncodeNormal(const Vec3& n)
+{
+    float l1 = LD_MATH_ABS(n.x) + LD_MATH_ABS(n.y) + LD_MATH_ABS(n.z);
+    Vec2 e(n.x / l1, n.y / l1);
+
+    // fold the lower hemisphere over the diagonals
+    if (n.z < 0.0f)
+    {
+        float x = (1.0f - LD_MATH_ABS(e.y)) * (e.x >= 0.0f ? 1.0f : -1.0f);
+        float y = (1.0f - LD_MATH_ABS(e.x)) * (e.y >= 0.0f ? 1.0f : -1.0f);
+        e = Vec2(x, y);
+    }
+
+    return e;
+}
+
+/// @brief decode an octahedral encoded unit vector
+inline Vec3 GBufferDecodeNormal(const Vec2& e)
+{
+    Vec3 n(e.x, e.y, 1.0f - LD_MATH_ABS(e.x) - LD_MATH_ABS(e.y));
+    float t = n.z < 0.0f ? -n.z : 0.0f;
+
+    n.x += n.x >= 0.0f ? -t : t;
+    n.y += n.y >= 0.0f ? -t : t;
+
+    return n.Normalized();
+}
+
+/// @brief reconstruct view space position from a depth attachment sample
+/// @param invProj inverse of the projection matrix used in the geometry pass
+/// @param uv framebuffer texture coordinates of the sample, where [0, 1] spans NDC [-1, 1]
+/// @param ndcDepth NDC depth of the sample, window depth * 2 - 1 under the OpenGL depth range
+inline Vec3 GBufferReconstructPosition(const Mat4& invProj, const Vec2& uv, float ndcDepth)
+{
+    Vec4 ndc(uv.x * 2.0f - 1.0f, uv.y * 2.0f - 1.0f, ndcDepth, 1.0f);
+    Vec4 view = invProj * ndc;
+
+    return Vec3(view.x, view.y, view.z) / view.w;
+}
+
+} // namespace LD
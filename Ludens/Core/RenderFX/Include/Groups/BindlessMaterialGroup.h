@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Core/Header/Include/Types.h"
+#include "Core/DSA/Include/Vector.h"
+#include "Core/RenderBase/Include/RBinding.h"
+#include "Core/RenderBase/Include/RTexture.h"
+#include "Core/RenderBase/Include/RBuffer.h"
+#include "Core/RenderFX/Include/PrefabBindingGroup.h"
+#include "Core/RenderFX/Include/Groups/MaterialGroup.h"
+#include "Core/Math/Include/Vec4.h"
+
+// must match the array sizes declared in GBufferBindless.glsl
+#define MAX_BINDLESS_MATERIAL_COUNT 1024
+#define MAX_BINDLESS_TEXTURE_COUNT 512
+
+namespace LD
+{
+
+/// binding 0, one entry per material in the storage buffer,
+/// texture fields index into the bindless texture array at binding 1, or -1 if not used.
+struct BindlessMaterialData
+{
+    Vec4 Albedo;
+    f32 Roughness;
+    f32 Metallic;
+    i32 MetallicRoughnessLayout;
+    i32 AlbedoTexture;
+    i32 NormalTexture;
+    i32 MetallicTexture;
+    i32 RoughnessTexture;
+    i32 Reserved;
+};
+
+LD_STATIC_ASSERT(sizeof(BindlessMaterialData) % 16 == 0);
+
+/// All materials in a single binding group: material parameters live in one storage buffer
+/// and material textures in one bindless texture array. Draws select a material by index,
+/// so the group is bound once per pass instead of once per batch. Requires RDevice::HasBindlessSupport.
+class BindlessMaterialGroup : public PrefabBindingGroup
+{
+public:
+    BindlessMaterialGroup() = default;
+    BindlessMaterialGroup(const BindlessMaterialGroup&) = delete;
+    ~BindlessMaterialGroup();
+
+    BindlessMaterialGroup& operator=(const BindlessMaterialGroup&) = delete;
+
+    /// @brief startup the bindless material binding group
+    /// @param device the owning device, must have bindless support
+    /// @param materialBGL a layout compatible with the bindless material binding group, such as from CreateLayout()
+    void Startup(RDevice device, RBindingGroupLayout materialBGL);
+
+    /// cleanup the binding group and any material that has not been removed, the input BGL is not deleted
+    void Cleanup();
+
+    /// @brief create the textures of a material and register its parameters
+    /// @param info flat values and texture infos of the material, Device and MaterialBGL are not used
+    /// @return index of the material in the storage buffer, to be passed along with draws
+    u32 AddMaterial(const MaterialGroupInfo& info);
+
+    /// @brief delete the textures of a material and release its index for reuse,
+    ///        the material must no longer be referenced by frames in flight
+    void RemoveMaterial(u32 index);
+
+    virtual RBindingGroupLayoutData GetLayoutData() const override;
+
+    virtual RBindingGroupLayout CreateLayout(RDevice device) override;
+
+private:
+    struct MaterialSlot
+    {
+        RTexture Textures[4]; // albedo, normal, metallic, roughness
+        i32 TextureIndices[4];
+    };
+
+    i32 AddTexture(RTexture& texture, const Optional<RTextureInfo>& info);
+
+    RDevice mDevice;
+    RBuffer mSSBO;                     // binding 0
+    Vector<MaterialSlot> mMaterials;   // indexed by material index
+    Vector<u32> mFreeMaterials;        // released material indices
+    Vector<i32> mFreeTextures;         // released texture array indices
+    u32 mMaterialCount = 0;            // material indices handed out so far
+    i32 mTextureCount = 0;             // texture array indices handed out so far
+};
+
+} // namespace LD
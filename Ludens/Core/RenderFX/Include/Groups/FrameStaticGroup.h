@@ -4,7 +4,9 @@
 #include "Core/RenderBase/Include/RBuffer.h"
 #include "Core/RenderFX/Include/PrefabBindingGroup.h"
 
-#define LD_MAX_POINT_LIGHTS 128
+// point and spot lights share one array, lights are selected per pixel through the light clusters
+// of the viewport, see LightCluster.h
+#define LD_MAX_LIGHTS 256
 
 namespace LD
 {
@@ -17,23 +19,24 @@ struct DirectionalLightData
 
 LD_STATIC_ASSERT(sizeof(DirectionalLightData) == 32);
 
-struct PointLightData
+/// a point or spot light, point lights are spot lights whose cone covers every direction
+struct LightData
 {
-    Vec4 PosRadius;
-    Vec4 Color;
+    Vec4 PosRadius; // world space position, range beyond which the light has no contribution
+    Vec4 Color;     // color, w is the cosine of the inner cone angle
+    Vec4 Dir;       // world space spot direction, w is the cosine of the outer cone angle
 };
 
-LD_STATIC_ASSERT(sizeof(PointLightData) == 32);
+LD_STATIC_ASSERT(sizeof(LightData) == 48);
 
 /// binding 0, lighting conditions of the current frame
 struct FrameStaticLightingUBO
 {
-    alignas(32) DirectionalLightData DirectionalLight;
-    alignas(32) PointLightData PointLights[LD_MAX_POINT_LIGHTS];
+    alignas(16) DirectionalLightData DirectionalLight;
+    alignas(16) LightData Lights[LD_MAX_LIGHTS];
 };
 
-LD_STATIC_ASSERT(sizeof(FrameStaticLightingUBO) ==
-                 sizeof(DirectionalLightData) + sizeof(PointLightData) * LD_MAX_POINT_LIGHTS);
+LD_STATIC_ASSERT(sizeof(FrameStaticLightingUBO) == sizeof(DirectionalLightData) + sizeof(LightData) * LD_MAX_LIGHTS);
 
 /// resources whose values do not change within a frame.
 /// the expected usage is to create one instance of this binding group
@@ -1,12 +1,24 @@
 #pragma once
 
+#include "Core/Math/Include/Vec4.h"
 #include "Core/RenderBase/Include/RBuffer.h"
 #include "Core/RenderBase/Include/RTexture.h"
 #include "Core/RenderFX/Include/PrefabBindingGroup.h"
 
+#define LD_SSAO_MAX_SAMPLES 64
+
 namespace LD
 {
 
+/// hemisphere kernel of the ssao pipeline, only the first SampleCount samples are used
+struct SSAOKernelUBO
+{
+    Vec4 Samples[LD_SSAO_MAX_SAMPLES];
+    alignas(16) int SampleCount;
+};
+
+LD_STATIC_ASSERT(sizeof(SSAOKernelUBO) == sizeof(Vec4) * (LD_SSAO_MAX_SAMPLES + 1));
+
 /// group of resources used during ssao texture generation
 class SSAOGroup : public PrefabBindingGroup
 {
@@ -20,7 +32,8 @@ public:
     /// @brief startup the ssao binding group
     /// @param device the owning device
     /// @param ssaoBGL a layout compatible with the ssao binding group, such as from CreateLayout()
-    void Startup(RDevice device, RBindingGroupLayout ssaoBGL);
+    /// @param sampleCount number of kernel samples, at most LD_SSAO_MAX_SAMPLES
+    void Startup(RDevice device, RBindingGroupLayout ssaoBGL, int sampleCount = LD_SSAO_MAX_SAMPLES);
 
     /// cleanup the ssao binding group, the input BGL in Startup() is not deleted
     void Cleanup();
@@ -28,6 +41,15 @@ public:
     /// bind the raw output of ssao pipeline to this binding group
     void BindSSAOTexture(RTexture ssao);
 
+    /// @brief regenerate the kernel with a different number of samples,
+    ///        the caller ensures that no frame in flight still reads the kernel
+    void SetSampleCount(int sampleCount);
+
+    inline int GetSampleCount() const
+    {
+        return mSampleCount;
+    }
+
     virtual RBindingGroupLayoutData GetLayoutData() const override;
 
     virtual RBindingGroupLayout CreateLayout(RDevice device) override;
@@ -36,6 +58,7 @@ private:
     RDevice mDevice;
     RBuffer mKernelUBO;
     RTexture mNoise;
+    int mSampleCount = 0;
 };
 
 } // namespace LD
\ No newline at end of file
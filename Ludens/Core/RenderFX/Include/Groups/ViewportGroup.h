@@ -5,11 +5,22 @@
 #include "Core/RenderFX/Include/PrefabBindingGroup.h"
 #include "Core/Math/Include/Mat4.h"
 
+// Light Clusters
+// - the view frustum is split into X by Y screen tiles and Z exponential depth slices
+// - each cluster record packs the offset of its first light index in the low 16 bits
+//   and the number of light indices in the high 16 bits
+// - light indices are 8 bit, packed 16 to a uvec4 in GLSL
+// - both buffers stay within the 16 KB uniform block size every backend guarantees
+#define LD_LIGHT_CLUSTER_X 16
+#define LD_LIGHT_CLUSTER_Y 8
+#define LD_LIGHT_CLUSTER_Z 24
+#define LD_LIGHT_CLUSTER_COUNT (LD_LIGHT_CLUSTER_X * LD_LIGHT_CLUSTER_Y * LD_LIGHT_CLUSTER_Z)
+#define LD_MAX_LIGHT_INDICES 16384
+
 namespace LD
 {
 
 class GBuffer;
-class ColorBuffer;
 
 /// binding 0, viewport information
 struct ViewportUBO
@@ -18,12 +29,29 @@ struct ViewportUBO
     alignas(16) Mat4 ProjMat;         // camera projection matrix
     alignas(16) Mat4 ViewProjMat;     // pre-computed at CPU side
     alignas(16) Vec3 ViewPos;         // world space eye position
-    alignas(8) Vec2 Size;             // width and height (and aspect ratio) of the viewport
-    alignas(4) int PointLightStart;   // starting index in FrameStaticGroup point light array
-    alignas(4) int PointLightCount;   // number of point lights participating in lighting
+    alignas(8) Vec2 Size;             // width and height of the rendered area, smaller than the viewport under dynamic resolution
+    alignas(16) Mat4 InvProjMat;      // inverse projection, reconstructs view space position from depth
+};
+
+LD_STATIC_ASSERT(sizeof(ViewportUBO) == 64 * 3 + 16 + 16 + 64);
+
+/// binding 5, light cluster records of the viewport
+struct LightClusterUBO
+{
+    alignas(16) Vec4 DepthParams;                   // near, far, slice scale and slice bias, see LightCluster
+    alignas(16) u32 Records[LD_LIGHT_CLUSTER_COUNT]; // x varies fastest, then y, then the depth slice
 };
 
-LD_STATIC_ASSERT(sizeof(ViewportUBO) == 64 * 3 + 16 + 8 + 4 + 4);
+LD_STATIC_ASSERT(sizeof(LightClusterUBO) == 16 + 4 * LD_LIGHT_CLUSTER_COUNT);
+LD_STATIC_ASSERT(sizeof(LightClusterUBO) <= 16384);
+
+/// binding 6, light indices referenced by the cluster records
+struct LightIndexUBO
+{
+    alignas(16) u8 Indices[LD_MAX_LIGHT_INDICES];
+};
+
+LD_STATIC_ASSERT(sizeof(LightIndexUBO) <= 16384);
 
 /// Standard Viewport Binding Group, this group provides information of how the scene is viewed from.
 /// A local split-screen game with 2 players might require multiple viewports for each camera.
@@ -47,6 +75,7 @@ public:
 
     /// bind the gbuffer textures to this viewport,
     /// the textures are bound at bindings 1 to 3 of this group.
+    /// binding 1 is the position texture, or the depth texture under the compact layout.
     void BindGBuffer(const GBuffer& gbuffer);
 
     /// bind the ssao texture to this viewport,
@@ -55,7 +84,7 @@ public:
 
     /// bind the HDR and LDR color buffers to this viewport
     /// the textures are bound at binding 1 and 2 of this group.
-    void BindColorTextures(const ColorBuffer& hdr, const ColorBuffer& ldr);
+    void BindColorTextures(RTexture hdr, RTexture ldr);
 
     virtual RBindingGroupLayoutData GetLayoutData() const override;
 
@@ -68,9 +97,25 @@ public:
         return mUBO;
     }
 
+    /// light cluster records at binding 5
+    inline RBuffer GetLightClusterUBO() const
+    {
+        LD_DEBUG_ASSERT(mLightClusterUBO);
+        return mLightClusterUBO;
+    }
+
+    /// light indices at binding 6
+    inline RBuffer GetLightIndexUBO() const
+    {
+        LD_DEBUG_ASSERT(mLightIndexUBO);
+        return mLightIndexUBO;
+    }
+
 private:
     RDevice mDevice;
     RBuffer mUBO;
+    RBuffer mLightClusterUBO;
+    RBuffer mLightIndexUBO;
 };
 
 } // namespace LD
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <vector>
+#include "Core/Header/Include/Types.h"
+#include "Core/Math/Include/Mat4.h"
+#include "Core/Math/Include/Stream.h"
+#include "Core/RenderFX/Include/Groups/FrameStaticGroup.h"
+#include "Core/RenderFX/Include/Groups/ViewportGroup.h"
+
+// Clustered Light Assignment
+// - lights are binned into view space froxels on the CPU, a pixel only shades the lights of its cluster
+// - a fragment at view depth d lies in slice floor(log(d) * scale + bias), see LightClusterUBO::DepthParams
+// - reference: Olsson et al., Clustered Deferred and Forward Shading
+//   https://www.cse.chalmers.se/~uffe/clustered_shading_preprint.pdf
+
+namespace LD
+{
+
+/// statistics of a single LightCluster::Build
+struct LightClusterStats
+{
+    u32 LightCount = 0;     // lights in front of the camera
+    u32 IndexCount = 0;     // light indices written
+    u32 MaxClusterLights = 0;
+    bool Overflow = false;  // true if some cluster lost lights because the index buffer was full
+};
+
+/// @brief Builds the light cluster records and light indices of a viewport.
+///        Build is called from the main thread and may split the work across JobSystem workers.
+class LightCluster
+{
+public:
+    LightCluster();
+    LightCluster(const LightCluster&) = delete;
+    ~LightCluster();
+
+    LightCluster& operator=(const LightCluster&) = delete;
+
+    /// @brief assign lights to the clusters of a view
+    /// @param view world to view matrix
+    /// @param proj perspective projection matrix from Mat4::Perspective
+    /// @param lights world space lights, at most LD_MAX_LIGHTS
+    LightClusterStats Build(const Mat4& view, const Mat4& proj, const LightData* lights, u32 lightCount);
+
+    inline const LightClusterUBO& GetClusterUBO() const
+    {
+        return mClusterUBO;
+    }
+
+    inline const LightIndexUBO& GetIndexUBO() const
+    {
+        return mIndexUBO;
+    }
+
+    /// number of bytes of the index UBO referenced by the records, rounded up to 16
+    inline u32 GetIndexUploadSize() const
+    {
+        return (mIndexCount + 15) & ~15u;
+    }
+
+    /// @brief view space bounds of a cluster
+    AABB GetClusterBounds(u32 x, u32 y, u32 z) const;
+
+private:
+    struct BinJobData
+    {
+        LightCluster* Cluster;
+        u32 SliceBegin;
+        u32 SliceEnd;
+    };
+
+    static void BinJob(void* data);
+
+    void UpdateClusterBounds(const Mat4& proj);
+    void BinSlices(u32 sliceBegin, u32 sliceEnd);
+    void Compact(LightClusterStats& stats);
+
+    AABBStream mClusterBounds;       // view space bounds of each cluster, in record order
+    Mat4 mProj;                      // projection of mClusterBounds
+    Vec3Stream mLightCenters;        // view space bounding sphere centers
+    std::vector<float> mLightRadius; // bounding sphere radius
+    std::vector<u32> mLightSlices;   // first slice in the low 16 bits, last slice in the high 16 bits
+    std::vector<u64> mLightMasks;    // one bit per light for each cluster
+    std::vector<BinJobData> mJobs;
+    LightClusterUBO mClusterUBO;
+    LightIndexUBO mIndexUBO;
+    u32 mIndexCount;
+    float mNear;
+    float mFar;
+};
+
+} // namespace LD
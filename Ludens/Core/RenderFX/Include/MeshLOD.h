@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Core/Header/Include/Types.h"
+#include "Core/Math/Include/Vec3.h"
+#include "Core/Math/Include/Mat4.h"
+#include "Core/DSA/Include/Vector.h"
+#include "Core/Media/Include/Mesh.h"
+
+// Mesh Levels of Detail
+// - a level is an index range over the vertices of the full detail mesh, simplification only removes
+//   triangles and moves corners onto surviving vertices, so all levels of a batch share one vertex buffer
+// - triangles are removed by half edge collapses in the order of their quadric error
+// - vertices on UV seams, where one position is split into vertices with different attributes,
+//   and vertices on open borders never move, so the texture mapping does not tear and no holes open
+// - a level is selected from the projected size of the bounding sphere, the coarsest level whose
+//   error covers less than a pixel threshold on screen is drawn
+// - reference: Garland and Heckbert, Surface Simplification Using Quadric Error Metrics
+//   https://www.cs.cmu.edu/~garland/Papers/quadrics.pdf
+
+#define LD_MESH_LOD_MAX_LEVELS 5
+
+namespace LD
+{
+
+struct MeshLODInfo
+{
+    u32 LevelCount = 4;         // levels including the full detail level, at most LD_MESH_LOD_MAX_LEVELS
+    float TriangleRatio = 0.5f; // target triangle count of a level relative to the previous level
+};
+
+struct MeshLODLevel
+{
+    u32 IndexStart; // first index of the level in the index buffer of the batch
+    u32 IndexCount;
+    float Error;    // bound of the distance to the full detail surface, in mesh units
+};
+
+/// @brief simplify the triangles of a mesh with quadric error metrics
+/// @param targetIndexCount simplification stops once the index count is at most this many indices
+/// @param outIndices remaining triangles, referencing the input vertices
+/// @return largest error of the collapses, in mesh units
+float SimplifyMesh(const MeshVertex* vertices, u32 vertexCount, const u32* indices, u32 indexCount,
+                   u32 targetIndexCount, Vector<u32>& outIndices);
+
+/// @brief generate a chain of levels, each level simplifies the previous one.
+///        Generation stops early once a level no longer removes a meaningful number of triangles.
+/// @param lodIndices indices of all levels, level 0 is the input indices
+/// @param levels index ranges of the levels into lodIndices
+void GenerateMeshLODs(const MeshLODInfo& info, const Vector<MeshVertex>& vertices, const Vector<u32>& indices,
+                      Vector<u32>& lodIndices, Vector<MeshLODLevel>& levels);
+
+/// @brief projected radius of a bounding sphere in pixels
+/// @param viewCenter center of the sphere in view space
+/// @param proj perspective projection matrix from Mat4::Perspective
+/// @param viewportHeight height of the rendered area in pixels
+/// @return projected radius, infinity if the camera is inside the sphere
+float GetMeshScreenRadius(const Vec3& viewCenter, float radius, const Mat4& proj, float viewportHeight);
+
+/// @brief select the coarsest level whose error stays below a threshold on screen
+/// @param errors error of each level relative to the bounding sphere radius, non decreasing
+/// @param screenRadius projected radius of the bounding sphere in pixels
+/// @param pixelThreshold largest error on screen in pixels
+u32 SelectMeshLOD(const float* errors, u32 levelCount, float screenRadius, float pixelThreshold);
+
+} // namespace LD
@@ -2,6 +2,7 @@
 
 #include "Core/RenderBase/Include/RTexture.h"
 #include "Core/RenderFX/Include/PrefabRenderPass.h"
+#include "Core/RenderFX/Include/GBufferLayout.h"
 
 namespace LD
 {
@@ -9,7 +10,8 @@ namespace LD
 struct GBufferPassInfo
 {
     RDevice Device;
-    RTextureFormat PositionFormat = RTextureFormat::RGBA16F;
+    GBufferLayout Layout = GBufferLayout::Standard;
+    RTextureFormat PositionFormat = RTextureFormat::RGBA16F; // unused by the compact layout
     RTextureFormat NormalFormat = RTextureFormat::RGBA16F;
     RTextureFormat AlbedoFormat = RTextureFormat::RGBA8;
     RTextureFormat DepthStencilFormat = RTextureFormat::D32F;
@@ -21,6 +23,17 @@ public:
     void Startup(const GBufferPassInfo& info);
     void Cleanup();
 
+    inline GBufferLayout GetLayout() const
+    {
+        return mLayout;
+    }
+
+    /// number of color attachments, the depth stencil attachment follows the color attachments
+    inline u32 GetColorAttachmentCount() const
+    {
+        return mLayout == GBufferLayout::Compact ? 2 : 3;
+    }
+
     inline RTextureFormat GetPositionFormat() const
     {
         return mPositionFormat;
@@ -43,6 +56,7 @@ public:
 
 private:
     RDevice mDevice;
+    GBufferLayout mLayout;
     RTextureFormat mPositionFormat;
     RTextureFormat mNormalFormat;
     RTextureFormat mAlbedoFormat;
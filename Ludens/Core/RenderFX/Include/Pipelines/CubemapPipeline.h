@@ -10,6 +10,9 @@ struct CubemapPipelineInfo
     RDevice Device;
     RPipelineLayout CubemapPipelineLayout;
     RPass RenderPass;
+
+    // write to the GBufferLayout::Compact attachments
+    bool CompactGBuffer = false;
 };
 
 class CubemapPipeline : public PrefabPipeline
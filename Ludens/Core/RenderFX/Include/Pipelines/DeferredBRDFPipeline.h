@@ -12,6 +12,9 @@ struct DeferredBRDFPipelineInfo
     RDevice Device;
     RPass RenderPass;
     RPipelineLayout PipelineLayout;
+
+    // read the GBufferLayout::Compact attachments
+    bool CompactGBuffer = false;
 };
 
 class DeferredBRDFPipeline : public PrefabPipeline
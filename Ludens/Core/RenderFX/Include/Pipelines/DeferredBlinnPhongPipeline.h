@@ -11,6 +11,9 @@ struct DeferredBlinnPhongPipelineInfo
     RDevice Device;
     RPipelineLayout PipelineLayout;
     RPass RenderPass;
+
+    // read the GBufferLayout::Compact attachments
+    bool CompactGBuffer = false;
 };
 
 class DeferredBlinnPhongPipeline : public PrefabPipeline
@@ -12,6 +12,9 @@ struct DeferredSSAOPipelineInfo
     RDevice Device;
     RPipelineLayout PipelineLayout;
     RPass RenderPass;
+
+    // read the GBufferLayout::Compact attachments
+    bool CompactGBuffer = false;
 };
 
 class DeferredSSAOPipeline : public PrefabPipeline
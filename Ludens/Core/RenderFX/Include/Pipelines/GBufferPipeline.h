@@ -12,6 +12,17 @@ struct GBufferPipelineInfo
     RDevice Device;
     RPipelineLayout GBufferPipelineLayout;
     RPass RenderPass;
+
+    // use the BindlessMaterialGroup layout for group 1, draws select the material
+    // through the per-instance material index. Requires RDevice::HasBindlessSupport.
+    bool Bindless = false;
+
+    // write to the GBufferLayout::Compact attachments
+    bool CompactGBuffer = false;
+
+    // read QuantizedVertex vertex buffers instead of MeshVertex,
+    // the model matrix of each instance includes the dequantize matrix of the mesh
+    bool QuantizedVertices = false;
 };
 
 class GBufferPipeline : public PrefabPipeline
@@ -32,6 +43,7 @@ private:
     RDevice mDevice;
     RShader mGBufferVS;
     RShader mGBufferFS;
+    bool mBindless = false;
 };
 
 } // namespace LD
\ No newline at end of file
@@ -10,6 +10,9 @@ struct ToneMappingPipelineInfo
     RDevice Device;
     RPass RenderPass;
     RPipelineLayout PipelineLayout;
+
+    // read the GBufferLayout::Compact attachments
+    bool CompactGBuffer = false;
 };
 
 class ToneMappingPipeline : public PrefabPipeline
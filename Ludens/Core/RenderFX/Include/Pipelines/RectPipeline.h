@@ -3,6 +3,7 @@
 #include <functional>
 #include "Core/DSA/Include/Optional.h"
 #include "Core/Header/Include/Types.h"
+#include "Core/Header/Include/Error.h"
 #include "Core/Math/Include/Mat4.h"
 #include "Core/Math/Include/Rect2D.h"
 #include "Core/Math/Include/Vec4.h"
@@ -18,15 +19,30 @@
 namespace LD
 {
 
-struct RectVertex
+/// one rect drawn as an instance of 6 vertices, the rect pipeline expands the corners
+struct RectInstance
 {
-    Vec2 Position;
-    Vec2 TexUV;
-    Vec4 Color;
-    float TexID;
+    Rect2D Rect;    // screen space position of the top left corner and size
+    u16 TexRect[4]; // unsigned normalized texture coordinates at the top left and bottom right corners
+    u32 Color;      // RGBA8, red in the lowest byte
+    float TexID;    // index into the textures of the RectGroup
 };
 
-/// rect batching utility to construct vertex and index buffers,
+LD_STATIC_ASSERT(sizeof(RectInstance) == 32);
+
+/// @brief instance of a filled rect, sampling the white pixel texture
+RectInstance GetRectFilledInstance(const Rect2D& rect, Vec4 color);
+
+/// @brief the 4 instances of an outline drawn along the inside of a rect
+void GetRectOutlineInstances(const Rect2D& rect, Vec4 color, float lineWidth, RectInstance* outInstances);
+
+/// @brief instance of a rect showing a region of a texture
+RectInstance GetTextureInstance(const Rect2D& rect, const Rect2D& texRegion, Vec2 texSize, Vec4 color, int texID);
+
+/// @brief instance of a font glyph, see RectBatch::AddGlyph
+RectInstance GetGlyphInstance(const Vec2& cursor, const FontGlyph& glyph, float scale, Vec4 color, int texID);
+
+/// rect batching utility to construct an instance buffer,
 /// which can be drawn using the rect pipeline.
 class RectBatch
 {
@@ -46,7 +62,12 @@ public:
     }
 
     void Reset();
-    bool AddCustom(const RectVertex* vertices);
+    bool AddCustom(const RectInstance& instance);
+
+    /// @brief add instances until the batch is full
+    /// @return number of instances added
+    int AddInstances(const RectInstance* instances, int count);
+
     bool AddRectOutline(const Rect2D& rect, Vec4 color, float lineWidth);
     bool AddRectFilled(const Rect2D& rect, Vec4 color);
     bool AddTexture(const Rect2D& rect, const Rect2D& texRegion, Vec2 texSize, Vec4 color, int texID);
@@ -62,13 +83,12 @@ public:
     int GetRectCount();
     int GetRectCommitedCount();
     void Commit();
-    void GetBuffers(RBuffer& vertexBuffer, RBuffer& indexBuffer);
+    RBuffer GetInstanceBuffer();
 
 private:
     RDevice mDevice;
-    RBuffer mVertexBuffer;
-    RBuffer mIndexBuffer;
-    RBatch<RectVertex, u16> mBatch;
+    RBuffer mInstanceBuffer;
+    RBatch<RectInstance> mBatch;
     int mRectCommited;
 };
 
@@ -79,8 +99,8 @@ class RectBatcher
 {
 public:
 
-    /// called by the batcher whenever a batch is full
-    using OnCommit = std::function<void(RBuffer vertexBuffer, RBuffer indexBuffer, int indexStart, int indexCount)>;
+    /// called by the batcher whenever a batch is full, draws 6 vertices for each instance
+    using OnCommit = std::function<void(RBuffer instanceBuffer, int instanceStart, int instanceCount)>;
 
     RectBatcher();
     RectBatcher(const RectBatcher&) = delete;
@@ -97,7 +117,11 @@ public:
     /// manually perform a commit
     void Commit();
 
-    void AddCustom(const RectVertex* vertices);
+    void AddCustom(const RectInstance& instance);
+
+    /// add prepared instances, spanning as many batches as needed
+    void AddInstances(const RectInstance* instances, int count);
+
     void AddRectOutline(const Rect2D& rect, Vec4 color, float lineWidth);
     void AddRectFilled(const Rect2D& rect, Vec4 color);
     void AddTexture(const Rect2D& rect, const Rect2D& texRegion, Vec2 texSize, Vec4 color, int texID);
@@ -10,6 +10,9 @@ struct SSAOBlurPipelineInfo
     RDevice Device;
     RPipelineLayout PipelineLayout;
     RPass RenderPass;
+
+    // read the GBufferLayout::Compact attachments
+    bool CompactGBuffer = false;
 };
 
 class SSAOBlurPipeline : public PrefabPipeline
@@ -1,41 +1,33 @@
 #pragma once
 
+#include <algorithm>
 #include "Core/OS/Include/Memory.h"
-#include "Core/DSA/Include/View.h"
 
 namespace LD
 {
 
-template <typename TVertex, typename TIndex>
+/// Batches elements of a fixed number of vertices, such as one instance per element.
+/// Elements are expanded into primitives by the vertex shader, so there is no index buffer.
+template <typename TVertex>
 class RBatch
 {
 public:
     /// @brief startup the vertex batching service
-    void Startup(int vertexPerElement, View<int> indexSequence, int elementCapacity)
+    void Startup(int vertexPerElement, int elementCapacity)
     {
         mVertexPerElement = vertexPerElement;
-        mIndexPerElement = (int)indexSequence.Size();
         mElementCapacity = elementCapacity;
         mElementCtr = 0;
 
         mVertices = (TVertex*)MemoryAlloc(sizeof(TVertex) * mVertexPerElement * mElementCapacity);
-        mIndices = (TIndex*)MemoryAlloc(sizeof(TIndex) * mIndexPerElement * mElementCapacity);
-
-        // initialize index buffer data
-        for (int element = 0; element < mElementCapacity; element++)
-            for (int index = 0; index < mIndexPerElement; index++)
-                mIndices[mIndexPerElement * element + index] =
-                    static_cast<TIndex>(mVertexPerElement * element + indexSequence[index]);
     }
 
     /// @brief cleanup the vertex batching service.
     void Cleanup()
     {
         MemoryFree(mVertices);
-        MemoryFree(mIndices);
 
         mVertices = nullptr;
-        mIndices = nullptr;
     }
 
     int GetVertexCount() const
@@ -43,11 +35,6 @@ public:
         return mVertexPerElement * mElementCtr;
     }
 
-    int GetIndexCount() const
-    {
-        return mIndexPerElement * mElementCtr;
-    }
-
     int GetElementCount() const
     {
         return mElementCtr;
@@ -63,16 +50,6 @@ public:
         return sizeof(TVertex) * mVertexPerElement * mElementCapacity;
     }
 
-    size_t GetIndexBufferSize() const
-    {
-        return sizeof(TIndex) * mIndexPerElement * mElementCapacity;
-    }
-
-    const TIndex* GetIndices() const
-    {
-        return (const TIndex*)mIndices;
-    }
-
     const TVertex* GetVertices() const
     {
         return (const TVertex*)mVertices;
@@ -91,6 +68,20 @@ public:
         return true;
     }
 
+    /// @brief add as many elements as the remaining capacity allows
+    /// @return number of elements added
+    int AddElements(const TVertex* src, int elementCount)
+    {
+        int count = std::min(elementCount, mElementCapacity - mElementCtr);
+        TVertex* dst = mVertices + mVertexPerElement * mElementCtr;
+
+        for (int i = 0; i < mVertexPerElement * count; i++)
+            dst[i] = src[i];
+
+        mElementCtr += count;
+        return count;
+    }
+
     void Reset()
     {
         mElementCtr = 0;
@@ -98,9 +89,7 @@ public:
 
 private:
     TVertex* mVertices;
-    TIndex* mIndices;
     int mVertexPerElement;
-    int mIndexPerElement;
     int mElementCapacity;
     int mElementCtr;
 };
@@ -3,6 +3,9 @@
 #include <functional>
 #include "Core/RenderBase/Include/RDevice.h"
 #include "Core/RenderFX/Include/Groups/MaterialGroup.h"
+#include "Core/RenderFX/Include/Groups/BindlessMaterialGroup.h"
+#include "Core/RenderFX/Include/MeshLOD.h"
+#include "Core/RenderFX/Include/VertexQuantization.h"
 #include "Core/Media/Include/Model.h"
 
 namespace LD
@@ -13,6 +16,17 @@ struct RMeshInfo
     RDevice Device; // owner of this static mesh
     RBindingGroupLayout MaterialBGL;
     Ref<Model> Data = nullptr;
+
+    // if not null, batch materials are registered here instead of
+    // creating a MaterialGroup per batch, MaterialBGL is not used
+    BindlessMaterialGroup* BindlessMaterials = nullptr;
+
+    // levels of detail generated for each batch, a LevelCount of 1 only keeps the full detail level
+    MeshLODInfo LOD;
+
+    // store QuantizedVertex vertex buffers, quantized relative to the bounding box of the mesh,
+    // drawn with a GBufferPipeline created with QuantizedVertices
+    bool QuantizeVertices = false;
 };
 
 class RMesh
@@ -29,11 +43,20 @@ public:
 
     struct Batch
     {
-        RBuffer Vertices;    // batched vertex buffer
+        RBuffer Vertices;    // batched vertex buffer, MeshVertex or QuantizedVertex
         RBuffer Indices;     // batched index buffer
         MaterialGroup Material; // material used throughout this batch
-        u32 IndexCount;
+        u32 MaterialIndex;      // index into the bindless material group, if used instead
+        u32 IndexCount;         // indices of the full detail level
         u32 VertexCount;
+        u32 LODCount;
+        MeshLODLevel LODs[LD_MESH_LOD_MAX_LEVELS]; // index ranges of the levels in the batched index buffer
+
+        /// index range of a level, batches with fewer levels draw their coarsest level
+        inline const MeshLODLevel& GetLOD(u32 level) const
+        {
+            return LODs[level < LODCount ? level : LODCount - 1];
+        }
     };
 
     // called on each static mesh batch
@@ -41,11 +64,55 @@ public:
 
     void Draw(BatchFn fn);
 
+    inline size_t GetBatchCount() const
+    {
+        return mBatches.Size();
+    }
+
+    /// number of levels of detail of the batch with the most levels
+    inline u32 GetLODCount() const
+    {
+        return mLODCount;
+    }
+
+    /// error of each level relative to the bounding sphere radius, the largest error among batches
+    inline const float* GetLODErrors() const
+    {
+        return mLODErrors;
+    }
+
+    /// vertex buffers of all batches contain QuantizedVertex
+    inline bool IsQuantized() const
+    {
+        return mIsQuantized;
+    }
+
+    /// multiplied to the right of the model matrix of a quantized mesh
+    inline Mat4 GetDequantizeMatrix() const
+    {
+        return mIsQuantized ? LD::GetDequantizeMatrix(mBoundsMin, mBoundsMax) : Mat4::Identity;
+    }
+
+    /// bounding sphere of all batches in mesh space
+    inline void GetBoundingSphere(Vec3& center, float& radius) const
+    {
+        center = mBoundsCenter;
+        radius = mBoundsRadius;
+    }
+
 private:
     void PrepareMetallicRoughnessInfo(MaterialGroupInfo& matBGI, const Material& mat);
 
     RDevice mDevice;
+    BindlessMaterialGroup* mBindlessMaterials;
     Vector<Batch> mBatches;
+    Vec3 mBoundsMin;
+    Vec3 mBoundsMax;
+    Vec3 mBoundsCenter;
+    float mBoundsRadius;
+    bool mIsQuantized;
+    u32 mLODCount;
+    float mLODErrors[LD_MESH_LOD_MAX_LEVELS];
 };
 
 } // namespace LD
\ No newline at end of file
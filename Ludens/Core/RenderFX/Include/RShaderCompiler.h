@@ -56,6 +56,10 @@ public:
     void CompileStage(const RPipelineLayoutData& layout, RShaderType type, const std::string& glsl,
                       RShaderCompileResult& result);
 
+    /// @brief Define a preprocessor macro for all subsequent compilations,
+    ///        a single Ludens GLSL source may produce several shader variants this way.
+    void AddDefine(const std::string& name);
+
 private:
     void GlslangShaderType(RShaderType type, EShLanguage* language);
     void GlslangBackend(RBackend backend, glslang::EShClient* client, glslang::EShTargetClientVersion* version);
@@ -67,6 +71,7 @@ private:
     int ParseLudensMacroGroupPrefab(std::string str, RBindingGroupLayoutData& layoutData);
 
     RBackend mTargetBackend;
+    std::string mDefines;
 };
 
 struct RShaderCacheInfo
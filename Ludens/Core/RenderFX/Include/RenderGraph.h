@@ -0,0 +1,135 @@
+#pragma once
+
+#include "Core/Header/Include/Types.h"
+#include "Core/DSA/Include/Vector.h"
+#include "Core/RenderBase/Include/RPass.h"
+#include "Core/RenderBase/Include/RTexture.h"
+
+// Render Graph
+// - passes declare the attachments they sample as shader resources and the attachments they render to,
+//   writes are declared in the attachment order of the render pass, color attachments first
+// - Compile culls passes whose writes never reach an output, computes the lifetime of each attachment
+//   over the remaining passes, assigns transient attachments of the same description and disjoint
+//   lifetimes to a shared physical target, and derives the state transitions of each written attachment
+// - physical targets only describe which attachments could share memory, allocating them is left to the caller
+// - the compiled pass order is replayed by Execute every frame until the graph is declared again
+
+#define LD_RENDER_GRAPH_NONE 0xFFFFFFFF
+
+namespace LD
+{
+
+using RenderGraphResource = u32;
+using RenderGraphPass = u32;
+
+struct RenderGraphResourceInfo
+{
+    const char* Name = nullptr;
+    RTextureFormat Format = RTextureFormat::Undefined;
+    u32 Width = 0;
+    u32 Height = 0;
+
+    /// imported resources outlive the graph and never share a physical target, such as swapchain images
+    bool IsImported = false;
+
+    /// state of an output or imported resource after its last write
+    RState FinalState = RState::ShaderResource;
+};
+
+struct RenderGraphPassInfo
+{
+    const char* Name = nullptr;
+
+    /// records the pass
+    void (*Main)(void*) = nullptr;
+
+    /// payload data
+    void* Data = nullptr;
+};
+
+class RenderGraph
+{
+public:
+    /// @brief discard all passes and resources, the graph is declared and compiled again
+    void Reset();
+
+    RenderGraphResource AddResource(const RenderGraphResourceInfo& info);
+    RenderGraphPass AddPass(const RenderGraphPassInfo& info);
+
+    /// @brief the pass samples the resource as a shader resource
+    void AddRead(RenderGraphPass pass, RenderGraphResource resource);
+
+    /// @brief the pass renders to the resource as its next attachment
+    void AddWrite(RenderGraphPass pass, RenderGraphResource resource);
+
+    /// @brief the resource is consumed outside of the graph, passes writing it are never culled
+    void AddOutput(RenderGraphResource resource);
+
+    /// @brief cull passes, compute resource lifetimes, physical targets and attachment transitions
+    void Compile();
+
+    /// @brief record the passes that were not culled in declaration order
+    void Execute();
+
+    inline bool IsCompiled() const
+    {
+        return mIsCompiled;
+    }
+
+    bool IsPassCulled(RenderGraphPass pass) const;
+
+    /// @brief the resource is read or written by at least one pass that was not culled
+    bool IsResourceUsed(RenderGraphResource resource) const;
+
+    /// @brief index of the physical target of the resource, LD_RENDER_GRAPH_NONE for unused resources
+    u32 GetPhysicalIndex(RenderGraphResource resource) const;
+
+    /// @brief number of physical targets after aliasing
+    inline u32 GetPhysicalCount() const
+    {
+        return mPhysicalCount;
+    }
+
+    /// @brief index of the pass in the compiled order, LD_RENDER_GRAPH_NONE for culled passes
+    u32 GetPassOrder(RenderGraphPass pass) const;
+
+    /// @brief derived attachments of the pass, in the order the writes were declared.
+    ///        LoadOp is Load when the contents of a previous write must be preserved, otherwise
+    ///        Discard, which the render pass may replace with Clear.
+    const Vector<RPassAttachment>& GetAttachments(RenderGraphPass pass) const;
+
+    /// @brief check the transitions baked into a render pass attachment against the derived attachment
+    static bool IsAttachmentCompatible(const RPassAttachment& baked, const RPassAttachment& derived);
+
+private:
+    struct Resource
+    {
+        RenderGraphResourceInfo Info;
+        bool IsOutput;
+        u32 FirstPass; // compiled order of the first pass using the resource
+        u32 LastPass;  // compiled order of the last pass using the resource
+        u32 PhysicalIndex;
+    };
+
+    struct Pass
+    {
+        RenderGraphPassInfo Info;
+        Vector<RenderGraphResource> Reads;
+        Vector<RenderGraphResource> Writes;
+        Vector<RPassAttachment> Attachments;
+        u32 Order;
+    };
+
+    void CullPasses();
+    void ComputeLifetimes();
+    void AssignPhysicalTargets();
+    void DeriveAttachments();
+
+    Vector<Resource> mResources;
+    Vector<Pass> mPasses;
+    Vector<RenderGraphPass> mOrder;
+    u32 mPhysicalCount = 0;
+    bool mIsCompiled = false;
+};
+
+} // namespace LD
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Core/Header/Include/Types.h"
+#include "Core/Header/Include/Error.h"
+#include "Core/Math/Include/Vec2.h"
+#include "Core/Math/Include/Vec3.h"
+#include "Core/Math/Include/Mat4.h"
+#include "Core/Media/Include/Mesh.h"
+
+// Quantized Static Vertices
+// - positions are 16 bit unsigned normalized coordinates inside the bounding box of the mesh,
+//   the box is folded into the per-instance model matrix so the shader reads them as plain positions
+// - normal and tangent are octahedral encoded into two 8 bit signed normalized components each,
+//   the same encoding as GBufferEncodeNormal
+// - texture coordinates are 16 bit floats
+// - 16 bytes per vertex instead of the 44 bytes of MeshVertex
+// - shaders that read this layout are compiled with LD_VERTEX_QUANTIZED defined
+
+namespace LD
+{
+
+struct QuantizedVertex
+{
+    u16 Position[4];     // unsigned normalized xyz inside the bounding box, w is unused
+    i8 NormalTangent[4]; // signed normalized octahedral normal in xy, octahedral tangent in zw
+    u16 TexUV[2];        // 16 bit floats
+};
+
+LD_STATIC_ASSERT(sizeof(QuantizedVertex) == 16);
+
+/// @brief convert to the nearest 16 bit float, values out of range become infinity
+u16 FloatToHalf(float f);
+
+/// @brief convert a 16 bit float back to 32 bits
+float HalfToFloat(u16 h);
+
+/// @brief quantize vertices inside a bounding box
+/// @param boundsMin minimum corner of a box containing all vertex positions
+/// @param boundsMax maximum corner of a box containing all vertex positions
+void QuantizeVertices(const MeshVertex* vertices, u32 vertexCount, const Vec3& boundsMin, const Vec3& boundsMax,
+                      QuantizedVertex* outVertices);
+
+/// @brief CPU reference of the vertex shader decode, mesh space position and unit normal and tangent
+MeshVertex DequantizeVertex(const QuantizedVertex& vertex, const Vec3& boundsMin, const Vec3& boundsMax);
+
+/// @brief maps quantized positions in [0, 1] back into the bounding box,
+///        multiplied to the right of the model matrix of an instance
+Mat4 GetDequantizeMatrix(const Vec3& boundsMin, const Vec3& boundsMax);
+
+} // namespace LD
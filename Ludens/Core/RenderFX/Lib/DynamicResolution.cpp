@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cmath>
+#include "Core/RenderFX/Include/DynamicResolution.h"
+
+// a window above this fraction of the target shrinks the scale
+#define DYNAMIC_RESOLUTION_OVER_BUDGET 1.05f
+
+// a window below this fraction of the target has headroom that vertical sync did not hide
+#define DYNAMIC_RESOLUTION_UNDER_BUDGET 0.8f
+
+// largest change of the scale from a single window
+#define DYNAMIC_RESOLUTION_MIN_RATIO 0.75f
+#define DYNAMIC_RESOLUTION_MAX_RATIO 1.25f
+
+// stable windows before probing a larger scale, doubled after every failed probe
+#define DYNAMIC_RESOLUTION_MIN_PROBE_WINDOWS 4
+#define DYNAMIC_RESOLUTION_MAX_PROBE_WINDOWS 64
+
+namespace LD
+{
+
+DynamicResolution::DynamicResolution()
+    : mFrameCount(0), mStableWindows(0), mProbeWindows(DYNAMIC_RESOLUTION_MIN_PROBE_WINDOWS), mIsProbing(false),
+      mProbeOrigin(mInfo.MaxScale), mScale(mInfo.MaxScale)
+{
+}
+
+void DynamicResolution::Startup(const DynamicResolutionInfo& info)
+{
+    LD_DEBUG_ASSERT(info.TargetFrameTime > 0.0f);
+    LD_DEBUG_ASSERT(0.0f < info.MinScale && info.MinScale <= info.MaxScale && info.ScaleStep > 0.0f);
+
+    mInfo = info;
+    mFrameCount = 0;
+    mStableWindows = 0;
+    mProbeWindows = DYNAMIC_RESOLUTION_MIN_PROBE_WINDOWS;
+    mIsProbing = false;
+    mProbeOrigin = info.MaxScale;
+    mScale = info.MaxScale;
+}
+
+float DynamicResolution::Update(float frameTime)
+{
+    mFrameTimes[mFrameCount++] = frameTime;
+
+    if (mFrameCount < LD_DYNAMIC_RESOLUTION_WINDOW)
+        return mScale;
+
+    mFrameCount = 0;
+
+    float average = 0.0f;
+    for (float time : mFrameTimes)
+        average += time;
+    average /= (float)LD_DYNAMIC_RESOLUTION_WINDOW;
+
+    float target = mInfo.TargetFrameTime;
+
+    if (average > target * DYNAMIC_RESOLUTION_OVER_BUDGET)
+    {
+        mStableWindows = 0;
+
+        // a probe that missed the target returns to the last scale that met it,
+        // and waits longer before the next attempt
+        if (mIsProbing)
+        {
+            mIsProbing = false;
+            mProbeWindows = std::min(mProbeWindows * 2, DYNAMIC_RESOLUTION_MAX_PROBE_WINDOWS);
+            SetScale(mProbeOrigin);
+
+            return mScale;
+        }
+
+        float ratio = std::max(std::sqrt(target / average), DYNAMIC_RESOLUTION_MIN_RATIO);
+        float scale = std::min(Quantize(mScale * ratio), mScale - mInfo.ScaleStep);
+        SetScale(scale);
+
+        return mScale;
+    }
+
+    // the probe held, later probes start from the shortest interval again
+    if (mIsProbing)
+    {
+        mIsProbing = false;
+        mProbeWindows = DYNAMIC_RESOLUTION_MIN_PROBE_WINDOWS;
+    }
+
+    if (mScale >= mInfo.MaxScale)
+        return mScale;
+
+    if (average < target * DYNAMIC_RESOLUTION_UNDER_BUDGET)
+    {
+        float ratio = std::min(std::sqrt(target * DYNAMIC_RESOLUTION_UNDER_BUDGET / average), DYNAMIC_RESOLUTION_MAX_RATIO);
+        float scale = std::max(Quantize(mScale * ratio), mScale + mInfo.ScaleStep);
+        mStableWindows = 0;
+        SetScale(scale);
+
+        return mScale;
+    }
+
+    if (++mStableWindows >= mProbeWindows)
+    {
+        mStableWindows = 0;
+        mIsProbing = true;
+        mProbeOrigin = mScale;
+        SetScale(Quantize(mScale + mInfo.ScaleStep));
+    }
+
+    return mScale;
+}
+
+int DynamicResolution::GetScaledSize(int size) const
+{
+    return std::max(1, (int)std::ceil((float)size * mScale));
+}
+
+float DynamicResolution::Quantize(float scale) const
+{
+    // round down, tolerating rounding errors of previous multiples of the step
+    return std::floor(scale / mInfo.ScaleStep + 1e-3f) * mInfo.ScaleStep;
+}
+
+void DynamicResolution::SetScale(float scale)
+{
+    mScale = std::clamp(scale, mInfo.MinScale, mInfo.MaxScale);
+    mFrameCount = 0;
+}
+
+} // namespace LD
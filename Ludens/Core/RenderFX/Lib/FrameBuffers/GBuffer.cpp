@@ -15,17 +15,24 @@ namespace LD {
 	void GBuffer::Startup(const GBufferInfo& info)
 	{
 		mDevice = info.Device;
+		mLayout = info.Layout;
+
+		LD_DEBUG_ASSERT(mLayout == GBufferLayout::Standard || info.DepthStencilFormat != RTextureFormat::Undefined);
 
 		RTextureInfo textureI{};
 		textureI.Type = RTextureType::Texture2D;
 		textureI.TextureUsage = TEXTURE_USAGE_FRAME_BUFFER_ATTACHMENT_BIT;
 		textureI.Width = info.Width;
 		textureI.Height = info.Height;
-		textureI.Format = info.PositionFormat;
-		textureI.Size = info.Width * info.Height * GetTextureFormatPixelSize(info.PositionFormat);
 		textureI.Data = nullptr;
 		textureI.Sampler.AddressMode = RSamplerAddressMode::ClampToEdge;
-		mDevice.CreateTexture(mPosition, textureI);
+
+		if (mLayout == GBufferLayout::Standard)
+		{
+			textureI.Format = info.PositionFormat;
+			textureI.Size = info.Width * info.Height * GetTextureFormatPixelSize(info.PositionFormat);
+			mDevice.CreateTexture(mPosition, textureI);
+		}
 
 		textureI.Format = info.NormalsFormat;
 		textureI.Size = info.Width * info.Height * GetTextureFormatPixelSize(info.NormalsFormat);
@@ -37,20 +44,28 @@ namespace LD {
 
 		if (info.DepthStencilFormat != RTextureFormat::Undefined)
 		{
+			// depth is point sampled for position reconstruction
 			textureI.Format = info.DepthStencilFormat;
-			textureI.Size = info.Width * info.Height * GetTextureFormatPixelSize(info.AlbedoFormat);
+			textureI.Size = info.Width * info.Height * GetTextureFormatPixelSize(info.DepthStencilFormat);
+			textureI.Sampler.MinFilter = RSamplerFilter::Nearest;
+			textureI.Sampler.MagFilter = RSamplerFilter::Nearest;
 			mDevice.CreateTexture(mDepthStencil, textureI);
 		}
 
-		RTexture colorAttachments[3] = {
-			mPosition, mNormals, mAlbedo
-		};
+		RTexture colorAttachments[3];
+		u32 colorCount = 0;
+
+		if (mPosition)
+			colorAttachments[colorCount++] = mPosition;
+
+		colorAttachments[colorCount++] = mNormals;
+		colorAttachments[colorCount++] = mAlbedo;
 
 		RFrameBufferInfo gbufferI{};
 		gbufferI.Width = info.Width;
 		gbufferI.Height = info.Height;
 		gbufferI.RenderPass = info.RenderPass;
-		gbufferI.ColorAttachments = { 3, colorAttachments };
+		gbufferI.ColorAttachments = { colorCount, colorAttachments };
 		if (mDepthStencil)
 			gbufferI.DepthStencilAttachment = mDepthStencil;
 
@@ -66,7 +81,9 @@ namespace LD {
 
 		mDevice.DeleteTexture(mAlbedo);
 		mDevice.DeleteTexture(mNormals);
-		mDevice.DeleteTexture(mPosition);
+
+		if (mPosition)
+			mDevice.DeleteTexture(mPosition);
 
 		mDevice.ResetHandle();
 	}
@@ -0,0 +1,172 @@
+#include "Core/DSA/Include/Array.h"
+#include "Core/RenderFX/Include/Groups/BindlessMaterialGroup.h"
+
+namespace LD
+{
+
+BindlessMaterialGroup::~BindlessMaterialGroup()
+{
+    LD_DEBUG_ASSERT(!mDevice);
+}
+
+void BindlessMaterialGroup::Startup(RDevice device, RBindingGroupLayout materialBGL)
+{
+    LD_DEBUG_ASSERT(device && device.HasBindlessSupport());
+    mDevice = device;
+    mMaterialCount = 0;
+    mTextureCount = 0;
+    mMaterials.Resize(MAX_BINDLESS_MATERIAL_COUNT);
+
+    RBindingGroupInfo groupI;
+    groupI.Layout = materialBGL;
+    mDevice.CreateBindingGroup(mHandle, groupI);
+
+    // material parameters are written once per material, entries of removed materials are reused
+    RBufferInfo ssboI{};
+    ssboI.Type = RBufferType::StorageBuffer;
+    ssboI.MemoryUsage = RMemoryUsage::Persistent;
+    ssboI.Data = nullptr;
+    ssboI.Size = sizeof(BindlessMaterialData) * MAX_BINDLESS_MATERIAL_COUNT;
+    mDevice.CreateBuffer(mSSBO, ssboI);
+    mHandle.BindStorageBuffer(0, mSSBO);
+
+    // NOTE: Unlike MaterialGroup, no default textures are created. The texture array is partially bound,
+    //       the shader only samples the array elements a material refers to.
+}
+
+void BindlessMaterialGroup::Cleanup()
+{
+    for (u32 index = 0; index < mMaterialCount; index++)
+    {
+        for (RTexture& texture : mMaterials[index].Textures)
+        {
+            if (texture)
+                mDevice.DeleteTexture(texture);
+        }
+    }
+
+    mMaterials.Clear();
+    mFreeMaterials.Clear();
+    mFreeTextures.Clear();
+    mDevice.DeleteBuffer(mSSBO);
+    mDevice.DeleteBindingGroup(mHandle);
+    mDevice.ResetHandle();
+}
+
+u32 BindlessMaterialGroup::AddMaterial(const MaterialGroupInfo& info)
+{
+    u32 index;
+
+    if (!mFreeMaterials.IsEmpty())
+    {
+        index = mFreeMaterials.Back();
+        mFreeMaterials.PopBack();
+    }
+    else
+    {
+        LD_DEBUG_ASSERT(mMaterialCount < MAX_BINDLESS_MATERIAL_COUNT);
+        index = mMaterialCount++;
+    }
+
+    MaterialSlot& slot = mMaterials[index];
+    slot.TextureIndices[0] = AddTexture(slot.Textures[0], info.AlbedoTextureInfo);
+    slot.TextureIndices[1] = AddTexture(slot.Textures[1], info.NormalTextureInfo);
+    slot.TextureIndices[2] = AddTexture(slot.Textures[2], info.MetallicTextureInfo);
+    slot.TextureIndices[3] = AddTexture(slot.Textures[3], info.RoughnessTextureInfo);
+
+    BindlessMaterialData data{};
+    data.Albedo = info.UBO.Albedo;
+    data.Roughness = info.UBO.Roughness;
+    data.Metallic = info.UBO.Metallic;
+    data.MetallicRoughnessLayout = (i32)info.MetallicRoughnessLayout;
+    data.AlbedoTexture = info.UBO.UseAlbedoTexture ? slot.TextureIndices[0] : -1;
+    data.NormalTexture = info.UBO.UseNormalTexture ? slot.TextureIndices[1] : -1;
+    data.MetallicTexture = slot.TextureIndices[2];
+    data.RoughnessTexture = slot.TextureIndices[3];
+
+    // the entry is not referenced by frames in flight until a draw uses the returned index
+    mSSBO.SetData(index * sizeof(BindlessMaterialData), sizeof(BindlessMaterialData), &data);
+
+    return index;
+}
+
+void BindlessMaterialGroup::RemoveMaterial(u32 index)
+{
+    LD_DEBUG_ASSERT(index < mMaterialCount);
+
+    MaterialSlot& slot = mMaterials[index];
+
+    for (int i = 0; i < 4; i++)
+    {
+        if (!slot.Textures[i])
+            continue;
+
+        // the array element is left dangling, partially bound arrays allow this as long as it is not accessed
+        mDevice.DeleteTexture(slot.Textures[i]);
+        mFreeTextures.PushBack(slot.TextureIndices[i]);
+        slot.TextureIndices[i] = -1;
+    }
+
+    mFreeMaterials.PushBack(index);
+}
+
+i32 BindlessMaterialGroup::AddTexture(RTexture& texture, const Optional<RTextureInfo>& info)
+{
+    if (!info.HasValue())
+        return -1;
+
+    i32 arrayIndex;
+
+    if (!mFreeTextures.IsEmpty())
+    {
+        arrayIndex = mFreeTextures.Back();
+        mFreeTextures.PopBack();
+    }
+    else
+    {
+        LD_DEBUG_ASSERT(mTextureCount < MAX_BINDLESS_TEXTURE_COUNT);
+        arrayIndex = mTextureCount++;
+    }
+
+    RTextureInfo textureI = info.Value();
+    mDevice.CreateTexture(texture, textureI);
+    mHandle.BindTexture(1, texture, arrayIndex);
+
+    return arrayIndex;
+}
+
+RBindingGroupLayoutData BindlessMaterialGroup::GetLayoutData() const
+{
+    RBindingInfo materials;
+    materials.Count = 1;
+    materials.Type = RBindingType::StorageBuffer;
+
+    RBindingInfo textures;
+    textures.Count = MAX_BINDLESS_TEXTURE_COUNT;
+    textures.Type = RBindingType::Texture;
+    textures.Bindless = true;
+
+    return { materials, textures };
+}
+
+RBindingGroupLayout BindlessMaterialGroup::CreateLayout(RDevice device)
+{
+    LD_DEBUG_ASSERT(device && device.HasBindlessSupport());
+
+    RBindingGroupLayout materialBGL;
+
+    Array<RBindingInfo, 2> bindings;
+    bindings[0].Type = RBindingType::StorageBuffer;
+    bindings[0].Count = 1;
+    bindings[1].Type = RBindingType::Texture;
+    bindings[1].Count = MAX_BINDLESS_TEXTURE_COUNT;
+    bindings[1].Bindless = true;
+
+    RBindingGroupLayoutInfo materialBGLI;
+    materialBGLI.Bindings = bindings.GetView();
+    device.CreateBindingGroupLayout(materialBGL, materialBGLI);
+
+    return materialBGL;
+}
+
+} // namespace LD
@@ -1,4 +1,5 @@
 #include <random>
+#include <algorithm>
 #include "Core/DSA/Include/Array.h"
 #include "Core/DSA/Include/Vector.h"
 #include "Core/RenderFX/Include/Groups/SSAOGroup.h"
@@ -51,7 +52,7 @@ SSAOGroup::~SSAOGroup()
     LD_DEBUG_ASSERT(!mDevice);
 }
 
-void SSAOGroup::Startup(RDevice device, RBindingGroupLayout ssaoBGL)
+void SSAOGroup::Startup(RDevice device, RBindingGroupLayout ssaoBGL, int sampleCount)
 {
     LD_DEBUG_ASSERT(device);
     mDevice = device;
@@ -60,16 +61,7 @@ void SSAOGroup::Startup(RDevice device, RBindingGroupLayout ssaoBGL)
     groupI.Layout = ssaoBGL;
     mDevice.CreateBindingGroup(mHandle, groupI);
 
-    Vector<Vec4> samples;
-    GenerateSSAOKernelSamples(64, samples);
-
-    RBufferInfo bufferI;
-    bufferI.Type = RBufferType::UniformBuffer;
-    bufferI.MemoryUsage = RMemoryUsage::FrameDynamic;
-    bufferI.Data = samples.Data();
-    bufferI.Size = samples.ByteSize();
-    mDevice.CreateBuffer(mKernelUBO, bufferI);
-    mHandle.BindUniformBuffer(0, mKernelUBO);
+    SetSampleCount(sampleCount);
 
     Vector<u32> pixels;
     GenerateSSAONoiseTexture(256, pixels);
@@ -92,6 +84,7 @@ void SSAOGroup::Cleanup()
     mDevice.DeleteBuffer(mKernelUBO);
     mDevice.DeleteBindingGroup(mHandle);
     mDevice.ResetHandle();
+    mSampleCount = 0;
 }
 
 void SSAOGroup::BindSSAOTexture(RTexture ssao)
@@ -99,6 +92,36 @@ void SSAOGroup::BindSSAOTexture(RTexture ssao)
     mHandle.BindTexture(2, ssao);
 }
 
+void SSAOGroup::SetSampleCount(int sampleCount)
+{
+    LD_DEBUG_ASSERT(0 < sampleCount && sampleCount <= LD_SSAO_MAX_SAMPLES);
+
+    if (mSampleCount == sampleCount)
+        return;
+
+    mSampleCount = sampleCount;
+
+    // samples are distributed by their index, so fewer samples need a new kernel
+    // instead of a prefix of the full one
+    Vector<Vec4> samples;
+    GenerateSSAOKernelSamples(sampleCount, samples);
+
+    SSAOKernelUBO kernel{};
+    std::copy(samples.Begin(), samples.End(), kernel.Samples);
+    kernel.SampleCount = sampleCount;
+
+    if (mKernelUBO)
+        mDevice.DeleteBuffer(mKernelUBO);
+
+    RBufferInfo bufferI;
+    bufferI.Type = RBufferType::UniformBuffer;
+    bufferI.MemoryUsage = RMemoryUsage::Immutable;
+    bufferI.Data = &kernel;
+    bufferI.Size = sizeof(SSAOKernelUBO);
+    mDevice.CreateBuffer(mKernelUBO, bufferI);
+    mHandle.BindUniformBuffer(0, mKernelUBO);
+}
+
 RBindingGroupLayoutData SSAOGroup::GetLayoutData() const
 {
     // kernel ubo
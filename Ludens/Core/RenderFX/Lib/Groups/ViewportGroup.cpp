@@ -1,7 +1,6 @@
 #include "Core/DSA/Include/Array.h"
 #include "Core/RenderFX/Include/Groups/ViewportGroup.h"
 #include "Core/RenderFX/Include/FrameBuffers/GBuffer.h"
-#include "Core/RenderFX/Include/FrameBuffers/ColorBuffer.h"
 
 namespace LD {
 
@@ -22,23 +21,37 @@ void ViewportGroup::Startup(RDevice device, RBindingGroupLayout viewportBGL)
     bufferI.Size = sizeof(ViewportUBO);
     mDevice.CreateBuffer(mUBO, bufferI);
 
+    bufferI.Size = sizeof(LightClusterUBO);
+    mDevice.CreateBuffer(mLightClusterUBO, bufferI);
+
+    bufferI.Size = sizeof(LightIndexUBO);
+    mDevice.CreateBuffer(mLightIndexUBO, bufferI);
+
     RBindingGroupInfo bgI;
     bgI.Layout = viewportBGL;
     mDevice.CreateBindingGroup(mHandle, bgI);
 
     mHandle.BindUniformBuffer(0, mUBO);
+    mHandle.BindUniformBuffer(5, mLightClusterUBO);
+    mHandle.BindUniformBuffer(6, mLightIndexUBO);
 }
 
 void ViewportGroup::Cleanup()
 {
     mDevice.DeleteBindingGroup(mHandle);
+    mDevice.DeleteBuffer(mLightIndexUBO);
+    mDevice.DeleteBuffer(mLightClusterUBO);
     mDevice.DeleteBuffer(mUBO);
     mDevice.ResetHandle();
 }
 
 void ViewportGroup::BindGBuffer(const GBuffer& gbuffer)
 {
-    mHandle.BindTexture(1, gbuffer.GetPosition());
+    if (gbuffer.GetLayout() == GBufferLayout::Compact)
+        mHandle.BindTexture(1, gbuffer.GetDepthStencil());
+    else
+        mHandle.BindTexture(1, gbuffer.GetPosition());
+
     mHandle.BindTexture(2, gbuffer.GetNormals());
     mHandle.BindTexture(3, gbuffer.GetAlbedo());
 }
@@ -48,10 +61,10 @@ void ViewportGroup::BindSSAOTexture(RTexture ssao)
     mHandle.BindTexture(4, ssao);
 }
 
-void ViewportGroup::BindColorTextures(const ColorBuffer& hdr, const ColorBuffer& ldr)
+void ViewportGroup::BindColorTextures(RTexture hdr, RTexture ldr)
 {
-    mHandle.BindTexture(1, hdr.GetColorAttachment());
-    mHandle.BindTexture(2, ldr.GetColorAttachment());
+    mHandle.BindTexture(1, hdr);
+    mHandle.BindTexture(2, ldr);
 }
 
 RBindingGroupLayoutData ViewportGroup::GetLayoutData() const
@@ -65,11 +78,13 @@ RBindingGroupLayoutData ViewportGroup::GetLayoutData() const
     texture.Type = RBindingType::Texture;
 
     // viewport UBO
-    // gbuffer position
+    // gbuffer position, or depth under the compact layout
     // gbuffer normals
     // gbuffer albedo
     // ssao texture
-    return { binding0, texture, texture, texture, texture };
+    // light cluster records
+    // light indices
+    return { binding0, texture, texture, texture, texture, binding0, binding0 };
 }
 
 RBindingGroupLayout ViewportGroup::CreateLayout(RDevice device)
@@ -78,12 +93,14 @@ RBindingGroupLayout ViewportGroup::CreateLayout(RDevice device)
 
     RBindingGroupLayout viewportBGL;
 
-    Array<RBindingInfo, 5> bindings{
+    Array<RBindingInfo, 7> bindings{
         { RBindingType::UniformBuffer },
         { RBindingType::Texture },
         { RBindingType::Texture },
         { RBindingType::Texture },
         { RBindingType::Texture },
+        { RBindingType::UniformBuffer },
+        { RBindingType::UniformBuffer },
     };
 
     RBindingGroupLayoutInfo viewportBGLI;
@@ -0,0 +1,304 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "Core/RenderFX/Include/LightCluster.h"
+#include "Core/OS/Include/JobSystem.h"
+
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+// one mask word covers 64 lights
+#define LIGHT_MASK_WORDS (LD_MAX_LIGHTS / 64)
+
+// binning a few lights is cheaper than a job
+#define LIGHT_CLUSTER_MIN_LIGHTS_FOR_JOBS 32
+#define LIGHT_CLUSTER_MIN_SLICES_PER_JOB 2
+
+namespace LD
+{
+
+LD_STATIC_ASSERT(LD_MAX_LIGHTS % 64 == 0 && LD_MAX_LIGHTS <= 256); // light indices are 8 bit
+LD_STATIC_ASSERT(LD_LIGHT_CLUSTER_X % LD_MATH_WIDE_COUNT == 0);     // a row of clusters is whole Wide steps
+LD_STATIC_ASSERT(LD_LIGHT_CLUSTER_COUNT % LD_MATH_STREAM_PADDING == 0);
+LD_STATIC_ASSERT(LD_MAX_LIGHT_INDICES <= 65536);                    // record offsets are 16 bit
+
+static inline u32 CountTrailingZeros64(u64 mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, mask);
+    return (u32)index;
+#else
+    return (u32)__builtin_ctzll(mask);
+#endif
+}
+
+/// bounding sphere of a light, spot lights use the tighter sphere around their cone
+static inline void LightBoundingSphere(const LightData& light, Vec3& center, float& radius)
+{
+    Vec3 pos(light.PosRadius.x, light.PosRadius.y, light.PosRadius.z);
+    Vec3 dir(light.Dir.x, light.Dir.y, light.Dir.z);
+    float range = light.PosRadius.w;
+    float cosOuter = light.Dir.w;
+
+    center = pos;
+    radius = range;
+
+    // wide cones and point lights keep the sphere around the light position
+    if (cosOuter < 0.7071068f)
+        return;
+
+    // the sphere through the apex and the rim of the cone cap
+    radius = range / (2.0f * cosOuter);
+    center = pos + dir * radius;
+}
+
+LightCluster::LightCluster() : mProj(Mat4::Zero), mIndexCount(0), mNear(0.0f), mFar(0.0f)
+{
+    mClusterBounds.Resize(LD_LIGHT_CLUSTER_COUNT);
+    mClusterUBO = {};
+    mIndexUBO = {};
+}
+
+LightCluster::~LightCluster()
+{
+}
+
+LightClusterStats LightCluster::Build(const Mat4& view, const Mat4& proj, const LightData* lights, u32 lightCount)
+{
+    LD_DEBUG_ASSERT(lightCount <= LD_MAX_LIGHTS);
+    LD_DEBUG_ASSERT(proj[2][3] == -1.0f && "light clusters require a perspective projection");
+
+    LightClusterStats stats{};
+
+    if (memcmp(proj.GetData(), mProj.GetData(), sizeof(Mat4)) != 0)
+        UpdateClusterBounds(proj);
+
+    // exponential depth slices, slice k spans near * (far / near) ^ (k / Z) to near * (far / near) ^ ((k + 1) / Z)
+    float logDepthRange = std::log(mFar / mNear);
+    float sliceScale = LD_LIGHT_CLUSTER_Z / logDepthRange;
+    float sliceBias = -LD_LIGHT_CLUSTER_Z * std::log(mNear) / logDepthRange;
+    mClusterUBO.DepthParams = { mNear, mFar, sliceScale, sliceBias };
+
+    // bounding spheres to view space in one batch
+    mLightCenters.Resize(lightCount);
+    mLightRadius.resize(lightCount);
+
+    for (u32 i = 0; i < lightCount; i++)
+    {
+        Vec3 center;
+        LightBoundingSphere(lights[i], center, mLightRadius[i]);
+        mLightCenters.Set(i, center);
+    }
+
+    Vec3Stream::Transform(view, mLightCenters, mLightCenters);
+
+    // depth slice range of each sphere, lights entirely behind the near plane or beyond the far plane get none
+    mLightSlices.resize(lightCount);
+
+    for (u32 i = 0; i < lightCount; i++)
+    {
+        float depth = -mLightCenters.Component(2)[i];
+        float radius = mLightRadius[i];
+
+        if (depth + radius < mNear || depth - radius > mFar)
+        {
+            mLightSlices[i] = 0x0000FFFF; // first slice after the last slice
+            continue;
+        }
+
+        float minDepth = std::max(depth - radius, mNear);
+        float maxDepth = std::min(depth + radius, mFar);
+        int first = (int)std::floor(std::log(minDepth) * sliceScale + sliceBias);
+        int last = (int)std::floor(std::log(maxDepth) * sliceScale + sliceBias);
+        first = std::clamp(first, 0, LD_LIGHT_CLUSTER_Z - 1);
+        last = std::clamp(last, 0, LD_LIGHT_CLUSTER_Z - 1);
+
+        mLightSlices[i] = (u32)first | ((u32)last << 16);
+        stats.LightCount++;
+    }
+
+    mLightMasks.assign((size_t)LD_LIGHT_CLUSTER_COUNT * LIGHT_MASK_WORDS, 0);
+
+    // each job owns a contiguous range of depth slices and writes only the masks of its own clusters
+    JobSystem& js = JobSystem::GetSingleton();
+    int workerCount = js.GetWorkerThreadCount();
+
+    if (lightCount < LIGHT_CLUSTER_MIN_LIGHTS_FOR_JOBS || workerCount <= 1)
+    {
+        BinSlices(0, LD_LIGHT_CLUSTER_Z);
+    }
+    else
+    {
+        u32 slicesPerJob = std::max<u32>((LD_LIGHT_CLUSTER_Z + workerCount - 1) / workerCount, LIGHT_CLUSTER_MIN_SLICES_PER_JOB);
+        u32 jobCount = (LD_LIGHT_CLUSTER_Z + slicesPerJob - 1) / slicesPerJob;
+        mJobs.resize(jobCount);
+
+        for (u32 i = 0; i < jobCount; i++)
+        {
+            mJobs[i].Cluster = this;
+            mJobs[i].SliceBegin = i * slicesPerJob;
+            mJobs[i].SliceEnd = std::min<u32>((i + 1) * slicesPerJob, LD_LIGHT_CLUSTER_Z);
+
+            Job job;
+            job.Type = JobType::LightCulling;
+            job.Main = &LightCluster::BinJob;
+            job.Data = &mJobs[i];
+            js.Submit(job);
+        }
+
+        js.WaitType(JobType::LightCulling);
+    }
+
+    Compact(stats);
+
+    return stats;
+}
+
+AABB LightCluster::GetClusterBounds(u32 x, u32 y, u32 z) const
+{
+    LD_DEBUG_ASSERT(x < LD_LIGHT_CLUSTER_X && y < LD_LIGHT_CLUSTER_Y && z < LD_LIGHT_CLUSTER_Z);
+
+    return mClusterBounds.Get((z * LD_LIGHT_CLUSTER_Y + y) * LD_LIGHT_CLUSTER_X + x);
+}
+
+void LightCluster::BinJob(void* data)
+{
+    BinJobData& job = *(BinJobData*)data;
+
+    job.Cluster->BinSlices(job.SliceBegin, job.SliceEnd);
+}
+
+void LightCluster::UpdateClusterBounds(const Mat4& proj)
+{
+    mProj = proj;
+
+    // depth range from the third and fourth columns of Mat4::Perspective
+    float a = proj[2][2];
+    float b = proj[3][2];
+    mNear = b / (a - 1.0f);
+    mFar = b / (a + 1.0f);
+
+    float x = 1.0f / proj[0][0];
+    float y = 1.0f / proj[1][1];
+
+    for (u32 z = 0; z < LD_LIGHT_CLUSTER_Z; z++)
+    {
+        float depth0 = mNear * std::pow(mFar / mNear, (float)z / LD_LIGHT_CLUSTER_Z);
+        float depth1 = mNear * std::pow(mFar / mNear, (float)(z + 1) / LD_LIGHT_CLUSTER_Z);
+
+        for (u32 ty = 0; ty < LD_LIGHT_CLUSTER_Y; ty++)
+        {
+            // tile edges at unit depth, a view space point (px, py, -d) projects to ndc.x = proj[0][0] * px / d
+            float y0 = ((float)ty / LD_LIGHT_CLUSTER_Y * 2.0f - 1.0f) * y;
+            float y1 = ((float)(ty + 1) / LD_LIGHT_CLUSTER_Y * 2.0f - 1.0f) * y;
+
+            for (u32 tx = 0; tx < LD_LIGHT_CLUSTER_X; tx++)
+            {
+                float x0 = ((float)tx / LD_LIGHT_CLUSTER_X * 2.0f - 1.0f) * x;
+                float x1 = ((float)(tx + 1) / LD_LIGHT_CLUSTER_X * 2.0f - 1.0f) * x;
+
+                // the tile edges scale linearly with depth, so the extremes lie on the near or far face
+                AABB bounds;
+                bounds.Min.x = std::min(x0 * depth0, x0 * depth1);
+                bounds.Max.x = std::max(x1 * depth0, x1 * depth1);
+                bounds.Min.y = std::min(y0 * depth0, y0 * depth1);
+                bounds.Max.y = std::max(y1 * depth0, y1 * depth1);
+                bounds.Min.z = -depth1;
+                bounds.Max.z = -depth0;
+
+                mClusterBounds.Set((z * LD_LIGHT_CLUSTER_Y + ty) * LD_LIGHT_CLUSTER_X + tx, bounds);
+            }
+        }
+    }
+}
+
+void LightCluster::BinSlices(u32 sliceBegin, u32 sliceEnd)
+{
+    using namespace SIMD;
+
+    const Wide zero = WideSet(0.0f);
+    const float* minX = mClusterBounds.Component(0);
+    const float* minY = mClusterBounds.Component(1);
+    const float* minZ = mClusterBounds.Component(2);
+    const float* maxX = mClusterBounds.Component(3);
+    const float* maxY = mClusterBounds.Component(4);
+    const float* maxZ = mClusterBounds.Component(5);
+
+    for (u32 i = 0; i < (u32)mLightSlices.size(); i++)
+    {
+        u32 first = std::max(mLightSlices[i] & 0xFFFF, sliceBegin);
+        u32 last = std::min((mLightSlices[i] >> 16) + 1, sliceEnd);
+
+        if (first >= last)
+            continue;
+
+        const Wide cx = WideSet(mLightCenters.Component(0)[i]);
+        const Wide cy = WideSet(mLightCenters.Component(1)[i]);
+        const Wide cz = WideSet(mLightCenters.Component(2)[i]);
+        const Wide radiusSq = WideSet(mLightRadius[i] * mLightRadius[i]);
+        const u64 bit = 1ull << (i % 64);
+        u64* masks = mLightMasks.data() + i / 64;
+
+        for (u32 z = first; z < last; z++)
+        {
+            for (u32 y = 0; y < LD_LIGHT_CLUSTER_Y; y++)
+            {
+                u32 row = (z * LD_LIGHT_CLUSTER_Y + y) * LD_LIGHT_CLUSTER_X;
+
+                for (u32 x = 0; x < LD_LIGHT_CLUSTER_X; x += LD_MATH_WIDE_COUNT)
+                {
+                    u32 cluster = row + x;
+
+                    // squared distance from the sphere center to each box, zero inside the box
+                    Wide dx = WideMax(WideMax(WideSub(WideLoad(minX + cluster), cx), WideSub(cx, WideLoad(maxX + cluster))), zero);
+                    Wide dy = WideMax(WideMax(WideSub(WideLoad(minY + cluster), cy), WideSub(cy, WideLoad(maxY + cluster))), zero);
+                    Wide dz = WideMax(WideMax(WideSub(WideLoad(minZ + cluster), cz), WideSub(cz, WideLoad(maxZ + cluster))), zero);
+                    Wide distSq = WideMulAdd(dx, dx, WideMulAdd(dy, dy, WideMul(dz, dz)));
+
+                    int hits = WideLessMask(distSq, radiusSq);
+
+                    for (; hits; hits &= hits - 1)
+                    {
+                        u32 lane = CountTrailingZeros64((u64)hits);
+                        masks[(size_t)(cluster + lane) * LIGHT_MASK_WORDS] |= bit;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void LightCluster::Compact(LightClusterStats& stats)
+{
+    mIndexCount = 0;
+
+    for (u32 cluster = 0; cluster < LD_LIGHT_CLUSTER_COUNT; cluster++)
+    {
+        const u64* masks = mLightMasks.data() + (size_t)cluster * LIGHT_MASK_WORDS;
+        u32 offset = mIndexCount;
+
+        for (u32 word = 0; word < LIGHT_MASK_WORDS; word++)
+        {
+            for (u64 mask = masks[word]; mask; mask &= mask - 1)
+            {
+                if (mIndexCount == LD_MAX_LIGHT_INDICES)
+                {
+                    stats.Overflow = true;
+                    break;
+                }
+
+                mIndexUBO.Indices[mIndexCount++] = (u8)(word * 64 + CountTrailingZeros64(mask));
+            }
+        }
+
+        u32 count = mIndexCount - offset;
+        mClusterUBO.Records[cluster] = offset | (count << 16);
+        stats.MaxClusterLights = std::max(stats.MaxClusterLights, count);
+    }
+
+    stats.IndexCount = mIndexCount;
+}
+
+} // namespace LD
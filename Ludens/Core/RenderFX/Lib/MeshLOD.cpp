@@ -0,0 +1,527 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+#include "Core/RenderFX/Include/MeshLOD.h"
+
+// a level that keeps more than this fraction of the triangles of the previous level is not generated
+#define MESH_LOD_MIN_REDUCTION 0.85f
+
+// a collapse may not turn the normal of a remaining triangle further than this, as a cosine
+#define MESH_LOD_MIN_NORMAL_DOT 0.2
+
+namespace LD
+{
+
+/// sum of squared distances to a set of planes, weighted by triangle area
+struct Quadric
+{
+    double A00, A01, A02, A03, A11, A12, A13, A22, A23, A33;
+    double Weight;
+};
+
+static Quadric QuadricFromPlane(double a, double b, double c, double d, double weight)
+{
+    Quadric q;
+    q.A00 = weight * a * a;
+    q.A01 = weight * a * b;
+    q.A02 = weight * a * c;
+    q.A03 = weight * a * d;
+    q.A11 = weight * b * b;
+    q.A12 = weight * b * c;
+    q.A13 = weight * b * d;
+    q.A22 = weight * c * c;
+    q.A23 = weight * c * d;
+    q.A33 = weight * d * d;
+    q.Weight = weight;
+
+    return q;
+}
+
+static void QuadricAdd(Quadric& q, const Quadric& other)
+{
+    q.A00 += other.A00;
+    q.A01 += other.A01;
+    q.A02 += other.A02;
+    q.A03 += other.A03;
+    q.A11 += other.A11;
+    q.A12 += other.A12;
+    q.A13 += other.A13;
+    q.A22 += other.A22;
+    q.A23 += other.A23;
+    q.A33 += other.A33;
+    q.Weight += other.Weight;
+}
+
+/// squared distance of a point to the planes of the quadric, averaged by weight
+static double QuadricError(const Quadric& q, const Vec3& p)
+{
+    if (q.Weight <= 0.0)
+        return 0.0;
+
+    double x = p.x, y = p.y, z = p.z;
+    double error = q.A00 * x * x + 2.0 * q.A01 * x * y + 2.0 * q.A02 * x * z + 2.0 * q.A03 * x +
+                   q.A11 * y * y + 2.0 * q.A12 * y * z + 2.0 * q.A13 * y +
+                   q.A22 * z * z + 2.0 * q.A23 * z + q.A33;
+
+    return std::max(error, 0.0) / q.Weight;
+}
+
+static Vec3 TriangleNormal(const Vec3& p0, const Vec3& p1, const Vec3& p2)
+{
+    return Vec3::Cross(p1 - p0, p2 - p0);
+}
+
+/// half edge collapse candidate, moves a vertex onto a neighbor
+struct Collapse
+{
+    double Error;
+    u32 From;
+    u32 To;
+    u32 FromVersion; // versions of the vertex groups when the error was computed
+    u32 ToVersion;
+
+    bool operator>(const Collapse& other) const
+    {
+        return Error > other.Error;
+    }
+};
+
+class MeshSimplifier
+{
+public:
+    MeshSimplifier(const MeshVertex* vertices, u32 vertexCount, const u32* indices, u32 indexCount);
+
+    /// @return largest collapse error, squared
+    double Simplify(u32 targetIndexCount, Vector<u32>& outIndices);
+
+private:
+    void GroupVertices();
+    void LockVertices();
+    void ComputeQuadrics();
+    void PushCollapse(u32 from, u32 to);
+    void PushCollapses(u32 group);
+    void GetNeighborGroups(u32 group, std::vector<u32>& neighbors) const;
+    bool IsCollapseValid(u32 from, u32 to);
+    void ApplyCollapse(u32 from, u32 to);
+
+    inline const Vec3& GetPosition(u32 vertex) const
+    {
+        return mVertices[vertex].Position;
+    }
+
+    const MeshVertex* mVertices;
+    u32 mVertexCount;
+    u32 mTriangleCount;                             // alive triangles
+    std::vector<u32> mTriangles;                    // three corners per triangle
+    std::vector<bool> mIsTriangleAlive;
+    std::vector<u32> mGroups;                       // vertices at the same position share a group, the lowest vertex index
+    std::vector<u32> mGroupSizes;
+    std::vector<u32> mGroupVersions;                // changes when the quadric or the vertex of a group is gone
+    std::vector<std::vector<u32>> mGroupTriangles;  // triangles with a corner in the group, may list dead triangles
+    std::vector<Quadric> mQuadrics;                 // per group
+    std::vector<bool> mIsLocked;                    // per vertex, seam and border vertices never move
+    std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> mQueue;
+    std::vector<u32> mFromNeighbors;
+    std::vector<u32> mToNeighbors;
+};
+
+MeshSimplifier::MeshSimplifier(const MeshVertex* vertices, u32 vertexCount, const u32* indices, u32 indexCount)
+    : mVertices(vertices), mVertexCount(vertexCount), mTriangleCount(0)
+{
+    LD_DEBUG_ASSERT(indexCount % 3 == 0);
+
+    GroupVertices();
+
+    // triangles with two corners at the same position have no area and are dropped
+    for (u32 i = 0; i < indexCount; i += 3)
+    {
+        u32 g0 = mGroups[indices[i]];
+        u32 g1 = mGroups[indices[i + 1]];
+        u32 g2 = mGroups[indices[i + 2]];
+
+        if (g0 == g1 || g1 == g2 || g2 == g0)
+            continue;
+
+        u32 triangle = mTriangleCount++;
+        mTriangles.push_back(indices[i]);
+        mTriangles.push_back(indices[i + 1]);
+        mTriangles.push_back(indices[i + 2]);
+        mIsTriangleAlive.push_back(true);
+
+        mGroupTriangles[g0].push_back(triangle);
+        mGroupTriangles[g1].push_back(triangle);
+        mGroupTriangles[g2].push_back(triangle);
+    }
+
+    LockVertices();
+    ComputeQuadrics();
+}
+
+double MeshSimplifier::Simplify(u32 targetIndexCount, Vector<u32>& outIndices)
+{
+    for (u32 triangle = 0; triangle < (u32)mIsTriangleAlive.size(); triangle++)
+    {
+        const u32* corners = mTriangles.data() + triangle * 3;
+
+        for (int i = 0; i < 3; i++)
+        {
+            PushCollapse(corners[i], corners[(i + 1) % 3]);
+            PushCollapse(corners[(i + 1) % 3], corners[i]);
+        }
+    }
+
+    double maxError = 0.0;
+
+    while (mTriangleCount * 3 > targetIndexCount && !mQueue.empty())
+    {
+        Collapse collapse = mQueue.top();
+        mQueue.pop();
+
+        // the neighborhood changed since the error was computed, a newer candidate is queued
+        if (collapse.FromVersion != mGroupVersions[mGroups[collapse.From]] ||
+            collapse.ToVersion != mGroupVersions[mGroups[collapse.To]])
+            continue;
+
+        if (!IsCollapseValid(collapse.From, collapse.To))
+            continue;
+
+        ApplyCollapse(collapse.From, collapse.To);
+        maxError = std::max(maxError, collapse.Error);
+    }
+
+    outIndices.Clear();
+
+    for (u32 triangle = 0; triangle < (u32)mIsTriangleAlive.size(); triangle++)
+    {
+        if (!mIsTriangleAlive[triangle])
+            continue;
+
+        outIndices.PushBack(mTriangles[triangle * 3]);
+        outIndices.PushBack(mTriangles[triangle * 3 + 1]);
+        outIndices.PushBack(mTriangles[triangle * 3 + 2]);
+    }
+
+    return maxError;
+}
+
+void MeshSimplifier::GroupVertices()
+{
+    std::unordered_map<Vec3, u32> positionGroups;
+
+    mGroups.resize(mVertexCount);
+    mGroupSizes.assign(mVertexCount, 0);
+    mGroupVersions.assign(mVertexCount, 0);
+    mGroupTriangles.resize(mVertexCount);
+
+    for (u32 vertex = 0; vertex < mVertexCount; vertex++)
+    {
+        auto result = positionGroups.insert({ GetPosition(vertex), vertex });
+        u32 group = result.first->second;
+        mGroups[vertex] = group;
+        mGroupSizes[group]++;
+    }
+}
+
+void MeshSimplifier::LockVertices()
+{
+    // an edge between two positions is manifold if exactly two triangles share it,
+    // anything else is an open border or a non manifold junction
+    std::unordered_map<u64, u32> edgeTriangles;
+
+    for (u32 triangle = 0; triangle < mTriangleCount; triangle++)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            u64 g0 = mGroups[mTriangles[triangle * 3 + i]];
+            u64 g1 = mGroups[mTriangles[triangle * 3 + (i + 1) % 3]];
+            edgeTriangles[(std::min(g0, g1) << 32) | std::max(g0, g1)]++;
+        }
+    }
+
+    std::vector<bool> isBorderGroup(mVertexCount, false);
+
+    for (const auto& edge : edgeTriangles)
+    {
+        if (edge.second == 2)
+            continue;
+
+        isBorderGroup[(u32)(edge.first >> 32)] = true;
+        isBorderGroup[(u32)(edge.first & 0xFFFFFFFF)] = true;
+    }
+
+    // a position split into several vertices lies on an attribute seam
+    mIsLocked.resize(mVertexCount);
+
+    for (u32 vertex = 0; vertex < mVertexCount; vertex++)
+    {
+        u32 group = mGroups[vertex];
+        mIsLocked[vertex] = mGroupSizes[group] > 1 || isBorderGroup[group];
+    }
+}
+
+void MeshSimplifier::ComputeQuadrics()
+{
+    mQuadrics.assign(mVertexCount, QuadricFromPlane(0.0, 0.0, 0.0, 0.0, 0.0));
+
+    for (u32 triangle = 0; triangle < mTriangleCount; triangle++)
+    {
+        const u32* corners = mTriangles.data() + triangle * 3;
+        const Vec3& p0 = GetPosition(corners[0]);
+        Vec3 normal = TriangleNormal(p0, GetPosition(corners[1]), GetPosition(corners[2]));
+
+        double length = normal.Length();
+        if (length <= 0.0)
+            continue;
+
+        double a = normal.x / length;
+        double b = normal.y / length;
+        double c = normal.z / length;
+        double d = -(a * p0.x + b * p0.y + c * p0.z);
+        Quadric plane = QuadricFromPlane(a, b, c, d, length * 0.5);
+
+        for (int i = 0; i < 3; i++)
+            QuadricAdd(mQuadrics[mGroups[corners[i]]], plane);
+    }
+}
+
+void MeshSimplifier::PushCollapse(u32 from, u32 to)
+{
+    if (mIsLocked[from])
+        return;
+
+    u32 fromGroup = mGroups[from];
+    u32 toGroup = mGroups[to];
+
+    Quadric q = mQuadrics[fromGroup];
+    QuadricAdd(q, mQuadrics[toGroup]);
+
+    Collapse collapse;
+    collapse.Error = QuadricError(q, GetPosition(to));
+    collapse.From = from;
+    collapse.To = to;
+    collapse.FromVersion = mGroupVersions[fromGroup];
+    collapse.ToVersion = mGroupVersions[toGroup];
+    mQueue.push(collapse);
+}
+
+void MeshSimplifier::PushCollapses(u32 group)
+{
+    for (u32 triangle : mGroupTriangles[group])
+    {
+        if (!mIsTriangleAlive[triangle])
+            continue;
+
+        const u32* corners = mTriangles.data() + triangle * 3;
+        u32 center = corners[0];
+
+        for (int i = 0; i < 3; i++)
+        {
+            if (mGroups[corners[i]] == group)
+                center = corners[i];
+        }
+
+        for (int i = 0; i < 3; i++)
+        {
+            if (corners[i] == center)
+                continue;
+
+            PushCollapse(center, corners[i]);
+            PushCollapse(corners[i], center);
+        }
+    }
+}
+
+void MeshSimplifier::GetNeighborGroups(u32 group, std::vector<u32>& neighbors) const
+{
+    neighbors.clear();
+
+    for (u32 triangle : mGroupTriangles[group])
+    {
+        if (!mIsTriangleAlive[triangle])
+            continue;
+
+        for (int i = 0; i < 3; i++)
+        {
+            u32 neighbor = mGroups[mTriangles[triangle * 3 + i]];
+
+            if (neighbor != group)
+                neighbors.push_back(neighbor);
+        }
+    }
+
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+}
+
+bool MeshSimplifier::IsCollapseValid(u32 from, u32 to)
+{
+    u32 fromGroup = mGroups[from];
+    u32 toGroup = mGroups[to];
+    u32 sharedTriangles = 0;
+
+    // moving a vertex must not fold any remaining triangle over
+    for (u32 triangle : mGroupTriangles[fromGroup])
+    {
+        if (!mIsTriangleAlive[triangle])
+            continue;
+
+        const u32* corners = mTriangles.data() + triangle * 3;
+        Vec3 p[3];
+        bool isShared = false;
+
+        for (int i = 0; i < 3; i++)
+        {
+            p[i] = GetPosition(corners[i]);
+            isShared = isShared || mGroups[corners[i]] == toGroup;
+        }
+
+        if (isShared)
+        {
+            sharedTriangles++;
+            continue;
+        }
+
+        Vec3 oldNormal = TriangleNormal(p[0], p[1], p[2]);
+
+        for (int i = 0; i < 3; i++)
+        {
+            if (corners[i] == from)
+                p[i] = GetPosition(to);
+        }
+
+        Vec3 newNormal = TriangleNormal(p[0], p[1], p[2]);
+        double dot = Vec3::Dot(oldNormal, newNormal);
+
+        if (dot <= MESH_LOD_MIN_NORMAL_DOT * oldNormal.Length() * newNormal.Length())
+            return false;
+    }
+
+    // link condition, the two vertices may only share the neighbors opposite of their common edge,
+    // otherwise the collapse pinches the surface into a non manifold edge
+    GetNeighborGroups(fromGroup, mFromNeighbors);
+    GetNeighborGroups(toGroup, mToNeighbors);
+
+    u32 commonNeighbors = 0;
+    for (u32 neighbor : mFromNeighbors)
+    {
+        if (std::binary_search(mToNeighbors.begin(), mToNeighbors.end(), neighbor))
+            commonNeighbors++;
+    }
+
+    return sharedTriangles > 0 && commonNeighbors <= sharedTriangles;
+}
+
+void MeshSimplifier::ApplyCollapse(u32 from, u32 to)
+{
+    u32 fromGroup = mGroups[from];
+    u32 toGroup = mGroups[to];
+
+    for (u32 triangle : mGroupTriangles[fromGroup])
+    {
+        if (!mIsTriangleAlive[triangle])
+            continue;
+
+        u32* corners = mTriangles.data() + triangle * 3;
+        bool isShared = false;
+
+        for (int i = 0; i < 3; i++)
+            isShared = isShared || mGroups[corners[i]] == toGroup;
+
+        // triangles along the collapsed edge degenerate
+        if (isShared)
+        {
+            mIsTriangleAlive[triangle] = false;
+            mTriangleCount--;
+            continue;
+        }
+
+        for (int i = 0; i < 3; i++)
+        {
+            if (corners[i] == from)
+                corners[i] = to;
+        }
+
+        mGroupTriangles[toGroup].push_back(triangle);
+    }
+
+    mGroupTriangles[fromGroup].clear();
+    QuadricAdd(mQuadrics[toGroup], mQuadrics[fromGroup]);
+
+    mGroupVersions[fromGroup]++;
+    mGroupVersions[toGroup]++;
+    PushCollapses(toGroup);
+}
+
+float SimplifyMesh(const MeshVertex* vertices, u32 vertexCount, const u32* indices, u32 indexCount,
+                   u32 targetIndexCount, Vector<u32>& outIndices)
+{
+    MeshSimplifier simplifier(vertices, vertexCount, indices, indexCount);
+    double error = simplifier.Simplify(targetIndexCount, outIndices);
+
+    return (float)std::sqrt(error);
+}
+
+void GenerateMeshLODs(const MeshLODInfo& info, const Vector<MeshVertex>& vertices, const Vector<u32>& indices,
+                      Vector<u32>& lodIndices, Vector<MeshLODLevel>& levels)
+{
+    LD_DEBUG_ASSERT(1 <= info.LevelCount && info.LevelCount <= LD_MESH_LOD_MAX_LEVELS);
+    LD_DEBUG_ASSERT(0.0f < info.TriangleRatio && info.TriangleRatio < 1.0f);
+
+    lodIndices = indices;
+    levels.Clear();
+    levels.PushBack({ 0, (u32)indices.Size(), 0.0f });
+
+    Vector<u32> simplified;
+    u32 vertexCount = (u32)vertices.Size();
+
+    for (u32 level = 1; level < info.LevelCount; level++)
+    {
+        const MeshLODLevel& prev = levels.Back();
+        u32 targetIndexCount = (u32)((float)(prev.IndexCount / 3) * info.TriangleRatio) * 3;
+
+        // the previous level is still in the front of the buffer when appending this level
+        const u32* prevIndices = lodIndices.Data() + prev.IndexStart;
+        float error = SimplifyMesh(vertices.Data(), vertexCount, prevIndices, prev.IndexCount, targetIndexCount, simplified);
+
+        if ((float)simplified.Size() > (float)prev.IndexCount * MESH_LOD_MIN_REDUCTION)
+            break;
+
+        // errors of consecutive levels add up to a bound of the distance to the full detail level
+        MeshLODLevel next;
+        next.IndexStart = (u32)lodIndices.Size();
+        next.IndexCount = (u32)simplified.Size();
+        next.Error = prev.Error + error;
+
+        for (u32 index : simplified)
+            lodIndices.PushBack(index);
+
+        levels.PushBack(next);
+    }
+}
+
+float GetMeshScreenRadius(const Vec3& viewCenter, float radius, const Mat4& proj, float viewportHeight)
+{
+    float distanceSquared = viewCenter.LengthSquared();
+    float radiusSquared = radius * radius;
+
+    if (distanceSquared <= radiusSquared)
+        return std::numeric_limits<float>::infinity();
+
+    // proj[1][1] is the cotangent of half the vertical field of view
+    return radius * proj[1][1] * 0.5f * viewportHeight / std::sqrt(distanceSquared - radiusSquared);
+}
+
+u32 SelectMeshLOD(const float* errors, u32 levelCount, float screenRadius, float pixelThreshold)
+{
+    u32 level = 0;
+
+    while (level + 1 < levelCount && errors[level + 1] * screenRadius <= pixelThreshold)
+        level++;
+
+    return level;
+}
+
+} // namespace LD
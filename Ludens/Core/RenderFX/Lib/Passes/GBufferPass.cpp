@@ -13,34 +13,58 @@ void GBufferPass::Startup(const GBufferPassInfo& info)
     mAlbedoFormat = info.AlbedoFormat;
     mDepthStencilFormat = info.DepthStencilFormat;
 
+    mLayout = info.Layout;
+
     Array<RPassAttachment, 4> attachments;
-    attachments[0].InitialState = RState::Undefined;
-    attachments[0].FinalState = RState::ShaderResource;
-    attachments[0].Format = mPositionFormat;
-    attachments[0].LoadOp = RLoadOp::Clear;
-    attachments[0].StoreOp = RStoreOp::Store;
-
-    attachments[1].InitialState = RState::Undefined;
-    attachments[1].FinalState = RState::ShaderResource;
-    attachments[1].Format = mNormalFormat;
-    attachments[1].LoadOp = RLoadOp::Clear;
-    attachments[1].StoreOp = RStoreOp::Store;
-
-    attachments[2].InitialState = RState::Undefined;
-    attachments[2].FinalState = RState::ShaderResource;
-    attachments[2].Format = mAlbedoFormat;
-    attachments[2].LoadOp = RLoadOp::Clear;
-    attachments[2].StoreOp = RStoreOp::Store;
-
-    attachments[3].InitialState = RState::Undefined;
-    attachments[3].FinalState = RState::DepthStencilWrite;
-    attachments[3].Format = mDepthStencilFormat;
-    attachments[3].LoadOp = RLoadOp::Clear;
-    attachments[3].StoreOp = RStoreOp::Discard;
+    u32 colorCount = GetColorAttachmentCount();
+    u32 colorIdx = 0;
+
+    // the compact layout reconstructs position from depth instead of storing it
+    if (mLayout == GBufferLayout::Standard)
+    {
+        attachments[colorIdx].InitialState = RState::Undefined;
+        attachments[colorIdx].FinalState = RState::ShaderResource;
+        attachments[colorIdx].Format = mPositionFormat;
+        attachments[colorIdx].LoadOp = RLoadOp::Clear;
+        attachments[colorIdx].StoreOp = RStoreOp::Store;
+        colorIdx++;
+    }
+
+    attachments[colorIdx].InitialState = RState::Undefined;
+    attachments[colorIdx].FinalState = RState::ShaderResource;
+    attachments[colorIdx].Format = mNormalFormat;
+    attachments[colorIdx].LoadOp = RLoadOp::Clear;
+    attachments[colorIdx].StoreOp = RStoreOp::Store;
+    colorIdx++;
+
+    attachments[colorIdx].InitialState = RState::Undefined;
+    attachments[colorIdx].FinalState = RState::ShaderResource;
+    attachments[colorIdx].Format = mAlbedoFormat;
+    attachments[colorIdx].LoadOp = RLoadOp::Clear;
+    attachments[colorIdx].StoreOp = RStoreOp::Store;
+    colorIdx++;
+
+    LD_DEBUG_ASSERT(colorIdx == colorCount);
+
+    // depth is only read back by the compact layout
+    attachments[colorIdx].InitialState = RState::Undefined;
+    attachments[colorIdx].Format = mDepthStencilFormat;
+    attachments[colorIdx].LoadOp = RLoadOp::Clear;
+
+    if (mLayout == GBufferLayout::Compact)
+    {
+        attachments[colorIdx].FinalState = RState::ShaderResource;
+        attachments[colorIdx].StoreOp = RStoreOp::Store;
+    }
+    else
+    {
+        attachments[colorIdx].FinalState = RState::DepthStencilWrite;
+        attachments[colorIdx].StoreOp = RStoreOp::Discard;
+    }
 
     RPassInfo passI{};
     passI.Name = "GBufferPass";
-    passI.Attachments = attachments.GetView();
+    passI.Attachments = { colorCount + 1, attachments.Data() };
     mDevice.CreateRenderPass(mHandle, passI);
 }
 
@@ -14,6 +14,10 @@ extern void GetCubemapGLVS(unsigned int* size, const char** data);
 extern void GetCubemapGLFS(unsigned int* size, const char** data);
 extern void GetCubemapVKVS(unsigned int* size, const char** data);
 extern void GetCubemapVKFS(unsigned int* size, const char** data);
+extern void GetCubemapCompactGLVS(unsigned int* size, const char** data);
+extern void GetCubemapCompactGLFS(unsigned int* size, const char** data);
+extern void GetCubemapCompactVKVS(unsigned int* size, const char** data);
+extern void GetCubemapCompactVKFS(unsigned int* size, const char** data);
 
 } // namespace Embed
 
@@ -35,11 +39,21 @@ void CubemapPipeline::Startup(const CubemapPipelineInfo& info)
     const char* fsData;
     unsigned int fsSize;
 
-    if (backend == RBackend::Vulkan)
+    if (backend == RBackend::Vulkan && info.CompactGBuffer)
+    {
+        Embed::GetCubemapCompactVKVS(&vsSize, &vsData);
+        Embed::GetCubemapCompactVKFS(&fsSize, &fsData);
+    }
+    else if (backend == RBackend::Vulkan)
     {
         Embed::GetCubemapVKVS(&vsSize, &vsData);
         Embed::GetCubemapVKFS(&fsSize, &fsData);
     }
+    else if (info.CompactGBuffer)
+    {
+        Embed::GetCubemapCompactGLVS(&vsSize, &vsData);
+        Embed::GetCubemapCompactGLFS(&fsSize, &fsData);
+    }
     else
     {
         Embed::GetCubemapGLVS(&vsSize, &vsData);
@@ -13,6 +13,10 @@ extern void GetDeferredBRDFGLVS(unsigned int* size, const char** data);
 extern void GetDeferredBRDFGLFS(unsigned int* size, const char** data);
 extern void GetDeferredBRDFVKVS(unsigned int* size, const char** data);
 extern void GetDeferredBRDFVKFS(unsigned int* size, const char** data);
+extern void GetDeferredBRDFCompactGLVS(unsigned int* size, const char** data);
+extern void GetDeferredBRDFCompactGLFS(unsigned int* size, const char** data);
+extern void GetDeferredBRDFCompactVKVS(unsigned int* size, const char** data);
+extern void GetDeferredBRDFCompactVKFS(unsigned int* size, const char** data);
 
 } // namespace Embed
 
@@ -33,11 +37,21 @@ void DeferredBRDFPipeline::Startup(const DeferredBRDFPipelineInfo& info)
     const char* fsData;
     unsigned int fsSize;
 
-    if (backend == RBackend::Vulkan)
+    if (backend == RBackend::Vulkan && info.CompactGBuffer)
+    {
+        Embed::GetDeferredBRDFCompactVKVS(&vsSize, &vsData);
+        Embed::GetDeferredBRDFCompactVKFS(&fsSize, &fsData);
+    }
+    else if (backend == RBackend::Vulkan)
     {
         Embed::GetDeferredBRDFVKVS(&vsSize, &vsData);
         Embed::GetDeferredBRDFVKFS(&fsSize, &fsData);
     }
+    else if (info.CompactGBuffer)
+    {
+        Embed::GetDeferredBRDFCompactGLVS(&vsSize, &vsData);
+        Embed::GetDeferredBRDFCompactGLFS(&fsSize, &fsData);
+    }
     else
     {
         Embed::GetDeferredBRDFGLVS(&vsSize, &vsData);
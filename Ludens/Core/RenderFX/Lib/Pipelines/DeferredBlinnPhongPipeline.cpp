@@ -11,6 +11,10 @@ extern void GetDeferredBlinnPhongGLVS(unsigned int* size, const char** data);
 extern void GetDeferredBlinnPhongGLFS(unsigned int* size, const char** data);
 extern void GetDeferredBlinnPhongVKVS(unsigned int* size, const char** data);
 extern void GetDeferredBlinnPhongVKFS(unsigned int* size, const char** data);
+extern void GetDeferredBlinnPhongCompactGLVS(unsigned int* size, const char** data);
+extern void GetDeferredBlinnPhongCompactGLFS(unsigned int* size, const char** data);
+extern void GetDeferredBlinnPhongCompactVKVS(unsigned int* size, const char** data);
+extern void GetDeferredBlinnPhongCompactVKFS(unsigned int* size, const char** data);
 
 } // namespace Embed
 
@@ -39,11 +43,21 @@ void DeferredBlinnPhongPipeline::Startup(const DeferredBlinnPhongPipelineInfo& i
     const char* fsData;
     unsigned int fsSize;
 
-    if (backend == RBackend::Vulkan)
+    if (backend == RBackend::Vulkan && info.CompactGBuffer)
+    {
+        Embed::GetDeferredBlinnPhongCompactVKVS(&vsSize, &vsData);
+        Embed::GetDeferredBlinnPhongCompactVKFS(&fsSize, &fsData);
+    }
+    else if (backend == RBackend::Vulkan)
     {
         Embed::GetDeferredBlinnPhongVKVS(&vsSize, &vsData);
         Embed::GetDeferredBlinnPhongVKFS(&fsSize, &fsData);
     }
+    else if (info.CompactGBuffer)
+    {
+        Embed::GetDeferredBlinnPhongCompactGLVS(&vsSize, &vsData);
+        Embed::GetDeferredBlinnPhongCompactGLFS(&fsSize, &fsData);
+    }
     else
     {
         Embed::GetDeferredBlinnPhongGLVS(&vsSize, &vsData);
@@ -14,6 +14,10 @@ extern void GetDeferredSSAOGLVS(unsigned int* size, const char** data);
 extern void GetDeferredSSAOGLFS(unsigned int* size, const char** data);
 extern void GetDeferredSSAOVKVS(unsigned int* size, const char** data);
 extern void GetDeferredSSAOVKFS(unsigned int* size, const char** data);
+extern void GetDeferredSSAOCompactGLVS(unsigned int* size, const char** data);
+extern void GetDeferredSSAOCompactGLFS(unsigned int* size, const char** data);
+extern void GetDeferredSSAOCompactVKVS(unsigned int* size, const char** data);
+extern void GetDeferredSSAOCompactVKFS(unsigned int* size, const char** data);
 
 } // namespace Embed
 
@@ -43,11 +47,21 @@ void DeferredSSAOPipeline::Startup(const DeferredSSAOPipelineInfo& info)
     const char* fsData;
     unsigned int fsSize;
 
-    if (backend == RBackend::Vulkan)
+    if (backend == RBackend::Vulkan && info.CompactGBuffer)
+    {
+        Embed::GetDeferredSSAOCompactVKVS(&vsSize, &vsData);
+        Embed::GetDeferredSSAOCompactVKFS(&fsSize, &fsData);
+    }
+    else if (backend == RBackend::Vulkan)
     {
         Embed::GetDeferredSSAOVKVS(&vsSize, &vsData);
         Embed::GetDeferredSSAOVKFS(&fsSize, &fsData);
     }
+    else if (info.CompactGBuffer)
+    {
+        Embed::GetDeferredSSAOCompactGLVS(&vsSize, &vsData);
+        Embed::GetDeferredSSAOCompactGLFS(&fsSize, &fsData);
+    }
     else
     {
         Embed::GetDeferredSSAOGLVS(&vsSize, &vsData);
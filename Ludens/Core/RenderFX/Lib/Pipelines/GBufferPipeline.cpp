@@ -2,6 +2,7 @@
 #include "Core/RenderFX/Include/Pipelines/GBufferPipeline.h"
 #include "Core/RenderFX/Include/Groups/ViewportGroup.h"
 #include "Core/RenderFX/Include/Groups/MaterialGroup.h"
+#include "Core/RenderFX/Include/Groups/BindlessMaterialGroup.h"
 #include "Core/DSA/Include/Array.h"
 
 namespace LD {
@@ -12,6 +13,26 @@ extern void GetGBufferGLVS(unsigned int* size, const char** data);
 extern void GetGBufferGLFS(unsigned int* size, const char** data);
 extern void GetGBufferVKVS(unsigned int* size, const char** data);
 extern void GetGBufferVKFS(unsigned int* size, const char** data);
+extern void GetGBufferBindlessVKVS(unsigned int* size, const char** data);
+extern void GetGBufferBindlessVKFS(unsigned int* size, const char** data);
+extern void GetGBufferCompactGLVS(unsigned int* size, const char** data);
+extern void GetGBufferCompactGLFS(unsigned int* size, const char** data);
+extern void GetGBufferCompactVKVS(unsigned int* size, const char** data);
+extern void GetGBufferCompactVKFS(unsigned int* size, const char** data);
+extern void GetGBufferBindlessCompactVKVS(unsigned int* size, const char** data);
+extern void GetGBufferBindlessCompactVKFS(unsigned int* size, const char** data);
+extern void GetGBufferQuantizedGLVS(unsigned int* size, const char** data);
+extern void GetGBufferQuantizedGLFS(unsigned int* size, const char** data);
+extern void GetGBufferQuantizedVKVS(unsigned int* size, const char** data);
+extern void GetGBufferQuantizedVKFS(unsigned int* size, const char** data);
+extern void GetGBufferCompactQuantizedGLVS(unsigned int* size, const char** data);
+extern void GetGBufferCompactQuantizedGLFS(unsigned int* size, const char** data);
+extern void GetGBufferCompactQuantizedVKVS(unsigned int* size, const char** data);
+extern void GetGBufferCompactQuantizedVKFS(unsigned int* size, const char** data);
+extern void GetGBufferBindlessQuantizedVKVS(unsigned int* size, const char** data);
+extern void GetGBufferBindlessQuantizedVKFS(unsigned int* size, const char** data);
+extern void GetGBufferBindlessCompactQuantizedVKVS(unsigned int* size, const char** data);
+extern void GetGBufferBindlessCompactQuantizedVKFS(unsigned int* size, const char** data);
 
 } // namespace Embed
 
@@ -27,8 +48,11 @@ GBufferPipeline::~GBufferPipeline()
 void GBufferPipeline::Startup(const GBufferPipelineInfo& info)
 {
     mDevice = info.Device;
+    mBindless = info.Bindless;
     RBackend backend = mDevice.GetBackend();
 
+    LD_DEBUG_ASSERT(!mBindless || mDevice.HasBindlessSupport());
+
     Array<RVertexBufferSlot, 2> gbufferVertexSlots;
     Array<RVertexAttribute, 4> gbufferVertexAttr{
         { 0, RDataType::Vec3, false }, // position
@@ -36,15 +60,22 @@ void GBufferPipeline::Startup(const GBufferPipelineInfo& info)
         { 2, RDataType::Vec3, false }, // tangents
         { 3, RDataType::Vec2, false }, // UVs
     };
+
+    // QuantizedVertex, location 2 is unused since the tangent is packed next to the normal
+    Array<RVertexAttribute, 3> quantizedVertexAttr{
+        { 0, RDataType::UShort4, true }, // position in the mesh bounds
+        { 1, RDataType::Byte4, true },   // octahedral normal and tangent
+        { 3, RDataType::Half2, false },  // UVs
+    };
     gbufferVertexSlots[0].PollRate = RAttributePollRate::PerVertex;
-    gbufferVertexSlots[0].Attributes = gbufferVertexAttr.GetView();
+    gbufferVertexSlots[0].Attributes = info.QuantizedVertices ? quantizedVertexAttr.GetView() : gbufferVertexAttr.GetView();
 
     // per-instance model matrix and normal matrix
     Array<RVertexAttribute, 6> gbufferInstanceAttr{
         { 4, RDataType::Vec4, false }, // 4x4 model matrix row 1
         { 5, RDataType::Vec4, false }, // 4x4 model matrix row 2
         { 6, RDataType::Vec4, false }, // 4x4 model matrix row 3
-        { 7, RDataType::Vec4, false }, // 3x3 normal matrix column 1, w component reserved
+        { 7, RDataType::Vec4, false }, // 3x3 normal matrix column 1, w component is the bindless material index
         { 8, RDataType::Vec4, false }, // 3x3 normal matrix column 2, w component reserved
         { 9, RDataType::Vec4, false }, // 3x3 normal matrix column 3, w component reserved
     };
@@ -56,15 +87,75 @@ void GBufferPipeline::Startup(const GBufferPipelineInfo& info)
     const char* fsData;
     unsigned int fsSize;
 
-    if (backend == RBackend::Vulkan)
+    if (mBindless)
+    {
+        // bindless variants are only compiled for Vulkan
+        if (info.CompactGBuffer && info.QuantizedVertices)
+        {
+            Embed::GetGBufferBindlessCompactQuantizedVKVS(&vsSize, &vsData);
+            Embed::GetGBufferBindlessCompactQuantizedVKFS(&fsSize, &fsData);
+        }
+        else if (info.CompactGBuffer)
+        {
+            Embed::GetGBufferBindlessCompactVKVS(&vsSize, &vsData);
+            Embed::GetGBufferBindlessCompactVKFS(&fsSize, &fsData);
+        }
+        else if (info.QuantizedVertices)
+        {
+            Embed::GetGBufferBindlessQuantizedVKVS(&vsSize, &vsData);
+            Embed::GetGBufferBindlessQuantizedVKFS(&fsSize, &fsData);
+        }
+        else
+        {
+            Embed::GetGBufferBindlessVKVS(&vsSize, &vsData);
+            Embed::GetGBufferBindlessVKFS(&fsSize, &fsData);
+        }
+    }
+    else if (backend == RBackend::Vulkan)
     {
-        Embed::GetGBufferVKVS(&vsSize, &vsData);
-        Embed::GetGBufferVKFS(&fsSize, &fsData);
+        if (info.CompactGBuffer && info.QuantizedVertices)
+        {
+            Embed::GetGBufferCompactQuantizedVKVS(&vsSize, &vsData);
+            Embed::GetGBufferCompactQuantizedVKFS(&fsSize, &fsData);
+        }
+        else if (info.CompactGBuffer)
+        {
+            Embed::GetGBufferCompactVKVS(&vsSize, &vsData);
+            Embed::GetGBufferCompactVKFS(&fsSize, &fsData);
+        }
+        else if (info.QuantizedVertices)
+        {
+            Embed::GetGBufferQuantizedVKVS(&vsSize, &vsData);
+            Embed::GetGBufferQuantizedVKFS(&fsSize, &fsData);
+        }
+        else
+        {
+            Embed::GetGBufferVKVS(&vsSize, &vsData);
+            Embed::GetGBufferVKFS(&fsSize, &fsData);
+        }
     }
     else
     {
-        Embed::GetGBufferGLVS(&vsSize, &vsData);
-        Embed::GetGBufferGLFS(&fsSize, &fsData);
+        if (info.CompactGBuffer && info.QuantizedVertices)
+        {
+            Embed::GetGBufferCompactQuantizedGLVS(&vsSize, &vsData);
+            Embed::GetGBufferCompactQuantizedGLFS(&fsSize, &fsData);
+        }
+        else if (info.CompactGBuffer)
+        {
+            Embed::GetGBufferCompactGLVS(&vsSize, &vsData);
+            Embed::GetGBufferCompactGLFS(&fsSize, &fsData);
+        }
+        else if (info.QuantizedVertices)
+        {
+            Embed::GetGBufferQuantizedGLVS(&vsSize, &vsData);
+            Embed::GetGBufferQuantizedGLFS(&fsSize, &fsData);
+        }
+        else
+        {
+            Embed::GetGBufferGLVS(&vsSize, &vsData);
+            Embed::GetGBufferGLFS(&fsSize, &fsData);
+        }
     }
 
     RShaderInfo vertexSI;
@@ -82,7 +173,7 @@ void GBufferPipeline::Startup(const GBufferPipelineInfo& info)
     mDevice.CreateShader(mGBufferFS, fragmentSI);
 
     RPipelineInfo pipelineI{};
-    pipelineI.Name = "GBufferPipeline";
+    pipelineI.Name = info.QuantizedVertices ? "GBufferQuantizedPipeline" : "GBufferPipeline";
     pipelineI.PrimitiveTopology = RPrimitiveTopology::TriangleList;
     pipelineI.VertexLayout.Slots = gbufferVertexSlots.GetView();
     pipelineI.VertexShader = mGBufferVS;
@@ -104,7 +195,8 @@ void GBufferPipeline::Cleanup()
 RPipelineLayoutData GBufferPipeline::GetLayoutData() const
 {
     RBindingGroupLayoutData group0 = ViewportGroup{}.GetLayoutData();
-    RBindingGroupLayoutData group1 = MaterialGroup{}.GetLayoutData();
+    RBindingGroupLayoutData group1 =
+        mBindless ? BindlessMaterialGroup{}.GetLayoutData() : MaterialGroup{}.GetLayoutData();
     RPipelineLayoutData data{};
     data.GroupLayouts = { group0, group1 };
 
@@ -14,6 +14,10 @@ extern void GetToneMappingGLVS(unsigned int* size, const char** data);
 extern void GetToneMappingGLFS(unsigned int* size, const char** data);
 extern void GetToneMappingVKVS(unsigned int* size, const char** data);
 extern void GetToneMappingVKFS(unsigned int* size, const char** data);
+extern void GetToneMappingCompactGLVS(unsigned int* size, const char** data);
+extern void GetToneMappingCompactGLFS(unsigned int* size, const char** data);
+extern void GetToneMappingCompactVKVS(unsigned int* size, const char** data);
+extern void GetToneMappingCompactVKFS(unsigned int* size, const char** data);
 
 } // namespace Embed
 
@@ -34,11 +38,21 @@ void ToneMappingPipeline::Startup(const ToneMappingPipelineInfo& info)
     const char* fsData;
     unsigned int fsSize;
 
-    if (backend == RBackend::Vulkan)
+    if (backend == RBackend::Vulkan && info.CompactGBuffer)
+    {
+        Embed::GetToneMappingCompactVKVS(&vsSize, &vsData);
+        Embed::GetToneMappingCompactVKFS(&fsSize, &fsData);
+    }
+    else if (backend == RBackend::Vulkan)
     {
         Embed::GetToneMappingVKVS(&vsSize, &vsData);
         Embed::GetToneMappingVKFS(&fsSize, &fsData);
     }
+    else if (info.CompactGBuffer)
+    {
+        Embed::GetToneMappingCompactGLVS(&vsSize, &vsData);
+        Embed::GetToneMappingCompactGLFS(&fsSize, &fsData);
+    }
     else
     {
         Embed::GetToneMappingGLVS(&vsSize, &vsData);
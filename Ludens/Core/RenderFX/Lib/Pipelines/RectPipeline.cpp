@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <unordered_map>
 #include "Core/Header/Include/Error.h"
 #include "Core/Math/Include/Mat4.h"
@@ -24,12 +25,94 @@ extern void GetRectVKFS(unsigned int* size, const char** data);
 
 } // namespace Embed
 
-static const Vec2 sUnitRectPos[] = {
-    { 0.5f, 0.5f },
-    { 0.5f, -0.5f },
-    { -0.5f, -0.5f },
-    { -0.5f, 0.5f },
-};
+static inline u16 PackTexCoord(float t)
+{
+    return (u16)(std::clamp(t, 0.0f, 1.0f) * 65535.0f + 0.5f);
+}
+
+static inline u32 PackColor(const Vec4& color)
+{
+    u32 packed = 0;
+
+    for (int i = 0; i < 4; i++)
+        packed |= (u32)(std::clamp(color[i], 0.0f, 1.0f) * 255.0f + 0.5f) << (8 * i);
+
+    return packed;
+}
+
+static inline void SetTexRect(RectInstance& instance, float u0, float v0, float u1, float v1)
+{
+    instance.TexRect[0] = PackTexCoord(u0);
+    instance.TexRect[1] = PackTexCoord(v0);
+    instance.TexRect[2] = PackTexCoord(u1);
+    instance.TexRect[3] = PackTexCoord(v1);
+}
+
+RectInstance GetRectFilledInstance(const Rect2D& rect, Vec4 color)
+{
+    RectInstance instance;
+    instance.Rect = rect;
+    instance.Color = PackColor(color);
+    instance.TexID = 0.0f; // white pixel texture
+    SetTexRect(instance, 0.0f, 0.0f, 1.0f, 1.0f);
+
+    return instance;
+}
+
+void GetRectOutlineInstances(const Rect2D& rect, Vec4 color, float lineWidth, RectInstance* outInstances)
+{
+    Rect2D borderL{ rect.x, rect.y, lineWidth, rect.h };
+    Rect2D borderR{ rect.x + rect.w - lineWidth, rect.y, lineWidth, rect.h };
+    Rect2D borderT{ rect.x, rect.y, rect.w, lineWidth };
+    Rect2D borderB{ rect.x, rect.y + rect.h - lineWidth, rect.w, lineWidth };
+
+    outInstances[0] = GetRectFilledInstance(borderL, color);
+    outInstances[1] = GetRectFilledInstance(borderR, color);
+    outInstances[2] = GetRectFilledInstance(borderT, color);
+    outInstances[3] = GetRectFilledInstance(borderB, color);
+}
+
+RectInstance GetTextureInstance(const Rect2D& rect, const Rect2D& texRegion, Vec2 texSize, Vec4 color, int texID)
+{
+    float u0 = texRegion.x / texSize.x;
+    float v0 = texRegion.y / texSize.y;
+    float u1 = (texRegion.x + texRegion.w) / texSize.x;
+    float v1 = (texRegion.y + texRegion.h) / texSize.y;
+
+    RectInstance instance;
+    instance.Rect = rect;
+    instance.Color = PackColor(color);
+    instance.TexID = (float)texID;
+
+    // textures are sampled bottom up, the top of the rect shows the bottom of the region
+    SetTexRect(instance, u0, v1, u1, v0);
+
+    return instance;
+}
+
+RectInstance GetGlyphInstance(const Vec2& cursor, const FontGlyph& glyph, float scale, Vec4 color, int texID)
+{
+    float u0 = glyph.RectUV.x;
+    float v0 = glyph.RectUV.y;
+    float u1 = glyph.RectUV.x + glyph.RectUV.w;
+    float v1 = glyph.RectUV.y + glyph.RectUV.h;
+
+    // glyph bounding box top left corner, derived from baseline cursor and glyph bearing
+    float gx = cursor.x + glyph.BearingX * scale;
+    float gy = cursor.y - glyph.BearingY * scale;
+
+    // glyph rendered size
+    float gw = glyph.RectXY.w * scale;
+    float gh = glyph.RectXY.h * scale;
+
+    RectInstance instance;
+    instance.Rect = { gx, gy, gw, gh };
+    instance.Color = PackColor(color);
+    instance.TexID = (float)texID;
+    SetTexRect(instance, u0, v0, u1, v1);
+
+    return instance;
+}
 
 RectBatch::RectBatch()
 {
@@ -43,34 +126,23 @@ RectBatch::~RectBatch()
 void RectBatch::Startup(RDevice device, int capacity)
 {
     LD_DEBUG_ASSERT(capacity >= 4 && "AddRectOutline uses 4 rects");
-    LD_DEBUG_ASSERT(capacity < 65535 / 6 && "16 bit indices");
-
-    // one rect is 4 vertices referenced by 6 indices
-    int indexSequence[] = { 0, 1, 2, 2, 3, 0 };
 
     mDevice = device;
-    mBatch.Startup(4, { 6, indexSequence }, capacity);
+    mBatch.Startup(1, capacity);
 
     RBufferInfo info{};
     info.MemoryUsage = RMemoryUsage::FrameDynamic;
     info.Type = RBufferType::VertexBuffer;
     info.Size = mBatch.GetVertexBufferSize();
     info.Data = nullptr;
-    mDevice.CreateBuffer(mVertexBuffer, info);
-
-    info.MemoryUsage = RMemoryUsage::Immutable;
-    info.Type = RBufferType::IndexBuffer;
-    info.Size = mBatch.GetIndexBufferSize();
-    info.Data = mBatch.GetIndices();
-    mDevice.CreateBuffer(mIndexBuffer, info);
+    mDevice.CreateBuffer(mInstanceBuffer, info);
 
     mRectCommited = 0;
 }
 
 void RectBatch::Cleanup()
 {
-    mDevice.DeleteBuffer(mIndexBuffer);
-    mDevice.DeleteBuffer(mVertexBuffer);
+    mDevice.DeleteBuffer(mInstanceBuffer);
     mBatch.Cleanup();
     mDevice.ResetHandle();
 }
@@ -81,86 +153,54 @@ void RectBatch::Reset()
     mRectCommited = 0;
 }
 
-bool RectBatch::AddCustom(const RectVertex* vertices)
+bool RectBatch::AddCustom(const RectInstance& instance)
 {
     if (mBatch.GetElementCapacity() == mBatch.GetElementCount())
         return false;
 
-    bool ok = mBatch.AddElement(vertices);
+    bool ok = mBatch.AddElement(&instance);
     LD_DEBUG_ASSERT(ok);
     return ok;
 }
 
+int RectBatch::AddInstances(const RectInstance* instances, int count)
+{
+    return mBatch.AddElements(instances, count);
+}
+
 bool RectBatch::AddRectOutline(const Rect2D& rect, Vec4 color, float lineWidth)
 {
     if (mBatch.GetElementCapacity() - mBatch.GetElementCount() < 4)
         return false;
 
-    Rect2D borderL{ rect.x, rect.y, lineWidth, rect.h };
-    Rect2D borderR{ rect.x + rect.w - lineWidth, rect.y, lineWidth, rect.h };
-    Rect2D borderT{ rect.x, rect.y, rect.w, lineWidth };
-    Rect2D borderB{ rect.x, rect.y + rect.h - lineWidth, rect.w, lineWidth };
+    RectInstance borders[4];
+    GetRectOutlineInstances(rect, color, lineWidth, borders);
 
-    bool ok = AddRectFilled(borderL, color) && AddRectFilled(borderR, color) && AddRectFilled(borderT, color) &&
-              AddRectFilled(borderB, color);
-    LD_DEBUG_ASSERT(ok);
-    return ok;
+    int count = mBatch.AddElements(borders, 4);
+    LD_DEBUG_ASSERT(count == 4);
+    return count == 4;
 }
 
 bool RectBatch::AddRectFilled(const Rect2D& rect, Vec4 color)
 {
-    RectVertex vertex[4];
-
     if (mBatch.GetElementCapacity() == mBatch.GetElementCount())
         return false;
 
-    for (int i = 0; i < 4; i++)
-    {
-        float x = sUnitRectPos[i].x + 0.5f;
-        float y = sUnitRectPos[i].y + 0.5f;
-
-        vertex[i].Color = color;
-        vertex[i].Position.x = (x * rect.w) + rect.x;
-        vertex[i].Position.y = (y * rect.h) + rect.y;
-        vertex[i].TexID = 0.0f; // white pixel texture
-    }
-
-    vertex[0].TexUV = { 1.0f, 0.0f };
-    vertex[1].TexUV = { 1.0f, 1.0f };
-    vertex[2].TexUV = { 0.0f, 1.0f };
-    vertex[3].TexUV = { 0.0f, 0.0f };
+    RectInstance instance = GetRectFilledInstance(rect, color);
 
-    bool ok = mBatch.AddElement(vertex);
+    bool ok = mBatch.AddElement(&instance);
     LD_DEBUG_ASSERT(ok);
     return ok;
 }
 
 bool RectBatch::AddTexture(const Rect2D& rect, const Rect2D& texRegion, Vec2 texSize, Vec4 color, int texID)
 {
-    RectVertex vertex[4];
-
-    float u0 = texRegion.x / texSize.x;
-    float v0 = texRegion.y / texSize.y;
-    float u1 = (texRegion.x + texRegion.w) / texSize.x;
-    float v1 = (texRegion.y + texRegion.h) / texSize.y;
-
-    for (int i = 0; i < 4; i++)
-    {
-        float x = sUnitRectPos[i].x + 0.5f;
-        float y = sUnitRectPos[i].y + 0.5f;
-
-        vertex[i].Color = color;
-        vertex[i].Position.x = (x * rect.w) + rect.x;
-        vertex[i].Position.y = (y * rect.h) + rect.y;
-        vertex[i].TexID = (float)texID;
-    }
+    if (mBatch.GetElementCapacity() == mBatch.GetElementCount())
+        return false;
 
-    vertex[0].TexUV = { u1, v0 };
-    vertex[1].TexUV = { u1, v1 };
-    vertex[2].TexUV = { u0, v1 };
-    vertex[3].TexUV = { u0, v0 };
+    RectInstance instance = GetTextureInstance(rect, texRegion, texSize, color, texID);
 
-    bool ok = mBatch.AddElement(vertex);
+    bool ok = mBatch.AddElement(&instance);
     LD_DEBUG_ASSERT(ok);
     return ok;
 }
@@ -170,38 +210,9 @@ bool RectBatch::AddGlyph(const Vec2& cursor, const FontGlyph& glyph, float scale
     if (mBatch.GetElementCapacity() == mBatch.GetElementCount())
         return false;
 
-    RectVertex vertex[4];
-    float u0 = glyph.RectUV.x;
-    float v0 = glyph.RectUV.y;
-    float u1 = glyph.RectUV.x + glyph.RectUV.w;
-    float v1 = glyph.RectUV.y + glyph.RectUV.h;
-
-    // glyph bounding box top left corner, derived from baseline cursor and glyph bearing
-    float gx = cursor.x + glyph.BearingX * scale;
-    float gy = cursor.y - glyph.BearingY * scale;
-
-    // glyph rendered size
-    float gw = glyph.RectXY.w * scale;
-    float gh = glyph.RectXY.h * scale;
+    RectInstance instance = GetGlyphInstance(cursor, glyph, scale, color, texID);
 
-    vertex[0].Color = color;
-    vertex[0].TexID = (float)texID;
-    vertex[0].TexUV = { u0, v0 };
-    vertex[0].Position = { gx, gy };
-    vertex[1].Color = color;
-    vertex[1].TexID = (float)texID;
-    vertex[1].TexUV = { u0, v1 };
-    vertex[1].Position = { gx, gy + gh };
-    vertex[2].Color = color;
-    vertex[2].TexID = (float)texID;
-    vertex[2].TexUV = { u1, v1 };
-    vertex[2].Position = { gx + gw, gy + gh };
-    vertex[3].Color = color;
-    vertex[3].TexID = (float)texID;
-    vertex[3].TexUV = { u1, v0 };
-    vertex[3].Position = { gx + gw, gy };
-
-    bool ok = mBatch.AddElement(vertex);
+    bool ok = mBatch.AddElement(&instance);
     LD_DEBUG_ASSERT(ok);
     return ok;
 }
@@ -224,18 +235,17 @@ void RectBatch::Commit()
         return;
 
     int toCommit = rectCount - mRectCommited;
-    u32 dataOffset = sizeof(RectVertex) * 4 * mRectCommited;
-    u32 dataSize = sizeof(RectVertex) * 4 * toCommit;
-    const void* data = mBatch.GetVertices() + 4 * mRectCommited;
+    u32 dataOffset = sizeof(RectInstance) * mRectCommited;
+    u32 dataSize = sizeof(RectInstance) * toCommit;
+    const void* data = mBatch.GetVertices() + mRectCommited;
 
-    mVertexBuffer.SetData(dataOffset, dataSize, data);
+    mInstanceBuffer.SetData(dataOffset, dataSize, data);
     mRectCommited = rectCount;
 }
 
-void RectBatch::GetBuffers(RBuffer& vertexBuffer, RBuffer& indexBuffer)
+RBuffer RectBatch::GetInstanceBuffer()
 {
-    vertexBuffer = mVertexBuffer;
-    indexBuffer = mIndexBuffer;
+    return mInstanceBuffer;
 }
 
 RectBatcher::RectBatcher()
@@ -296,20 +306,32 @@ void RectBatcher::Commit()
     if (toCommit == 0)
         return;
 
-    RBuffer vbo, ibo;
     batch->Commit();
-    batch->GetBuffers(vbo, ibo);
-    mCommitCallback(vbo, ibo, commitedCount * 6, toCommit * 6);
+    mCommitCallback(batch->GetInstanceBuffer(), commitedCount, toCommit);
 }
 
-void RectBatcher::AddCustom(const RectVertex* vertices)
+void RectBatcher::AddCustom(const RectInstance& instance)
 {
     RectBatch* batch = GetRectBatch(1);
 
-    bool ok = batch->AddCustom(vertices);
+    bool ok = batch->AddCustom(instance);
     LD_DEBUG_ASSERT(ok);
 }
 
+void RectBatcher::AddInstances(const RectInstance* instances, int count)
+{
+    while (count > 0)
+    {
+        RectBatch* batch = GetRectBatch(1);
+
+        int added = batch->AddInstances(instances, count);
+        LD_DEBUG_ASSERT(added > 0);
+
+        instances += added;
+        count -= added;
+    }
+}
+
 void RectBatcher::AddRectOutline(const Rect2D& rect, Vec4 color, float lineWidth)
 {
     RectBatch* batch = GetRectBatch(4);
@@ -379,14 +401,15 @@ void RectPipeline::Startup(const RectPipelineInfo& info)
     mDevice = info.Device;
     RBackend backend = mDevice.GetBackend();
 
+    // RectInstance, the vertex shader expands the corners from the vertex index
     RVertexBufferSlot slot{};
     Array<RVertexAttribute, 4> attributes{
-        RVertexAttribute{ 0, RDataType::Vec2, false },  // Pos
-        RVertexAttribute{ 1, RDataType::Vec2, false },  // TexUV
-        RVertexAttribute{ 2, RDataType::Vec4, false },  // Color
-        RVertexAttribute{ 3, RDataType::Float, false }, // TexID
+        RVertexAttribute{ 0, RDataType::Vec4, false },   // Rect
+        RVertexAttribute{ 1, RDataType::UShort4, true }, // TexRect
+        RVertexAttribute{ 2, RDataType::UByte4, true },  // Color
+        RVertexAttribute{ 3, RDataType::Float, false },  // TexID
     };
-    slot.PollRate = RAttributePollRate::PerVertex;
+    slot.PollRate = RAttributePollRate::PerInstance;
     slot.Attributes = { attributes.Size(), attributes.Data() };
 
     const char* vsData;
@@ -12,6 +12,10 @@ extern void GetSSAOBlurGLVS(unsigned int* size, const char** data);
 extern void GetSSAOBlurGLFS(unsigned int* size, const char** data);
 extern void GetSSAOBlurVKVS(unsigned int* size, const char** data);
 extern void GetSSAOBlurVKFS(unsigned int* size, const char** data);
+extern void GetSSAOBlurCompactGLVS(unsigned int* size, const char** data);
+extern void GetSSAOBlurCompactGLFS(unsigned int* size, const char** data);
+extern void GetSSAOBlurCompactVKVS(unsigned int* size, const char** data);
+extern void GetSSAOBlurCompactVKFS(unsigned int* size, const char** data);
 
 } // namespace Embed
 
@@ -41,11 +45,21 @@ void SSAOBlurPipeline::Startup(const SSAOBlurPipelineInfo& info)
     const char* fsData;
     unsigned int fsSize;
 
-    if (backend == RBackend::Vulkan)
+    if (backend == RBackend::Vulkan && info.CompactGBuffer)
+    {
+        Embed::GetSSAOBlurCompactVKVS(&vsSize, &vsData);
+        Embed::GetSSAOBlurCompactVKFS(&fsSize, &fsData);
+    }
+    else if (backend == RBackend::Vulkan)
     {
         Embed::GetSSAOBlurVKVS(&vsSize, &vsData);
         Embed::GetSSAOBlurVKFS(&fsSize, &fsData);
     }
+    else if (info.CompactGBuffer)
+    {
+        Embed::GetSSAOBlurCompactGLVS(&vsSize, &vsData);
+        Embed::GetSSAOBlurCompactGLFS(&fsSize, &fsData);
+    }
     else
     {
         Embed::GetSSAOBlurGLVS(&vsSize, &vsData);
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include "Core/RenderBase/Include/RBinding.h"
 #include "Core/RenderFX/Include/RMesh.h"
 #include "Core/Media/Include/Image.h"
@@ -5,7 +6,9 @@
 namespace LD
 {
 
-RMesh::RMesh()
+LD_STATIC_ASSERT(LD_MESH_LOD_MAX_LEVELS <= LD_DRAW_STATS_MAX_LODS);
+
+RMesh::RMesh() : mBindlessMaterials(nullptr), mBoundsRadius(0.0f), mIsQuantized(false), mLODCount(0)
 {
     mDevice.ResetHandle();
 }
@@ -19,12 +22,46 @@ void RMesh::Startup(const RMeshInfo& info)
 {
     const Model& model = *info.Data;
     mDevice = info.Device;
+    mBindlessMaterials = info.BindlessMaterials;
+    mIsQuantized = info.QuantizeVertices;
 
     LD_DEBUG_ASSERT(mDevice);
 
     size_t materialCount = model.Materials.Size();
     mBatches.Resize(materialCount);
 
+    // bounding sphere around the center of the bounding box
+    Vec3 boundsMin, boundsMax;
+    bool hasBounds = false;
+
+    for (size_t meshIdx = 0; meshIdx < model.Meshes.Size(); meshIdx++)
+    {
+        for (const MeshVertex& vertex : model.Meshes[meshIdx].first.Vertices)
+        {
+            for (int axis = 0; axis < 3; axis++)
+            {
+                boundsMin[axis] = hasBounds ? std::min(boundsMin[axis], vertex.Position[axis]) : vertex.Position[axis];
+                boundsMax[axis] = hasBounds ? std::max(boundsMax[axis], vertex.Position[axis]) : vertex.Position[axis];
+            }
+            hasBounds = true;
+        }
+    }
+
+    mBoundsMin = boundsMin;
+    mBoundsMax = boundsMax;
+    mBoundsCenter = (boundsMin + boundsMax) * 0.5f;
+    mBoundsRadius = 0.0f;
+
+    for (size_t meshIdx = 0; meshIdx < model.Meshes.Size(); meshIdx++)
+    {
+        for (const MeshVertex& vertex : model.Meshes[meshIdx].first.Vertices)
+            mBoundsRadius = std::max(mBoundsRadius, (vertex.Position - mBoundsCenter).Length());
+    }
+
+    mLODCount = 1;
+    for (float& error : mLODErrors)
+        error = 0.0f;
+
     for (size_t batchIdx = 0; batchIdx < mBatches.Size(); batchIdx++)
     {
         const Material& mat = model.Materials[batchIdx].first;
@@ -77,7 +114,13 @@ void RMesh::Startup(const RMeshInfo& info)
         // PBR metallic roughness information can be stored in many different ways
         PrepareMetallicRoughnessInfo(matBGI, mat);
 
-        matBG.Startup(matBGI);
+        if (mBindlessMaterials)
+            batch.MaterialIndex = mBindlessMaterials->AddMaterial(matBGI);
+        else
+        {
+            matBG.Startup(matBGI);
+            batch.MaterialIndex = 0;
+        }
 
         // batch all geometry that uses the current material
         Vector<MeshVertex> batchVertices;
@@ -117,14 +160,43 @@ void RMesh::Startup(const RMeshInfo& info)
         vboInfo.Type = RBufferType::VertexBuffer;
         vboInfo.Data = batchVertices.Data();
         vboInfo.Size = batchVertices.ByteSize();
+
+        // all batches share the bounding box of the mesh, so one dequantize matrix serves every batch
+        Vector<QuantizedVertex> quantizedVertices;
+        if (mIsQuantized)
+        {
+            quantizedVertices.Resize(batchVertices.Size());
+            QuantizeVertices(batchVertices.Data(), (u32)batchVertices.Size(), mBoundsMin, mBoundsMax, quantizedVertices.Data());
+            vboInfo.Data = quantizedVertices.Data();
+            vboInfo.Size = quantizedVertices.ByteSize();
+        }
+
         mDevice.CreateBuffer(batch.Vertices, vboInfo);
 
+        // levels of detail share the batched vertices, their indices follow the full detail indices
+        Vector<u32> lodIndices;
+        Vector<MeshLODLevel> lodLevels;
+        GenerateMeshLODs(info.LOD, batchVertices, batchIndices, lodIndices, lodLevels);
+
+        batch.LODCount = (u32)lodLevels.Size();
+        mLODCount = std::max(mLODCount, batch.LODCount);
+
+        for (u32 level = 0; level < batch.LODCount; level++)
+            batch.LODs[level] = lodLevels[level];
+
         RBufferInfo iboInfo{};
         iboInfo.Type = RBufferType::IndexBuffer;
-        iboInfo.Data = batchIndices.Data();
-        iboInfo.Size = batchIndices.ByteSize();
+        iboInfo.Data = lodIndices.Data();
+        iboInfo.Size = lodIndices.ByteSize();
         mDevice.CreateBuffer(batch.Indices, iboInfo);
     }
+
+    // a level of the mesh is as coarse as its coarsest batch at that level
+    for (const Batch& batch : mBatches)
+    {
+        for (u32 level = 0; level < mLODCount && mBoundsRadius > 0.0f; level++)
+            mLODErrors[level] = std::max(mLODErrors[level], batch.GetLOD(level).Error / mBoundsRadius);
+    }
 }
 
 void RMesh::Cleanup()
@@ -133,9 +205,14 @@ void RMesh::Cleanup()
     {
         mDevice.DeleteBuffer(batch.Indices);
         mDevice.DeleteBuffer(batch.Vertices);
-        batch.Material.Cleanup();
+
+        if (mBindlessMaterials)
+            mBindlessMaterials->RemoveMaterial(batch.MaterialIndex);
+        else
+            batch.Material.Cleanup();
     }
 
+    mBindlessMaterials = nullptr;
     mDevice.ResetHandle();
 }
 
@@ -19,6 +19,7 @@
 #include "Core/RenderFX/Include/Groups/CubemapGroup.h"
 #include "Core/RenderFX/Include/Groups/ViewportGroup.h"
 #include "Core/RenderFX/Include/Groups/MaterialGroup.h"
+#include "Core/RenderFX/Include/Groups/BindlessMaterialGroup.h"
 #include "Core/RenderFX/Include/Groups/RectGroup.h"
 #include "Core/RenderFX/Include/Groups/SSAOGroup.h"
 
@@ -141,6 +142,8 @@ void RShaderCompiler::CompileStage(const RPipelineLayoutData& layout, RShaderTyp
     else if (mTargetBackend == RBackend::Vulkan)
         preamble = "#define LD_VULKAN\n";
 
+    preamble += mDefines;
+
     result.Success = GlslangCompile(mTargetBackend, type, input_glsl, preamble, spirv_u32, result.Error);
 
     result.SPIRV.Resize(spirv_u32.Size() * 4);
@@ -153,6 +156,11 @@ void RShaderCompiler::CompileStage(const RPipelineLayoutData& layout, RShaderTyp
     }
 }
 
+void RShaderCompiler::AddDefine(const std::string& name)
+{
+    mDefines += "#define " + name + '\n';
+}
+
 void RShaderCompiler::GlslangShaderType(RShaderType type, EShLanguage* planguage)
 {
     EShLanguage language;
@@ -299,13 +307,17 @@ void RShaderCompiler::PatchOpenGL(const RPipelineLayoutData& layout, RShaderType
             case RBindingType::UniformBuffer:
                 uboBaseRemap[{ (u32)groupIdx, (u32)bindingIdx }] = uboBaseCtr++;
                 break;
+            case RBindingType::StorageBuffer:
+                // storage buffers are only used by bindless shaders, which are not compiled for OpenGL
+                LD_DEBUG_UNREACHABLE;
+                break;
             }
         }
     }
 
     // even though ludens source GLSL is using the Vulkan dialect, we will still reconstruct
     // OpenGL GLSL later, so we respect the LD_OPENGL directives in the source GLSL
-    std::string preamble = "#define LD_OPENGL\n";
+    std::string preamble = "#define LD_OPENGL\n" + mDefines;
     std::string patchError;
 
     Vector<u32> spirv;
@@ -361,6 +373,7 @@ int RShaderCompiler::ParseLudensMacro(const std::string& line, RPipelineLayoutDa
     const char* groupStr = "group";
     const char* bindingStr = "binding";
     const char* uniformBufferStr = "UniformBuffer";
+    const char* storageBufferStr = "StorageBuffer";
     const char* textureStr = "Texture";
     const char* vertexStr = "vertex";
     const char* fragmentStr = "fragment";
@@ -415,6 +428,8 @@ int RShaderCompiler::ParseLudensMacro(const std::string& line, RPipelineLayoutDa
 
         if (strncmp(str, uniformBufferStr, strlen(uniformBufferStr)) == 0)
             layoutData[bindingIdx].Type = RBindingType::UniformBuffer;
+        else if (strncmp(str, storageBufferStr, strlen(storageBufferStr)) == 0)
+            layoutData[bindingIdx].Type = RBindingType::StorageBuffer;
         else if (strncmp(str, textureStr, strlen(textureStr)) == 0)
             layoutData[bindingIdx].Type = RBindingType::Texture;
         else
@@ -453,6 +468,8 @@ int RShaderCompiler::ParseLudensMacroGroupPrefab(std::string str, RBindingGroupL
         layoutData = ViewportGroup{}.GetLayoutData();
     else if (str == "Material")
         layoutData = MaterialGroup{}.GetLayoutData();
+    else if (str == "BindlessMaterial")
+        layoutData = BindlessMaterialGroup{}.GetLayoutData();
     else if (str == "Rect")
         layoutData = RectGroup{}.GetLayoutData();
     else if (str == "SSAO")
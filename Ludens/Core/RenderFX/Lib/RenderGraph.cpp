@@ -0,0 +1,344 @@
+#include "Core/RenderFX/Include/RenderGraph.h"
+
+namespace LD
+{
+
+static bool Contains(const Vector<RenderGraphResource>& resources, RenderGraphResource resource)
+{
+    for (RenderGraphResource r : resources)
+    {
+        if (r == resource)
+            return true;
+    }
+
+    return false;
+}
+
+void RenderGraph::Reset()
+{
+    mResources.Clear();
+    mPasses.Clear();
+    mOrder.Clear();
+    mPhysicalCount = 0;
+    mIsCompiled = false;
+}
+
+RenderGraphResource RenderGraph::AddResource(const RenderGraphResourceInfo& info)
+{
+    LD_DEBUG_ASSERT(info.Format != RTextureFormat::Undefined && info.Width > 0 && info.Height > 0);
+
+    Resource& resource = mResources.PushBack();
+    resource.Info = info;
+    resource.IsOutput = false;
+    resource.FirstPass = LD_RENDER_GRAPH_NONE;
+    resource.LastPass = LD_RENDER_GRAPH_NONE;
+    resource.PhysicalIndex = LD_RENDER_GRAPH_NONE;
+    mIsCompiled = false;
+
+    return (RenderGraphResource)(mResources.Size() - 1);
+}
+
+RenderGraphPass RenderGraph::AddPass(const RenderGraphPassInfo& info)
+{
+    LD_DEBUG_ASSERT(info.Main);
+
+    Pass& pass = mPasses.PushBack();
+    pass.Info = info;
+    pass.Order = LD_RENDER_GRAPH_NONE;
+    mIsCompiled = false;
+
+    return (RenderGraphPass)(mPasses.Size() - 1);
+}
+
+void RenderGraph::AddRead(RenderGraphPass pass, RenderGraphResource resource)
+{
+    LD_DEBUG_ASSERT(pass < mPasses.Size() && resource < mResources.Size());
+
+    // a pass may not sample an attachment it renders to
+    LD_DEBUG_ASSERT(!Contains(mPasses[pass].Writes, resource));
+
+    if (!Contains(mPasses[pass].Reads, resource))
+        mPasses[pass].Reads.PushBack(resource);
+
+    mIsCompiled = false;
+}
+
+void RenderGraph::AddWrite(RenderGraphPass pass, RenderGraphResource resource)
+{
+    LD_DEBUG_ASSERT(pass < mPasses.Size() && resource < mResources.Size());
+    LD_DEBUG_ASSERT(!Contains(mPasses[pass].Reads, resource) && !Contains(mPasses[pass].Writes, resource));
+
+    mPasses[pass].Writes.PushBack(resource);
+    mIsCompiled = false;
+}
+
+void RenderGraph::AddOutput(RenderGraphResource resource)
+{
+    LD_DEBUG_ASSERT(resource < mResources.Size());
+
+    mResources[resource].IsOutput = true;
+    mIsCompiled = false;
+}
+
+void RenderGraph::Compile()
+{
+    CullPasses();
+    ComputeLifetimes();
+    AssignPhysicalTargets();
+    DeriveAttachments();
+
+    mIsCompiled = true;
+}
+
+void RenderGraph::Execute()
+{
+    LD_DEBUG_ASSERT(mIsCompiled);
+
+    for (RenderGraphPass pass : mOrder)
+    {
+        const RenderGraphPassInfo& info = mPasses[pass].Info;
+        info.Main(info.Data);
+    }
+}
+
+bool RenderGraph::IsPassCulled(RenderGraphPass pass) const
+{
+    LD_DEBUG_ASSERT(mIsCompiled && pass < mPasses.Size());
+
+    return mPasses[pass].Order == LD_RENDER_GRAPH_NONE;
+}
+
+bool RenderGraph::IsResourceUsed(RenderGraphResource resource) const
+{
+    LD_DEBUG_ASSERT(mIsCompiled && resource < mResources.Size());
+
+    return mResources[resource].FirstPass != LD_RENDER_GRAPH_NONE;
+}
+
+u32 RenderGraph::GetPhysicalIndex(RenderGraphResource resource) const
+{
+    LD_DEBUG_ASSERT(mIsCompiled && resource < mResources.Size());
+
+    return mResources[resource].PhysicalIndex;
+}
+
+u32 RenderGraph::GetPassOrder(RenderGraphPass pass) const
+{
+    LD_DEBUG_ASSERT(mIsCompiled && pass < mPasses.Size());
+
+    return mPasses[pass].Order;
+}
+
+const Vector<RPassAttachment>& RenderGraph::GetAttachments(RenderGraphPass pass) const
+{
+    LD_DEBUG_ASSERT(mIsCompiled && pass < mPasses.Size());
+
+    return mPasses[pass].Attachments;
+}
+
+bool RenderGraph::IsAttachmentCompatible(const RPassAttachment& baked, const RPassAttachment& derived)
+{
+    if (baked.Format != derived.Format)
+        return false;
+
+    // contents of a previous write are loaded in the state that write left them in
+    if (derived.LoadOp == RLoadOp::Load && (baked.LoadOp != RLoadOp::Load || baked.InitialState != derived.InitialState))
+        return false;
+
+    // contents used by a later pass or outside of the graph are stored in the state that use expects,
+    // contents nobody uses may be stored in any state
+    if (derived.StoreOp == RStoreOp::Store && (baked.StoreOp != RStoreOp::Store || baked.FinalState != derived.FinalState))
+        return false;
+
+    return true;
+}
+
+void RenderGraph::CullPasses()
+{
+    // walk passes backwards from the outputs, a pass is needed if it writes a resource
+    // that a later needed pass reads or that is an output. A write is not known to cover
+    // every pixel, so earlier writes of the same resource stay needed.
+    Vector<bool> isNeeded(mResources.Size());
+
+    for (size_t i = 0; i < mResources.Size(); i++)
+        isNeeded[i] = mResources[i].IsOutput;
+
+    Vector<bool> isAlive(mPasses.Size());
+
+    for (size_t i = mPasses.Size(); i > 0; i--)
+    {
+        Pass& pass = mPasses[i - 1];
+        bool alive = false;
+
+        for (RenderGraphResource resource : pass.Writes)
+            alive = alive || isNeeded[resource];
+
+        isAlive[i - 1] = alive;
+
+        if (!alive)
+            continue;
+
+        for (RenderGraphResource resource : pass.Reads)
+            isNeeded[resource] = true;
+    }
+
+    mOrder.Clear();
+
+    for (size_t i = 0; i < mPasses.Size(); i++)
+    {
+        mPasses[i].Order = LD_RENDER_GRAPH_NONE;
+
+        if (isAlive[i])
+        {
+            mPasses[i].Order = (u32)mOrder.Size();
+            mOrder.PushBack((RenderGraphPass)i);
+        }
+    }
+}
+
+void RenderGraph::ComputeLifetimes()
+{
+    for (Resource& resource : mResources)
+    {
+        resource.FirstPass = LD_RENDER_GRAPH_NONE;
+        resource.LastPass = LD_RENDER_GRAPH_NONE;
+    }
+
+    auto extend = [this](RenderGraphResource resource, u32 order) {
+        Resource& r = mResources[resource];
+
+        if (r.FirstPass == LD_RENDER_GRAPH_NONE)
+            r.FirstPass = order;
+
+        r.LastPass = order;
+    };
+
+    for (u32 order = 0; order < (u32)mOrder.Size(); order++)
+    {
+        const Pass& pass = mPasses[mOrder[order]];
+
+        for (RenderGraphResource resource : pass.Reads)
+            extend(resource, order);
+
+        for (RenderGraphResource resource : pass.Writes)
+            extend(resource, order);
+    }
+}
+
+void RenderGraph::AssignPhysicalTargets()
+{
+    struct Physical
+    {
+        const RenderGraphResourceInfo* Info;
+        u32 LastPass;
+        bool IsExclusive;
+    };
+
+    Vector<Physical> physicals;
+
+    // visit resources in the order their lifetimes begin, a resource reuses the first target
+    // of the same description whose previous lifetime ended before the current one begins
+    for (u32 order = 0; order < (u32)mOrder.Size(); order++)
+    {
+        for (Resource& resource : mResources)
+        {
+            if (resource.FirstPass != order)
+                continue;
+
+            // imported resources and outputs are used outside of the graph
+            bool isExclusive = resource.Info.IsImported || resource.IsOutput;
+            resource.PhysicalIndex = LD_RENDER_GRAPH_NONE;
+
+            for (u32 i = 0; !isExclusive && i < (u32)physicals.Size(); i++)
+            {
+                Physical& physical = physicals[i];
+                const RenderGraphResourceInfo& info = *physical.Info;
+
+                if (physical.IsExclusive || physical.LastPass >= resource.FirstPass)
+                    continue;
+
+                if (info.Format != resource.Info.Format || info.Width != resource.Info.Width ||
+                    info.Height != resource.Info.Height)
+                    continue;
+
+                physical.LastPass = resource.LastPass;
+                resource.PhysicalIndex = i;
+                break;
+            }
+
+            if (resource.PhysicalIndex == LD_RENDER_GRAPH_NONE)
+            {
+                resource.PhysicalIndex = (u32)physicals.Size();
+                physicals.PushBack({ &resource.Info, resource.LastPass, isExclusive });
+            }
+        }
+    }
+
+    for (Resource& resource : mResources)
+    {
+        if (resource.FirstPass == LD_RENDER_GRAPH_NONE)
+            resource.PhysicalIndex = LD_RENDER_GRAPH_NONE;
+    }
+
+    mPhysicalCount = (u32)physicals.Size();
+}
+
+void RenderGraph::DeriveAttachments()
+{
+    // state each resource was left in by the last pass that wrote it
+    Vector<RState> states(mResources.Size());
+    Vector<bool> isWritten(mResources.Size());
+
+    for (size_t i = 0; i < mResources.Size(); i++)
+    {
+        states[i] = RState::Undefined;
+        isWritten[i] = false;
+    }
+
+    for (Pass& pass : mPasses)
+        pass.Attachments.Clear();
+
+    for (u32 order = 0; order < (u32)mOrder.Size(); order++)
+    {
+        Pass& pass = mPasses[mOrder[order]];
+
+        for (RenderGraphResource resource : pass.Writes)
+        {
+            const Resource& r = mResources[resource];
+            RState attachmentState = IsDepthStencilTextureFormat(r.Info.Format) ? RState::DepthStencilWrite : RState::ColorAttachment;
+
+            // the next use decides what happens to the contents after this pass
+            bool isReadLater = false;
+            bool isWrittenLater = false;
+
+            for (u32 next = order + 1; next < (u32)mOrder.Size(); next++)
+            {
+                const Pass& nextPass = mPasses[mOrder[next]];
+
+                if ((isReadLater = Contains(nextPass.Reads, resource)) || (isWrittenLater = Contains(nextPass.Writes, resource)))
+                    break;
+            }
+
+            RPassAttachment attachment;
+            attachment.Format = r.Info.Format;
+            attachment.InitialState = isWritten[resource] ? states[resource] : RState::Undefined;
+            attachment.LoadOp = isWritten[resource] ? RLoadOp::Load : RLoadOp::Discard;
+
+            if (isReadLater)
+                attachment.FinalState = RState::ShaderResource;
+            else if (!isWrittenLater && (r.IsOutput || r.Info.IsImported))
+                attachment.FinalState = r.Info.FinalState;
+            else
+                attachment.FinalState = attachmentState;
+
+            bool isStored = isReadLater || isWrittenLater || r.IsOutput || r.Info.IsImported;
+            attachment.StoreOp = isStored ? RStoreOp::Store : RStoreOp::Discard;
+
+            pass.Attachments.PushBack(attachment);
+            states[resource] = attachment.FinalState;
+            isWritten[resource] = true;
+        }
+    }
+}
+
+} // namespace LD
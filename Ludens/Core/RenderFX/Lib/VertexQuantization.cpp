@@ -0,0 +1,152 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "Core/RenderFX/Include/VertexQuantization.h"
+#include "Core/RenderFX/Include/GBufferLayout.h"
+
+namespace LD
+{
+
+static inline u16 EncodeUNorm16(float v)
+{
+    return (u16)(std::clamp(v, 0.0f, 1.0f) * 65535.0f + 0.5f);
+}
+
+static inline float DecodeUNorm16(u16 c)
+{
+    return (float)c / 65535.0f;
+}
+
+static inline i8 EncodeSNorm8(float v)
+{
+    return (i8)std::lround(std::clamp(v, -1.0f, 1.0f) * 127.0f);
+}
+
+static inline float DecodeSNorm8(i8 c)
+{
+    // -128 and -127 both decode to -1, matching the GPU conversion of signed normalized formats
+    return std::max((float)c / 127.0f, -1.0f);
+}
+
+u16 FloatToHalf(float f)
+{
+    u32 bits;
+    memcpy(&bits, &f, sizeof(bits));
+
+    u32 sign = (bits >> 16) & 0x8000;
+    u32 floatExponent = (bits >> 23) & 0xFF;
+    u32 mantissa = bits & 0x7FFFFF;
+    i32 exponent = (i32)floatExponent - 127 + 15;
+
+    // infinity stays infinity, NaN stays a quiet NaN
+    if (floatExponent == 0xFF)
+        return (u16)(sign | 0x7C00 | (mantissa ? 0x200 : 0));
+
+    if (exponent >= 31)
+        return (u16)(sign | 0x7C00);
+
+    // below the smallest normal half, shift the implicit leading bit into a subnormal
+    if (exponent <= 0)
+    {
+        if (exponent < -10)
+            return (u16)sign;
+
+        mantissa |= 0x800000;
+        u32 shift = (u32)(14 - exponent);
+        u32 half = mantissa >> shift;
+        u32 rest = mantissa & ((1u << shift) - 1);
+        u32 midpoint = 1u << (shift - 1);
+
+        if (rest > midpoint || (rest == midpoint && (half & 1)))
+            half++;
+
+        return (u16)(sign | half);
+    }
+
+    // round to nearest even, a carry out of the mantissa correctly increments the exponent
+    u32 half = ((u32)exponent << 10) | (mantissa >> 13);
+    u32 rest = mantissa & 0x1FFF;
+
+    if (rest > 0x1000 || (rest == 0x1000 && (half & 1)))
+        half++;
+
+    return (u16)(sign | half);
+}
+
+float HalfToFloat(u16 h)
+{
+    u32 sign = (u32)(h & 0x8000) << 16;
+    u32 exponent = (h >> 10) & 0x1F;
+    u32 mantissa = h & 0x3FF;
+
+    if (exponent == 0)
+    {
+        float value = std::ldexp((float)mantissa, -24);
+        return sign ? -value : value;
+    }
+
+    u32 bits;
+    if (exponent == 31)
+        bits = sign | 0x7F800000 | (mantissa << 13);
+    else
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+void QuantizeVertices(const MeshVertex* vertices, u32 vertexCount, const Vec3& boundsMin, const Vec3& boundsMax,
+                      QuantizedVertex* outVertices)
+{
+    Vec3 extent = boundsMax - boundsMin;
+    Vec3 invExtent;
+
+    // a flat axis keeps all positions on the minimum corner
+    for (int axis = 0; axis < 3; axis++)
+        invExtent[axis] = extent[axis] > 0.0f ? 1.0f / extent[axis] : 0.0f;
+
+    for (u32 i = 0; i < vertexCount; i++)
+    {
+        const MeshVertex& vertex = vertices[i];
+        QuantizedVertex& quantized = outVertices[i];
+
+        for (int axis = 0; axis < 3; axis++)
+            quantized.Position[axis] = EncodeUNorm16((vertex.Position[axis] - boundsMin[axis]) * invExtent[axis]);
+        quantized.Position[3] = 0;
+
+        Vec2 normal = GBufferEncodeNormal(vertex.Normal.Normalized());
+        Vec2 tangent = GBufferEncodeNormal(vertex.Tangent.Normalized());
+        quantized.NormalTangent[0] = EncodeSNorm8(normal.x);
+        quantized.NormalTangent[1] = EncodeSNorm8(normal.y);
+        quantized.NormalTangent[2] = EncodeSNorm8(tangent.x);
+        quantized.NormalTangent[3] = EncodeSNorm8(tangent.y);
+
+        quantized.TexUV[0] = FloatToHalf(vertex.TexUV.x);
+        quantized.TexUV[1] = FloatToHalf(vertex.TexUV.y);
+    }
+}
+
+MeshVertex DequantizeVertex(const QuantizedVertex& vertex, const Vec3& boundsMin, const Vec3& boundsMax)
+{
+    Vec3 extent = boundsMax - boundsMin;
+    MeshVertex decoded;
+
+    for (int axis = 0; axis < 3; axis++)
+        decoded.Position[axis] = boundsMin[axis] + extent[axis] * DecodeUNorm16(vertex.Position[axis]);
+
+    Vec2 normal(DecodeSNorm8(vertex.NormalTangent[0]), DecodeSNorm8(vertex.NormalTangent[1]));
+    Vec2 tangent(DecodeSNorm8(vertex.NormalTangent[2]), DecodeSNorm8(vertex.NormalTangent[3]));
+    decoded.Normal = GBufferDecodeNormal(normal);
+    decoded.Tangent = GBufferDecodeNormal(tangent);
+    decoded.TexUV = Vec2(HalfToFloat(vertex.TexUV[0]), HalfToFloat(vertex.TexUV[1]));
+
+    return decoded;
+}
+
+Mat4 GetDequantizeMatrix(const Vec3& boundsMin, const Vec3& boundsMax)
+{
+    return Mat4::Translate(boundsMin) * Mat4::Scale(boundsMax - boundsMin);
+}
+
+} // namespace LD
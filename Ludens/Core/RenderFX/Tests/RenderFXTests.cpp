@@ -0,0 +1,9 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
+
+#include "Core/RenderFX/Tests/TestGBufferLayout.h"
+#include "Core/RenderFX/Tests/TestDynamicResolution.h"
+#include "Core/RenderFX/Tests/TestRenderGraph.h"
+#include "Core/RenderFX/Tests/TestMeshLOD.h"
+#include "Core/RenderFX/Tests/TestVertexQuantization.h"
+#include "Core/RenderFX/Tests/TestLightCluster.h"
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cmath>
+#include <doctest.h>
+#include "Core/RenderFX/Include/DynamicResolution.h"
+
+using namespace LD;
+
+// frame cost in milliseconds of a fixed part and a part proportional to the pixel count
+struct DynamicResolutionTestScene
+{
+    float FixedCost;
+    float PixelCost; // at scale 1
+    bool VSync;
+
+    float GetFrameTime(float scale) const
+    {
+        const float period = 1000.0f / 60.0f;
+        float cost = FixedCost + PixelCost * scale * scale;
+
+        // a frame that misses vertical sync waits for the next one
+        if (VSync)
+            cost = std::ceil(cost / period - 1e-4f) * period;
+
+        return cost / 1000.0f;
+    }
+
+    bool MissesTarget(float scale) const
+    {
+        return FixedCost + PixelCost * scale * scale > 1000.0f / 60.0f;
+    }
+};
+
+TEST_CASE("DynamicResolution cheap scene")
+{
+    DynamicResolution controller;
+    controller.Startup({});
+    CHECK(controller.GetScale() == 1.0f);
+
+    DynamicResolutionTestScene scene{ 2.0f, 6.0f, true };
+
+    for (int i = 0; i < 2000; i++)
+        controller.Update(scene.GetFrameTime(controller.GetScale()));
+
+    CHECK(controller.GetScale() == 1.0f);
+}
+
+TEST_CASE("DynamicResolution vsync")
+{
+    DynamicResolution controller;
+    controller.Startup({});
+
+    // full resolution misses 60 Hz, the largest step that fits is 0.75
+    DynamicResolutionTestScene scene{ 4.0f, 20.0f, true };
+    CHECK(scene.MissesTarget(1.0f));
+    CHECK(scene.MissesTarget(0.8f));
+    CHECK_FALSE(scene.MissesTarget(0.75f));
+
+    int missed = 0;
+    float minScale = 1.0f;
+
+    for (int i = 0; i < 6000; i++)
+    {
+        float scale = controller.GetScale();
+
+        if (i >= 1000)
+        {
+            missed += scene.MissesTarget(scale) ? 1 : 0;
+            minScale = std::min(minScale, scale);
+        }
+
+        controller.Update(scene.GetFrameTime(scale));
+    }
+
+    // probes of 0.8 back off, the controller does not settle far below the best scale
+    CHECK(missed < 5000 / 20);
+    CHECK(minScale >= 0.7f - 1e-4f);
+    CHECK(std::abs(controller.GetScale() - 0.75f) < 0.05f + 1e-4f);
+}
+
+TEST_CASE("DynamicResolution recovers without vsync")
+{
+    DynamicResolution controller;
+    controller.Startup({});
+
+    // the largest step that fits is 0.55
+    DynamicResolutionTestScene heavy{ 3.0f, 45.0f, false };
+    DynamicResolutionTestScene light{ 2.0f, 4.0f, false };
+    CHECK(heavy.MissesTarget(0.6f));
+    CHECK_FALSE(heavy.MissesTarget(0.55f));
+
+    int missed = 0;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        float scale = controller.GetScale();
+        if (i >= 500)
+            missed += heavy.MissesTarget(scale) ? 1 : 0;
+
+        controller.Update(heavy.GetFrameTime(scale));
+    }
+
+    // only the occasional probe misses the target
+    CHECK(missed < 500 / 10);
+    CHECK(controller.GetScale() < 0.7f);
+
+    // headroom is measurable without vertical sync, the scale grows without probing
+    for (int i = 0; i < 100; i++)
+        controller.Update(light.GetFrameTime(controller.GetScale()));
+
+    CHECK(controller.GetScale() == 1.0f);
+}
+
+TEST_CASE("DynamicResolution bounds")
+{
+    DynamicResolutionInfo info;
+    info.MinScale = 0.5f;
+    info.MaxScale = 1.0f;
+
+    DynamicResolution controller;
+    controller.Startup(info);
+
+    DynamicResolutionTestScene scene{ 20.0f, 100.0f, false };
+
+    for (int i = 0; i < 1000; i++)
+        controller.Update(scene.GetFrameTime(controller.GetScale()));
+
+    CHECK(controller.GetScale() == 0.5f);
+    CHECK(controller.GetScaledSize(1919) == 960);
+    CHECK(controller.GetScaledSize(1) == 1);
+}
@@ -0,0 +1,276 @@
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include <doctest.h>
+#include "Core/RenderFX/Include/GBufferLayout.h"
+
+using namespace LD;
+
+// storage precision of RGBA16F attachments
+static float GBufferTestHalf(float value)
+{
+    if (value == 0.0f)
+        return 0.0f;
+
+    int exponent;
+    float mantissa = std::frexp(value, &exponent);
+
+    return std::ldexp(std::nearbyint(mantissa * 2048.0f) / 2048.0f, exponent);
+}
+
+static Vec3 GBufferTestDirection(u32& state)
+{
+    Vec3 dir;
+
+    do
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            state = state * 1664525u + 1013904223u;
+            dir[i] = (float)(state >> 8) / (float)(1u << 24) * 2.0f - 1.0f;
+        }
+    } while (dir.LengthSquared() < 0.01f || dir.LengthSquared() > 1.0f);
+
+    return dir.Normalized();
+}
+
+struct GBufferTestVertex
+{
+    Vec3 Position; // view space
+    Vec3 Normal;   // view space
+};
+
+struct GBufferTestPixel
+{
+    // Standard layout
+    Vec4 PosRoughness;
+    Vec4 NormalMetallic;
+
+    // Compact layout
+    Vec4 NormalRoughnessMetallic;
+    float Depth;
+};
+
+// rasterizes view space triangles into both layouts at pixel centers,
+// with a depth test and perspective correct interpolation as the geometry pass does
+class GBufferTestRasterizer
+{
+public:
+    GBufferTestRasterizer(int width, int height, const Mat4& proj)
+        : mWidth(width), mHeight(height), mProj(proj), mPixels(width * height)
+    {
+        for (GBufferTestPixel& pixel : mPixels)
+        {
+            pixel.PosRoughness = Vec4(0.0f, 0.0f, 0.0f, 0.0f);
+            pixel.NormalMetallic = Vec4(0.0f, 0.0f, 0.0f, 0.0f);
+            pixel.NormalRoughnessMetallic = Vec4(0.0f, 0.0f, 0.0f, 0.0f);
+            pixel.Depth = 1.0f;
+        }
+    }
+
+    void DrawTriangle(const GBufferTestVertex* v, float roughness, float metallic)
+    {
+        Vec4 clip[3];
+        Vec3 ndc[3];
+
+        for (int i = 0; i < 3; i++)
+        {
+            clip[i] = mProj * Vec4(v[i].Position.x, v[i].Position.y, v[i].Position.z, 1.0f);
+            ndc[i] = Vec3(clip[i].x, clip[i].y, clip[i].z) / clip[i].w;
+        }
+
+        float area = Edge(ndc[0], ndc[1], ndc[2].x, ndc[2].y);
+        if (std::abs(area) < 1e-8f)
+            return;
+
+        for (int y = 0; y < mHeight; y++)
+        {
+            for (int x = 0; x < mWidth; x++)
+            {
+                float px = ((float)x + 0.5f) / (float)mWidth * 2.0f - 1.0f;
+                float py = ((float)y + 0.5f) / (float)mHeight * 2.0f - 1.0f;
+                float b0 = Edge(ndc[1], ndc[2], px, py) / area;
+                float b1 = Edge(ndc[2], ndc[0], px, py) / area;
+                float b2 = Edge(ndc[0], ndc[1], px, py) / area;
+
+                if (b0 < 0.0f || b1 < 0.0f || b2 < 0.0f)
+                    continue;
+
+                // NDC depth is linear in screen space, attributes are not
+                float depth = (b0 * ndc[0].z + b1 * ndc[1].z + b2 * ndc[2].z) * 0.5f + 0.5f;
+                GBufferTestPixel& pixel = mPixels[y * mWidth + x];
+
+                if (depth >= pixel.Depth)
+                    continue;
+
+                float w0 = b0 / clip[0].w;
+                float w1 = b1 / clip[1].w;
+                float w2 = b2 / clip[2].w;
+                float wsum = w0 + w1 + w2;
+                Vec3 position = (v[0].Position * w0 + v[1].Position * w1 + v[2].Position * w2) / wsum;
+                Vec3 normal = ((v[0].Normal * w0 + v[1].Normal * w1 + v[2].Normal * w2) / wsum).Normalized();
+                Vec2 octNormal = GBufferEncodeNormal(normal);
+
+                pixel.Depth = depth;
+                pixel.PosRoughness.x = GBufferTestHalf(position.x);
+                pixel.PosRoughness.y = GBufferTestHalf(position.y);
+                pixel.PosRoughness.z = GBufferTestHalf(position.z);
+                pixel.PosRoughness.w = GBufferTestHalf(roughness);
+                pixel.NormalMetallic.x = GBufferTestHalf(normal.x);
+                pixel.NormalMetallic.y = GBufferTestHalf(normal.y);
+                pixel.NormalMetallic.z = GBufferTestHalf(normal.z);
+                pixel.NormalMetallic.w = GBufferTestHalf(metallic);
+                pixel.NormalRoughnessMetallic.x = GBufferTestHalf(octNormal.x);
+                pixel.NormalRoughnessMetallic.y = GBufferTestHalf(octNormal.y);
+                pixel.NormalRoughnessMetallic.z = GBufferTestHalf(roughness);
+                pixel.NormalRoughnessMetallic.w = GBufferTestHalf(metallic);
+            }
+        }
+    }
+
+    inline const GBufferTestPixel& GetPixel(int x, int y) const
+    {
+        return mPixels[y * mWidth + x];
+    }
+
+private:
+    static float Edge(const Vec3& a, const Vec3& b, float x, float y)
+    {
+        return (b.x - a.x) * (y - a.y) - (b.y - a.y) * (x - a.x);
+    }
+
+    int mWidth;
+    int mHeight;
+    Mat4 mProj;
+    std::vector<GBufferTestPixel> mPixels;
+};
+
+TEST_CASE("GBufferLayout octahedral normals")
+{
+    const Vec3 axes[] = {
+        { 1.0f, 0.0f, 0.0f }, { -1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f },
+        { 0.0f, -1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, -1.0f },
+    };
+
+    for (const Vec3& axis : axes)
+    {
+        Vec2 e = GBufferEncodeNormal(axis);
+        Vec3 n = GBufferDecodeNormal(e);
+        CHECK(Vec3::Dot(n, axis) > 0.99999f);
+    }
+
+    u32 state = 42;
+    float minCos = 1.0f;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        Vec3 dir = GBufferTestDirection(state);
+        Vec2 e = GBufferEncodeNormal(dir);
+        CHECK(std::abs(e.x) <= 1.0f);
+        CHECK(std::abs(e.y) <= 1.0f);
+        if (dir.z >= 0.0f)
+            CHECK(std::abs(e.x) + std::abs(e.y) <= 1.0f + 1e-5f);
+
+        Vec3 exact = GBufferDecodeNormal(e);
+        CHECK(Vec3::Dot(exact, dir) > 0.99999f);
+
+        // decoding from two 16 bit float channels
+        Vec3 stored = GBufferDecodeNormal(Vec2(GBufferTestHalf(e.x), GBufferTestHalf(e.y)));
+        minCos = std::min(minCos, Vec3::Dot(stored, dir));
+    }
+
+    // within a tenth of a degree
+    CHECK(minCos > 0.999998f);
+}
+
+TEST_CASE("GBufferLayout compact matches standard")
+{
+    const int width = 160;
+    const int height = 120;
+    const Mat4 proj = Mat4::Perspective(LD_MATH_PI / 3.0f, (float)width / (float)height, 0.1f, 100.0f);
+    const Mat4 invProj = Mat4::Inverse(proj);
+
+    GBufferTestRasterizer raster(width, height, proj);
+
+    // floor and back wall, viewed from inside the box
+    GBufferTestVertex quads[][4] = {
+        {
+            { { -10.0f, -2.0f, -1.0f }, { 0.0f, 1.0f, 0.0f } },
+            { { 10.0f, -2.0f, -1.0f }, { 0.0f, 1.0f, 0.0f } },
+            { { 10.0f, -2.0f, -60.0f }, { 0.0f, 1.0f, 0.0f } },
+            { { -10.0f, -2.0f, -60.0f }, { 0.0f, 1.0f, 0.0f } },
+        },
+        {
+            { { -30.0f, -30.0f, -50.0f }, { 0.0f, 0.0f, 1.0f } },
+            { { 30.0f, -30.0f, -50.0f }, { 0.0f, 0.0f, 1.0f } },
+            { { 30.0f, 30.0f, -50.0f }, { 0.0f, 0.0f, 1.0f } },
+            { { -30.0f, 30.0f, -50.0f }, { 0.0f, 0.0f, 1.0f } },
+        },
+    };
+
+    for (auto& quad : quads)
+    {
+        GBufferTestVertex tri0[3] = { quad[0], quad[1], quad[2] };
+        GBufferTestVertex tri1[3] = { quad[0], quad[2], quad[3] };
+        raster.DrawTriangle(tri0, 0.8f, 0.0f);
+        raster.DrawTriangle(tri1, 0.8f, 0.0f);
+    }
+
+    // intersecting triangles with arbitrary smooth normals, including normals facing away from the camera
+    u32 state = 7;
+
+    for (int i = 0; i < 40; i++)
+    {
+        GBufferTestVertex tri[3];
+        Vec3 center = GBufferTestDirection(state) * 3.0f + Vec3(0.0f, 0.0f, -12.0f);
+
+        for (int j = 0; j < 3; j++)
+        {
+            tri[j].Position = center + GBufferTestDirection(state) * 2.5f;
+            tri[j].Normal = GBufferTestDirection(state);
+        }
+
+        raster.DrawTriangle(tri, (float)i / 40.0f, (float)(i % 2));
+    }
+
+    int covered = 0;
+    float maxPositionError = 0.0f;
+    float minNormalCos = 1.0f;
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            const GBufferTestPixel& pixel = raster.GetPixel(x, y);
+            Vec3 standardN(pixel.NormalMetallic.x, pixel.NormalMetallic.y, pixel.NormalMetallic.z);
+            bool standardGeometry = standardN.Length() >= 1e-5f;
+            bool compactGeometry = pixel.Depth < 1.0f;
+
+            // the compact layout detects empty pixels from cleared depth
+            CHECK(standardGeometry == compactGeometry);
+            if (!standardGeometry)
+                continue;
+
+            covered++;
+
+            Vec2 uv(((float)x + 0.5f) / (float)width, ((float)y + 0.5f) / (float)height);
+            Vec3 standardP(pixel.PosRoughness.x, pixel.PosRoughness.y, pixel.PosRoughness.z);
+            Vec3 compactP = GBufferReconstructPosition(invProj, uv, pixel.Depth * 2.0f - 1.0f);
+            Vec3 compactN = GBufferDecodeNormal(Vec2(pixel.NormalRoughnessMetallic.x, pixel.NormalRoughnessMetallic.y));
+
+            maxPositionError = std::max(maxPositionError, (compactP - standardP).Length() / -standardP.z);
+            minNormalCos = std::min(minNormalCos, Vec3::Dot(compactN, standardN.Normalized()));
+
+            CHECK(pixel.NormalRoughnessMetallic.z == pixel.PosRoughness.w);
+            CHECK(pixel.NormalRoughnessMetallic.w == pixel.NormalMetallic.w);
+        }
+    }
+
+    CHECK(covered > width * height / 2);
+
+    // reconstructed positions are as close to the rasterized positions
+    // as the RGBA16F position attachment precision
+    CHECK(maxPositionError < 2e-3f);
+    CHECK(minNormalCos > 0.99999f);
+}
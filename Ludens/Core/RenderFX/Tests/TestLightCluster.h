@@ -0,0 +1,147 @@
+#pragma once
+
+#include <vector>
+#include <doctest.h>
+#include "Core/Math/Include/Math.h"
+#include "Core/RenderFX/Include/LightCluster.h"
+
+using namespace LD;
+
+// 90 degree vertical field of view over square tiles, depth slices from 0.1 to 100
+static Mat4 LightClusterTestProj()
+{
+    return Mat4::Perspective(LD_MATH_PI / 2.0f, (float)LD_LIGHT_CLUSTER_X / LD_LIGHT_CLUSTER_Y, 0.1f, 100.0f);
+}
+
+static LightData LightClusterTestLight(const Vec3& pos, float range, const Vec3& dir, float cosOuter)
+{
+    LightData light;
+    light.PosRadius = Vec4(pos.x, pos.y, pos.z, range);
+    light.Color = Vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    light.Dir = Vec4(dir.x, dir.y, dir.z, cosOuter);
+
+    return light;
+}
+
+static u32 LightClusterTestRecord(const LightCluster& cluster, u32 x, u32 y, u32 z)
+{
+    return cluster.GetClusterUBO().Records[(z * LD_LIGHT_CLUSTER_Y + y) * LD_LIGHT_CLUSTER_X + x];
+}
+
+// number of lights of every cluster in a depth slice
+static u32 LightClusterTestSliceCount(const LightCluster& cluster, u32 z)
+{
+    u32 count = 0;
+
+    for (u32 y = 0; y < LD_LIGHT_CLUSTER_Y; y++)
+        for (u32 x = 0; x < LD_LIGHT_CLUSTER_X; x++)
+            count += LightClusterTestRecord(cluster, x, y, z) >> 16;
+
+    return count;
+}
+
+TEST_CASE("LightCluster point light")
+{
+    // the camera looks down -z, a small light at depth 5 projects to ndc (0.03, 0.04)
+    LightCluster cluster;
+    LightData light = LightClusterTestLight(Vec3(0.3f, 0.2f, -5.0f), 0.01f, Vec3(0.0f, 0.0f, -1.0f), -1.0f);
+    LightClusterStats stats = cluster.Build(Mat4::Identity, LightClusterTestProj(), &light, 1);
+
+    CHECK(stats.LightCount == 1);
+    CHECK(stats.IndexCount == 1);
+    CHECK(stats.MaxClusterLights == 1);
+    CHECK_FALSE(stats.Overflow);
+
+    // tile (8, 4), slice floor(24 * log(5 / 0.1) / log(1000)) = 13
+    CHECK(cluster.GetClusterBounds(8, 4, 13).Contains(Vec3(0.3f, 0.2f, -5.0f)));
+
+    u32 record = LightClusterTestRecord(cluster, 8, 4, 13);
+    CHECK((record >> 16) == 1);
+    CHECK(cluster.GetIndexUBO().Indices[record & 0xFFFF] == 0);
+
+    for (u32 z = 0; z < LD_LIGHT_CLUSTER_Z; z++)
+        CHECK(LightClusterTestSliceCount(cluster, z) == (z == 13 ? 1u : 0u));
+
+    // lights behind the camera are not binned
+    light.PosRadius = Vec4(0.0f, 0.0f, 5.0f, 1.0f);
+    stats = cluster.Build(Mat4::Identity, LightClusterTestProj(), &light, 1);
+    CHECK(stats.LightCount == 0);
+    CHECK(stats.IndexCount == 0);
+}
+
+TEST_CASE("LightCluster spot light bounds")
+{
+    LightCluster cluster;
+    Vec3 pos(0.0f, 0.0f, -2.0f);
+    Vec3 dir(0.0f, 0.0f, -1.0f);
+
+    // a point light with the same range reaches the near plane
+    LightData light = LightClusterTestLight(pos, 20.0f, dir, -1.0f);
+    cluster.Build(Mat4::Identity, LightClusterTestProj(), &light, 1);
+    CHECK(LightClusterTestSliceCount(cluster, 0) > 0);
+    CHECK((LightClusterTestRecord(cluster, 8, 4, 0) >> 16) == 1);
+
+    // a narrow cone is bounded by the sphere through its apex and cap rim, which starts at the apex,
+    // the apex at depth 2 lies in slice floor(24 * log(2 / 0.1) / log(1000)) = 10
+    light.Dir.w = 0.95f;
+    LightClusterStats stats = cluster.Build(Mat4::Identity, LightClusterTestProj(), &light, 1);
+    CHECK(stats.LightCount == 1);
+
+    for (u32 z = 0; z < 10; z++)
+        CHECK(LightClusterTestSliceCount(cluster, z) == 0);
+
+    // the far end of the cone at depth 22 is still covered
+    u32 farSlice = 0;
+    while (farSlice < LD_LIGHT_CLUSTER_Z && !cluster.GetClusterBounds(8, 4, farSlice).Contains(Vec3(0.0f, 0.0f, -21.5f)))
+        farSlice++;
+
+    REQUIRE(farSlice < LD_LIGHT_CLUSTER_Z);
+    CHECK((LightClusterTestRecord(cluster, 8, 4, farSlice) >> 16) == 1);
+
+    // the corner tiles of the far slices lie outside the cone
+    CHECK((LightClusterTestRecord(cluster, 0, 0, farSlice) >> 16) == 0);
+
+    // wide cones keep the sphere around the light position
+    light.Dir.w = 0.5f;
+    cluster.Build(Mat4::Identity, LightClusterTestProj(), &light, 1);
+    CHECK((LightClusterTestRecord(cluster, 8, 4, 0) >> 16) == 1);
+}
+
+TEST_CASE("LightCluster index overflow")
+{
+    // every light covers every cluster, far more indices than the index buffer holds
+    LightCluster cluster;
+    std::vector<LightData> lights(LD_MAX_LIGHTS);
+
+    for (u32 i = 0; i < LD_MAX_LIGHTS; i++)
+        lights[i] = LightClusterTestLight(Vec3(0.0f, 0.0f, -5.0f), 1000.0f, Vec3(0.0f, 0.0f, -1.0f), -1.0f);
+
+    LightClusterStats stats = cluster.Build(Mat4::Identity, LightClusterTestProj(), lights.data(), LD_MAX_LIGHTS);
+
+    CHECK(stats.LightCount == LD_MAX_LIGHTS);
+    CHECK(stats.Overflow);
+    CHECK(stats.IndexCount == LD_MAX_LIGHT_INDICES);
+    CHECK(cluster.GetIndexUploadSize() == LD_MAX_LIGHT_INDICES);
+
+    // a cluster holds more lights than an 8 bit count, the last light index still fits in 8 bits
+    CHECK(stats.MaxClusterLights == LD_MAX_LIGHTS);
+
+    const u8* indices = cluster.GetIndexUBO().Indices;
+    u32 fullClusters = LD_MAX_LIGHT_INDICES / LD_MAX_LIGHTS;
+
+    for (u32 i = 0; i < LD_LIGHT_CLUSTER_COUNT; i++)
+    {
+        u32 record = cluster.GetClusterUBO().Records[i];
+        u32 offset = record & 0xFFFF;
+        u32 count = record >> 16;
+
+        CHECK(offset + count <= LD_MAX_LIGHT_INDICES);
+        CHECK(count == (i < fullClusters ? (u32)LD_MAX_LIGHTS : 0u));
+    }
+
+    for (u32 i = 0; i < LD_MAX_LIGHTS; i++)
+    {
+        CHECK(indices[i] == i);
+        CHECK(indices[LD_MAX_LIGHT_INDICES - LD_MAX_LIGHTS + i] == i);
+    }
+}
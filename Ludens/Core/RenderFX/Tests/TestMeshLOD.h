@@ -0,0 +1,213 @@
+#pragma once
+
+#include <cmath>
+#include <doctest.h>
+#include "Core/RenderFX/Include/MeshLOD.h"
+
+using namespace LD;
+
+// a grid of quads on the XZ plane with a UV seam down the middle column of vertices,
+// vertices on the seam are split into a left and a right vertex with different texture coordinates
+struct MeshLODTestGrid
+{
+    Vector<MeshVertex> Vertices;
+    Vector<u32> Indices;
+    float SeamX;
+
+    MeshLODTestGrid(int size, float amplitude)
+    {
+        int seam = size / 2;
+        SeamX = (float)seam;
+
+        // vertex index of each grid point for the quads to the left and right of it
+        Vector<u32> left((size + 1) * (size + 1));
+        Vector<u32> right((size + 1) * (size + 1));
+
+        for (int z = 0; z <= size; z++)
+        {
+            for (int x = 0; x <= size; x++)
+            {
+                MeshVertex vertex;
+                vertex.Position = { (float)x, amplitude * std::sin(x * 0.7f) * std::cos(z * 0.5f), (float)z };
+                vertex.Normal = { 0.0f, 1.0f, 0.0f };
+                vertex.Tangent = { 1.0f, 0.0f, 0.0f };
+                vertex.TexUV = { (float)x / size, (float)z / size };
+
+                int point = z * (size + 1) + x;
+                left[point] = right[point] = (u32)Vertices.Size();
+                Vertices.PushBack(vertex);
+
+                if (x == seam)
+                {
+                    vertex.TexUV.x += 1.0f;
+                    right[point] = (u32)Vertices.Size();
+                    Vertices.PushBack(vertex);
+                }
+            }
+        }
+
+        for (int z = 0; z < size; z++)
+        {
+            for (int x = 0; x < size; x++)
+            {
+                const Vector<u32>& side = x < seam ? left : right;
+                u32 p00 = side[z * (size + 1) + x];
+                u32 p10 = side[z * (size + 1) + x + 1];
+                u32 p01 = side[(z + 1) * (size + 1) + x];
+                u32 p11 = side[(z + 1) * (size + 1) + x + 1];
+
+                // counter clockwise seen from above
+                Indices.PushBack(p00);
+                Indices.PushBack(p01);
+                Indices.PushBack(p11);
+                Indices.PushBack(p00);
+                Indices.PushBack(p11);
+                Indices.PushBack(p10);
+            }
+        }
+    }
+
+    // the side of the seam a vertex belongs to, 0 for vertices off the seam
+    int GetSeamSide(u32 vertex) const
+    {
+        if (Vertices[vertex].Position.x != SeamX)
+            return 0;
+
+        return Vertices[vertex].TexUV.x > 1.0f ? 1 : -1;
+    }
+};
+
+static Vec3 MeshLODTestNormal(const MeshLODTestGrid& grid, const u32* corners)
+{
+    const Vec3& p0 = grid.Vertices[corners[0]].Position;
+    const Vec3& p1 = grid.Vertices[corners[1]].Position;
+    const Vec3& p2 = grid.Vertices[corners[2]].Position;
+
+    return Vec3::Cross(p1 - p0, p2 - p0);
+}
+
+TEST_CASE("MeshLOD flat surface")
+{
+    MeshLODTestGrid grid(16, 0.0f);
+    u32 vertexCount = (u32)grid.Vertices.Size();
+    u32 indexCount = (u32)grid.Indices.Size();
+
+    Vector<u32> simplified;
+    float error = SimplifyMesh(grid.Vertices.Data(), vertexCount, grid.Indices.Data(), indexCount, indexCount / 4, simplified);
+
+    // interior vertices of a plane collapse without error
+    CHECK(simplified.Size() <= indexCount / 4);
+    CHECK(simplified.Size() % 3 == 0);
+    CHECK(error < 1e-4f);
+
+    for (u32 index : simplified)
+        CHECK(index < vertexCount);
+}
+
+TEST_CASE("MeshLOD UV seams")
+{
+    MeshLODTestGrid grid(16, 0.2f);
+    u32 vertexCount = (u32)grid.Vertices.Size();
+
+    Vector<u32> simplified;
+    SimplifyMesh(grid.Vertices.Data(), vertexCount, grid.Indices.Data(), (u32)grid.Indices.Size(), 0, simplified);
+    CHECK(simplified.Size() < grid.Indices.Size() / 4);
+
+    Vector<int> references(vertexCount);
+    for (int& count : references)
+        count = 0;
+
+    for (size_t i = 0; i < simplified.Size(); i += 3)
+    {
+        const u32* corners = simplified.Data() + i;
+        int side = 0;
+        float minX = grid.Vertices[corners[0]].Position.x;
+        float maxX = minX;
+
+        for (int j = 0; j < 3; j++)
+        {
+            const Vec3& position = grid.Vertices[corners[j]].Position;
+            minX = std::min(minX, position.x);
+            maxX = std::max(maxX, position.x);
+            side = side != 0 ? side : grid.GetSeamSide(corners[j]);
+            references[corners[j]]++;
+        }
+
+        // a triangle never stretches texture coordinates across the seam
+        CHECK_FALSE((minX < grid.SeamX && grid.SeamX < maxX));
+        if (side < 0)
+            CHECK(maxX <= grid.SeamX);
+        else if (side > 0)
+            CHECK(minX >= grid.SeamX);
+
+        // the surface is a height field, no triangle is folded over
+        CHECK(MeshLODTestNormal(grid, corners).y > 0.0f);
+    }
+
+    // both sides of the seam are still connected along the seam
+    for (u32 vertex = 0; vertex < vertexCount; vertex++)
+    {
+        if (grid.GetSeamSide(vertex) != 0)
+            CHECK(references[vertex] > 0);
+    }
+}
+
+TEST_CASE("MeshLOD levels")
+{
+    MeshLODTestGrid grid(32, 0.3f);
+
+    MeshLODInfo info;
+    Vector<u32> lodIndices;
+    Vector<MeshLODLevel> levels;
+    GenerateMeshLODs(info, grid.Vertices, grid.Indices, lodIndices, levels);
+
+    REQUIRE(levels.Size() == info.LevelCount);
+    CHECK(levels[0].IndexStart == 0);
+    CHECK(levels[0].IndexCount == grid.Indices.Size());
+    CHECK(levels[0].Error == 0.0f);
+
+    for (u32 level = 1; level < (u32)levels.Size(); level++)
+    {
+        const MeshLODLevel& prev = levels[level - 1];
+        const MeshLODLevel& next = levels[level];
+
+        CHECK(next.IndexStart == prev.IndexStart + prev.IndexCount);
+        CHECK(next.IndexCount <= prev.IndexCount / 2 + 2);
+        CHECK(next.Error >= prev.Error);
+    }
+
+    // coarse levels deviate from the surface, but not beyond the height of the bumps
+    CHECK(levels.Back().Error > 0.0f);
+    CHECK(levels.Back().Error < 0.6f);
+    CHECK(lodIndices.Size() == levels.Back().IndexStart + levels.Back().IndexCount);
+
+    // a mesh without removable vertices stops after the full detail level
+    MeshLODTestGrid quad(1, 0.0f);
+    GenerateMeshLODs(info, quad.Vertices, quad.Indices, lodIndices, levels);
+    CHECK(levels.Size() == 1);
+    CHECK(lodIndices.Size() == quad.Indices.Size());
+}
+
+TEST_CASE("MeshLOD selection")
+{
+    float errors[4] = { 0.0f, 0.01f, 0.05f, 0.2f };
+
+    CHECK(SelectMeshLOD(errors, 4, 1000.0f, 1.0f) == 0);
+    CHECK(SelectMeshLOD(errors, 4, 50.0f, 1.0f) == 1);
+    CHECK(SelectMeshLOD(errors, 4, 10.0f, 1.0f) == 2);
+    CHECK(SelectMeshLOD(errors, 4, 4.0f, 1.0f) == 3);
+    CHECK(SelectMeshLOD(errors, 1, 4.0f, 1.0f) == 0);
+
+    // a sphere of radius 1 at distance 10 with a 90 degree field of view covers a tenth of the half height
+    Mat4 proj = Mat4::Perspective(LD_MATH_PI / 2.0f, 1.0f, 0.1f, 100.0f);
+    float screenRadius = GetMeshScreenRadius({ 0.0f, 0.0f, -10.0f }, 1.0f, proj, 1000.0f);
+    CHECK(screenRadius == doctest::Approx(500.0f / std::sqrt(99.0f)).epsilon(1e-3));
+
+    // farther meshes select coarser levels
+    float farRadius = GetMeshScreenRadius({ 0.0f, 0.0f, -100.0f }, 1.0f, proj, 1000.0f);
+    CHECK(SelectMeshLOD(errors, 4, farRadius, 1.0f) > SelectMeshLOD(errors, 4, screenRadius, 1.0f));
+
+    // the camera inside the bounding sphere always selects full detail
+    float insideRadius = GetMeshScreenRadius({ 0.0f, 0.5f, 0.0f }, 1.0f, proj, 1000.0f);
+    CHECK(SelectMeshLOD(errors, 4, insideRadius, 1.0f) == 0);
+}
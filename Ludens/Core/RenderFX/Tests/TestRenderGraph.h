@@ -0,0 +1,309 @@
+#pragma once
+
+#include <string>
+#include <doctest.h>
+#include "Core/RenderFX/Include/RenderGraph.h"
+
+using namespace LD;
+
+// records the names of executed passes
+static std::string sRenderGraphTestLog;
+
+static void RenderGraphTestPassMain(void* data)
+{
+    sRenderGraphTestLog += (const char*)data;
+    sRenderGraphTestLog += ";";
+}
+
+static RenderGraphPass RenderGraphTestAddPass(RenderGraph& graph, const char* name)
+{
+    RenderGraphPassInfo passI;
+    passI.Name = name;
+    passI.Main = &RenderGraphTestPassMain;
+    passI.Data = (void*)name;
+
+    return graph.AddPass(passI);
+}
+
+static RenderGraphResource RenderGraphTestAddResource(RenderGraph& graph, RTextureFormat format, u32 size = 64)
+{
+    RenderGraphResourceInfo resourceI;
+    resourceI.Format = format;
+    resourceI.Width = size;
+    resourceI.Height = size;
+
+    return graph.AddResource(resourceI);
+}
+
+// passes and attachments of the deferred renderer
+struct RenderGraphTestFrame
+{
+    RenderGraphPass GBuffer, SSAO, SSAOBlur, Lighting, Screen, SwapChain;
+    RenderGraphResource Normals, Albedo, Depth, Occlusion, OcclusionBlur, HDR, LDR, SwapChainImage;
+
+    RenderGraphTestFrame(RenderGraph& graph, bool isToneMapped)
+    {
+        graph.Reset();
+
+        Normals = RenderGraphTestAddResource(graph, RTextureFormat::RGBA16F);
+        Albedo = RenderGraphTestAddResource(graph, RTextureFormat::RGBA8);
+        Depth = RenderGraphTestAddResource(graph, RTextureFormat::D32F);
+        Occlusion = RenderGraphTestAddResource(graph, RTextureFormat::R8, 32);
+        OcclusionBlur = RenderGraphTestAddResource(graph, RTextureFormat::R8);
+        HDR = RenderGraphTestAddResource(graph, RTextureFormat::RGBA16F);
+        LDR = RenderGraphTestAddResource(graph, RTextureFormat::RGBA8);
+
+        RenderGraphResourceInfo swapChainI;
+        swapChainI.Format = RTextureFormat::BGRA8;
+        swapChainI.Width = 64;
+        swapChainI.Height = 64;
+        swapChainI.IsImported = true;
+        swapChainI.FinalState = RState::Present;
+        SwapChainImage = graph.AddResource(swapChainI);
+        graph.AddOutput(SwapChainImage);
+
+        GBuffer = RenderGraphTestAddPass(graph, "GBuffer");
+        graph.AddWrite(GBuffer, Normals);
+        graph.AddWrite(GBuffer, Albedo);
+        graph.AddWrite(GBuffer, Depth);
+
+        SSAO = RenderGraphTestAddPass(graph, "SSAO");
+        graph.AddRead(SSAO, Depth);
+        graph.AddRead(SSAO, Normals);
+        graph.AddWrite(SSAO, Occlusion);
+
+        SSAOBlur = RenderGraphTestAddPass(graph, "SSAOBlur");
+        graph.AddRead(SSAOBlur, Occlusion);
+        graph.AddRead(SSAOBlur, Depth);
+        graph.AddWrite(SSAOBlur, OcclusionBlur);
+
+        Lighting = RenderGraphTestAddPass(graph, "Lighting");
+        graph.AddRead(Lighting, Depth);
+        graph.AddRead(Lighting, Normals);
+        graph.AddRead(Lighting, Albedo);
+        graph.AddRead(Lighting, OcclusionBlur);
+        graph.AddWrite(Lighting, HDR);
+
+        // debug views output GBuffer attachments without lighting
+        Screen = RenderGraphTestAddPass(graph, "Screen");
+        if (isToneMapped)
+            graph.AddRead(Screen, HDR);
+        else
+            graph.AddRead(Screen, Albedo);
+        graph.AddWrite(Screen, LDR);
+
+        SwapChain = RenderGraphTestAddPass(graph, "SwapChain");
+        graph.AddRead(SwapChain, LDR);
+        graph.AddWrite(SwapChain, SwapChainImage);
+
+        graph.Compile();
+    }
+};
+
+TEST_CASE("RenderGraph culling")
+{
+    RenderGraph graph;
+
+    {
+        RenderGraphTestFrame frame(graph, true);
+        CHECK(graph.IsCompiled());
+        CHECK_FALSE(graph.IsPassCulled(frame.SSAO));
+        CHECK_FALSE(graph.IsPassCulled(frame.Lighting));
+        CHECK(graph.GetPassOrder(frame.GBuffer) == 0);
+        CHECK(graph.GetPassOrder(frame.SwapChain) == 5);
+    }
+
+    {
+        // lighting output is unused, the occlusion passes that only feed lighting go with it
+        RenderGraphTestFrame frame(graph, false);
+        CHECK_FALSE(graph.IsPassCulled(frame.GBuffer));
+        CHECK(graph.IsPassCulled(frame.SSAO));
+        CHECK(graph.IsPassCulled(frame.SSAOBlur));
+        CHECK(graph.IsPassCulled(frame.Lighting));
+        CHECK_FALSE(graph.IsPassCulled(frame.Screen));
+        CHECK(graph.GetPassOrder(frame.Screen) == 1);
+        CHECK(graph.GetPassOrder(frame.Lighting) == LD_RENDER_GRAPH_NONE);
+
+        CHECK_FALSE(graph.IsResourceUsed(frame.Occlusion));
+        CHECK_FALSE(graph.IsResourceUsed(frame.HDR));
+        CHECK(graph.GetPhysicalIndex(frame.HDR) == LD_RENDER_GRAPH_NONE);
+        CHECK(graph.IsResourceUsed(frame.Normals));
+    }
+
+    {
+        // nothing reaches an output
+        graph.Reset();
+        RenderGraphResource color = RenderGraphTestAddResource(graph, RTextureFormat::RGBA8);
+        RenderGraphPass pass = RenderGraphTestAddPass(graph, "Unused");
+        graph.AddWrite(pass, color);
+        graph.Compile();
+        CHECK(graph.IsPassCulled(pass));
+        CHECK(graph.GetPhysicalCount() == 0);
+    }
+}
+
+TEST_CASE("RenderGraph aliasing")
+{
+    RenderGraph graph;
+
+    // a chain of full screen passes, each attachment is dead once the next pass has read it
+    RenderGraphResource a = RenderGraphTestAddResource(graph, RTextureFormat::RGBA16F);
+    RenderGraphResource b = RenderGraphTestAddResource(graph, RTextureFormat::RGBA16F);
+    RenderGraphResource c = RenderGraphTestAddResource(graph, RTextureFormat::RGBA16F);
+    RenderGraphResource d = RenderGraphTestAddResource(graph, RTextureFormat::RGBA8);
+    RenderGraphResource e = RenderGraphTestAddResource(graph, RTextureFormat::RGBA16F, 32);
+    RenderGraphResource out = RenderGraphTestAddResource(graph, RTextureFormat::RGBA16F);
+    graph.AddOutput(out);
+
+    RenderGraphPass p0 = RenderGraphTestAddPass(graph, "P0");
+    graph.AddWrite(p0, a);
+    RenderGraphPass p1 = RenderGraphTestAddPass(graph, "P1");
+    graph.AddRead(p1, a);
+    graph.AddWrite(p1, b);
+    RenderGraphPass p2 = RenderGraphTestAddPass(graph, "P2");
+    graph.AddRead(p2, b);
+    graph.AddWrite(p2, c);
+    graph.AddWrite(p2, d);
+    graph.AddWrite(p2, e);
+    RenderGraphPass p3 = RenderGraphTestAddPass(graph, "P3");
+    graph.AddRead(p3, c);
+    graph.AddRead(p3, d);
+    graph.AddRead(p3, e);
+    graph.AddWrite(p3, out);
+    graph.Compile();
+
+    // c begins after a was last read, b overlaps both
+    CHECK(graph.GetPhysicalIndex(c) == graph.GetPhysicalIndex(a));
+    CHECK(graph.GetPhysicalIndex(b) != graph.GetPhysicalIndex(a));
+
+    // other formats and sizes never share a target
+    CHECK(graph.GetPhysicalIndex(d) != graph.GetPhysicalIndex(a));
+    CHECK(graph.GetPhysicalIndex(e) != graph.GetPhysicalIndex(a));
+    CHECK(graph.GetPhysicalIndex(e) != graph.GetPhysicalIndex(b));
+
+    // the output starts after a and c are dead but is used outside of the graph
+    CHECK(graph.GetPhysicalIndex(out) != graph.GetPhysicalIndex(a));
+    CHECK(graph.GetPhysicalIndex(out) != graph.GetPhysicalIndex(b));
+    CHECK(graph.GetPhysicalCount() == 5);
+
+    // tone mapping renders to the albedo target once lighting has consumed it
+    RenderGraphTestFrame frame(graph, true);
+    CHECK(graph.GetPhysicalIndex(frame.LDR) == graph.GetPhysicalIndex(frame.Albedo));
+    CHECK(graph.GetPhysicalCount() == 7);
+
+    // debug views sample albedo while rendering the LDR result
+    RenderGraphTestFrame debugFrame(graph, false);
+    CHECK(graph.GetPhysicalIndex(debugFrame.LDR) != graph.GetPhysicalIndex(debugFrame.Albedo));
+}
+
+TEST_CASE("RenderGraph attachment transitions")
+{
+    RenderGraph graph;
+    RenderGraphTestFrame frame(graph, true);
+
+    const Vector<RPassAttachment>& gbuffer = graph.GetAttachments(frame.GBuffer);
+    REQUIRE(gbuffer.Size() == 3);
+
+    // sampled by later passes
+    CHECK(gbuffer[0].Format == RTextureFormat::RGBA16F);
+    CHECK(gbuffer[0].InitialState == RState::Undefined);
+    CHECK(gbuffer[0].LoadOp == RLoadOp::Discard);
+    CHECK(gbuffer[0].FinalState == RState::ShaderResource);
+    CHECK(gbuffer[0].StoreOp == RStoreOp::Store);
+    CHECK(gbuffer[2].FinalState == RState::ShaderResource);
+
+    const Vector<RPassAttachment>& swapChain = graph.GetAttachments(frame.SwapChain);
+    REQUIRE(swapChain.Size() == 1);
+    CHECK(swapChain[0].FinalState == RState::Present);
+    CHECK(swapChain[0].StoreOp == RStoreOp::Store);
+
+    // depth that nothing samples stays a depth attachment and is not stored
+    RenderGraphTestFrame debugFrame(graph, false);
+    const Vector<RPassAttachment>& debugGBuffer = graph.GetAttachments(debugFrame.GBuffer);
+    CHECK(debugGBuffer[2].FinalState == RState::DepthStencilWrite);
+    CHECK(debugGBuffer[2].StoreOp == RStoreOp::Discard);
+    CHECK(graph.GetAttachments(debugFrame.Lighting).IsEmpty());
+
+    // a pass accumulating over a previous pass loads its contents
+    graph.Reset();
+    RenderGraphResource color = RenderGraphTestAddResource(graph, RTextureFormat::RGBA8);
+    RenderGraphResource result = RenderGraphTestAddResource(graph, RTextureFormat::RGBA8);
+    graph.AddOutput(result);
+    RenderGraphPass base = RenderGraphTestAddPass(graph, "Base");
+    graph.AddWrite(base, color);
+    RenderGraphPass overlay = RenderGraphTestAddPass(graph, "Overlay");
+    graph.AddWrite(overlay, color);
+    RenderGraphPass resolve = RenderGraphTestAddPass(graph, "Resolve");
+    graph.AddRead(resolve, color);
+    graph.AddWrite(resolve, result);
+    graph.Compile();
+
+    // both writes reach the output, the overlay is not known to cover every pixel
+    CHECK_FALSE(graph.IsPassCulled(base));
+    const RPassAttachment& baseColor = graph.GetAttachments(base)[0];
+    const RPassAttachment& overlayColor = graph.GetAttachments(overlay)[0];
+    CHECK(baseColor.FinalState == RState::ColorAttachment);
+    CHECK(baseColor.StoreOp == RStoreOp::Store);
+    CHECK(overlayColor.InitialState == RState::ColorAttachment);
+    CHECK(overlayColor.LoadOp == RLoadOp::Load);
+    CHECK(overlayColor.FinalState == RState::ShaderResource);
+    CHECK(graph.GetAttachments(resolve)[0].FinalState == RState::ShaderResource);
+}
+
+TEST_CASE("RenderGraph baked render passes")
+{
+    RPassAttachment derived;
+    derived.Format = RTextureFormat::RGBA8;
+    derived.InitialState = RState::Undefined;
+    derived.FinalState = RState::ShaderResource;
+    derived.LoadOp = RLoadOp::Discard;
+    derived.StoreOp = RStoreOp::Store;
+
+    // clearing instead of discarding is up to the pass
+    RPassAttachment baked = derived;
+    baked.LoadOp = RLoadOp::Clear;
+    CHECK(RenderGraph::IsAttachmentCompatible(baked, derived));
+
+    baked.StoreOp = RStoreOp::Discard;
+    CHECK_FALSE(RenderGraph::IsAttachmentCompatible(baked, derived));
+
+    baked = derived;
+    baked.FinalState = RState::ColorAttachment;
+    CHECK_FALSE(RenderGraph::IsAttachmentCompatible(baked, derived));
+
+    baked = derived;
+    baked.Format = RTextureFormat::RGBA16F;
+    CHECK_FALSE(RenderGraph::IsAttachmentCompatible(baked, derived));
+
+    // storing unused contents only costs bandwidth
+    derived.FinalState = RState::DepthStencilWrite;
+    derived.StoreOp = RStoreOp::Discard;
+    derived.Format = RTextureFormat::D32F;
+    baked = derived;
+    baked.FinalState = RState::ShaderResource;
+    baked.StoreOp = RStoreOp::Store;
+    CHECK(RenderGraph::IsAttachmentCompatible(baked, derived));
+
+    // preserved contents must be loaded
+    derived.InitialState = RState::ColorAttachment;
+    derived.LoadOp = RLoadOp::Load;
+    derived.Format = RTextureFormat::RGBA8;
+    baked = derived;
+    baked.LoadOp = RLoadOp::Clear;
+    CHECK_FALSE(RenderGraph::IsAttachmentCompatible(baked, derived));
+}
+
+TEST_CASE("RenderGraph replay")
+{
+    RenderGraph graph;
+    RenderGraphTestFrame frame(graph, false);
+
+    sRenderGraphTestLog.clear();
+    graph.Execute();
+    graph.Execute();
+    CHECK(sRenderGraphTestLog == "GBuffer;Screen;SwapChain;GBuffer;Screen;SwapChain;");
+
+    // declaring the graph again requires another compile
+    RenderGraphTestAddPass(graph, "Late");
+    CHECK_FALSE(graph.IsCompiled());
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cmath>
+#include <doctest.h>
+#include "Core/RenderFX/Include/VertexQuantization.h"
+
+using namespace LD;
+
+// deterministic values in [-1, 1]
+static float VertexQuantizationTestValue(u32 i, u32 salt)
+{
+    u32 x = (i + 1) * 2654435761u ^ salt * 40503u;
+    x ^= x >> 13;
+    x *= 1274126177u;
+    x ^= x >> 16;
+
+    return (float)(x & 0xFFFF) / 32767.5f - 1.0f;
+}
+
+TEST_CASE("VertexQuantization half floats")
+{
+    // values with an exact half representation
+    const float exact[] = { 0.0f, 1.0f, -2.0f, 0.5f, 0.375f, 1024.0f, 65504.0f, 6.103515625e-5f, 5.9604644775390625e-8f };
+
+    for (float f : exact)
+        CHECK(HalfToFloat(FloatToHalf(f)) == f);
+
+    CHECK(FloatToHalf(1.0f) == 0x3C00);
+    CHECK(FloatToHalf(-0.0f) == 0x8000);
+    CHECK(FloatToHalf(1e6f) == 0x7C00);
+    CHECK(std::isinf(HalfToFloat(FloatToHalf(-1e6f))));
+    CHECK(FloatToHalf(1e-9f) == 0);
+
+    // ties round to even, 1 + 2^-11 lies halfway between 1 and the next half
+    CHECK(FloatToHalf(1.0f + 1.0f / 2048.0f) == 0x3C00);
+    CHECK(FloatToHalf(1.0f + 3.0f / 2048.0f) == 0x3C02);
+
+    // texture coordinates keep 11 significant bits
+    for (u32 i = 0; i < 1000; i++)
+    {
+        float f = VertexQuantizationTestValue(i, 1) * 4.0f;
+        float h = HalfToFloat(FloatToHalf(f));
+        CHECK(std::abs(h - f) <= std::abs(f) / 2048.0f + 3e-8f);
+    }
+}
+
+TEST_CASE("VertexQuantization vertices")
+{
+    Vec3 boundsMin(-2.0f, 0.5f, -10.0f);
+    Vec3 boundsMax(3.0f, 1.5f, 30.0f);
+    Vec3 extent = boundsMax - boundsMin;
+
+    const u32 vertexCount = 500;
+    Vector<MeshVertex> vertices(vertexCount);
+
+    for (u32 i = 0; i < vertexCount; i++)
+    {
+        MeshVertex& vertex = vertices[i];
+        for (int axis = 0; axis < 3; axis++)
+        {
+            float t = VertexQuantizationTestValue(i, axis) * 0.5f + 0.5f;
+            vertex.Position[axis] = boundsMin[axis] + extent[axis] * t;
+        }
+
+        vertex.Normal = Vec3(VertexQuantizationTestValue(i, 3), VertexQuantizationTestValue(i, 4), VertexQuantizationTestValue(i, 5));
+        vertex.Normal = vertex.Normal.Length() > 0.01f ? vertex.Normal.Normalized() : Vec3(0.0f, 0.0f, -1.0f);
+        vertex.Tangent = Vec3::Cross(vertex.Normal, Vec3(0.6f, 0.0f, 0.8f)).Normalized();
+        vertex.TexUV = Vec2(VertexQuantizationTestValue(i, 6) + 1.0f, VertexQuantizationTestValue(i, 7) * 3.0f);
+    }
+
+    Vector<QuantizedVertex> quantized(vertexCount);
+    QuantizeVertices(vertices.Data(), vertexCount, boundsMin, boundsMax, quantized.Data());
+
+    Mat4 dequantize = GetDequantizeMatrix(boundsMin, boundsMax);
+
+    for (u32 i = 0; i < vertexCount; i++)
+    {
+        const MeshVertex& vertex = vertices[i];
+        MeshVertex decoded = DequantizeVertex(quantized[i], boundsMin, boundsMax);
+
+        // half a step of 16 bits across the box
+        for (int axis = 0; axis < 3; axis++)
+            CHECK(std::abs(decoded.Position[axis] - vertex.Position[axis]) <= extent[axis] / 65535.0f * 0.5f + 1e-5f);
+
+        // the shader reads unsigned normalized positions and transforms them with the dequantize matrix
+        Vec4 unit((float)quantized[i].Position[0] / 65535.0f, (float)quantized[i].Position[1] / 65535.0f,
+                  (float)quantized[i].Position[2] / 65535.0f, 1.0f);
+        Vec4 position = dequantize * unit;
+        CHECK(position.x == doctest::Approx(decoded.Position.x).epsilon(1e-5));
+        CHECK(position.y == doctest::Approx(decoded.Position.y).epsilon(1e-5));
+        CHECK(position.z == doctest::Approx(decoded.Position.z).epsilon(1e-5));
+
+        // 8 bit octahedral directions stay within about a degree
+        CHECK(Vec3::Dot(decoded.Normal, vertex.Normal) > 0.999f);
+        CHECK(Vec3::Dot(decoded.Tangent, vertex.Tangent) > 0.999f);
+
+        CHECK(std::abs(decoded.TexUV.x - vertex.TexUV.x) <= 2.0f / 2048.0f);
+        CHECK(std::abs(decoded.TexUV.y - vertex.TexUV.y) <= 3.0f / 2048.0f);
+    }
+
+    // a flat axis decodes onto the minimum corner
+    MeshVertex flat = vertices[0];
+    flat.Position.y = 1.0f;
+    QuantizedVertex flatQuantized;
+    QuantizeVertices(&flat, 1, Vec3(-2.0f, 1.0f, -10.0f), Vec3(3.0f, 1.0f, 30.0f), &flatQuantized);
+    CHECK(flatQuantized.Position[1] == 0);
+    CHECK(DequantizeVertex(flatQuantized, Vec3(-2.0f, 1.0f, -10.0f), Vec3(3.0f, 1.0f, 30.0f)).Position.y == 1.0f);
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Header/Include/Singleton.h"
+#include "Core/Math/Include/Math.h"
 #include "Core/Math/Include/Mat4.h"
 #include "Core/OS/Include/UID.h"
 #include "Core/OS/Include/Memory.h"
@@ -12,6 +13,7 @@ namespace LD
 
 class UIContext;
 class Model;
+struct RDrawStats;
 
 /// renderer resource id
 using RRID = UID;
@@ -40,12 +42,39 @@ enum class LDRResult
     Roughness = 5,
 };
 
+/// screen space ambient occlusion cost and quality
+enum class SSAOQuality
+{
+    /// no ambient occlusion
+    Off = 0,
+
+    /// half resolution, 16 kernel samples
+    Low,
+
+    /// half resolution, 32 kernel samples
+    Medium,
+
+    /// full resolution, 64 kernel samples
+    High,
+};
+
+/// screen UI statistics of a frame
+struct RenderUIStats
+{
+    u32 WindowCount;            // windows drawn
+    u32 RegeneratedWindowCount; // dirty windows whose rects were generated again, the others replay cached rects
+    u32 RectCount;              // rects submitted, cached or generated
+};
+
 class RenderService : public Singleton<RenderService>
 {
     friend class Singleton<RenderService>;
 
 public:
-    void Startup(RBackend backend);
+    /// @brief startup the renderer
+    /// @param compactGBuffer store octahedral normals and reconstruct position from depth
+    ///        instead of storing a position attachment, reduces GBuffer bandwidth
+    void Startup(RBackend backend, bool compactGBuffer = false);
     void Cleanup();
 
     void GetDefaultFont(Ref<FontTTF>& ttf, Ref<FontGlyphTable>& table);
@@ -53,6 +82,24 @@ public:
     void SetDefaultRenderPipeline(RenderPipeline pipeline);
     void SetLDRResult(LDRResult result);
 
+    /// @brief set the SSAO quality, reduced resolution occlusion is upsampled
+    ///        with a depth aware filter. Defaults to SSAOQuality::High.
+    void SetSSAOQuality(SSAOQuality quality);
+
+    /// @brief scale the resolution of world passes to meet a frame time, the tone mapping pass
+    ///        upscales the result to the viewport. Disabled by default.
+    /// @param targetFrameTime frame time in seconds the render scale adapts to
+    void SetDynamicResolution(bool enabled, float targetFrameTime = 1.0f / 60.0f);
+
+    /// @brief render scale of the world passes, 1.0 without dynamic resolution
+    float GetRenderScale();
+
+    /// @brief draw statistics of the last frame, including mesh draws at each level of detail
+    void GetDrawStats(RDrawStats& stats);
+
+    /// @brief screen UI statistics of the last frame
+    void GetUIStats(RenderUIStats& stats);
+
     void BeginFrame();
     void EndFrame();
 
@@ -65,21 +112,33 @@ public:
     void CreateCubemap(RRID& id, int resolution, const void* data);
     void DeleteCubemap(RRID id);
 
-    void CreateMesh(RRID& id, Ref<Model> model);
+    /// @brief upload a model as a static mesh
+    /// @param quantizeVertices store 16 byte quantized vertices instead of full precision vertices,
+    ///        positions keep 16 bits of precision across the bounding box of the model
+    void CreateMesh(RRID& id, Ref<Model> model, bool quantizeVertices = false);
     void DeleteMesh(RRID id);
 
     void CreateDirectionalLight(RRID& id, const Vec3& direction, const Vec3& color);
     void DeleteDirectionalLight(RRID id);
 
+    /// @brief create a point light
+    /// @param radius range of the light, there is no contribution beyond this distance
+    void CreatePointLight(RRID& id, const Vec3& position, const Vec3& color, float radius);
+    void DeletePointLight(RRID id);
+
+    /// @brief create a spot light
+    /// @param innerAngle half angle of the cone at full intensity
+    /// @param outerAngle half angle of the cone, the light fades out between the inner and outer angle
+    void CreateSpotLight(RRID& id, const Vec3& position, const Vec3& direction, const Vec3& color, float radius,
+                         Degrees innerAngle, Degrees outerAngle);
+    void DeleteSpotLight(RRID id);
+
     void DrawMesh(RRID mesh, const Mat4& transform);
 
     void DrawScreenUI(UIContext* ui);
 
 private:
     void OnViewportResize(int width, int height);
-    void WorldRenderPasses();
-    void ScreenRenderPasses();
-    void SwapChainRenderPasses();
 
     struct RenderContext* mCtx;
 };
@@ -18,6 +18,9 @@ void BindingGroupResources::Startup(RDevice device)
     mFrameStaticBGL = FrameStaticGroup{}.CreateLayout(mDevice);
     mViewportBGL = ViewportGroup{}.CreateLayout(mDevice);
     mMaterialBGL = MaterialGroup{}.CreateLayout(mDevice);
+    mBindlessMaterialBGL.ResetHandle();
+    if (mDevice.HasBindlessSupport())
+        mBindlessMaterialBGL = BindlessMaterialGroup{}.CreateLayout(mDevice);
     mCubemapBGL = CubemapGroup{}.CreateLayout(mDevice);
     mRectBGL = RectGroup{}.CreateLayout(mDevice);
     mSSAOBGL = SSAOGroup{}.CreateLayout(mDevice);
@@ -35,10 +38,15 @@ void BindingGroupResources::Cleanup()
     if (mSSAOGroup)
         mSSAOGroup.Cleanup();
 
+    if (mBindlessMaterialGroup)
+        mBindlessMaterialGroup.Cleanup();
+
     mDevice.DeleteBindingGroupLayout(mToneMappingBGL);
     mDevice.DeleteBindingGroupLayout(mSSAOBGL);
     mDevice.DeleteBindingGroupLayout(mRectBGL);
     mDevice.DeleteBindingGroupLayout(mCubemapBGL);
+    if (mBindlessMaterialBGL)
+        mDevice.DeleteBindingGroupLayout(mBindlessMaterialBGL);
     mDevice.DeleteBindingGroupLayout(mMaterialBGL);
     mDevice.DeleteBindingGroupLayout(mViewportBGL);
     mDevice.DeleteBindingGroupLayout(mFrameStaticBGL);
@@ -79,4 +87,17 @@ SSAOGroup& BindingGroupResources::GetSSAOGroup()
     return mSSAOGroup;
 }
 
+BindlessMaterialGroup& BindingGroupResources::GetBindlessMaterialGroup()
+{
+    LD_DEBUG_ASSERT(mBindlessMaterialBGL);
+
+    if (!mBindlessMaterialGroup)
+    {
+        mBindlessMaterialGroup.Startup(mDevice, mBindlessMaterialBGL);
+        LD_DEBUG_ASSERT(mBindlessMaterialGroup);
+    }
+
+    return mBindlessMaterialGroup;
+}
+
 } // namespace LD
\ No newline at end of file
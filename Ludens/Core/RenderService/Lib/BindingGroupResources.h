@@ -4,6 +4,7 @@
 #include "Core/RenderFX/Include/Groups/FrameStaticGroup.h"
 #include "Core/RenderFX/Include/Groups/SSAOGroup.h"
 #include "Core/RenderFX/Include/Groups/ToneMappingGroup.h"
+#include "Core/RenderFX/Include/Groups/BindlessMaterialGroup.h"
 #include "Core/RenderService/Lib/RenderResources.h"
 
 namespace LD
@@ -21,6 +22,14 @@ public:
 
     SSAOGroup& GetSSAOGroup();
 
+    /// all mesh materials, only available if the device has bindless support
+    BindlessMaterialGroup& GetBindlessMaterialGroup();
+
+    inline bool HasBindlessMaterials() const
+    {
+        return (bool)mBindlessMaterialBGL;
+    }
+
     inline RBindingGroupLayout GetFrameStaticBGL()
     {
         return mFrameStaticBGL;
@@ -41,6 +50,11 @@ public:
         return mMaterialBGL;
     }
 
+    inline RBindingGroupLayout GetBindlessMaterialBGL()
+    {
+        return mBindlessMaterialBGL;
+    }
+
     inline RBindingGroupLayout GetCubemapBGL()
     {
         return mCubemapBGL;
@@ -60,10 +74,12 @@ private:
     FrameStaticGroup mFrameStaticGroup;
     ToneMappingGroup mToneMappingGroup;
     SSAOGroup mSSAOGroup;
+    BindlessMaterialGroup mBindlessMaterialGroup;
     RBindingGroupLayout mFrameStaticBGL;
     RBindingGroupLayout mToneMappingBGL;
     RBindingGroupLayout mViewportBGL;
     RBindingGroupLayout mMaterialBGL;
+    RBindingGroupLayout mBindlessMaterialBGL;
     RBindingGroupLayout mCubemapBGL;
     RBindingGroupLayout mRectBGL;
     RBindingGroupLayout mSSAOBGL;
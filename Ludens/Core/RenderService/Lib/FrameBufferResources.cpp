@@ -31,6 +31,7 @@ void FrameBufferResources::CreateGBuffer(GBuffer& gbuffer, int width, int height
     GBufferInfo gbufferI;
     gbufferI.Device = mDevice;
     gbufferI.RenderPass = (RPass)pass;
+    gbufferI.Layout = pass.GetLayout();
     gbufferI.PositionFormat = pass.GetPositionFormat();
     gbufferI.NormalsFormat = pass.GetNormalFormat();
     gbufferI.AlbedoFormat = pass.GetAlbedoFormat();
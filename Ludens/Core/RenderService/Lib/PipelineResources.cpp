@@ -22,6 +22,9 @@ void PipelineResources::Cleanup()
     if (mGBuffer)
         mGBuffer.Cleanup();
 
+    if (mGBufferQuantized)
+        mGBufferQuantized.Cleanup();
+
     if (mCubemap)
         mCubemap.Cleanup();
 
@@ -48,23 +51,50 @@ void PipelineResources::Cleanup()
     mDevice.ResetHandle();
 }
 
-GBufferPipeline& PipelineResources::GetGBufferPipeline()
+bool PipelineResources::IsCompactGBuffer()
 {
-    if (!mGBuffer)
+    return mPassRes->GetGBufferLayout() == GBufferLayout::Compact;
+}
+
+void PipelineResources::Prewarm()
+{
+    GetGBufferPipeline(false);
+    GetGBufferPipeline(true);
+    GetCubemapPipeline();
+    GetRectPipeline();
+    GetDeferredBlinnPhongPipeline();
+    GetDeferredBRDFPipeline();
+    GetDeferredSSAOPipeline();
+    GetSSAOBlurPipeline();
+    GetToneMappingPipeline();
+    GetSwapChainTransferPipeline();
+}
+
+GBufferPipeline& PipelineResources::GetGBufferPipeline(bool quantizedVertices)
+{
+    GBufferPipeline& gbuffer = quantizedVertices ? mGBufferQuantized : mGBuffer;
+
+    if (!gbuffer)
     {
+        // prefer a single bindless material group over one material group per mesh batch
+        bool isBindless = mGroupRes->HasBindlessMaterials();
+
         Array<RBindingGroupLayout, 2> groupLayout;
         groupLayout[0] = mGroupRes->GetViewportBGL();
-        groupLayout[1] = mGroupRes->GetMaterialBGL();
+        groupLayout[1] = isBindless ? mGroupRes->GetBindlessMaterialBGL() : mGroupRes->GetMaterialBGL();
 
         GBufferPipelineInfo pipelineI;
         pipelineI.Device = mDevice;
+        pipelineI.Bindless = isBindless;
+        pipelineI.CompactGBuffer = IsCompactGBuffer();
+        pipelineI.QuantizedVertices = quantizedVertices;
         pipelineI.RenderPass = (RPass)mPassRes->GetGBufferPass();
         pipelineI.GBufferPipelineLayout.GroupLayouts = groupLayout.GetView();
-        mGBuffer.Startup(pipelineI);
+        gbuffer.Startup(pipelineI);
     }
 
-    LD_DEBUG_ASSERT(mGBuffer);
-    return mGBuffer;
+    LD_DEBUG_ASSERT(gbuffer);
+    return gbuffer;
 }
 
 CubemapPipeline& PipelineResources::GetCubemapPipeline()
@@ -78,6 +108,7 @@ CubemapPipeline& PipelineResources::GetCubemapPipeline()
 
         CubemapPipelineInfo pipelineI;
         pipelineI.Device = mDevice;
+        pipelineI.CompactGBuffer = IsCompactGBuffer();
         pipelineI.RenderPass = (RPass)mPassRes->GetGBufferPass();
         pipelineI.CubemapPipelineLayout.GroupLayouts = groupLayout.GetView();
         mCubemap.Startup(pipelineI);
@@ -116,6 +147,7 @@ DeferredBlinnPhongPipeline& PipelineResources::GetDeferredBlinnPhongPipeline()
 
         DeferredBlinnPhongPipelineInfo pipelineI;
         pipelineI.Device = mDevice;
+        pipelineI.CompactGBuffer = IsCompactGBuffer();
         pipelineI.RenderPass = (RPass)mPassRes->GetColorPassHDR();
         pipelineI.PipelineLayout.GroupLayouts = groupLayout.GetView();
         mDeferredBlinnPhong.Startup(pipelineI);
@@ -135,6 +167,7 @@ DeferredBRDFPipeline& PipelineResources::GetDeferredBRDFPipeline()
 
         DeferredBRDFPipelineInfo pipelineI;
         pipelineI.Device = mDevice;
+        pipelineI.CompactGBuffer = IsCompactGBuffer();
         pipelineI.RenderPass = (RPass)mPassRes->GetColorPassHDR();
         pipelineI.PipelineLayout.GroupLayouts = groupLayout.GetView();
         mDeferredBRDF.Startup(pipelineI);
@@ -154,6 +187,7 @@ DeferredSSAOPipeline& PipelineResources::GetDeferredSSAOPipeline()
 
         DeferredSSAOPipelineInfo pipelineI;
         pipelineI.Device = mDevice;
+        pipelineI.CompactGBuffer = IsCompactGBuffer();
         pipelineI.RenderPass = (RPass)mPassRes->GetSSAOPass();
         pipelineI.PipelineLayout.GroupLayouts = groupLayout.GetView();
         mDeferredSSAO.Startup(pipelineI);
@@ -173,6 +207,7 @@ SSAOBlurPipeline& PipelineResources::GetSSAOBlurPipeline()
 
         SSAOBlurPipelineInfo pipelineI;
         pipelineI.Device = mDevice;
+        pipelineI.CompactGBuffer = IsCompactGBuffer();
         pipelineI.RenderPass = (RPass)mPassRes->GetSSAOPass();
         pipelineI.PipelineLayout.GroupLayouts = groupLayout.GetView();
         mSSAOBlur.Startup(pipelineI);
@@ -194,6 +229,7 @@ ToneMappingPipeline& PipelineResources::GetToneMappingPipeline()
 
         ToneMappingPipelineInfo pipelineI;
         pipelineI.Device = mDevice;
+        pipelineI.CompactGBuffer = IsCompactGBuffer();
         pipelineI.RenderPass = (RPass)mPassRes->GetColorPassLDR();
         pipelineI.PipelineLayout.GroupLayouts = groupLayout.GetView();
         mToneMapping.Startup(pipelineI);
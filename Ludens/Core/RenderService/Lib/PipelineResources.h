@@ -23,7 +23,12 @@ public:
     void Startup(RDevice device, RenderPassResources* passRes, BindingGroupResources* groupRes);
     void Cleanup();
 
-    GBufferPipeline& GetGBufferPipeline();
+    /// create all pipelines up front, the Vulkan backend compiles them
+    /// on worker threads while the rest of the render context starts up
+    void Prewarm();
+
+    /// @param quantizedVertices the variant that draws meshes with QuantizedVertex buffers
+    GBufferPipeline& GetGBufferPipeline(bool quantizedVertices = false);
 
     CubemapPipeline& GetCubemapPipeline();
 
@@ -42,9 +47,12 @@ public:
     SwapChainTransferPipeline& GetSwapChainTransferPipeline();
 
 private:
+    bool IsCompactGBuffer();
+
     RenderPassResources* mPassRes;
     BindingGroupResources* mGroupRes;
     GBufferPipeline mGBuffer;
+    GBufferPipeline mGBufferQuantized;
     CubemapPipeline mCubemap;
     RectPipeline mRect;
     DeferredBlinnPhongPipeline mDeferredBlinnPhong;
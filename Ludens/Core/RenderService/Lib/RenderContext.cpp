@@ -1,6 +1,10 @@
+#include <algorithm>
+#include <cmath>
+#include "Core/OS/Include/JobSystem.h"
 #include "Core/RenderService/Lib/RenderContext.h"
 
 #define RECT_BATCH_CAPACITY 8192
+#define MAX_GBUFFER_COMMAND_LISTS 8
 
 namespace LD
 {
@@ -12,6 +16,35 @@ void GetDMSans_Regular(unsigned int* size, const char** data);
 
 } // namespace Embed
 
+struct SSAOQualitySettings
+{
+    float ResolutionScale; // SSAO target size relative to the viewport
+    int SampleCount;       // number of kernel samples per pixel
+};
+
+static SSAOQualitySettings GetSSAOQualitySettings(SSAOQuality quality)
+{
+    switch (quality)
+    {
+    case SSAOQuality::Low:
+        return { 0.5f, 16 };
+    case SSAOQuality::Medium:
+        return { 0.5f, 32 };
+    case SSAOQuality::High:
+        return { 1.0f, LD_SSAO_MAX_SAMPLES };
+    default:
+        break;
+    }
+
+    LD_DEBUG_UNREACHABLE;
+    return { 1.0f, LD_SSAO_MAX_SAMPLES };
+}
+
+static int GetScaledSize(int size, float scale)
+{
+    return std::max(1, (int)std::ceil(size * scale));
+}
+
 // clang-format off
 static float sQuadVertices[]{
      1.0f,  1.0f,  1.0f, 1.0f,
@@ -67,19 +100,25 @@ static float sCubeVertices[]{
 };
 // clang-format on
 
-void RenderContext::Startup(RDevice device, int viewportWidth, int viewportHeight)
+void RenderContext::Startup(RDevice device, int viewportWidth, int viewportHeight, GBufferLayout gbufferLayout)
 {
     LD_DEBUG_ASSERT(device);
     Device = device;
 
     ViewportWidth = viewportWidth;
     ViewportHeight = viewportHeight;
+    DefaultSSAOQuality = SSAOQuality::High;
+    IsDynamicResolutionEnabled = false;
+    IsRenderGraphDirty = true;
+    IsHDRUsed = true;
+    IsSSAOUsed = true;
     Device.ResizeViewport(ViewportWidth, ViewportHeight);
 
-    Passes.Startup(device);
+    Passes.Startup(device, gbufferLayout);
     FrameBuffers.Startup(Device, &Passes);
     BindingGroups.Startup(Device);
     Pipelines.Startup(Device, &Passes, &BindingGroups);
+    Pipelines.Prewarm();
     Textures.Startup(Device);
 
     {
@@ -87,20 +126,15 @@ void RenderContext::Startup(RDevice device, int viewportWidth, int viewportHeigh
         int vh = ViewportHeight;
 
         FrameBuffers.CreateGBuffer(DefaultGBuffer, vw, vh);
-        FrameBuffers.CreateSSAOBuffer(DefaultSSAOBuffer, vw, vh, &Passes.GetSSAOPass());
-        FrameBuffers.CreateSSAOBuffer(DefaultSSAOBlurBuffer, vw, vh, &Passes.GetSSAOPass());
         FrameBuffers.CreateColorBuffer(ColorBufferHDR, vw, vh, &Passes.GetColorPassHDR());
         FrameBuffers.CreateColorBuffer(ColorBufferLDR, vw, vh, &Passes.GetColorPassLDR());
 
         WorldViewportGroup.Startup(Device, BindingGroups.GetViewportBGL());
         WorldViewportGroup.BindGBuffer(DefaultGBuffer);
-        WorldViewportGroup.BindSSAOTexture(DefaultSSAOBlurBuffer.GetTexture());
+        CreateSSAOBuffers();
 
         ScreenViewportGroup.Startup(Device, BindingGroups.GetViewportBGL());
-        ScreenViewportGroup.BindColorTextures(ColorBufferHDR, ColorBufferLDR);
-
-        SSAOGroup& ssaoGroup = BindingGroups.GetSSAOGroup();
-        ssaoGroup.BindSSAOTexture(DefaultSSAOBuffer.GetTexture());
+        BindColorTextures();
 
         RBufferInfo info;
         info.Type = RBufferType::VertexBuffer;
@@ -131,16 +165,16 @@ void RenderContext::Startup(RDevice device, int viewportWidth, int viewportHeigh
         atlasI.FontData = DefaultFontTTF;
         DefaultFontAtlas.Startup(atlasI);
 
-        // one draw call per commit
-        auto onRectBatchCommit = [&](RBuffer vbo, RBuffer ibo, int indexStart, int indexCount)
+        // one instanced draw call per commit, each rect instance expands into two triangles
+        auto onRectBatchCommit = [&](RBuffer instanceBuffer, int instanceStart, int instanceCount)
         {
-            Device.SetVertexBuffer(0, vbo);
-            Device.SetIndexBuffer(ibo, RIndexType::u16);
+            Device.SetVertexBuffer(0, instanceBuffer);
 
-            RDrawIndexedInfo drawI;
-            drawI.IndexStart = indexStart;
-            drawI.IndexCount = indexCount;
-            Device.DrawIndexed(drawI);
+            RDrawVertexInfo drawI;
+            drawI.VertexCount = 6;
+            drawI.InstanceStart = instanceStart;
+            drawI.InstanceCount = instanceCount;
+            Device.DrawVertex(drawI);
         };
 
         DefaultRectBatcher.Startup(Device, RECT_BATCH_CAPACITY, onRectBatchCommit);
@@ -151,6 +185,19 @@ void RenderContext::Startup(RDevice device, int viewportWidth, int viewportHeigh
 
         DefaultRectGroup.BindTexture(DefaultFontAtlas.GetAtlas(), 1);
     }
+
+    {
+        int workerCount = JobSystem::GetSingleton().GetWorkerThreadCount();
+        GBufferCommandLists.Resize(std::clamp(workerCount, 1, MAX_GBUFFER_COMMAND_LISTS));
+
+        RCommandListInfo listI;
+        listI.Name = "GBufferCommandList";
+        for (RCommandList& list : GBufferCommandLists)
+            Device.CreateCommandList(list, listI);
+
+        listI.Name = "SkyboxCommandList";
+        Device.CreateCommandList(SkyboxCommandList, listI);
+    }
 }
 
 void RenderContext::Cleanup()
@@ -158,7 +205,13 @@ void RenderContext::Cleanup()
     Device.WaitIdle();
 
     {
+        Device.DeleteCommandList(SkyboxCommandList);
+        for (RCommandList& list : GBufferCommandLists)
+            Device.DeleteCommandList(list);
+        GBufferCommandLists.Clear();
+
         DefaultRectBatcher.Cleanup();
+        UICache.Windows.clear();
         DefaultRectGroup.Cleanup();
         DefaultFontAtlas.Cleanup();
         DefaultFontTTF = nullptr;
@@ -167,9 +220,12 @@ void RenderContext::Cleanup()
         ScreenViewportGroup.Cleanup();
         WorldViewportGroup.Cleanup();
         DefaultGBuffer.Cleanup();
-        DefaultSSAOBuffer.Cleanup();
-        DefaultSSAOBlurBuffer.Cleanup();
-        ColorBufferHDR.Cleanup();
+        if (DefaultSSAOBuffer)
+            DefaultSSAOBuffer.Cleanup();
+        if (DefaultSSAOBlurBuffer)
+            DefaultSSAOBlurBuffer.Cleanup();
+        if (ColorBufferHDR)
+            ColorBufferHDR.Cleanup();
         ColorBufferLDR.Cleanup();
     }
 
@@ -194,17 +250,10 @@ void RenderContext::OnViewportResize(int viewportWidth, int viewportHeight)
         DefaultGBuffer.Cleanup();
     FrameBuffers.CreateGBuffer(DefaultGBuffer, ViewportWidth, ViewportHeight);
 
-    if (DefaultSSAOBuffer)
-        DefaultSSAOBuffer.Cleanup();
-    FrameBuffers.CreateSSAOBuffer(DefaultSSAOBuffer, ViewportWidth, ViewportHeight, &Passes.GetSSAOPass());
-
-    if (DefaultSSAOBlurBuffer)
-        DefaultSSAOBlurBuffer.Cleanup();
-    FrameBuffers.CreateSSAOBuffer(DefaultSSAOBlurBuffer, ViewportWidth, ViewportHeight, &Passes.GetSSAOPass());
-
     if (ColorBufferHDR)
         ColorBufferHDR.Cleanup();
-    FrameBuffers.CreateColorBuffer(ColorBufferHDR, ViewportWidth, ViewportHeight, &Passes.GetColorPassHDR());
+    if (IsHDRUsed)
+        FrameBuffers.CreateColorBuffer(ColorBufferHDR, ViewportWidth, ViewportHeight, &Passes.GetColorPassHDR());
 
     if (ColorBufferLDR)
         ColorBufferLDR.Cleanup();
@@ -213,13 +262,134 @@ void RenderContext::OnViewportResize(int viewportWidth, int viewportHeight)
     // make gbuffer results visible from the viewport group
     WorldViewportGroup.BindGBuffer(DefaultGBuffer);
 
-    // make ssao results visible from the viewport group
+    // SSAO buffers at the scale of the current quality
+    CreateSSAOBuffers();
+
+    // make HDR and LDR results visible from the viewport group
+    BindColorTextures();
+
+    // the frame spent recreating targets is not a measurement of the render scale
+    FrameTimer.Start();
+    IsRenderGraphDirty = true;
+}
+
+void RenderContext::SetSSAOQuality(SSAOQuality quality)
+{
+    if (DefaultSSAOQuality == quality)
+        return;
+
+    // the SSAO buffers and kernel may still be read by frames in flight
+    Device.WaitIdle();
+
+    DefaultSSAOQuality = quality;
+    CreateSSAOBuffers();
+    IsRenderGraphDirty = true;
+}
+
+void RenderContext::CreateSSAOBuffers()
+{
+    if (DefaultSSAOBuffer)
+        DefaultSSAOBuffer.Cleanup();
+
+    if (DefaultSSAOBlurBuffer)
+        DefaultSSAOBlurBuffer.Cleanup();
+
     SSAOGroup& ssaoGroup = BindingGroups.GetSSAOGroup();
+    UpdateRenderExtent();
+
+    // SSAO passes are skipped or culled, deferred lighting samples a fully unoccluded texture
+    if (DefaultSSAOQuality == SSAOQuality::Off || !IsSSAOUsed)
+    {
+        ssaoGroup.BindSSAOTexture(Textures.GetWhitePixel());
+        WorldViewportGroup.BindSSAOTexture(Textures.GetWhitePixel());
+        return;
+    }
+
+    SSAOQualitySettings settings = GetSSAOQualitySettings(DefaultSSAOQuality);
+    ssaoGroup.SetSampleCount(settings.SampleCount);
+
+    // raw occlusion at the quality scale, the blur pass upsamples to viewport resolution
+    FrameBuffers.CreateSSAOBuffer(DefaultSSAOBuffer, SSAOWidth, SSAOHeight, &Passes.GetSSAOPass());
+    FrameBuffers.CreateSSAOBuffer(DefaultSSAOBlurBuffer, ViewportWidth, ViewportHeight, &Passes.GetSSAOPass());
+
+    // make ssao results visible from the viewport group
     ssaoGroup.BindSSAOTexture(DefaultSSAOBuffer.GetTexture());
     WorldViewportGroup.BindSSAOTexture(DefaultSSAOBlurBuffer.GetTexture());
+}
 
-    // make HDR and LDR results visible from the viewport group
-    ScreenViewportGroup.BindColorTextures(ColorBufferHDR, ColorBufferLDR);
+void RenderContext::UpdateTargets(bool useHDR, bool useSSAO)
+{
+    // SSAO buffers are already released if SSAO is off
+    bool isSSAOChanged = DefaultSSAOQuality != SSAOQuality::Off && IsSSAOUsed != useSSAO;
+
+    if (IsHDRUsed == useHDR && !isSSAOChanged)
+        return;
+
+    // targets may still be read by frames in flight
+    Device.WaitIdle();
+
+    IsSSAOUsed = useSSAO;
+    if (isSSAOChanged)
+        CreateSSAOBuffers();
+
+    if (IsHDRUsed != useHDR)
+    {
+        IsHDRUsed = useHDR;
+
+        if (ColorBufferHDR)
+            ColorBufferHDR.Cleanup();
+        if (IsHDRUsed)
+            FrameBuffers.CreateColorBuffer(ColorBufferHDR, ViewportWidth, ViewportHeight, &Passes.GetColorPassHDR());
+
+        BindColorTextures();
+    }
+}
+
+void RenderContext::BindColorTextures()
+{
+    RTexture hdr = IsHDRUsed ? ColorBufferHDR.GetColorAttachment() : Textures.GetWhitePixel();
+    ScreenViewportGroup.BindColorTextures(hdr, ColorBufferLDR.GetColorAttachment());
+}
+
+void RenderContext::SetDynamicResolution(bool enabled, float targetFrameTime)
+{
+    IsDynamicResolutionEnabled = enabled;
+
+    // frame buffers stay allocated at the viewport size, only the rendered area changes
+    DynamicResolutionInfo info;
+    info.TargetFrameTime = targetFrameTime;
+    DefaultDynamicResolution.Startup(info);
+    FrameTimer.Start();
+
+    UpdateRenderExtent();
+}
+
+void RenderContext::UpdateRenderExtent()
+{
+    RenderWidth = ViewportWidth;
+    RenderHeight = ViewportHeight;
+
+    if (IsDynamicResolutionEnabled)
+    {
+        RenderWidth = DefaultDynamicResolution.GetScaledSize(ViewportWidth);
+        RenderHeight = DefaultDynamicResolution.GetScaledSize(ViewportHeight);
+    }
+
+    if (DefaultSSAOQuality == SSAOQuality::Off)
+    {
+        SSAOWidth = 0;
+        SSAOHeight = 0;
+        SSAORenderWidth = 0;
+        SSAORenderHeight = 0;
+        return;
+    }
+
+    // the SSAO pass covers the same fraction of the reduced resolution SSAO buffer
+    SSAOQualitySettings settings = GetSSAOQualitySettings(DefaultSSAOQuality);
+    SSAOWidth = GetScaledSize(ViewportWidth, settings.ResolutionScale);
+    SSAOHeight = GetScaledSize(ViewportHeight, settings.ResolutionScale);
+    SSAORenderWidth = std::clamp((int)std::lround((double)RenderWidth * SSAOWidth / ViewportWidth), 1, SSAOWidth);
+    SSAORenderHeight = std::clamp((int)std::lround((double)RenderHeight * SSAOHeight / ViewportHeight), 1, SSAOHeight);
 }
 
 } // namespace LD
\ No newline at end of file
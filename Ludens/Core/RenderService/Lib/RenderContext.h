@@ -1,8 +1,12 @@
 #pragma once
 
 #include "Core/Media/Include/Font.h"
+#include "Core/OS/Include/Time.h"
 #include "Core/RenderBase/Include/RDevice.h"
+#include "Core/RenderBase/Include/RCommandList.h"
 #include "Core/RenderFX/Include/RFont.h"
+#include "Core/RenderFX/Include/DynamicResolution.h"
+#include "Core/RenderFX/Include/RenderGraph.h"
 #include "Core/RenderFX/Include/Groups/ViewportGroup.h"
 #include "Core/RenderFX/Include/Groups/RectGroup.h"
 #include "Core/RenderFX/Include/FrameBuffers/GBuffer.h"
@@ -14,6 +18,7 @@
 #include "Core/RenderService/Lib/BindingGroupResources.h"
 #include "Core/RenderService/Lib/PipelineResources.h"
 #include "Core/RenderService/Lib/TextureResources.h"
+#include "Core/RenderService/Lib/RenderUI.h"
 
 namespace LD
 {
@@ -21,15 +26,44 @@ namespace LD
 /// internal resources and state of the renderer
 struct RenderContext
 {
-    void Startup(RDevice device, int viewportWidth, int viewportHeight);
+    void Startup(RDevice device, int viewportWidth, int viewportHeight, GBufferLayout gbufferLayout);
     void Cleanup();
 
     void OnViewportResize(int viewportWidth, int viewportHeight);
 
+    /// @brief change the SSAO kernel and reallocate the SSAO buffers, waits for the device to be idle
+    void SetSSAOQuality(SSAOQuality quality);
+
+    /// @brief allocate the SSAO buffers of DefaultSSAOQuality for the current viewport size
+    void CreateSSAOBuffers();
+
+    /// @brief enable or disable the frame time driven render scale of the world passes
+    void SetDynamicResolution(bool enabled, float targetFrameTime);
+
+    /// @brief derive the rendered area of the world frame buffers from the viewport size and render scale
+    void UpdateRenderExtent();
+
+    /// @brief allocate the targets used by the compiled render graph and release the targets of culled passes,
+    ///        waits for the device to be idle if any target changes
+    void UpdateTargets(bool useHDR, bool useSSAO);
+
+    /// @brief bind the HDR and LDR color buffers to the screen viewport group, a white texture replaces a released HDR buffer
+    void BindColorTextures();
+
     bool HasBeginViewport;
     bool HasBeginFrame;
     int ViewportWidth;
     int ViewportHeight;
+    int RenderWidth;      // rendered area of the world frame buffers, at most the viewport size
+    int RenderHeight;
+    int SSAOWidth;        // size of the reduced resolution SSAO buffer, zero if SSAO is off
+    int SSAOHeight;
+    int SSAORenderWidth;  // rendered area of the reduced resolution SSAO buffer
+    int SSAORenderHeight;
+    bool IsDynamicResolutionEnabled;
+    bool IsRenderGraphDirty; // the render graph is declared again before the next frame
+    bool IsHDRUsed;          // the HDR color buffer is allocated
+    bool IsSSAOUsed;         // the SSAO buffers are allocated if SSAO is not off
     int RectBatchCtr;
     int RectBatchIndexCtr;
 
@@ -41,6 +75,10 @@ struct RenderContext
     TextureResources Textures;
     RenderPipeline DefaultRenderPipeline;
     LDRResult DefaultLDRResult;
+    SSAOQuality DefaultSSAOQuality;
+    DynamicResolution DefaultDynamicResolution;
+    Timer FrameTimer;
+    RenderGraph DefaultRenderGraph;
 
     RBuffer QuadVBO;
     RBuffer CubeVBO;
@@ -53,8 +91,14 @@ struct RenderContext
     ColorBuffer ColorBufferLDR;
     RectBatcher DefaultRectBatcher;
     RectGroup DefaultRectGroup;
+    RenderUICache UICache;
     ViewportGroup WorldViewportGroup;
     ViewportGroup ScreenViewportGroup;
+
+    // GBuffer meshes are split into chunks recorded on JobSystem workers,
+    // the skybox is recorded on the main thread while the workers are busy
+    Vector<RCommandList> GBufferCommandLists;
+    RCommandList SkyboxCommandList;
 };
 
 } // namespace LD
\ No newline at end of file
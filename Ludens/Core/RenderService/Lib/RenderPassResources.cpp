@@ -2,10 +2,11 @@
 
 namespace LD
 {
-void RenderPassResources::Startup(RDevice device)
+void RenderPassResources::Startup(RDevice device, GBufferLayout gbufferLayout)
 {
     LD_DEBUG_ASSERT(device);
     mDevice = device;
+    mGBufferLayout = gbufferLayout;
 }
 
 void RenderPassResources::Cleanup()
@@ -42,6 +43,7 @@ GBufferPass& RenderPassResources::GetGBufferPass()
     {
         GBufferPassInfo passI;
         passI.Device = mDevice;
+        passI.Layout = mGBufferLayout;
         passI.PositionFormat = RTextureFormat::RGBA16F;
         passI.NormalFormat = RTextureFormat::RGBA16F;
         passI.AlbedoFormat = RTextureFormat::RGBA8;
@@ -13,9 +13,17 @@ namespace LD
 class RenderPassResources : public RenderResources
 {
 public:
-    void Startup(RDevice device);
+    /// @brief startup render pass resources
+    /// @param gbufferLayout attachment layout of the geometry pass, every pipeline that
+    ///        reads or writes the GBuffer selects its shader variant from this layout
+    void Startup(RDevice device, GBufferLayout gbufferLayout = GBufferLayout::Standard);
     void Cleanup();
 
+    inline GBufferLayout GetGBufferLayout() const
+    {
+        return mGBufferLayout;
+    }
+
     RPass GetSwapChainRenderPass();
     GBufferPass& GetGBufferPass();
     SSAOPass& GetSSAOPass();
@@ -28,6 +36,7 @@ private:
     SSAOPass mSSAOPass;
     ColorPass mColorPassHDR;
     ColorPass mColorPassLDR;
+    GBufferLayout mGBufferLayout;
 };
 
 } // namespace LD
\ No newline at end of file
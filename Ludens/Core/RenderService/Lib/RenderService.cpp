@@ -1,11 +1,17 @@
+#include <algorithm>
 #include <unordered_map>
 #include <utility>
 #include "Core/Math/Include/Mat3.h"
 #include "Core/DSA/Include/Array.h"
 #include "Core/Application/Include/Application.h"
+#include "Core/OS/Include/JobSystem.h"
+#include "Core/RenderBase/Include/RCommandList.h"
 #include "Core/RenderBase/Include/RPipeline.h"
 #include "Core/RenderBase/Include/RShader.h"
 #include "Core/RenderFX/Include/RMesh.h"
+#include "Core/RenderFX/Include/LightCluster.h"
+#include "Core/RenderFX/Include/MeshLOD.h"
+#include "Core/RenderFX/Include/RenderGraph.h"
 #include "Core/RenderFX/Include/Groups/CubemapGroup.h"
 #include "Core/RenderFX/Include/Groups/ViewportGroup.h"
 #include "Core/RenderService/Lib/RenderPassResources.h"
@@ -51,20 +57,624 @@ struct ScreenDrawList : DrawList
     UIContext* UI = nullptr;
 };
 
+/// a contiguous range of meshes recorded into one GBuffer command list on a worker thread
+struct GBufferRecordJob
+{
+    RCommandList List;
+    RCommandListBeginInfo BeginInfo;
+    RPipeline Pipeline;
+    RPipeline QuantizedPipeline; // draws meshes with quantized vertices
+    RBindingGroup ViewportGroup;
+    RBindingGroup BindlessMaterialGroup; // bound once if valid, otherwise each batch binds its own material
+    MeshResource** Meshes;
+    const u32* LODs; // level of detail of each mesh
+    size_t MeshCount;
+};
+
+// do not split into chunks smaller than this, recording a handful of meshes is cheaper than a job
+#define GBUFFER_MIN_MESHES_PER_JOB 32
+
+// a coarser level of detail is drawn once its error covers less than this many pixels
+#define MESH_LOD_PIXEL_ERROR 1.0f
+
 static RDevice sDevice;
 static RRID sDirectionalLight;
 static FrameStaticLightingUBO sLightingUBO;
+static u32 sLightCount;                           // point and spot lights are dense in sLightingUBO.Lights
+static RRID sLightIDs[LD_MAX_LIGHTS];
+static std::unordered_map<RRID, u32> sLightIndices;
+static LightCluster sLightCluster;
+static RDrawStats sDrawStats;
 static std::unordered_map<RRID, MeshResource> sMeshes;
 static std::unordered_map<RRID, CubemapResource> sCubemaps;
 static Vector<WorldDrawList> sWorldDrawLists;
 static Vector<ScreenDrawList> sScreenDrawLists;
+static Vector<MeshResource*> sGBufferMeshes;
+static Vector<u32> sGBufferLODs;
+static Vector<Vec4> sInstanceData;
+static Vector<GBufferRecordJob> sGBufferJobs;
 
 static void RenderServiceCallback(const RResult& result)
 {
     LD_DEBUG_ASSERT(result.Type == RResultType::Ok);
 }
 
-void RenderService::Startup(RBackend backend)
+static void CreateLight(RRID& id, const LightData& light)
+{
+    LD_DEBUG_ASSERT(sLightCount < LD_MAX_LIGHTS);
+
+    id = GUID::Get();
+    sLightIDs[sLightCount] = id;
+    sLightIndices[id] = sLightCount;
+    sLightingUBO.Lights[sLightCount++] = light;
+}
+
+static void DeleteLight(RRID id)
+{
+    auto iter = sLightIndices.find(id);
+
+    if (iter == sLightIndices.end())
+        return;
+
+    // keep lights dense by moving the last light into the hole
+    u32 index = iter->second;
+    u32 last = --sLightCount;
+    sLightIndices.erase(iter);
+
+    if (index != last)
+    {
+        sLightingUBO.Lights[index] = sLightingUBO.Lights[last];
+        sLightIDs[index] = sLightIDs[last];
+        sLightIndices[sLightIDs[index]] = index;
+    }
+}
+
+static void RecordGBufferCommands(void* data)
+{
+    GBufferRecordJob& job = *(GBufferRecordJob*)data;
+    RCommandList& list = job.List;
+
+    list.Begin(job.BeginInfo);
+
+    bool isBindless = (bool)job.BindlessMaterialGroup;
+    RPipeline boundPipeline;
+    boundPipeline.ResetHandle();
+
+    for (size_t i = 0; i < job.MeshCount; i++)
+    {
+        MeshResource& res = *job.Meshes[i];
+        u32 batchIdx = 0;
+        u32 lod = job.LODs[i];
+
+        // the vertex layout of a mesh selects the pipeline, groups are bound again after a switch
+        RPipeline pipeline = res.Mesh.IsQuantized() ? job.QuantizedPipeline : job.Pipeline;
+        if (pipeline != boundPipeline)
+        {
+            list.SetPipeline(pipeline);
+            list.SetBindingGroup(0, job.ViewportGroup);
+
+            if (isBindless)
+                list.SetBindingGroup(1, job.BindlessMaterialGroup);
+
+            boundPipeline = pipeline;
+        }
+
+        res.Mesh.Draw(
+            [&](RMesh::Batch& batch)
+            {
+                if (!isBindless)
+                    list.SetBindingGroup(1, (RBindingGroup)batch.Material);
+
+                list.SetVertexBuffer(0, batch.Vertices);
+                list.SetVertexBuffer(1, res.InstanceTransforms);
+                list.SetIndexBuffer(batch.Indices, RIndexType::u32);
+
+                // each batch reads its own instance entry, which carries the material index
+                // batches with fewer levels draw their coarsest level
+                u32 level = std::min(lod, batch.LODCount - 1);
+
+                RDrawIndexedInfo info{};
+                info.IndexCount = batch.LODs[level].IndexCount;
+                info.IndexStart = batch.LODs[level].IndexStart;
+                info.LOD = level;
+                info.InstanceStart = batchIdx++;
+                info.InstanceCount = 1;
+                list.DrawIndexed(info);
+            });
+    }
+
+    list.End();
+}
+
+// geometry of world draw lists to the GBuffer, recorded on JobSystem workers
+static void GBufferRenderPass(void* data)
+{
+    RenderContext* ctx = (RenderContext*)data;
+
+    GBufferPass& gbufferPass = ctx->Passes.GetGBufferPass();
+    u32 colorCount = gbufferPass.GetColorAttachmentCount();
+
+    // clear values of color attachments followed by depth stencil attachment
+    Array<RClearValue, 4> clearValues;
+    for (u32 i = 0; i < colorCount; i++)
+        clearValues[i].Color = { 0.0f, 0.0f, 0.0f, 1.0f };
+    clearValues[colorCount].DepthStencil = { 1.0f, 0 };
+
+    RPassBeginInfo passBI;
+    passBI.RenderPass = (RPass)gbufferPass;
+    passBI.FrameBuffer = (RFrameBuffer)ctx->DefaultGBuffer;
+    passBI.ClearValues = { colorCount + 1, clearValues.Data() };
+    passBI.UseCommandLists = true;
+    passBI.RenderWidth = (u32)ctx->RenderWidth;
+    passBI.RenderHeight = (u32)ctx->RenderHeight;
+    sDevice.BeginRenderPass(passBI);
+
+    RCommandListBeginInfo listBI;
+    listBI.RenderPass = passBI.RenderPass;
+    listBI.FrameBuffer = passBI.FrameBuffer;
+    listBI.RenderWidth = passBI.RenderWidth;
+    listBI.RenderHeight = passBI.RenderHeight;
+
+    // TODO: one viewport group per draw list
+    LD_DEBUG_ASSERT(sWorldDrawLists.Size() <= 1);
+
+    for (WorldDrawList& list : sWorldDrawLists)
+    {
+        RBuffer& ubo = ctx->WorldViewportGroup.GetUBO();
+        ViewportUBO viewportData;
+        viewportData.ViewMat = list.ViewMat;
+        viewportData.ProjMat = list.ProjMat;
+        viewportData.ViewProjMat = list.ProjMat * list.ViewMat;
+        viewportData.InvProjMat = Mat4::Inverse(list.ProjMat);
+        viewportData.Size = { (float)ctx->RenderWidth, (float)ctx->RenderHeight };
+        viewportData.ViewPos = list.ViewPos;
+        ubo.SetData(0, sizeof(viewportData), &viewportData);
+
+        // buffer uploads stay on the main thread, workers only record commands
+        sGBufferMeshes.Clear();
+        sGBufferLODs.Clear();
+
+        for (auto& mesh : list.Meshes)
+        {
+            RRID id = mesh.first;
+            const Mat4& modelMat = mesh.second;
+            const Mat3 normalMat = Mat3::Transpose(Mat3::Inverse(Mat3(list.ViewMat * modelMat)));
+            MeshResource& res = sMeshes[id];
+
+            // quantized positions are mapped back into the mesh bounds by the model matrix
+            const Mat4 vertexMat = res.Mesh.IsQuantized() ? modelMat * res.Mesh.GetDequantizeMatrix() : modelMat;
+
+            Array<Vec4, 6> instanceData;
+            // 4x4 model matrix top 3 rows
+            instanceData[0] = { vertexMat[0][0], vertexMat[1][0], vertexMat[2][0], vertexMat[3][0] };
+            instanceData[1] = { vertexMat[0][1], vertexMat[1][1], vertexMat[2][1], vertexMat[3][1] };
+            instanceData[2] = { vertexMat[0][2], vertexMat[1][2], vertexMat[2][2], vertexMat[3][2] };
+            // 3x3 normal matrix columns
+            instanceData[3] = { normalMat[0], 0.0f };
+            instanceData[4] = { normalMat[1], 0.0f };
+            instanceData[5] = { normalMat[2], 0.0f };
+
+            // one instance entry per batch, the w component of the first normal matrix column
+            // holds the bindless material index of the batch
+            sInstanceData.Clear();
+            res.Mesh.Draw(
+                [&](RMesh::Batch& batch)
+                {
+                    instanceData[3].w = (float)batch.MaterialIndex;
+                    for (const Vec4& v : instanceData)
+                        sInstanceData.PushBack(v);
+                });
+
+            res.InstanceTransforms.SetData(0, sInstanceData.ByteSize(), sInstanceData.Data());
+            sGBufferMeshes.PushBack(&res);
+
+            // level of detail from the projected size of the bounding sphere in the rendered area
+            Vec3 center;
+            float radius;
+            res.Mesh.GetBoundingSphere(center, radius);
+
+            float scale = 0.0f;
+            for (int i = 0; i < 3; i++)
+                scale = std::max(scale, Vec3(modelMat[i].x, modelMat[i].y, modelMat[i].z).Length());
+
+            Vec4 viewCenter = list.ViewMat * modelMat * Vec4(center, 1.0f);
+            float screenRadius = GetMeshScreenRadius(Vec3(viewCenter.x, viewCenter.y, viewCenter.z), radius * scale,
+                                                     list.ProjMat, (float)ctx->RenderHeight);
+            sGBufferLODs.PushBack(SelectMeshLOD(res.Mesh.GetLODErrors(), res.Mesh.GetLODCount(), screenRadius, MESH_LOD_PIXEL_ERROR));
+        }
+
+        size_t meshCount = sGBufferMeshes.Size();
+        size_t listCount = ctx->GBufferCommandLists.Size();
+        size_t chunkSize = std::max<size_t>((meshCount + listCount - 1) / listCount, GBUFFER_MIN_MESHES_PER_JOB);
+        size_t jobCount = std::min<size_t>((meshCount + chunkSize - 1) / chunkSize, listCount);
+
+        // workers never wait on jobs, pending pipeline compile jobs are served before recording starts
+        JobSystem::GetSingleton().WaitType(JobType::CompilePipeline);
+
+        sGBufferJobs.Resize(jobCount);
+
+        for (size_t i = 0; i < jobCount; i++)
+        {
+            GBufferRecordJob& recordJob = sGBufferJobs[i];
+            recordJob.List = ctx->GBufferCommandLists[i];
+            recordJob.BeginInfo = listBI;
+            recordJob.Pipeline = (RPipeline)ctx->Pipelines.GetGBufferPipeline(false);
+            recordJob.QuantizedPipeline = (RPipeline)ctx->Pipelines.GetGBufferPipeline(true);
+            recordJob.ViewportGroup = (RBindingGroup)ctx->WorldViewportGroup;
+            recordJob.BindlessMaterialGroup.ResetHandle();
+            if (ctx->BindingGroups.HasBindlessMaterials())
+                recordJob.BindlessMaterialGroup = (RBindingGroup)ctx->BindingGroups.GetBindlessMaterialGroup();
+            recordJob.Meshes = sGBufferMeshes.Data() + i * chunkSize;
+            recordJob.LODs = sGBufferLODs.Data() + i * chunkSize;
+            recordJob.MeshCount = std::min(chunkSize, meshCount - i * chunkSize);
+
+            Job job;
+            job.Type = JobType::RecordCommands;
+            job.Main = &RecordGBufferCommands;
+            job.Data = &recordJob;
+            JobSystem::GetSingleton().Submit(job);
+        }
+
+        // assign lights to the clusters of this view, the binning jobs are waited on with WaitType,
+        // which holds back the record jobs still queued until light culling is done
+        sLightCluster.Build(list.ViewMat, list.ProjMat, sLightingUBO.Lights, sLightCount);
+        ctx->WorldViewportGroup.GetLightClusterUBO().SetData(0, sizeof(LightClusterUBO), &sLightCluster.GetClusterUBO());
+
+        u32 indexSize = sLightCluster.GetIndexUploadSize();
+        if (indexSize > 0)
+            ctx->WorldViewportGroup.GetLightIndexUBO().SetData(0, indexSize, &sLightCluster.GetIndexUBO());
+
+        // render skybox after meshes, recorded while the workers are busy
+        bool hasSkybox = false;
+        auto iter = sCubemaps.find(list.Cubemap);
+        if (iter != sCubemaps.end())
+        {
+            CubemapResource& res = iter->second;
+            RCommandList& skybox = ctx->SkyboxCommandList;
+            skybox.Begin(listBI);
+            skybox.SetPipeline((RPipeline)ctx->Pipelines.GetCubemapPipeline());
+            skybox.SetBindingGroup(0, (RBindingGroup)ctx->BindingGroups.GetFrameStaticGroup());
+            skybox.SetBindingGroup(1, (RBindingGroup)ctx->WorldViewportGroup);
+            skybox.SetBindingGroup(2, (RBindingGroup)res.CubemapBG);
+            skybox.SetVertexBuffer(0, ctx->CubeVBO);
+
+            RDrawVertexInfo info{};
+            info.VertexStart = 0;
+            info.VertexCount = 36;
+            skybox.DrawVertex(info);
+            skybox.End();
+            hasSkybox = true;
+        }
+
+        JobSystem::GetSingleton().WaitType(JobType::RecordCommands);
+
+        Vector<RCommandList> executeLists(jobCount);
+        for (size_t i = 0; i < jobCount; i++)
+            executeLists[i] = sGBufferJobs[i].List;
+
+        if (hasSkybox)
+            executeLists.PushBack(ctx->SkyboxCommandList);
+
+        sDevice.ExecuteCommandLists({ executeLists.Size(), executeLists.Data() });
+    }
+
+    sDevice.EndRenderPass();
+}
+
+// occlusion at the reduced resolution of the SSAO quality
+static void SSAORenderPass(void* data)
+{
+    RenderContext* ctx = (RenderContext*)data;
+
+    RPassBeginInfo passBI;
+    passBI.RenderPass = (RPass)ctx->Passes.GetSSAOPass();
+    passBI.FrameBuffer = (RFrameBuffer)ctx->DefaultSSAOBuffer;
+    passBI.RenderWidth = (u32)ctx->SSAORenderWidth;
+    passBI.RenderHeight = (u32)ctx->SSAORenderHeight;
+    sDevice.BeginRenderPass(passBI);
+
+    sDevice.SetPipeline((RPipeline)ctx->Pipelines.GetDeferredSSAOPipeline());
+    sDevice.SetBindingGroup(0, (RBindingGroup)ctx->WorldViewportGroup);
+    sDevice.SetBindingGroup(1, (RBindingGroup)ctx->BindingGroups.GetSSAOGroup());
+    sDevice.SetVertexBuffer(0, ctx->QuadVBO);
+
+    RDrawVertexInfo drawInfo{};
+    drawInfo.VertexCount = 6;
+    sDevice.DrawVertex(drawInfo);
+
+    sDevice.EndRenderPass();
+}
+
+// blurred occlusion, upsampled to render resolution
+static void SSAOBlurRenderPass(void* data)
+{
+    RenderContext* ctx = (RenderContext*)data;
+
+    RPassBeginInfo passBI;
+    passBI.RenderPass = (RPass)ctx->Passes.GetSSAOPass();
+    passBI.FrameBuffer = (RFrameBuffer)ctx->DefaultSSAOBlurBuffer;
+    passBI.RenderWidth = (u32)ctx->RenderWidth;
+    passBI.RenderHeight = (u32)ctx->RenderHeight;
+    sDevice.BeginRenderPass(passBI);
+
+    sDevice.SetPipeline((RPipeline)ctx->Pipelines.GetSSAOBlurPipeline());
+    sDevice.SetBindingGroup(0, (RBindingGroup)ctx->WorldViewportGroup);
+    sDevice.SetBindingGroup(1, (RBindingGroup)ctx->BindingGroups.GetSSAOGroup());
+    sDevice.SetVertexBuffer(0, ctx->QuadVBO);
+
+    RDrawVertexInfo drawInfo{};
+    drawInfo.VertexCount = 6;
+    sDevice.DrawVertex(drawInfo);
+
+    sDevice.EndRenderPass();
+}
+
+// deferred lighting to the HDR color buffer
+static void DeferredLightingRenderPass(void* data)
+{
+    RenderContext* ctx = (RenderContext*)data;
+
+    RPassBeginInfo passBI;
+    passBI.RenderPass = (RPass)ctx->Passes.GetColorPassHDR();
+    passBI.FrameBuffer = (RFrameBuffer)ctx->ColorBufferHDR;
+    passBI.RenderWidth = (u32)ctx->RenderWidth;
+    passBI.RenderHeight = (u32)ctx->RenderHeight;
+    sDevice.BeginRenderPass(passBI);
+
+    if (ctx->DefaultRenderPipeline == RenderPipeline::BRDF)
+        sDevice.SetPipeline((RPipeline)ctx->Pipelines.GetDeferredBRDFPipeline());
+    else    
+        sDevice.SetPipeline((RPipeline)ctx->Pipelines.GetDeferredBlinnPhongPipeline());
+
+    sDevice.SetBindingGroup(0, (RBindingGroup)ctx->BindingGroups.GetFrameStaticGroup());
+    sDevice.SetBindingGroup(1, (RBindingGroup)ctx->WorldViewportGroup);
+    sDevice.SetVertexBuffer(0, ctx->QuadVBO);
+
+    RDrawVertexInfo drawInfo{};
+    drawInfo.VertexCount = 6;
+    sDevice.DrawVertex(drawInfo);
+
+    sDevice.EndRenderPass();
+}
+
+// tone mapping to the LDR color buffer followed by screen space objects
+static void ScreenRenderPass(void* data)
+{
+    RenderContext* ctx = (RenderContext*)data;
+
+    RPassBeginInfo passBI;
+    passBI.RenderPass = (RPass)ctx->Passes.GetColorPassLDR();
+    passBI.FrameBuffer = (RFrameBuffer)ctx->ColorBufferLDR;
+    sDevice.BeginRenderPass(passBI);
+
+    ToneMappingGroup& toneGroup = ctx->BindingGroups.GetToneMappingGroup();
+    RBuffer toneUBO = toneGroup.GetUBO();
+
+    ToneMappingUBO toneUBOData;
+    toneUBOData.LDRResult = (int)ctx->DefaultLDRResult;
+    toneUBO.SetData(0, sizeof(ToneMappingUBO), &toneUBOData);
+
+    // tone mapping, the HDR texture should already be bound in the ScreenViewportGroup,
+    // world passes rendered at a reduced resolution are upscaled to the viewport
+    sDevice.SetPipeline((RPipeline)ctx->Pipelines.GetToneMappingPipeline());
+    sDevice.SetBindingGroup(0, (RBindingGroup)ctx->BindingGroups.GetFrameStaticGroup());
+    sDevice.SetBindingGroup(1, (RBindingGroup)ctx->WorldViewportGroup);
+    sDevice.SetBindingGroup(2, (RBindingGroup)ctx->ScreenViewportGroup);
+    sDevice.SetBindingGroup(3, (RBindingGroup)ctx->BindingGroups.GetToneMappingGroup());
+    sDevice.SetVertexBuffer(0, ctx->QuadVBO);
+
+    RDrawVertexInfo drawInfo{};
+    drawInfo.VertexCount = 6;
+    sDevice.DrawVertex(drawInfo);
+
+    // TODO: one viewport group per draw list
+    LD_DEBUG_ASSERT(sScreenDrawLists.Size() <= 1);
+
+    ctx->UICache.Stats = {};
+
+    // Render Screen Space Objects
+    for (ScreenDrawList& list : sScreenDrawLists)
+    {
+        if (!list.UI)
+            continue;
+
+        RBuffer& ubo = ctx->ScreenViewportGroup.GetUBO();
+        ViewportUBO viewportData;
+        viewportData.ViewMat = list.ViewMat;
+        viewportData.ProjMat = list.ProjMat;
+        viewportData.ViewProjMat = list.ProjMat * list.ViewMat;
+        viewportData.InvProjMat = Mat4::Inverse(list.ProjMat);
+        viewportData.Size = { (float)ctx->ViewportWidth, (float)ctx->ViewportHeight };
+        viewportData.ViewPos = list.ViewPos;
+        ubo.SetData(0, sizeof(viewportData), &viewportData);
+
+        sDevice.SetPipeline((RPipeline)ctx->Pipelines.GetRectPipeline());
+        sDevice.SetBindingGroup(0, (RBindingGroup)ctx->ScreenViewportGroup);
+        sDevice.SetBindingGroup(1, (RBindingGroup)ctx->DefaultRectGroup);
+        ctx->DefaultRectBatcher.Reset();
+
+        RenderUI(ctx, list.UI);
+
+        ctx->DefaultRectBatcher.Commit();
+    }
+
+    sDevice.EndRenderPass();
+}
+
+// copy the LDR result to the swapchain framebuffer with gamma correction
+static void SwapChainRenderPass(void* data)
+{
+    RenderContext* ctx = (RenderContext*)data;
+
+    RFrameBuffer swapChainFB;
+    RPass swapChainRP;
+    sDevice.GetSwapChainRenderPass(swapChainRP);
+    sDevice.GetSwapChainFrameBuffer(swapChainFB);
+
+    RClearValue clearColor;
+    clearColor.Color = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+    RPassBeginInfo passBI;
+    passBI.RenderPass = swapChainRP;
+    passBI.FrameBuffer = swapChainFB;
+    passBI.ClearValues = { 1, &clearColor };
+    sDevice.BeginRenderPass(passBI);
+
+    sDevice.SetPipeline((RPipeline)ctx->Pipelines.GetSwapChainTransferPipeline());
+    sDevice.SetBindingGroup(0, (RBindingGroup)ctx->BindingGroups.GetFrameStaticGroup());
+    sDevice.SetBindingGroup(1, (RBindingGroup)ctx->ScreenViewportGroup);
+    sDevice.SetVertexBuffer(0, ctx->QuadVBO);
+
+    RDrawVertexInfo drawInfo{};
+    drawInfo.VertexCount = 6;
+    sDevice.DrawVertex(drawInfo);
+
+    sDevice.EndRenderPass();
+}
+
+static RenderGraphResource AddGraphTarget(RenderGraph& graph, const char* name, RTextureFormat format, int width, int height)
+{
+    RenderGraphResourceInfo resourceI;
+    resourceI.Name = name;
+    resourceI.Format = format;
+    resourceI.Width = (u32)width;
+    resourceI.Height = (u32)height;
+
+    return graph.AddResource(resourceI);
+}
+
+static RenderGraphPass AddGraphPass(RenderGraph& graph, const char* name, void (*main)(void*), RenderContext* ctx)
+{
+    RenderGraphPassInfo passI;
+    passI.Name = name;
+    passI.Main = main;
+    passI.Data = ctx;
+
+    return graph.AddPass(passI);
+}
+
+/// declare the passes of a frame, passes that do not contribute to the current LDR result are culled
+/// and the targets only they use are released
+static void BuildRenderGraph(RenderContext* ctx)
+{
+    RenderGraph& graph = ctx->DefaultRenderGraph;
+    graph.Reset();
+
+    GBufferPass& gbufferPass = ctx->Passes.GetGBufferPass();
+    bool isCompact = gbufferPass.GetLayout() == GBufferLayout::Compact;
+    bool hasSSAO = ctx->DefaultSSAOQuality != SSAOQuality::Off;
+    int vw = ctx->ViewportWidth;
+    int vh = ctx->ViewportHeight;
+
+    // GBuffer attachments, position is reconstructed from depth under the compact layout
+    RenderGraphResource position = LD_RENDER_GRAPH_NONE;
+    if (!isCompact)
+        position = AddGraphTarget(graph, "Position", gbufferPass.GetPositionFormat(), vw, vh);
+    RenderGraphResource normals = AddGraphTarget(graph, "Normals", gbufferPass.GetNormalFormat(), vw, vh);
+    RenderGraphResource albedo = AddGraphTarget(graph, "Albedo", gbufferPass.GetAlbedoFormat(), vw, vh);
+    RenderGraphResource depth = AddGraphTarget(graph, "Depth", gbufferPass.GetDepthStencilFormat(), vw, vh);
+    RenderGraphResource geometry = isCompact ? depth : position;
+
+    RenderGraphResource ssao = LD_RENDER_GRAPH_NONE;
+    RenderGraphResource ssaoBlur = LD_RENDER_GRAPH_NONE;
+    if (hasSSAO)
+    {
+        ssao = AddGraphTarget(graph, "SSAO", RTextureFormat::R8, ctx->SSAOWidth, ctx->SSAOHeight);
+        ssaoBlur = AddGraphTarget(graph, "SSAOBlur", RTextureFormat::R8, vw, vh);
+    }
+
+    RenderGraphResource hdr = AddGraphTarget(graph, "HDR", ctx->Passes.GetColorPassHDR().GetColorFormat(), vw, vh);
+    RenderGraphResource ldr = AddGraphTarget(graph, "LDR", ctx->Passes.GetColorPassLDR().GetColorFormat(), vw, vh);
+
+    RenderGraphResourceInfo swapChainI;
+    swapChainI.Name = "SwapChain";
+    swapChainI.Format = ctx->Passes.GetSwapChainRenderPass().GetAttachment(0).Format;
+    swapChainI.Width = (u32)vw;
+    swapChainI.Height = (u32)vh;
+    swapChainI.IsImported = true;
+    swapChainI.FinalState = RState::Present;
+    RenderGraphResource swapChain = graph.AddResource(swapChainI);
+    graph.AddOutput(swapChain);
+
+    // writes follow the attachment order of the render passes
+    RenderGraphPass gbuffer = AddGraphPass(graph, "GBuffer", &GBufferRenderPass, ctx);
+    if (!isCompact)
+        graph.AddWrite(gbuffer, position);
+    graph.AddWrite(gbuffer, normals);
+    graph.AddWrite(gbuffer, albedo);
+    graph.AddWrite(gbuffer, depth);
+
+    RenderGraphPass ssaoPass = LD_RENDER_GRAPH_NONE;
+    RenderGraphPass ssaoBlurPass = LD_RENDER_GRAPH_NONE;
+    if (hasSSAO)
+    {
+        ssaoPass = AddGraphPass(graph, "SSAO", &SSAORenderPass, ctx);
+        graph.AddRead(ssaoPass, geometry);
+        graph.AddRead(ssaoPass, normals);
+        graph.AddWrite(ssaoPass, ssao);
+
+        ssaoBlurPass = AddGraphPass(graph, "SSAOBlur", &SSAOBlurRenderPass, ctx);
+        graph.AddRead(ssaoBlurPass, ssao);
+        graph.AddRead(ssaoBlurPass, geometry);
+        graph.AddWrite(ssaoBlurPass, ssaoBlur);
+    }
+
+    RenderGraphPass lighting = AddGraphPass(graph, "DeferredLighting", &DeferredLightingRenderPass, ctx);
+    graph.AddRead(lighting, geometry);
+    graph.AddRead(lighting, normals);
+    graph.AddRead(lighting, albedo);
+    if (hasSSAO)
+        graph.AddRead(lighting, ssaoBlur);
+    graph.AddWrite(lighting, hdr);
+
+    // the tone mapping shader samples the GBuffer for debug results, the HDR result
+    // is only sampled when it is tone mapped
+    RenderGraphPass screen = AddGraphPass(graph, "Screen", &ScreenRenderPass, ctx);
+    graph.AddRead(screen, geometry);
+    graph.AddRead(screen, normals);
+    graph.AddRead(screen, albedo);
+    if (ctx->DefaultLDRResult == LDRResult::ToneMappedReinhard)
+        graph.AddRead(screen, hdr);
+    graph.AddWrite(screen, ldr);
+
+    RenderGraphPass swapChainPass = AddGraphPass(graph, "SwapChain", &SwapChainRenderPass, ctx);
+    graph.AddRead(swapChainPass, ldr);
+    graph.AddWrite(swapChainPass, swapChain);
+
+    graph.Compile();
+
+#ifndef NDEBUG
+    // transitions are baked into the render passes, they must agree with the transitions of the graph
+    RPass bakedPasses[] = {
+        (RPass)gbufferPass,
+        (RPass)ctx->Passes.GetSSAOPass(),
+        (RPass)ctx->Passes.GetSSAOPass(),
+        (RPass)ctx->Passes.GetColorPassHDR(),
+        (RPass)ctx->Passes.GetColorPassLDR(),
+        ctx->Passes.GetSwapChainRenderPass(),
+    };
+    RenderGraphPass graphPasses[] = { gbuffer, ssaoPass, ssaoBlurPass, lighting, screen, swapChainPass };
+
+    for (int i = 0; i < (int)(sizeof(graphPasses) / sizeof(*graphPasses)); i++)
+    {
+        if (graphPasses[i] == LD_RENDER_GRAPH_NONE || graph.IsPassCulled(graphPasses[i]))
+            continue;
+
+        const Vector<RPassAttachment>& attachments = graph.GetAttachments(graphPasses[i]);
+        LD_DEBUG_ASSERT(bakedPasses[i].GetAttachmentCount() == (u32)attachments.Size());
+
+        for (u32 j = 0; j < (u32)attachments.Size(); j++)
+            LD_DEBUG_ASSERT(RenderGraph::IsAttachmentCompatible(bakedPasses[i].GetAttachment(j), attachments[j]));
+    }
+#endif
+
+    // targets are owned by the frame buffers of their render passes, so physical indices are not consumed.
+    // no two targets of this frame share a description with disjoint lifetimes, culled targets are released instead
+    ctx->UpdateTargets(graph.IsResourceUsed(hdr), hasSSAO && graph.IsResourceUsed(ssao));
+    ctx->IsRenderGraphDirty = false;
+}
+
+void RenderService::Startup(RBackend backend, bool compactGBuffer)
 {
     int width, height;
     auto& app = Application::GetSingleton();
@@ -76,7 +686,7 @@ void RenderService::Startup(RBackend backend)
     CreateRenderDevice(sDevice, deviceI);
 
     mCtx = new RenderContext();
-    mCtx->Startup(sDevice, width, height);
+    mCtx->Startup(sDevice, width, height, compactGBuffer ? GBufferLayout::Compact : GBufferLayout::Standard);
 }
 
 void RenderService::Cleanup()
@@ -100,7 +710,40 @@ void RenderService::SetDefaultRenderPipeline(RenderPipeline pipeline)
 
 void RenderService::SetLDRResult(LDRResult result)
 {
+    if (mCtx->DefaultLDRResult == result)
+        return;
+
+    // debug results do not sample the HDR color buffer
     mCtx->DefaultLDRResult = result;
+    mCtx->IsRenderGraphDirty = true;
+}
+
+void RenderService::SetSSAOQuality(SSAOQuality quality)
+{
+    mCtx->SetSSAOQuality(quality);
+}
+
+void RenderService::SetDynamicResolution(bool enabled, float targetFrameTime)
+{
+    mCtx->SetDynamicResolution(enabled, targetFrameTime);
+}
+
+void RenderService::GetDrawStats(RDrawStats& stats)
+{
+    stats = sDrawStats;
+}
+
+void RenderService::GetUIStats(RenderUIStats& stats)
+{
+    stats = mCtx->UICache.Stats;
+}
+
+float RenderService::GetRenderScale()
+{
+    if (!mCtx->IsDynamicResolutionEnabled)
+        return 1.0f;
+
+    return mCtx->DefaultDynamicResolution.GetScale();
 }
 
 void RenderService::BeginFrame()
@@ -115,14 +758,26 @@ void RenderService::BeginFrame()
     {
         OnViewportResize(width, height);
     }
+    else if (mCtx->IsDynamicResolutionEnabled)
+    {
+        // the interval between frames includes waiting for the swapchain,
+        // the render scale of this frame follows the previous frame time
+        mCtx->DefaultDynamicResolution.Update((float)mCtx->FrameTimer.GetSeconds());
+        mCtx->FrameTimer.Start();
+        mCtx->UpdateRenderExtent();
+    }
 
     sWorldDrawLists.Clear();
     sScreenDrawLists.Clear();
 
-    // upload frame static data
+    // upload frame static data, only the lights in use
     FrameStaticGroup& group = mCtx->BindingGroups.GetFrameStaticGroup();
     RBuffer ubo = group.GetLightingUBO();
-    ubo.SetData(0, sizeof(sLightingUBO), &sLightingUBO);
+    ubo.SetData(0, sizeof(DirectionalLightData) + sizeof(LightData) * sLightCount, &sLightingUBO);
+
+    // passes and targets of the frame change with the viewport size, SSAO quality and LDR result
+    if (mCtx->IsRenderGraphDirty)
+        BuildRenderGraph(mCtx);
 
     sDevice.BeginFrame();
 
@@ -133,14 +788,11 @@ void RenderService::EndFrame()
 {
     mCtx->HasBeginFrame = false;
 
-    // Render world space objects to HDR color buffer
-    WorldRenderPasses();
-
-    // Tone mapping to LDR and render screen space objects
-    ScreenRenderPasses();
-
-    // Copy results to SwapChain FrameBuffer with gamma correction.
-    SwapChainRenderPasses();
+    // world passes to the HDR color buffer, tone mapping and screen space objects to the LDR
+    // color buffer, then the LDR result is copied to the swapchain framebuffer
+    sDevice.BeginDrawStats(&sDrawStats);
+    mCtx->DefaultRenderGraph.Execute();
+    sDevice.EndDrawStats();
 
     sDevice.EndFrame();
 }
@@ -218,7 +870,7 @@ void RenderService::DeleteCubemap(RRID id)
     sCubemaps.erase(iter);
 }
 
-void RenderService::CreateMesh(RRID& id, Ref<Model> model)
+void RenderService::CreateMesh(RRID& id, Ref<Model> model, bool quantizeVertices)
 {
     id = CUID<MeshResource>::Get();
     LD_DEBUG_ASSERT(sMeshes.find(id) == sMeshes.end());
@@ -229,13 +881,18 @@ void RenderService::CreateMesh(RRID& id, Ref<Model> model)
     meshI.Device = sDevice;
     meshI.MaterialBGL = mCtx->BindingGroups.GetMaterialBGL();
     meshI.Data = model;
+    meshI.QuantizeVertices = quantizeVertices;
+
+    if (mCtx->BindingGroups.HasBindlessMaterials())
+        meshI.BindlessMaterials = &mCtx->BindingGroups.GetBindlessMaterialGroup();
+
     res.Mesh.Startup(meshI);
 
-    // store model matrix and normal matrix of one instance
+    // store model matrix and normal matrix of one instance, repeated for each batch with its material index
     RBufferInfo bufferI;
     bufferI.MemoryUsage = RMemoryUsage::FrameDynamic;
     bufferI.Type = RBufferType::VertexBuffer;
-    bufferI.Size = sizeof(Vec4) * 6;
+    bufferI.Size = sizeof(Vec4) * 6 * (u32)res.Mesh.GetBatchCount();
     bufferI.Data = nullptr;
     sDevice.CreateBuffer(res.InstanceTransforms, bufferI);
 }
@@ -268,266 +925,60 @@ void RenderService::DeleteDirectionalLight(RRID id)
     sDirectionalLight = 0;
 }
 
-void RenderService::DrawMesh(RRID id, const Mat4& transform)
+void RenderService::CreatePointLight(RRID& id, const Vec3& position, const Vec3& color, float radius)
 {
-    LD_DEBUG_ASSERT(mCtx->HasBeginViewport);
-    LD_DEBUG_ASSERT(sMeshes.find(id) != sMeshes.end());
+    // a cone that covers every direction
+    LightData light;
+    light.PosRadius = { position, radius };
+    light.Color = { color, -1.0f };
+    light.Dir = { Vec3::Zero, -1.0f };
 
-    sWorldDrawLists.Back().Meshes.PushBack({ id, transform });
+    CreateLight(id, light);
 }
 
-void RenderService::DrawScreenUI(UIContext* ui)
+void RenderService::DeletePointLight(RRID id)
 {
-    LD_DEBUG_ASSERT(mCtx->HasBeginViewport);
-
-    sScreenDrawLists.Back().UI = ui;
+    DeleteLight(id);
 }
 
-void RenderService::OnViewportResize(int width, int height)
+void RenderService::CreateSpotLight(RRID& id, const Vec3& position, const Vec3& direction, const Vec3& color,
+                                    float radius, Degrees innerAngle, Degrees outerAngle)
 {
-    printf("RenderService::OnViewportResize(%d,%d)\n", width, height);
+    LD_DEBUG_ASSERT(innerAngle <= outerAngle && outerAngle < 90.0f);
 
-    mCtx->OnViewportResize(width, height);
+    LightData light;
+    light.PosRadius = { position, radius };
+    light.Color = { color, LD_MATH_COS((float)innerAngle.ToRadians()) };
+    light.Dir = { direction.Normalized(), LD_MATH_COS((float)outerAngle.ToRadians()) };
+
+    CreateLight(id, light);
 }
 
-void RenderService::WorldRenderPasses()
+void RenderService::DeleteSpotLight(RRID id)
 {
-    // GBuffer Pass
-    {
-        Array<RClearValue, 4> clearValues;
-        clearValues[0].Color = { 0.0f, 0.0f, 0.0f, 1.0f };
-        clearValues[1].Color = { 0.0f, 0.0f, 0.0f, 1.0f };
-        clearValues[2].Color = { 0.0f, 0.0f, 0.0f, 1.0f };
-        clearValues[3].DepthStencil = { 1.0f, 0 };
-
-        RPassBeginInfo passBI;
-        passBI.RenderPass = (RPass)mCtx->Passes.GetGBufferPass();
-        passBI.FrameBuffer = (RFrameBuffer)mCtx->DefaultGBuffer;
-        passBI.ClearValues = clearValues.GetView();
-        sDevice.BeginRenderPass(passBI);
-
-        sDevice.SetPipeline((RPipeline)mCtx->Pipelines.GetGBufferPipeline());
-        sDevice.SetBindingGroup(0, (RBindingGroup)mCtx->WorldViewportGroup);
-
-        // TODO: one viewport group per draw list
-        LD_DEBUG_ASSERT(sWorldDrawLists.Size() <= 1);
-
-        for (WorldDrawList& list : sWorldDrawLists)
-        {
-            RBuffer& ubo = mCtx->WorldViewportGroup.GetUBO();
-            ViewportUBO viewportData;
-            viewportData.PointLightStart = 0;
-            viewportData.PointLightCount = 0;
-            viewportData.ViewMat = list.ViewMat;
-            viewportData.ProjMat = list.ProjMat;
-            viewportData.ViewProjMat = list.ProjMat * list.ViewMat;
-            viewportData.Size = { (float)mCtx->ViewportWidth, (float)mCtx->ViewportHeight };
-            viewportData.ViewPos = list.ViewPos;
-            ubo.SetData(0, sizeof(viewportData), &viewportData);
-
-            for (auto& mesh : list.Meshes)
-            {
-                RRID id = mesh.first;
-                const Mat4& modelMat = mesh.second;
-                const Mat3 normalMat = Mat3::Transpose(Mat3::Inverse(Mat3(list.ViewMat * modelMat)));
-                MeshResource& res = sMeshes[id];
-
-                Array<Vec4, 6> instanceData;
-                // 4x4 model matrix top 3 rows
-                instanceData[0] = { modelMat[0][0], modelMat[1][0], modelMat[2][0], modelMat[3][0] };
-                instanceData[1] = { modelMat[0][1], modelMat[1][1], modelMat[2][1], modelMat[3][1] };
-                instanceData[2] = { modelMat[0][2], modelMat[1][2], modelMat[2][2], modelMat[3][2] };
-                // 3x3 normal matrix columns
-                instanceData[3] = { normalMat[0], 0.0f };
-                instanceData[4] = { normalMat[1], 0.0f };
-                instanceData[5] = { normalMat[2], 0.0f };
-
-                res.InstanceTransforms.SetData(0, instanceData.ByteSize(), instanceData.Data());
-
-                res.Mesh.Draw(
-                    [&](RMesh::Batch& batch)
-                    {
-                        sDevice.SetBindingGroup(1, (RBindingGroup)batch.Material);
-                        sDevice.SetVertexBuffer(0, batch.Vertices);
-                        sDevice.SetVertexBuffer(1, res.InstanceTransforms);
-                        sDevice.SetIndexBuffer(batch.Indices, RIndexType::u32);
-
-                        RDrawIndexedInfo info{};
-                        info.IndexCount = batch.IndexCount;
-                        info.InstanceStart = 0;
-                        info.InstanceCount = 1;
-                        sDevice.DrawIndexed(info);
-                    });
-            }
-
-            // render skybox after meshes
-            auto iter = sCubemaps.find(list.Cubemap);
-            if (iter != sCubemaps.end())
-            {
-                CubemapResource& res = sCubemaps[list.Cubemap];
-                sDevice.SetPipeline((RPipeline)mCtx->Pipelines.GetCubemapPipeline());
-                sDevice.SetBindingGroup(0, (RBindingGroup)mCtx->BindingGroups.GetFrameStaticGroup());
-                sDevice.SetBindingGroup(1, (RBindingGroup)mCtx->WorldViewportGroup);
-                sDevice.SetBindingGroup(2, (RBindingGroup)res.CubemapBG);
-                sDevice.SetVertexBuffer(0, mCtx->CubeVBO);
-
-                RDrawVertexInfo info{};
-                info.VertexStart = 0;
-                info.VertexCount = 36;
-                sDevice.DrawVertex(info);
-            }
-        }
-
-        sDevice.EndRenderPass();
-    }
-
-    // SSAO pass
-    {
-        RPassBeginInfo passBI;
-        passBI.RenderPass = (RPass)mCtx->Passes.GetSSAOPass();
-        passBI.FrameBuffer = (RFrameBuffer)mCtx->DefaultSSAOBuffer;
-        sDevice.BeginRenderPass(passBI);
-
-        sDevice.SetPipeline((RPipeline)mCtx->Pipelines.GetDeferredSSAOPipeline());
-        sDevice.SetBindingGroup(0, (RBindingGroup)mCtx->WorldViewportGroup);
-        sDevice.SetBindingGroup(1, (RBindingGroup)mCtx->BindingGroups.GetSSAOGroup());
-        sDevice.SetVertexBuffer(0, mCtx->QuadVBO);
-
-        RDrawVertexInfo drawInfo{};
-        drawInfo.VertexCount = 6;
-        sDevice.DrawVertex(drawInfo);
-
-        sDevice.EndRenderPass();
-    }
-
-    // SSAO blur pass
-    {
-        RPassBeginInfo passBI;
-        passBI.RenderPass = (RPass)mCtx->Passes.GetSSAOPass();
-        passBI.FrameBuffer = (RFrameBuffer)mCtx->DefaultSSAOBlurBuffer;
-        sDevice.BeginRenderPass(passBI);
-
-        sDevice.SetPipeline((RPipeline)mCtx->Pipelines.GetSSAOBlurPipeline());
-        sDevice.SetBindingGroup(0, (RBindingGroup)mCtx->WorldViewportGroup);
-        sDevice.SetBindingGroup(1, (RBindingGroup)mCtx->BindingGroups.GetSSAOGroup());
-        sDevice.SetVertexBuffer(0, mCtx->QuadVBO);
-
-        RDrawVertexInfo drawInfo{};
-        drawInfo.VertexCount = 6;
-        sDevice.DrawVertex(drawInfo);
-
-        sDevice.EndRenderPass();
-    }
-
-    // deferred lighting pass, render to HDR framebuffer
-    {
-        RPassBeginInfo passBI;
-        passBI.RenderPass = (RPass)mCtx->Passes.GetColorPassHDR();
-        passBI.FrameBuffer = (RFrameBuffer)mCtx->ColorBufferHDR;
-        sDevice.BeginRenderPass(passBI);
-
-        if (mCtx->DefaultRenderPipeline == RenderPipeline::BRDF)
-            sDevice.SetPipeline((RPipeline)mCtx->Pipelines.GetDeferredBRDFPipeline());
-        else    
-            sDevice.SetPipeline((RPipeline)mCtx->Pipelines.GetDeferredBlinnPhongPipeline());
-
-        sDevice.SetBindingGroup(0, (RBindingGroup)mCtx->BindingGroups.GetFrameStaticGroup());
-        sDevice.SetBindingGroup(1, (RBindingGroup)mCtx->WorldViewportGroup);
-        sDevice.SetVertexBuffer(0, mCtx->QuadVBO);
-
-        RDrawVertexInfo drawInfo{};
-        drawInfo.VertexCount = 6;
-        sDevice.DrawVertex(drawInfo);
-
-        sDevice.EndRenderPass();
-    }
+    DeleteLight(id);
 }
 
-void RenderService::ScreenRenderPasses()
+void RenderService::DrawMesh(RRID id, const Mat4& transform)
 {
-    RPassBeginInfo passBI;
-    passBI.RenderPass = (RPass)mCtx->Passes.GetColorPassLDR();
-    passBI.FrameBuffer = (RFrameBuffer)mCtx->ColorBufferLDR;
-    sDevice.BeginRenderPass(passBI);
-
-    ToneMappingGroup& toneGroup = mCtx->BindingGroups.GetToneMappingGroup();
-    RBuffer toneUBO = toneGroup.GetUBO();
-
-    ToneMappingUBO toneUBOData;
-    toneUBOData.LDRResult = (int)mCtx->DefaultLDRResult;
-    toneUBO.SetData(0, sizeof(ToneMappingUBO), &toneUBOData);
-
-    // tone mapping, the HDR texture should already be bound in the ScreenViewportGroup
-    sDevice.SetPipeline((RPipeline)mCtx->Pipelines.GetToneMappingPipeline());
-    sDevice.SetBindingGroup(0, (RBindingGroup)mCtx->BindingGroups.GetFrameStaticGroup());
-    sDevice.SetBindingGroup(1, (RBindingGroup)mCtx->WorldViewportGroup);
-    sDevice.SetBindingGroup(2, (RBindingGroup)mCtx->ScreenViewportGroup);
-    sDevice.SetBindingGroup(3, (RBindingGroup)mCtx->BindingGroups.GetToneMappingGroup());
-    sDevice.SetVertexBuffer(0, mCtx->QuadVBO);
-
-    RDrawVertexInfo drawInfo{};
-    drawInfo.VertexCount = 6;
-    sDevice.DrawVertex(drawInfo);
-
-    // TODO: one viewport group per draw list
-    LD_DEBUG_ASSERT(sScreenDrawLists.Size() <= 1);
-
-    // Render Screen Space Objects
-    for (ScreenDrawList& list : sScreenDrawLists)
-    {
-        if (!list.UI)
-            continue;
-
-        RBuffer& ubo = mCtx->ScreenViewportGroup.GetUBO();
-        ViewportUBO viewportData;
-        viewportData.PointLightStart = 0;
-        viewportData.PointLightCount = 0;
-        viewportData.ViewMat = list.ViewMat;
-        viewportData.ProjMat = list.ProjMat;
-        viewportData.ViewProjMat = list.ProjMat * list.ViewMat;
-        viewportData.Size = { (float)mCtx->ViewportWidth, (float)mCtx->ViewportHeight };
-        viewportData.ViewPos = list.ViewPos;
-        ubo.SetData(0, sizeof(viewportData), &viewportData);
-
-        sDevice.SetPipeline((RPipeline)mCtx->Pipelines.GetRectPipeline());
-        sDevice.SetBindingGroup(0, (RBindingGroup)mCtx->ScreenViewportGroup);
-        sDevice.SetBindingGroup(1, (RBindingGroup)mCtx->DefaultRectGroup);
-        mCtx->DefaultRectBatcher.Reset();
-
-        RenderUI(mCtx, list.UI);
-
-        mCtx->DefaultRectBatcher.Commit();
-    }
+    LD_DEBUG_ASSERT(mCtx->HasBeginViewport);
+    LD_DEBUG_ASSERT(sMeshes.find(id) != sMeshes.end());
 
-    sDevice.EndRenderPass();
+    sWorldDrawLists.Back().Meshes.PushBack({ id, transform });
 }
 
-void RenderService::SwapChainRenderPasses()
+void RenderService::DrawScreenUI(UIContext* ui)
 {
-    RFrameBuffer swapChainFB;
-    RPass swapChainRP;
-    sDevice.GetSwapChainRenderPass(swapChainRP);
-    sDevice.GetSwapChainFrameBuffer(swapChainFB);
-
-    RClearValue clearColor;
-    clearColor.Color = { 0.0f, 0.0f, 0.0f, 1.0f };
-
-    RPassBeginInfo passBI;
-    passBI.RenderPass = swapChainRP;
-    passBI.FrameBuffer = swapChainFB;
-    passBI.ClearValues = { 1, &clearColor };
-    sDevice.BeginRenderPass(passBI);
+    LD_DEBUG_ASSERT(mCtx->HasBeginViewport);
 
-    sDevice.SetPipeline((RPipeline)mCtx->Pipelines.GetSwapChainTransferPipeline());
-    sDevice.SetBindingGroup(0, (RBindingGroup)mCtx->BindingGroups.GetFrameStaticGroup());
-    sDevice.SetBindingGroup(1, (RBindingGroup)mCtx->ScreenViewportGroup);
-    sDevice.SetVertexBuffer(0, mCtx->QuadVBO);
+    sScreenDrawLists.Back().UI = ui;
+}
 
-    RDrawVertexInfo drawInfo{};
-    drawInfo.VertexCount = 6;
-    sDevice.DrawVertex(drawInfo);
+void RenderService::OnViewportResize(int width, int height)
+{
+    printf("RenderService::OnViewportResize(%d,%d)\n", width, height);
 
-    sDevice.EndRenderPass();
+    mCtx->OnViewportResize(width, height);
 }
 
 } // namespace LD
\ No newline at end of file
@@ -12,34 +12,85 @@
 namespace LD
 {
 
-static void RenderUIWindow(RenderContext* ctx, UIWindow* window);
-static void RenderUIWidget(RenderContext* ctx, const Rect2D& rect, UIWidget* widget);
-static void RenderUIContainer(RenderContext* ctx, const Rect2D& rect, UIContainerWidget* widget);
-static void RenderUIScroll(RenderContext* ctx, const Rect2D& rect, UIScroll* scroll);
-static void RenderUILabel(RenderContext* ctx, const Rect2D& rect, UILabel* label);
-static void RenderUIPanel(RenderContext* ctx, const Rect2D& rect, UIPanel* panel);
-static void RenderUITexture(RenderContext* ctx, const Rect2D& rect, UITexture* texture);
-static void RenderUIButton(RenderContext* ctx, const Rect2D& rect, UIButton* button);
+static void RenderUIWindow(RenderUIWindowCache& cache, UIWindow* window);
+static void RenderUIWidget(RenderUIWindowCache& cache, const Rect2D& rect, UIWidget* widget);
+static void RenderUIContainer(RenderUIWindowCache& cache, const Rect2D& rect, UIContainerWidget* widget);
+static void RenderUIScroll(RenderUIWindowCache& cache, const Rect2D& rect, UIScroll* scroll);
+static void RenderUILabel(RenderUIWindowCache& cache, const Rect2D& rect, UILabel* label);
+static void RenderUIPanel(RenderUIWindowCache& cache, const Rect2D& rect, UIPanel* panel);
+static void RenderUITexture(RenderUIWindowCache& cache, const Rect2D& rect, UITexture* texture);
+static void RenderUIButton(RenderUIWindowCache& cache, const Rect2D& rect, UIButton* button);
+static void SubmitUIWindow(RenderContext* ctx, const RenderUIWindowCache& cache);
 
 void RenderUI(RenderContext* ctx, UIContext* ui)
 {
+    RenderUICache& uiCache = ctx->UICache;
+    u64 frame = ++uiCache.Frame;
+
     for (UIWindow* window : ui->GetWindows())
     {
-        RenderUIWindow(ctx, window);
+        // a window not seen before has its dirty flag set since startup
+        RenderUIWindowCache& cache = uiCache.Windows[window];
+
+        if (window->IsRenderDirty())
+        {
+            cache.Instances.Clear();
+            cache.Scissors.Clear();
+            RenderUIWindow(cache, window);
+            window->SetRenderDirty(false);
+            uiCache.Stats.RegeneratedWindowCount++;
+        }
+
+        cache.LastFrame = frame;
+        uiCache.Stats.WindowCount++;
+        uiCache.Stats.RectCount += (u32)cache.Instances.Size();
+
+        SubmitUIWindow(ctx, cache);
+    }
+
+    // release caches of windows that are no longer drawn
+    for (auto it = uiCache.Windows.begin(); it != uiCache.Windows.end();)
+    {
+        if (it->second.LastFrame != frame)
+            it = uiCache.Windows.erase(it);
+        else
+            ++it;
     }
 }
 
-static void RenderUIWindow(RenderContext* ctx, UIWindow* window)
+static void SubmitUIWindow(RenderContext* ctx, const RenderUIWindowCache& cache)
+{
+    RectBatcher& batcher = ctx->DefaultRectBatcher;
+    const RectInstance* instances = cache.Instances.Data();
+    int instanceStart = 0;
+
+    for (const RenderUIScissor& scissor : cache.Scissors)
+    {
+        batcher.AddInstances(instances + instanceStart, scissor.InstanceIndex - instanceStart);
+        batcher.Commit();
+        instanceStart = scissor.InstanceIndex;
+
+        if (scissor.IsPush)
+            ctx->Device.PushScissor(scissor.Rect);
+        else
+            ctx->Device.PopScissor();
+    }
+
+    batcher.AddInstances(instances + instanceStart, (int)cache.Instances.Size() - instanceStart);
+}
+
+static void RenderUIWindow(RenderUIWindowCache& cache, UIWindow* window)
 {
     Rect2D windowRect = window->GetWindowRect();
     Vec4 windowColor = window->GetColor();
-    RectBatcher& batcher = ctx->DefaultRectBatcher;
-    batcher.AddRectFilled(windowRect, windowColor);
+    cache.Instances.PushBack(GetRectFilledInstance(windowRect, windowColor));
 
     float border = window->GetBorder();
 
     Vec4 borderColor = Vec4::Lerp(windowColor, { 1.0f, 1.0f, 1.0f, windowColor.a }, 0.5f);
-    batcher.AddRectOutline(windowRect, borderColor, border);
+    size_t outlineIndex = cache.Instances.Size();
+    cache.Instances.Resize(outlineIndex + 4);
+    GetRectOutlineInstances(windowRect, borderColor, border, cache.Instances.Data() + outlineIndex);
 
     // render direct child of window
     for (UIWidget* widget : window->GetWidgets())
@@ -47,16 +98,16 @@ static void RenderUIWindow(RenderContext* ctx, UIWindow* window)
         Rect2D rect = widget->GetRect();
         rect.x += windowRect.x;
         rect.y += windowRect.y;
-        RenderUIWidget(ctx, rect, widget);
+        RenderUIWidget(cache, rect, widget);
     }
 }
 
-static void RenderUIWidget(RenderContext* ctx, const Rect2D& rect, UIWidget* widget)
+static void RenderUIWidget(RenderUIWindowCache& cache, const Rect2D& rect, UIWidget* widget)
 {
     if (widget->GetFlags() & UIWidget::IS_CONTAINER_BIT)
     {
         UIContainerWidget* container = static_cast<UIContainerWidget*>(widget);
-        RenderUIContainer(ctx, rect, container);
+        RenderUIContainer(cache, rect, container);
         return;
     }
 
@@ -64,37 +115,37 @@ static void RenderUIWidget(RenderContext* ctx, const Rect2D& rect, UIWidget* wid
     switch (type)
     {
     case UIType::Panel:
-        RenderUIPanel(ctx, rect, (UIPanel*)widget);
+        RenderUIPanel(cache, rect, (UIPanel*)widget);
         break;
     case UIType::Label:
-        RenderUILabel(ctx, rect, (UILabel*)widget);
+        RenderUILabel(cache, rect, (UILabel*)widget);
         break;
     case UIType::Button:
-        RenderUIButton(ctx, rect, (UIButton*)widget);
+        RenderUIButton(cache, rect, (UIButton*)widget);
         break;
     case UIType::Texture:
-        RenderUITexture(ctx, rect, (UITexture*)widget);
+        RenderUITexture(cache, rect, (UITexture*)widget);
         break;
     default:
         LD_DEBUG_UNREACHABLE;
     }
 }
 
-static void RenderUIContainer(RenderContext* ctx, const Rect2D& rect, UIContainerWidget* container)
+static void RenderUIContainer(RenderUIWindowCache& cache, const Rect2D& rect, UIContainerWidget* container)
 {
     UIType type = container->GetType();
     bool commitAndScissor = type == UIType::Scroll;
 
     if (commitAndScissor)
     {
-        ctx->DefaultRectBatcher.Commit();
-        ctx->Device.PushScissor(rect);
+        int instanceIndex = (int)cache.Instances.Size();
+        cache.Scissors.PushBack({ instanceIndex, true, rect });
     }
 
     switch (type)
     {
     case UIType::Scroll:
-        RenderUIScroll(ctx, rect, (UIScroll*)container);
+        RenderUIScroll(cache, rect, (UIScroll*)container);
         break;
     default:
         LD_DEBUG_UNREACHABLE;
@@ -105,38 +156,33 @@ static void RenderUIContainer(RenderContext* ctx, const Rect2D& rect, UIContaine
         Rect2D widgetRect = container->AdjustedRect(widget->GetRect());
         widgetRect.x += rect.x;
         widgetRect.y += rect.y;
-        RenderUIWidget(ctx, widgetRect, widget);
+        RenderUIWidget(cache, widgetRect, widget);
     }
 
     if (commitAndScissor)
     {
-        ctx->DefaultRectBatcher.Commit();
-        ctx->Device.PopScissor();
+        int instanceIndex = (int)cache.Instances.Size();
+        cache.Scissors.PushBack({ instanceIndex, false, rect });
     }
 }
 
-static void RenderUIScroll(RenderContext* ctx, const Rect2D& rect, UIScroll* scroll)
+static void RenderUIScroll(RenderUIWindowCache& cache, const Rect2D& rect, UIScroll* scroll)
 {
-    RectBatcher& batcher = ctx->DefaultRectBatcher;
-
     Vec4 color = Hex(0xCC2222FF);
-    batcher.AddRectFilled(rect, color);
+    cache.Instances.PushBack(GetRectFilledInstance(rect, color));
 }
 
-static void RenderUIPanel(RenderContext* ctx, const Rect2D& rect, UIPanel* panel)
+static void RenderUIPanel(RenderUIWindowCache& cache, const Rect2D& rect, UIPanel* panel)
 {
-    RectBatcher& batcher = ctx->DefaultRectBatcher;
-
-    batcher.AddRectFilled(rect, panel->GetColor());
+    cache.Instances.PushBack(GetRectFilledInstance(rect, panel->GetColor()));
 }
 
-static void RenderUILabel(RenderContext* ctx, const Rect2D& rect, UILabel* label)
+static void RenderUILabel(RenderUIWindowCache& cache, const Rect2D& rect, UILabel* label)
 {
     View<FontGlyphExt> glyphsExts = label->GetTextGlyphs();
     float scale = label->GetGlyphScale();
     UIFont* uiFont = label->GetFont();
     Ref<FontTTF> ttf = uiFont->GetTTF();
-    RectBatcher& batcher = ctx->DefaultRectBatcher;
 
     int ascent;
     ttf->GetVerticalMetrics(&ascent, nullptr, nullptr, nullptr);
@@ -148,26 +194,25 @@ static void RenderUILabel(RenderContext* ctx, const Rect2D& rect, UILabel* label
     label->GetColors(bgColor, fgColor);
 
     if (bgColor.a != 0.0f)
-        batcher.AddRectFilled(rect, bgColor);
+        cache.Instances.PushBack(GetRectFilledInstance(rect, bgColor));
 
     for (const FontGlyphExt& glyphExt : glyphsExts)
     {
-        batcher.AddGlyph(cursor + glyphExt.Offset, glyphExt, scale, fgColor, 1);
+        cache.Instances.PushBack(GetGlyphInstance(cursor + glyphExt.Offset, glyphExt, scale, fgColor, 1));
     }
 }
 
-static void RenderUIButton(RenderContext* ctx, const Rect2D& rect, UIButton* button)
+static void RenderUIButton(RenderUIWindowCache& cache, const Rect2D& rect, UIButton* button)
 {
     View<FontGlyphExt> glyphsExts = button->GetTextGlyphs();
     float scale = button->GetGlyphScale();
     UIFont* uiFont = button->GetFont();
     Ref<FontTTF> ttf = uiFont->GetTTF();
-    RectBatcher& batcher = ctx->DefaultRectBatcher;
 
     Vec4 bgColor, fgColor;
     button->GetColors(bgColor, fgColor);
 
-    batcher.AddRectFilled(rect, bgColor);
+    cache.Instances.PushBack(GetRectFilledInstance(rect, bgColor));
 
     int ascent;
     ttf->GetVerticalMetrics(&ascent, nullptr, nullptr, nullptr);
@@ -177,17 +222,15 @@ static void RenderUIButton(RenderContext* ctx, const Rect2D& rect, UIButton* but
 
     for (const FontGlyphExt& glyphExt : glyphsExts)
     {
-        batcher.AddGlyph(cursor + glyphExt.Offset, glyphExt, scale, fgColor, 1);
+        cache.Instances.PushBack(GetGlyphInstance(cursor + glyphExt.Offset, glyphExt, scale, fgColor, 1));
     }
 }
 
-static void RenderUITexture(RenderContext* ctx, const Rect2D& rect, UITexture* texture)
+static void RenderUITexture(RenderUIWindowCache& cache, const Rect2D& rect, UITexture* texture)
 {
-    RectBatcher& batcher = ctx->DefaultRectBatcher;
-
     Vec4 white(1.0f, 1.0f, 1.0f, 1.0f);
     Vec2 size(rect.w, rect.h);
-    batcher.AddTexture(rect, { 0.0f, 0.0f, rect.w, rect.h }, size, white, texture->GetTextureID());
+    cache.Instances.PushBack(GetTextureInstance(rect, { 0.0f, 0.0f, rect.w, rect.h }, size, white, texture->GetTextureID()));
 }
 
 } // namespace LD
\ No newline at end of file
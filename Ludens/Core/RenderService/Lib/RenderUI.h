@@ -1,11 +1,43 @@
 #pragma once
 
+#include <unordered_map>
+#include "Core/DSA/Include/Vector.h"
+#include "Core/Math/Include/Rect2D.h"
+#include "Core/RenderFX/Include/Pipelines/RectPipeline.h"
+#include "Core/RenderService/Include/RenderService.h"
+
 namespace LD
 {
 
 struct RenderContext;
 class UIContext;
+class UIWindow;
+
+/// a scissor change in between the rects of a window
+struct RenderUIScissor
+{
+    int InstanceIndex; // rects before this index are committed before the scissor changes
+    bool IsPush;       // push Rect as the scissor, otherwise pop the last scissor
+    Rect2D Rect;
+};
+
+/// rects generated for one window, replayed while the window is not dirty
+struct RenderUIWindowCache
+{
+    Vector<RectInstance> Instances;
+    Vector<RenderUIScissor> Scissors;
+    u64 LastFrame; // caches of windows not drawn in a frame are released
+};
+
+/// retained draw data of UI windows, stored across frames
+struct RenderUICache
+{
+    std::unordered_map<UIWindow*, RenderUIWindowCache> Windows;
+    RenderUIStats Stats;
+    u64 Frame = 0;
+};
 
+/// @brief draw the windows of a UI context, only windows marked dirty generate their rects again
 void RenderUI(RenderContext* ctx, UIContext* ui);
 
-} // namespace LD
\ No newline at end of file
+} // namespace LD
@@ -0,0 +1,134 @@
+#include <string>
+#include <cstring>
+#include <algorithm>
+#include <iostream>
+#include "Core/Serialize/Include/XML.h"
+#include "Core/Serialize/Include/XMLReader.h"
+#include "Core/OS/Include/Time.h"
+
+using namespace LD;
+
+// size of the generated document in MB, Doxygen output for a large code base is hundreds of MB
+#define BENCH_XML_MB 64
+
+// number of parses of the generated document
+#define BENCH_XML_PASSES 4
+
+// Doxygen style compound, indented and attribute heavy with short text nodes
+static void AppendCompound(std::string& xml, int id)
+{
+    std::string sid = std::to_string(id);
+
+    xml += "  <compounddef id=\"class_l_d_1_1_view" + sid + "\" kind=\"class\" language=\"C++\" prot=\"public\">\n";
+    xml += "    <compoundname>LD::View" + sid + "</compoundname>\n";
+    xml += "    <templateparamlist>\n      <param>\n        <type>typename T</type>\n      </param>\n    </templateparamlist>\n";
+    xml += "    <sectiondef kind=\"public-func\">\n";
+
+    for (int m = 0; m < 8; m++)
+    {
+        std::string mid = sid + "_" + std::to_string(m);
+        xml += "      <memberdef kind=\"function\" id=\"class_l_d_1_1_view_1a" + mid + "\" prot=\"public\" static=\"no\" const=\"yes\" explicit=\"no\" inline=\"yes\" virt=\"non-virtual\">\n";
+        xml += "        <type>size_t</type>\n";
+        xml += "        <definition>size_t LD::View&lt; T &gt;::Size" + mid + "</definition>\n";
+        xml += "        <argsstring>() const</argsstring>\n";
+        xml += "        <name>Size" + mid + "</name>\n";
+        xml += "        <qualifiedname>LD::View::Size" + mid + "</qualifiedname>\n";
+        xml += "        <briefdescription>\n<para>get the number of elements in the view, the view does not own the elements </para>\n        </briefdescription>\n";
+        xml += "        <detaileddescription>\n        </detaileddescription>\n";
+        xml += "        <location file=\"Ludens/Core/DSA/Include/View.h\" line=\"38\" column=\"9\" bodyfile=\"Ludens/Core/DSA/Include/View.h\" bodystart=\"38\" bodyend=\"41\"/>\n";
+        xml += "      </memberdef>\n";
+    }
+
+    xml += "    </sectiondef>\n  </compounddef>\n";
+}
+
+struct BenchSource
+{
+    const std::string* XML;
+    size_t Offset;
+};
+
+static size_t BenchRead(void* user, char* dst, size_t size)
+{
+    BenchSource* source = (BenchSource*)user;
+    size_t bytes = std::min(size, source->XML->size() - source->Offset);
+
+    memcpy(dst, source->XML->data() + source->Offset, bytes);
+    source->Offset += bytes;
+    return bytes;
+}
+
+// streaming reader over 64 KB chunks, the document is never resident as a whole
+static double BenchReader(const std::string& xml)
+{
+    double bestTime = 0.0;
+
+    for (int pass = 0; pass < BENCH_XML_PASSES; pass++)
+    {
+        BenchSource source{ &xml, 0 };
+        XMLReaderConfig config{};
+        XMLReader reader(config, &BenchRead, &source);
+        size_t events = 0;
+        XMLEvent event;
+        double time;
+
+        {
+            ScopeTimer timer(&time);
+
+            while ((event = reader.Next()) != XMLEvent::EndDocument && event != XMLEvent::Error)
+                events++;
+        }
+
+        if (event == XMLEvent::Error)
+        {
+            std::cout << "read failed" << std::endl;
+            return 0.0;
+        }
+
+        if (pass == 0 || time < bestTime)
+            bestTime = time;
+    }
+
+    return bestTime;
+}
+
+int main()
+{
+    std::string xml = "<?xml version='1.0' encoding='UTF-8' standalone='no'?>\n<doxygen version=\"1.9.8\" xml:lang=\"en-US\">\n";
+    const size_t targetSize = (size_t)BENCH_XML_MB * 1024 * 1024;
+
+    for (int id = 0; xml.size() < targetSize; id++)
+        AppendCompound(xml, id);
+
+    xml += "</doxygen>\n";
+
+    double mb = (double)xml.size() / (1024.0 * 1024.0);
+    double bestTime = 0.0;
+
+    for (int pass = 0; pass < BENCH_XML_PASSES; pass++)
+    {
+        XMLParserConfig config{};
+        XMLParser parser(config);
+        Ref<XMLDocument> doc;
+        double time;
+
+        {
+            ScopeTimer timer(&time);
+            doc = parser.ParseString(xml.data(), xml.size());
+        }
+
+        if (!doc)
+        {
+            std::cout << "parse failed" << std::endl;
+            return 1;
+        }
+
+        if (pass == 0 || time < bestTime)
+            bestTime = time;
+    }
+
+    std::cout << "XML parse " << mb << " MB, " << bestTime << " ms, " << mb / (bestTime / 1000.0) << " MB/s" << std::endl;
+
+    bestTime = BenchReader(xml);
+    std::cout << "XML reader " << mb << " MB, " << bestTime << " ms, " << mb / (bestTime / 1000.0) << " MB/s" << std::endl;
+}
@@ -191,12 +191,19 @@ private:
     /// @return number of parsed attributes
     int ParseAttributes(XMLDocument& doc, XMLAttribute** frist, XMLAttribute** last);
 
+    /// @brief byte at an offset from the cursor
+    /// @return the byte, or '\0' past the end of the document
+    inline char Peek(size_t offset = 0) const
+    {
+        return mCursor + offset < mXMLSize ? mXML[mCursor + offset] : '\0';
+    }
+
     Stack<XMLTag> mTagStack;
     XMLParserConfig mConfig;
     XMLElement* mElement;
     const char* mXML;
     size_t mXMLSize;
-    int mCursor;
+    size_t mCursor;
 };
 
 class XMLNode
@@ -287,6 +294,7 @@ private:
     void FreeNode(XMLNode* node);
 
     Vector<NodeAllocator> mPages;
+    size_t mPageHint = 0; // index of the first page that may have free nodes
     XMLElement* mHeader = nullptr;
     XMLNode* mFirstChild = nullptr;
     XMLNode* mLastChild = nullptr;
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "Core/Serialize/Include/XML.h"
+
+namespace LD {
+
+enum class XMLEvent
+{
+    /// no more input, all elements are closed
+    EndDocument = 0,
+
+    /// opening tag or self closing tag, followed by the Attribute events of the tag
+    StartElement,
+
+    /// closing tag, or the end of a self closing tag
+    EndElement,
+
+    /// attribute of the last StartElement
+    Attribute,
+
+    /// text content of the current element, or the raw content of a CDATA section
+    Text,
+
+    /// malformed or truncated document, the reader should be discarded
+    Error,
+};
+
+/// @brief source of document bytes for the XMLReader
+/// @param user user data passed to the XMLReader
+/// @param dst destination of the bytes
+/// @param size capacity of dst in bytes
+/// @return number of bytes written to dst, 0 at the end of the document
+typedef size_t (*XMLReadFn)(void* user, char* dst, size_t size);
+
+struct XMLReaderConfig
+{
+    /// number of bytes requested from the source at a time
+    size_t ChunkSize = 64 * 1024;
+};
+
+/// @brief Pull reader that produces one event at a time from a chunked source.
+///        Bytes that belong to consumed events are discarded, so memory is bounded by the chunk size
+///        plus the longest tag or text run instead of the document size. Processing instructions
+///        such as the xml header, comments and DOCTYPE declarations are skipped. End tags must
+///        match the open element, CDATA sections produce Text events.
+class XMLReader
+{
+public:
+    XMLReader() = delete;
+
+    /// read from a document already in memory, no copies are made
+    XMLReader(const char* xml, size_t size);
+
+    /// read from a chunked source
+    XMLReader(const XMLReaderConfig& config, XMLReadFn read, void* user);
+
+    XMLReader(const XMLReader&) = delete;
+    ~XMLReader();
+
+    XMLReader& operator=(const XMLReader&) = delete;
+
+    /// @brief advance to the next event, names and values of the previous event are invalidated
+    XMLEvent Next();
+
+    /// element name of StartElement and EndElement, attribute name of Attribute
+    inline XMLString GetName() const
+    {
+        return mName;
+    }
+
+    /// attribute value of Attribute, content of Text
+    inline XMLString GetValue() const
+    {
+        return mValue;
+    }
+
+    /// number of open elements, a StartElement event counts its own element
+    inline size_t GetDepth() const
+    {
+        return mDepth;
+    }
+
+    /// @brief consume the element of the last StartElement event, including its content and end tag
+    /// @return raw bytes of the element, valid until the next call to Next, or an empty string on Error.
+    ///         Hand this to XMLParser to build a DOM for a single element instead of the whole document.
+    XMLString ReadElement();
+
+    /// @brief consume the element of the last StartElement event without producing events
+    /// @return false on Error
+    bool SkipElement();
+
+private:
+    enum State
+    {
+        STATE_CONTENT = 0,
+        STATE_ATTRIBUTES,
+        STATE_ERROR,
+    };
+
+    XMLEvent NextContent();
+    XMLEvent NextAttribute();
+
+    /// @brief read more input, discarding bytes before mBegin
+    /// @param pos buffer offset adjusted to the compacted buffer
+    /// @return false if there is no more input
+    bool Refill(size_t& pos);
+
+    /// make sure count bytes starting at pos are available
+    bool Ensure(size_t& pos, size_t count);
+
+    /// @brief find the first byte at or after pos in any of the classes, reading more input as needed
+    template <u32 TClasses>
+    bool ScanUntil(size_t& pos);
+
+    /// @brief find the first byte at or after pos in none of the classes, reading more input as needed
+    template <u32 TClasses>
+    bool ScanWhile(size_t& pos);
+
+    /// @brief skip a processing instruction, comment or declaration starting at mCursor
+    bool SkipMarkup();
+
+    /// @brief read the CDATA section starting at mCursor as a Text event
+    XMLEvent ReadCData();
+
+    /// @brief remember the name of an opened element, the tag may be discarded on refill
+    void PushOpenName(const XMLString& name);
+
+    inline XMLEvent Fail()
+    {
+        mState = STATE_ERROR;
+        return XMLEvent::Error;
+    }
+
+    XMLReaderConfig mConfig;
+    XMLReadFn mRead;
+    void* mUser;
+    const char* mData;      // document bytes, mBuffer if reading from a source
+    char* mBuffer;          // owned buffer if reading from a source
+    size_t mCapacity;       // size of mBuffer in bytes
+    size_t mBegin;          // first byte that is still needed, bytes before it are discarded on refill
+    size_t mCursor;         // current parse position
+    size_t mEnd;            // number of valid bytes in mData
+    size_t mDepth;
+    XMLString mName;
+    XMLString mValue;
+    XMLString mElementName; // name of the last StartElement, for the EndElement of a self closing tag
+    Vector<char> mOpenNames;         // names of the open elements, concatenated
+    Vector<size_t> mOpenNameOffsets; // offset of each open element name in mOpenNames
+    State mState;
+    bool mPinned;           // keep everything after mBegin during ReadElement
+    bool mEOF;
+};
+
+} // namespace LD
@@ -1,5 +1,7 @@
-#include <cctype>
+#include <cstring>
+#include <algorithm>
 #include "Core/Serialize/Include/XML.h"
+#include "Core/Serialize/Lib/XMLScan.h"
 
 #define NUM_NODES_PER_PAGE 1024
 
@@ -8,42 +10,34 @@ namespace LD {
 // NOTE: currently assumes ASCII string, one byte per character.
 //       will implement UTF8 sooner or later.
 
-static inline void EatWhiteSpace(const char* str, int* cursor)
+static inline void EatWhiteSpace(const char* str, size_t size, size_t* cursor)
 {
-    int c = *cursor;
-
-    while (str[c] && isspace(str[c]))
-        c++;
-
-    *cursor = c;
+    *cursor = XMLScanWhile<XML_CLASS_SPACE>(str, size, *cursor);
 }
 
-static inline XMLString EatWord(const char* str, int* cursor, const char* delims = "\0")
+/// consume a word, terminated by whitespace or any of the delimiter classes
+template <u32 TDelims>
+static inline XMLString EatWord(const char* str, size_t size, size_t* cursor)
 {
-    int beg = *cursor;
-    int end = beg;
+    size_t beg = *cursor;
 
-    LD_DEBUG_ASSERT(!isspace(str[beg]) && "word should not begin with space");
+    LD_DEBUG_ASSERT((beg == size || !XMLIsClass(str[beg], XML_CLASS_SPACE)) && "word should not begin with space");
 
-    while (str[end] && !isspace(str[end]) && !strchr(delims, str[end]))
-        end++;
+    size_t end = XMLScanUntil<XML_CLASS_SPACE | TDelims>(str, size, beg);
 
-    size_t len = end - beg;
     *cursor = end;
-    return {len, str + beg};
+    return {end - beg, str + beg};
 }
 
-static inline XMLString EatUntil(const char* str, int* cursor, const char* delims)
+/// consume bytes until any of the delimiter classes
+template <u32 TDelims>
+static inline XMLString EatUntil(const char* str, size_t size, size_t* cursor)
 {
-    int beg = *cursor;
-    int end = beg;
-
-    while (str[end] && !strchr(delims, str[end]))
-        end++;
+    size_t beg = *cursor;
+    size_t end = XMLScanUntil<TDelims>(str, size, beg);
 
-    size_t len = end - beg;
     *cursor = end;
-    return {len, str + beg};
+    return {end - beg, str + beg};
 }
 
 static inline bool StringEqual(const XMLString& lhs, const XMLString& rhs)
@@ -181,6 +175,7 @@ XMLParser::XMLParser(const XMLParserConfig& config) : mConfig(config)
     mTagStack.Clear();
     mElement = nullptr;
     mXML = nullptr;
+    mXMLSize = 0;
     mCursor = 0;
 }
 
@@ -235,11 +230,11 @@ bool XMLParser::ParseElement(XMLDocument& doc)
 
 void XMLParser::ParseElementContent(XMLDocument& doc)
 {
-    int textBeg = mCursor;
-    
-    EatWhiteSpace(mXML, &mCursor);
+    size_t textBeg = mCursor;
 
-    char c = mXML[mCursor];
+    EatWhiteSpace(mXML, mXMLSize, &mCursor);
+
+    char c = Peek();
 
     if (c == '<')
     {
@@ -249,12 +244,7 @@ void XMLParser::ParseElementContent(XMLDocument& doc)
     {
         LD_DEBUG_ASSERT(mElement && "text node must be a child of some element node");
 
-        int textEnd = textBeg;
-
-        while (c && c != '<')
-        {
-            c = mXML[++textEnd];
-        }
+        size_t textEnd = XMLScanUntil<XML_CLASS_LT>(mXML, mXMLSize, mCursor);
 
         XMLString text(textEnd - textBeg, mXML + textBeg);
         mElement->AddText(text);
@@ -264,15 +254,15 @@ void XMLParser::ParseElementContent(XMLDocument& doc)
 
 bool XMLParser::ParseHeader(XMLDocument& doc)
 {
-    EatWhiteSpace(mXML, &mCursor);
+    EatWhiteSpace(mXML, mXMLSize, &mCursor);
 
-    if (mXML[mCursor] != '<' || mXML[mCursor + 1] != '?')
+    if (Peek() != '<' || Peek(1) != '?')
         return false;
 
     mCursor += 2;
-    EatWhiteSpace(mXML, &mCursor);
+    EatWhiteSpace(mXML, mXMLSize, &mCursor);
 
-    XMLString word = EatWord(mXML, &mCursor, "?");
+    XMLString word = EatWord<XML_CLASS_QMARK>(mXML, mXMLSize, &mCursor);
     if (!StringEqual(word, "xml"))
         return false;
 
@@ -282,7 +272,7 @@ bool XMLParser::ParseHeader(XMLDocument& doc)
     XMLAttribute* lastAttr;
     ParseAttributes(doc, &firstAttr, &lastAttr);
 
-    if (mXML[mCursor] != '?' || mXML[mCursor + 1] != '>')
+    if (Peek() != '?' || Peek(1) != '>')
         return false;
 
     mCursor += 2;
@@ -297,23 +287,23 @@ bool XMLParser::ParseHeader(XMLDocument& doc)
 
 int XMLParser::ParseTag(XMLDocument& doc)
 {
-    EatWhiteSpace(mXML, &mCursor);
+    EatWhiteSpace(mXML, mXMLSize, &mCursor);
 
-    if (mXML[mCursor] != '<')
+    if (Peek() != '<')
         return false;
 
     ++mCursor;
-    EatWhiteSpace(mXML, &mCursor);
+    EatWhiteSpace(mXML, mXMLSize, &mCursor);
 
     // closing tag, whose name should match with the top of tag stack
-    if (mXML[mCursor] == '/')
+    if (Peek() == '/')
     {
         ++mCursor;
-        EatWhiteSpace(mXML, &mCursor);
+        EatWhiteSpace(mXML, mXMLSize, &mCursor);
 
-        XMLString name = EatWord(mXML, &mCursor, ">");
-        EatWhiteSpace(mXML, &mCursor);
-        LD_DEBUG_ASSERT(mXML[mCursor] == '>' && "bad closing tag syntax");
+        XMLString name = EatWord<XML_CLASS_GT>(mXML, mXMLSize, &mCursor);
+        EatWhiteSpace(mXML, mXMLSize, &mCursor);
+        LD_DEBUG_ASSERT(Peek() == '>' && "bad closing tag syntax");
         ++mCursor;
 
         XMLTag tag = mTagStack.Top();
@@ -330,18 +320,18 @@ int XMLParser::ParseTag(XMLDocument& doc)
 
     // Opening tag, or self closing tag.
     // Can contain attributes.
-    XMLString name = EatWord(mXML, &mCursor, "/>");
-    EatWhiteSpace(mXML, &mCursor);
+    XMLString name = EatWord<XML_CLASS_SLASH | XML_CLASS_GT>(mXML, mXMLSize, &mCursor);
+    EatWhiteSpace(mXML, mXMLSize, &mCursor);
 
     XMLAttribute* firstAttr;
     XMLAttribute* lastAttr;
     int numAttrs = ParseAttributes(doc, &firstAttr, &lastAttr);
-    EatWhiteSpace(mXML, &mCursor);
+    EatWhiteSpace(mXML, mXMLSize, &mCursor);
 
     XMLElement* newElement = nullptr;
     int tagType;
 
-    if (mXML[mCursor] == '>')
+    if (Peek() == '>')
     {
         // handle opening tag
         ++mCursor;
@@ -366,12 +356,12 @@ int XMLParser::ParseTag(XMLDocument& doc)
         // opening tag
         tagType = 2;
     }
-    else if (mXML[mCursor] == '/')
+    else if (Peek() == '/')
     {
         // handle self closing tag
         ++mCursor;
-        EatWhiteSpace(mXML, &mCursor);
-        LD_DEBUG_ASSERT(mXML[mCursor] == '>');
+        EatWhiteSpace(mXML, mXMLSize, &mCursor);
+        LD_DEBUG_ASSERT(Peek() == '>');
         ++mCursor;
 
         if (!mElement)
@@ -406,33 +396,34 @@ int XMLParser::ParseAttributes(XMLDocument& doc, XMLAttribute** first, XMLAttrib
     XMLAttribute* tail = nullptr;
     int numAttrs = 0;
 
-    EatWhiteSpace(mXML, &mCursor);
+    EatWhiteSpace(mXML, mXMLSize, &mCursor);
 
-    char c = mXML[mCursor];
+    char c = Peek();
 
     while (c && c != '>' && c != '/' && c != '?')
     {
-        XMLString name = EatWord(mXML, &mCursor, "=");
+        XMLString name = EatWord<XML_CLASS_EQ>(mXML, mXMLSize, &mCursor);
 
-        EatWhiteSpace(mXML, &mCursor);
+        EatWhiteSpace(mXML, mXMLSize, &mCursor);
 
-        LD_DEBUG_ASSERT(mXML[mCursor] == '=');
+        LD_DEBUG_ASSERT(Peek() == '=');
 
         ++mCursor;
-        EatWhiteSpace(mXML, &mCursor);
-        char quote = mXML[mCursor++];
+        EatWhiteSpace(mXML, mXMLSize, &mCursor);
+        char quote = Peek();
+        ++mCursor;
 
         LD_DEBUG_ASSERT(quote == '\'' || quote == '"');
 
-        EatWhiteSpace(mXML, &mCursor);
+        EatWhiteSpace(mXML, mXMLSize, &mCursor);
 
-        char delim[2] = {quote, '\0'};
-        XMLString value = EatUntil(mXML, &mCursor, delim);
+        XMLString value = quote == '"' ? EatUntil<XML_CLASS_QUOTE>(mXML, mXMLSize, &mCursor)
+                                       : EatUntil<XML_CLASS_APOS>(mXML, mXMLSize, &mCursor);
 
-        LD_DEBUG_ASSERT(mXML[mCursor] == quote);
+        LD_DEBUG_ASSERT(Peek() == quote);
         ++mCursor;
 
-        EatWhiteSpace(mXML, &mCursor);
+        EatWhiteSpace(mXML, mXMLSize, &mCursor);
 
         XMLAttribute* attr = (XMLAttribute*)doc.AllocNode(XMLType::Attribute);
         attr->mName = name;
@@ -446,7 +437,7 @@ int XMLParser::ParseAttributes(XMLDocument& doc, XMLAttribute** first, XMLAttrib
 
         ++numAttrs;
 
-        c = mXML[mCursor];
+        c = Peek();
     }
 
     *first = head;
@@ -498,11 +489,14 @@ XMLNode* XMLDocument::AllocNode(XMLType type)
 {
     NodeAllocator* page = nullptr;
 
-    for (size_t i = 0; i < mPages.Size(); i++)
+    // pages before the hint are full, otherwise every allocation
+    // would scan all pages and large documents parse in quadratic time
+    for (size_t i = mPageHint; i < mPages.Size(); i++)
     {
         if (mPages[i].CountFreeChunks() > 0)
         {
             page = mPages.Begin() + i;
+            mPageHint = i;
             break;
         }
     }
@@ -513,6 +507,7 @@ XMLNode* XMLDocument::AllocNode(XMLType type)
         newPage.Startup(NUM_NODES_PER_PAGE);
         mPages.PushBack(newPage);
         page = mPages.End() - 1;
+        mPageHint = mPages.Size() - 1;
     }
 
     XMLNode* node = (XMLNode*)page->Alloc(sizeof(XMLNode));
@@ -525,11 +520,12 @@ XMLNode* XMLDocument::AllocNode(XMLType type)
 
 void XMLDocument::FreeNode(XMLNode* node)
 {
-    for (NodeAllocator& page : mPages)
+    for (size_t i = 0; i < mPages.Size(); i++)
     {
-        if (page.Contains(node))
+        if (mPages[i].Contains(node))
         {
-            page.Free(node);
+            mPages[i].Free(node);
+            mPageHint = std::min(mPageHint, i);
             return;
         }
     }
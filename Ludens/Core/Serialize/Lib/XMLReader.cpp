@@ -0,0 +1,460 @@
+#include <cstring>
+#include "Core/Serialize/Include/XMLReader.h"
+#include "Core/Serialize/Lib/XMLScan.h"
+
+namespace LD {
+
+XMLReader::XMLReader(const char* xml, size_t size)
+    : mRead(nullptr), mUser(nullptr), mData(xml), mBuffer(nullptr), mCapacity(0), mBegin(0), mCursor(0), mEnd(size),
+      mDepth(0), mState(STATE_CONTENT), mPinned(false), mEOF(true)
+{
+}
+
+XMLReader::XMLReader(const XMLReaderConfig& config, XMLReadFn read, void* user)
+    : mConfig(config), mRead(read), mUser(user), mData(nullptr), mBuffer(nullptr), mCapacity(0), mBegin(0), mCursor(0),
+      mEnd(0), mDepth(0), mState(STATE_CONTENT), mPinned(false), mEOF(false)
+{
+    LD_DEBUG_ASSERT(mRead && mConfig.ChunkSize > 0);
+}
+
+XMLReader::~XMLReader()
+{
+    if (mBuffer)
+        MemoryFree(mBuffer);
+}
+
+XMLEvent XMLReader::Next()
+{
+    mName = {};
+    mValue = {};
+
+    switch (mState)
+    {
+    case STATE_CONTENT:
+        return NextContent();
+    case STATE_ATTRIBUTES:
+        return NextAttribute();
+    default:
+        break;
+    }
+
+    return XMLEvent::Error;
+}
+
+XMLString XMLReader::ReadElement()
+{
+    LD_DEBUG_ASSERT(mState == STATE_ATTRIBUTES && "ReadElement must follow a StartElement event");
+
+    // mBegin stays at the opening tag until the element is closed
+    mPinned = true;
+    bool valid = SkipElement();
+    mPinned = false;
+
+    if (!valid)
+        return {};
+
+    return { mCursor - mBegin, mData + mBegin };
+}
+
+bool XMLReader::SkipElement()
+{
+    LD_DEBUG_ASSERT(mState == STATE_ATTRIBUTES && "SkipElement must follow a StartElement event");
+
+    size_t depth = mDepth - 1;
+
+    for (;;)
+    {
+        XMLEvent event = Next();
+
+        if (event == XMLEvent::Error || event == XMLEvent::EndDocument)
+            return false;
+
+        if (event == XMLEvent::EndElement && mDepth == depth)
+            return true;
+    }
+}
+
+XMLEvent XMLReader::NextContent()
+{
+    if (!mPinned)
+        mBegin = mCursor;
+
+    // offsets into the buffer change when it is compacted, offsets from mBegin do not
+    size_t textOffset = mCursor - mBegin;
+    size_t pos = mCursor;
+
+    while (true)
+    {
+        if (!ScanWhile<XML_CLASS_SPACE>(pos))
+        {
+            mCursor = pos;
+            return mDepth == 0 ? XMLEvent::EndDocument : Fail();
+        }
+
+        if (mData[pos] != '<')
+            break;
+
+        // the bytes before the tag are whitespace and can be discarded
+        if (!mPinned)
+            mBegin = pos;
+
+        mCursor = pos;
+
+        if (!Ensure(pos, 2))
+            return Fail();
+
+        char c = mData[pos + 1];
+
+        if (c == '!' && Ensure(pos, 3) && mData[pos + 2] == '[')
+            return ReadCData();
+
+        if (c == '?' || c == '!')
+        {
+            if (!SkipMarkup())
+                return Fail();
+
+            pos = mCursor;
+            if (!mPinned)
+                mBegin = pos;
+            textOffset = pos - mBegin;
+            continue;
+        }
+
+        // Read up to the end of the tag first, so that parsing the tag and its
+        // attribute events never refill and invalidate the element name.
+        // A '>' inside a quoted attribute value does not end the tag.
+        size_t tagEnd = pos + 1;
+        char quote = '\0';
+
+        while (true)
+        {
+            bool found;
+
+            if (quote == '"')
+                found = ScanUntil<XML_CLASS_QUOTE>(tagEnd);
+            else if (quote == '\'')
+                found = ScanUntil<XML_CLASS_APOS>(tagEnd);
+            else
+                found = ScanUntil<XML_CLASS_GT | XML_CLASS_QUOTE | XML_CLASS_APOS>(tagEnd);
+
+            if (!found)
+                return Fail();
+
+            char t = mData[tagEnd++];
+
+            if (quote)
+                quote = '\0';
+            else if (t == '>')
+                break;
+            else
+                quote = t;
+        }
+
+        // the scan may have compacted the buffer, the tag starts at mCursor
+        pos = mCursor + 1;
+        ScanWhile<XML_CLASS_SPACE>(pos);
+
+        if (mData[pos] == '/')
+        {
+            // closing tag
+            pos++;
+            ScanWhile<XML_CLASS_SPACE>(pos);
+
+            size_t nameBeg = pos;
+            ScanUntil<XML_CLASS_SPACE | XML_CLASS_GT>(pos);
+            size_t nameEnd = pos;
+
+            ScanWhile<XML_CLASS_SPACE>(pos);
+            if (mData[pos] != '>' || mDepth == 0)
+                return Fail();
+
+            // the end tag must close the innermost open element
+            size_t openOffset = mOpenNameOffsets.Back();
+            size_t openSize = mOpenNames.Size() - openOffset;
+            if (nameEnd - nameBeg != openSize || memcmp(mData + nameBeg, mOpenNames.Data() + openOffset, openSize) != 0)
+                return Fail();
+
+            mOpenNames.Resize(openOffset);
+            mOpenNameOffsets.PopBack();
+
+            mCursor = pos + 1;
+            mDepth--;
+            mName = { nameEnd - nameBeg, mData + nameBeg };
+            return XMLEvent::EndElement;
+        }
+
+        // opening tag or self closing tag
+        size_t nameBeg = pos;
+        ScanUntil<XML_CLASS_SPACE | XML_CLASS_SLASH | XML_CLASS_GT>(pos);
+
+        if (pos == nameBeg)
+            return Fail();
+
+        mCursor = pos;
+        mDepth++;
+        mState = STATE_ATTRIBUTES;
+        mElementName = { pos - nameBeg, mData + nameBeg };
+        mName = mElementName;
+        PushOpenName(mElementName);
+        return XMLEvent::StartElement;
+    }
+
+    // text content, leading whitespace is kept the same way as XMLParser does
+    if (mDepth == 0)
+        return Fail();
+
+    if (!ScanUntil<XML_CLASS_LT>(pos))
+        return Fail();
+
+    size_t textBeg = mBegin + textOffset;
+    mCursor = pos;
+    mValue = { pos - textBeg, mData + textBeg };
+    return XMLEvent::Text;
+}
+
+XMLEvent XMLReader::NextAttribute()
+{
+    // the whole tag is in the buffer, no scan below reads past its '>'
+    size_t pos = mCursor;
+    ScanWhile<XML_CLASS_SPACE>(pos);
+
+    char c = mData[pos];
+
+    if (c == '>')
+    {
+        mCursor = pos + 1;
+        mState = STATE_CONTENT;
+        return NextContent();
+    }
+
+    if (c == '/')
+    {
+        pos++;
+        ScanWhile<XML_CLASS_SPACE>(pos);
+
+        if (mData[pos] != '>')
+            return Fail();
+
+        mCursor = pos + 1;
+        mDepth--;
+        mState = STATE_CONTENT;
+        mName = mElementName;
+        mOpenNames.Resize(mOpenNameOffsets.Back());
+        mOpenNameOffsets.PopBack();
+        return XMLEvent::EndElement;
+    }
+
+    size_t nameBeg = pos;
+    ScanUntil<XML_CLASS_SPACE | XML_CLASS_EQ | XML_CLASS_SLASH | XML_CLASS_GT>(pos);
+    size_t nameEnd = pos;
+
+    ScanWhile<XML_CLASS_SPACE>(pos);
+    if (nameBeg == nameEnd || mData[pos] != '=')
+        return Fail();
+
+    pos++;
+    ScanWhile<XML_CLASS_SPACE>(pos);
+
+    char quote = mData[pos++];
+    if (quote != '"' && quote != '\'')
+        return Fail();
+
+    ScanWhile<XML_CLASS_SPACE>(pos);
+    size_t valueBeg = pos;
+
+    if (quote == '"')
+        ScanUntil<XML_CLASS_QUOTE>(pos);
+    else
+        ScanUntil<XML_CLASS_APOS>(pos);
+
+    mCursor = pos + 1;
+    mName = { nameEnd - nameBeg, mData + nameBeg };
+    mValue = { pos - valueBeg, mData + valueBeg };
+    return XMLEvent::Attribute;
+}
+
+bool XMLReader::SkipMarkup()
+{
+    size_t pos = mCursor;
+    LD_DEBUG_ASSERT(mData[pos] == '<');
+
+    if (mData[pos + 1] == '?')
+    {
+        // processing instruction, ends with "?>"
+        pos += 2;
+
+        while (true)
+        {
+            if (!ScanUntil<XML_CLASS_QMARK>(pos) || !Ensure(pos, 2))
+                return false;
+
+            if (mData[pos + 1] == '>')
+                break;
+
+            pos++;
+        }
+
+        mCursor = pos + 2;
+        return true;
+    }
+
+    if (!Ensure(pos, 4))
+        return false;
+
+    // comments end with "-->", other declarations end with the first '>' outside of brackets,
+    // such as the internal subset of a DOCTYPE
+    bool comment = mData[pos + 2] == '-' && mData[pos + 3] == '-';
+    size_t bodyBeg = comment ? 4 : 2;
+    int depth = 0;
+    pos += bodyBeg;
+
+    while (true)
+    {
+        // the scan may compact the buffer, offsets from mCursor stay valid
+        size_t scanBeg = pos - mCursor;
+
+        if (!ScanUntil<XML_CLASS_GT>(pos))
+            return false;
+
+        if (comment)
+        {
+            if (pos - mCursor >= bodyBeg + 2 && mData[pos - 2] == '-' && mData[pos - 1] == '-')
+                break;
+        }
+        else
+        {
+            for (size_t i = mCursor + scanBeg; i < pos; i++)
+            {
+                if (mData[i] == '[')
+                    depth++;
+                else if (mData[i] == ']')
+                    depth--;
+            }
+
+            if (depth <= 0)
+                break;
+        }
+
+        pos++;
+    }
+
+    mCursor = pos + 1;
+    return true;
+}
+
+XMLEvent XMLReader::ReadCData()
+{
+    // CDATA sections are content, the text starts after "<![CDATA[" and ends before "]]>"
+    size_t pos = mCursor;
+    size_t bodyBeg = 9;
+
+    if (mDepth == 0 || !Ensure(pos, bodyBeg) || memcmp(mData + pos, "<![CDATA[", bodyBeg) != 0)
+        return Fail();
+
+    pos += bodyBeg;
+
+    while (true)
+    {
+        if (!ScanUntil<XML_CLASS_GT>(pos))
+            return Fail();
+
+        if (pos - mCursor >= bodyBeg + 2 && mData[pos - 2] == ']' && mData[pos - 1] == ']')
+            break;
+
+        pos++;
+    }
+
+    // the scan may have compacted the buffer, the section starts at mCursor
+    size_t textBeg = mCursor + bodyBeg;
+    mValue = { pos - 2 - textBeg, mData + textBeg };
+    mCursor = pos + 1;
+    return XMLEvent::Text;
+}
+
+void XMLReader::PushOpenName(const XMLString& name)
+{
+    size_t offset = mOpenNames.Size();
+    mOpenNameOffsets.PushBack(offset);
+    mOpenNames.Resize(offset + name.Size());
+    memcpy(mOpenNames.Data() + offset, name.Data(), name.Size());
+}
+
+bool XMLReader::Refill(size_t& pos)
+{
+    if (mEOF)
+        return false;
+
+    size_t shift = mBegin;
+
+    if (shift > 0)
+    {
+        memmove(mBuffer, mBuffer + shift, mEnd - shift);
+        mEnd -= shift;
+        mCursor -= shift;
+        pos -= shift;
+        mBegin = 0;
+    }
+
+    if (mCapacity - mEnd < mConfig.ChunkSize)
+    {
+        // grows only when a single token or a pinned element outgrows the buffer
+        size_t capacity = mCapacity * 2 > mEnd + mConfig.ChunkSize ? mCapacity * 2 : mEnd + mConfig.ChunkSize;
+        mBuffer = (char*)MemoryRealloc(mBuffer, capacity);
+        mCapacity = capacity;
+        mData = mBuffer;
+    }
+
+    size_t bytes = mRead(mUser, mBuffer + mEnd, mConfig.ChunkSize);
+
+    if (bytes == 0)
+    {
+        mEOF = true;
+        return false;
+    }
+
+    mEnd += bytes;
+    return true;
+}
+
+bool XMLReader::Ensure(size_t& pos, size_t count)
+{
+    while (pos + count > mEnd)
+    {
+        if (!Refill(pos))
+            return false;
+    }
+
+    return true;
+}
+
+template <u32 TClasses>
+bool XMLReader::ScanUntil(size_t& pos)
+{
+    while (true)
+    {
+        pos = XMLScanUntil<TClasses>(mData, mEnd, pos);
+
+        if (pos < mEnd)
+            return true;
+
+        if (!Refill(pos))
+            return false;
+    }
+}
+
+template <u32 TClasses>
+bool XMLReader::ScanWhile(size_t& pos)
+{
+    while (true)
+    {
+        pos = XMLScanWhile<TClasses>(mData, mEnd, pos);
+
+        if (pos < mEnd)
+            return true;
+
+        if (!Refill(pos))
+            return false;
+    }
+}
+
+} // namespace LD
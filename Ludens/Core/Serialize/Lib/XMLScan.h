@@ -0,0 +1,198 @@
+#pragma once
+
+#include <cstddef>
+#include "Core/Header/Include/Types.h"
+
+#if defined(__AVX2__)
+# define LD_XML_AVX2
+# include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define LD_XML_SSE2
+# include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+namespace LD {
+
+/// Character classes the XML tokenizer scans for, a byte may belong to a single class only.
+enum XMLCharClass : u32
+{
+    XML_CLASS_SPACE = 1 << 0, // ' ', '\t', '\n', '\r'
+    XML_CLASS_LT = 1 << 1,    // '<'
+    XML_CLASS_GT = 1 << 2,    // '>'
+    XML_CLASS_SLASH = 1 << 3, // '/'
+    XML_CLASS_EQ = 1 << 4,    // '='
+    XML_CLASS_QUOTE = 1 << 5, // '"'
+    XML_CLASS_APOS = 1 << 6,  // '\''
+    XML_CLASS_QMARK = 1 << 7, // '?'
+};
+
+struct XMLCharTable
+{
+    u8 Class[256];
+
+    constexpr XMLCharTable() : Class{}
+    {
+        Class[(u8)' '] = XML_CLASS_SPACE;
+        Class[(u8)'\t'] = XML_CLASS_SPACE;
+        Class[(u8)'\n'] = XML_CLASS_SPACE;
+        Class[(u8)'\r'] = XML_CLASS_SPACE;
+        Class[(u8)'<'] = XML_CLASS_LT;
+        Class[(u8)'>'] = XML_CLASS_GT;
+        Class[(u8)'/'] = XML_CLASS_SLASH;
+        Class[(u8)'='] = XML_CLASS_EQ;
+        Class[(u8)'"'] = XML_CLASS_QUOTE;
+        Class[(u8)'\''] = XML_CLASS_APOS;
+        Class[(u8)'?'] = XML_CLASS_QMARK;
+    }
+};
+
+constexpr XMLCharTable sXMLCharTable;
+
+inline bool XMLIsClass(char c, u32 classes)
+{
+    return (sXMLCharTable.Class[(u8)c] & classes) != 0;
+}
+
+inline u32 XMLCountTrailingZeros(u32 mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (u32)index;
+#else
+    return (u32)__builtin_ctz(mask);
+#endif
+}
+
+#if defined(LD_XML_AVX2)
+
+# define LD_XML_SCAN_WIDTH 32
+
+/// bit i is set if byte i of the chunk belongs to any of the classes
+template <u32 TClasses>
+inline u32 XMLClassMask(const char* chunk)
+{
+    __m256i bytes = _mm256_loadu_si256((const __m256i*)chunk);
+    __m256i match = _mm256_setzero_si256();
+
+    if (TClasses & XML_CLASS_SPACE)
+    {
+        match = _mm256_or_si256(match, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(' ')));
+        match = _mm256_or_si256(match, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\t')));
+        match = _mm256_or_si256(match, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\n')));
+        match = _mm256_or_si256(match, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\r')));
+    }
+# define LD_XML_MATCH_BYTE(CLASS, BYTE)                                                                                 \
+    if (TClasses & CLASS)                                                                                              \
+        match = _mm256_or_si256(match, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(BYTE)));
+    LD_XML_MATCH_BYTE(XML_CLASS_LT, '<')
+    LD_XML_MATCH_BYTE(XML_CLASS_GT, '>')
+    LD_XML_MATCH_BYTE(XML_CLASS_SLASH, '/')
+    LD_XML_MATCH_BYTE(XML_CLASS_EQ, '=')
+    LD_XML_MATCH_BYTE(XML_CLASS_QUOTE, '"')
+    LD_XML_MATCH_BYTE(XML_CLASS_APOS, '\'')
+    LD_XML_MATCH_BYTE(XML_CLASS_QMARK, '?')
+# undef LD_XML_MATCH_BYTE
+
+    return (u32)_mm256_movemask_epi8(match);
+}
+
+#elif defined(LD_XML_SSE2)
+
+# define LD_XML_SCAN_WIDTH 16
+
+/// bit i is set if byte i of the chunk belongs to any of the classes
+template <u32 TClasses>
+inline u32 XMLClassMask(const char* chunk)
+{
+    __m128i bytes = _mm_loadu_si128((const __m128i*)chunk);
+    __m128i match = _mm_setzero_si128();
+
+    if (TClasses & XML_CLASS_SPACE)
+    {
+        match = _mm_or_si128(match, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(' ')));
+        match = _mm_or_si128(match, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\t')));
+        match = _mm_or_si128(match, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n')));
+        match = _mm_or_si128(match, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\r')));
+    }
+# define LD_XML_MATCH_BYTE(CLASS, BYTE)                                                                                 \
+    if (TClasses & CLASS)                                                                                              \
+        match = _mm_or_si128(match, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(BYTE)));
+    LD_XML_MATCH_BYTE(XML_CLASS_LT, '<')
+    LD_XML_MATCH_BYTE(XML_CLASS_GT, '>')
+    LD_XML_MATCH_BYTE(XML_CLASS_SLASH, '/')
+    LD_XML_MATCH_BYTE(XML_CLASS_EQ, '=')
+    LD_XML_MATCH_BYTE(XML_CLASS_QUOTE, '"')
+    LD_XML_MATCH_BYTE(XML_CLASS_APOS, '\'')
+    LD_XML_MATCH_BYTE(XML_CLASS_QMARK, '?')
+# undef LD_XML_MATCH_BYTE
+
+    return (u32)_mm_movemask_epi8(match);
+}
+
+#endif
+
+/// @brief find the first byte at or after pos that belongs to any of the classes
+/// @return offset of the byte, or size if there is none
+template <u32 TClasses>
+inline size_t XMLScanUntil(const char* str, size_t size, size_t pos)
+{
+#ifdef LD_XML_SCAN_WIDTH
+    // short tokens such as names are common, check a few bytes before paying for a full chunk
+    for (size_t end = pos + 4; pos < end && pos < size; pos++)
+    {
+        if (XMLIsClass(str[pos], TClasses))
+            return pos;
+    }
+
+    for (; pos + LD_XML_SCAN_WIDTH <= size; pos += LD_XML_SCAN_WIDTH)
+    {
+        u32 mask = XMLClassMask<TClasses>(str + pos);
+
+        if (mask)
+            return pos + XMLCountTrailingZeros(mask);
+    }
+#endif
+
+    while (pos < size && !XMLIsClass(str[pos], TClasses))
+        pos++;
+
+    return pos;
+}
+
+/// @brief find the first byte at or after pos that does not belong to any of the classes
+/// @return offset of the byte, or size if there is none
+template <u32 TClasses>
+inline size_t XMLScanWhile(const char* str, size_t size, size_t pos)
+{
+#ifdef LD_XML_SCAN_WIDTH
+    // runs of whitespace between tags are usually a newline and some indentation
+    for (size_t end = pos + 4; pos < end && pos < size; pos++)
+    {
+        if (!XMLIsClass(str[pos], TClasses))
+            return pos;
+    }
+
+    for (; pos + LD_XML_SCAN_WIDTH <= size; pos += LD_XML_SCAN_WIDTH)
+    {
+        u32 mask = ~XMLClassMask<TClasses>(str + pos);
+# if LD_XML_SCAN_WIDTH < 32
+        mask &= (1u << LD_XML_SCAN_WIDTH) - 1;
+# endif
+
+        if (mask)
+            return pos + XMLCountTrailingZeros(mask);
+    }
+#endif
+
+    while (pos < size && XMLIsClass(str[pos], TClasses))
+        pos++;
+
+    return pos;
+}
+
+} // namespace LD
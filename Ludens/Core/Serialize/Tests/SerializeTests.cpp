@@ -3,4 +3,5 @@
 
 #include "Core/Serialize/Tests/SerializeINI.h"
 #include "Core/Serialize/Tests/SerializeXML.h"
+#include "Core/Serialize/Tests/SerializeXMLReader.h"
 #include "Core/Serialize/Tests/SerializeMD.h"
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string>
 #include <doctest.h>
 #include "Core/Serialize/Include/XML.h"
 
@@ -476,4 +477,47 @@ TEST_CASE("Doxygen XML")
 
         doc = nullptr;
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("XML Long Tokens")
+{
+    XMLParserConfig config{};
+    config.SkipHeader = true;
+
+    XMLParser parser(config);
+
+    // tokens and whitespace runs longer than a scan chunk, with delimiters at every offset
+    for (int len = 1; len < 80; len++)
+    {
+        std::string name(len, 'n');
+        std::string value(len, 'v');
+        std::string text(len, 't');
+        std::string space(len, ' ');
+
+        std::string xml = "<" + name + space + "a" + space + "=" + space + "\"" + value + "\"" + space + ">" + space + text +
+                          "</" + name + space + ">";
+
+        // the document is not null terminated, the parser must stop at the given size
+        std::string padded = xml + "<garbage>";
+
+        Ref<XMLDocument> doc = parser.ParseString(padded.data(), xml.size());
+        CHECK(doc);
+
+        XMLElement* element = doc->GetChild()->ToElement();
+        CHECK(element);
+        CHECK(Equal(element->GetName(), name.c_str()));
+        CHECK(!element->GetNext());
+
+        XMLAttribute* attr = element->GetAttributes();
+        CHECK(attr);
+        CHECK(Equal(attr->GetName(), "a"));
+        CHECK(Equal(attr->GetValue(), value.c_str()));
+
+        // leading whitespace belongs to the text node
+        XMLText* textNode = element->GetChild()->ToText();
+        CHECK(textNode);
+        CHECK(Equal(textNode->GetText(), (space + text).c_str()));
+
+        doc = nullptr;
+    }
+}
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <doctest.h>
+#include "Core/Serialize/Include/XMLReader.h"
+
+using namespace LD;
+
+struct XMLTestSource
+{
+    const std::string* XML;
+    size_t Offset;
+    size_t MaxRead;
+};
+
+// hands out at most MaxRead bytes per call to exercise tokens split across chunks
+static size_t XMLTestRead(void* user, char* dst, size_t size)
+{
+    XMLTestSource* source = (XMLTestSource*)user;
+    size_t remain = source->XML->size() - source->Offset;
+    size_t bytes = std::min(std::min(size, source->MaxRead), remain);
+
+    memcpy(dst, source->XML->data() + source->Offset, bytes);
+    source->Offset += bytes;
+    return bytes;
+}
+
+static std::string ToString(const XMLString& str)
+{
+    return std::string(str.Data(), str.Size());
+}
+
+static std::vector<std::string> CollectEvents(XMLReader& reader)
+{
+    std::vector<std::string> events;
+
+    for (;;)
+    {
+        XMLEvent event = reader.Next();
+
+        switch (event)
+        {
+        case XMLEvent::StartElement:
+            events.push_back("S:" + ToString(reader.GetName()));
+            break;
+        case XMLEvent::EndElement:
+            events.push_back("E:" + ToString(reader.GetName()));
+            break;
+        case XMLEvent::Attribute:
+            events.push_back("A:" + ToString(reader.GetName()) + "=" + ToString(reader.GetValue()));
+            break;
+        case XMLEvent::Text:
+            events.push_back("T:" + ToString(reader.GetValue()));
+            break;
+        case XMLEvent::Error:
+            events.push_back("error");
+            return events;
+        case XMLEvent::EndDocument:
+            return events;
+        }
+    }
+}
+
+static const char* sReaderXML = R"(<?xml version='1.0' encoding='UTF-8' standalone='no'?>
+<!-- generated -> by doxygen -->
+<doxygen version="1.9.8">
+  <compounddef id="class_view" kind="class">
+    <compoundname>LD::View</compoundname>
+    <definition>const T* LD::View&lt; T &gt;::mData</definition>
+    <argsstring cmp="a > b"></argsstring>
+    <location file='View.h' line="38"/>
+  </compounddef>
+  <compounddef id="class_vector" kind="class">
+    <para>mixed <bold>content</bold> text</para>
+  </compounddef>
+</doxygen>
+)";
+
+TEST_CASE("XMLReader Events")
+{
+    std::string xml(sReaderXML);
+    XMLReader reader(xml.data(), xml.size());
+
+    std::vector<std::string> expected{
+        "S:doxygen", "A:version=1.9.8",
+        "S:compounddef", "A:id=class_view", "A:kind=class",
+        "S:compoundname", "T:LD::View", "E:compoundname",
+        "S:definition", "T:const T* LD::View&lt; T &gt;::mData", "E:definition",
+        "S:argsstring", "A:cmp=a > b", "E:argsstring",
+        "S:location", "A:file=View.h", "A:line=38", "E:location",
+        "E:compounddef",
+        "S:compounddef", "A:id=class_vector", "A:kind=class",
+        "S:para", "T:mixed ", "S:bold", "T:content", "E:bold", "T: text", "E:para",
+        "E:compounddef",
+        "E:doxygen",
+    };
+
+    CHECK(CollectEvents(reader) == expected);
+}
+
+TEST_CASE("XMLReader Chunked Source")
+{
+    std::string xml(sReaderXML);
+    XMLReader memoryReader(xml.data(), xml.size());
+    std::vector<std::string> expected = CollectEvents(memoryReader);
+
+    // every chunk size splits tokens at different offsets
+    for (size_t chunkSize = 1; chunkSize < 80; chunkSize++)
+    {
+        XMLTestSource source{ &xml, 0, chunkSize };
+        XMLReaderConfig config{};
+        config.ChunkSize = chunkSize;
+
+        XMLReader reader(config, &XMLTestRead, &source);
+        CHECK(CollectEvents(reader) == expected);
+    }
+}
+
+TEST_CASE("XMLReader ReadElement")
+{
+    std::string xml(sReaderXML);
+    XMLTestSource source{ &xml, 0, 7 };
+    XMLReaderConfig config{};
+    config.ChunkSize = 16;
+
+    XMLReader reader(config, &XMLTestRead, &source);
+
+    CHECK(reader.Next() == XMLEvent::StartElement);
+    CHECK(reader.Next() == XMLEvent::Attribute);
+    CHECK(reader.Next() == XMLEvent::StartElement);
+    CHECK(ToString(reader.GetName()) == "compounddef");
+
+    // the raw element can be parsed into a DOM of its own
+    XMLString element = reader.ReadElement();
+    CHECK(ToString(element).find("<compounddef id=\"class_view\"") == 0);
+    CHECK(ToString(element).rfind("</compounddef>") == element.Size() - 14);
+
+    XMLParserConfig parserConfig{};
+    parserConfig.SkipHeader = true;
+    XMLParser parser(parserConfig);
+    Ref<XMLDocument> doc = parser.ParseString(element.Data(), element.Size());
+    CHECK(doc);
+
+    XMLElement* compounddef = doc->GetChild()->ToElement();
+    CHECK(compounddef);
+    CHECK(compounddef->HasName("compounddef"));
+    CHECK(!compounddef->GetNext());
+    doc = nullptr;
+
+    // the second element is skipped without producing events
+    CHECK(reader.Next() == XMLEvent::StartElement);
+    CHECK(reader.SkipElement());
+    CHECK(reader.Next() == XMLEvent::EndElement);
+    CHECK(ToString(reader.GetName()) == "doxygen");
+    CHECK(reader.GetDepth() == 0);
+    CHECK(reader.Next() == XMLEvent::EndDocument);
+}
+
+TEST_CASE("XMLReader Declarations")
+{
+    // '>' inside a CDATA section or the internal subset of a DOCTYPE does not end the declaration,
+    // the CDATA section is text content
+    std::string xml = R"(<?xml version="1.0"?>
+<!DOCTYPE doxygen [
+  <!ENTITY gt ">">
+  <!ENTITY lt "<">
+]>
+<doxygen>
+  <![CDATA[ a > b ]> ]]>
+  <compound/>
+</doxygen>
+)";
+    std::vector<std::string> expected{ "S:doxygen", "T: a > b ]> ", "S:compound", "E:compound", "E:doxygen" };
+
+    XMLReader memoryReader(xml.data(), xml.size());
+    CHECK(CollectEvents(memoryReader) == expected);
+
+    for (size_t chunkSize = 1; chunkSize < 40; chunkSize++)
+    {
+        XMLTestSource source{ &xml, 0, chunkSize };
+        XMLReaderConfig config{};
+        config.ChunkSize = chunkSize;
+
+        XMLReader reader(config, &XMLTestRead, &source);
+        CHECK(CollectEvents(reader) == expected);
+    }
+}
+
+TEST_CASE("XMLReader Errors")
+{
+    auto lastEvent = [](const char* xml) {
+        XMLReader reader(xml, strlen(xml));
+        std::vector<std::string> events = CollectEvents(reader);
+        return events.empty() ? std::string() : events.back();
+    };
+
+    CHECK(lastEvent("<a><b></b>") == "error");
+    CHECK(lastEvent("<a>text") == "error");
+    CHECK(lastEvent("<a name='value></a>") == "error");
+    CHECK(lastEvent("</a>") == "error");
+    CHECK(lastEvent("text") == "error");
+    CHECK(lastEvent("<a><![CDATA[ b ]></a>") == "error");
+    CHECK(lastEvent("<!DOCTYPE a [ <!ENTITY b 'c'> <a></a>") == "error");
+    CHECK(lastEvent("<![CDATA[ a ]]><a></a>") == "error");
+    CHECK(lastEvent("<a><b></a></b>") == "error");
+    CHECK(lastEvent("<a></ab>") == "error");
+    CHECK(lastEvent("<a><b/></a >") == "E:a");
+    CHECK(lastEvent("<a></a>") == "E:a");
+}
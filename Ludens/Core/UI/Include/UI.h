@@ -1,7 +1,7 @@
 #pragma once
 
 #include <string>
-#include <unordered_set>
+#include <unordered_map>
 #include "Core/OS/Include/Time.h"
 #include "Core/Math/Include/Rect2D.h"
 #include "Core/Math/Include/Vec2.h"
@@ -144,6 +144,19 @@ public:
     /// raise the window to the top
     void Raise();
 
+    /// whether anything drawn in the window changed since the renderer last generated it,
+    /// set by widget layout, color, text and scroll changes
+    inline bool IsRenderDirty() const
+    {
+        return mIsRenderDirty;
+    }
+
+    /// the renderer clears the flag after generating the window again
+    inline void SetRenderDirty(bool isDirty)
+    {
+        mIsRenderDirty = isDirty;
+    }
+
     // by default, the context forwards input events to destination window,
     // but the user can also directly inject input into a specific window.
 
@@ -164,6 +177,14 @@ private:
     UIWindow* mParent;      // parent window
     UIWindow* mChild;       // first child window
     UIWindow* mNext;        // next sibling window
+    bool mIsRenderDirty;    // cached draw data of the window is stale
+};
+
+/// layout statistics of a frame
+struct UILayoutStats
+{
+    u32 LayoutPasses; // layout roots calculated, roots without changes are skipped
+    u32 NodesVisited; // layout nodes visited within those passes
 };
 
 struct UIContextInfo
@@ -209,9 +230,17 @@ public:
         return mHoverWidget;
     }
 
+    /// @brief calculate the layout of windows and layout roots whose widgets changed size,
+    ///        text or attachment since the last frame, and invalidate every window if the theme changed
     void BeginFrame(DeltaTime dt);
     void EndFrame();
 
+    /// get the layout statistics of the last BeginFrame
+    inline void GetLayoutStats(UILayoutStats& stats) const
+    {
+        stats = mLayoutStats;
+    }
+
     /// raise window to the top
     void RaiseWindow(UIWindow* window);
 
@@ -225,13 +254,16 @@ public:
     void InputKeyPress(KeyCode key);
     void InputKeyRelease(KeyCode key);
 
-    void AddLayoutRoot(UILayoutNode* root);
+    /// @brief register a layout node without parent, calculated at the beginning of each frame
+    /// @param window the window drawing the nodes, invalidated when the layout changes
+    void AddLayoutRoot(UILayoutNode* root, UIWindow* window);
     void RemoveLayoutRoot(UILayoutNode* root);
 
 private:
     UIWindow* GetTopWindow(const Vec2& pos);
+    void CalculateLayout(UILayoutNode* root, UIWindow* window);
 
-    std::unordered_set<UILayoutNode*> mLayoutRoots;
+    std::unordered_map<UILayoutNode*, UIWindow*> mLayoutRoots;
     UILogicStack<UIWindow> mWindowStack; // window stack, one per context
     UIWindow mRoot;                      // root window is provided by context
     UIWindow* mFocus;                    // window receiving key input
@@ -243,8 +275,10 @@ private:
     UIWidget* mLastDetach;               // last widget that is detached from a parent
     UIWidget* mTooltip;                  // the tooltip widget, rendered beside mouse cursor
     UITheme* mTheme;                     // the current active theme
+    u32 mThemeRevision;                  // theme revision the windows were last invalidated for
     Vec2 mMousePos;                      // mouse cursor position in the viewport
     Vec2 mAnchorPos;                     // anchor position, transforms local position to viewport position
+    UILayoutStats mLayoutStats;          // layout statistics of the last frame
     bool mIsWithinFrame = false;
     bool mIsWithinDraw = false;
 };
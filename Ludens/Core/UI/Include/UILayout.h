@@ -1,6 +1,7 @@
 #pragma once
 
 #include <yoga/Yoga.h>
+#include "Core/Header/Include/Types.h"
 #include "Core/Math/Include/Vec2.h"
 
 namespace LD
@@ -52,8 +53,26 @@ public:
     void Startup(const UILayoutNodeInfo& info);
     void Cleanup();
 
+    /// calculate the layout of this node as a root, including all descendants
     void CalculateLayout();
 
+    /// whether the style of this node or its descendants changed since the last layout calculation
+    inline bool IsDirty() const
+    {
+        return YGNodeIsDirty(mNode);
+    }
+
+    /// whether CalculateLayout on this root would change any layout results,
+    /// Yoga only marks nodes dirty on style or child changes, so the first calculation is tracked here
+    inline bool NeedsLayout() const
+    {
+        return !mHasLayout || YGNodeIsDirty(mNode);
+    }
+
+    /// number of nodes the next CalculateLayout on this root visits, clean subtrees
+    /// reuse their cached layout and are counted as a single node
+    u32 GetLayoutVisitCount() const;
+
     /// get position relative to parent layout node 
     inline const UILayoutNode& GetPos(Vec2& pos) const
     {
@@ -158,7 +177,7 @@ public:
 
 private:
     YGNodeRef mNode = nullptr;
-    size_t mChildCount = 0;
+    bool mHasLayout = false;
 };
 
 } // namespace LD
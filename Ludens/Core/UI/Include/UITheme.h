@@ -1,6 +1,7 @@
 #pragma once
 
 #include <unordered_map>
+#include "Core/Header/Include/Types.h"
 #include "Core/Math/Include/Vec4.h"
 #include "Core/DSA/Include/String.h"
 
@@ -23,6 +24,7 @@ union UIProperty
     inline void Set##NAME(float value)                                                                                 \
     {                                                                                                                  \
         mProps[sHash##NAME].Value = value;                                                                             \
+        mRevision++;                                                                                                   \
     }
 
 #define UI_THEME_COLOR(NAME)                                                                                           \
@@ -33,6 +35,7 @@ union UIProperty
     inline void Set##NAME(const Vec4& color)                                                                           \
     {                                                                                                                  \
         mProps[sHash##NAME].Color = color;                                                                             \
+        mRevision++;                                                                                                   \
     }
 
 struct UIThemeInfo
@@ -60,6 +63,12 @@ public:
     /// @return true if the property exists and was overriden
     bool SetProperty(StringHash name, const UIProperty& prop);
 
+    /// @brief incremented by every setter, lets the context notice a changed theme
+    inline u32 GetRevision() const
+    {
+        return mRevision;
+    }
+
     UI_THEME_COLOR(BackgroundColor)
     UI_THEME_COLOR(SurfaceColor)
     UI_THEME_COLOR(PrimaryColor)
@@ -81,6 +90,7 @@ private:
 
     // TODO: explore other hash map solutions
     std::unordered_map<StringHash, UIProperty> mProps;
+    u32 mRevision = 0;
 };
 
 #undef UI_THEME_COLOR
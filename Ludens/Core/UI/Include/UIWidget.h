@@ -183,6 +183,9 @@ public:
         return &mLayout;
     }
 
+    /// mark the window of this widget for the renderer to generate again
+    void InvalidateRender();
+
     void OnEnter();
     void OnLeave();
     void OnPress();
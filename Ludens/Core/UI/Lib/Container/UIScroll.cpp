@@ -32,7 +32,7 @@ void UIScroll::Startup(const UIScrollInfo& info)
     layoutI.FlexDirection = UIFlexDirection::Column; // TODO: flex row and horizontal scroll
 
     mLayoutRoot.Startup(layoutI);
-    ctx->AddLayoutRoot(&mLayoutRoot);
+    ctx->AddLayoutRoot(&mLayoutRoot, mWindow);
 }
 
 void UIScroll::Cleanup()
@@ -51,7 +51,13 @@ float UIScroll::GetScroll() const
 
 void UIScroll::SetScroll(float value)
 {
-    mScroll = std::max(0.0f, value);
+    float scroll = std::max(0.0f, value);
+
+    if (scroll == mScroll)
+        return;
+
+    mScroll = scroll;
+    InvalidateRender();
 }
 
 UILayoutNode* UIScroll::GetLayoutRoot()
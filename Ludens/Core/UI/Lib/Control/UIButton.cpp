@@ -88,6 +88,7 @@ void UIButton::SetText(const UIString& text)
     mText.Font->DeriveTextSize(mText.Content, scale, textSize, mTextGlyphs.Data());
 
     mLayout.SetSize(textSize);
+    InvalidateRender();
 }
 
 void UIButton::OnPress(UIContext* ctx, UIWidget* widget)
@@ -65,6 +65,7 @@ void UILabel::SetText(const UIString& text)
         mText.Font->DeriveTextSize(mText.Content, scale, textSize, mTextGlyphs.Data());
 
     mLayout.SetSize(textSize);
+    InvalidateRender();
 }
 
 float UILabel::GetTextSize()
@@ -75,6 +76,9 @@ float UILabel::GetTextSize()
 void UILabel::SetTextSize(float size)
 {
     mText.Size = size;
+
+    // derive glyphs and layout size at the new scale
+    SetText(mText.Content);
 }
 
 View<FontGlyphExt> UILabel::GetTextGlyphs()
@@ -32,6 +32,7 @@ Vec4 UIPanel::GetColor() const
 void UIPanel::SetColor(const Vec4& color)
 {
     mColor = color;
+    InvalidateRender();
 }
 
 } // namespace LD
\ No newline at end of file
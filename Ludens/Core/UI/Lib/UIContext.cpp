@@ -12,6 +12,7 @@ UIContext::~UIContext()
 void UIContext::Startup(const UIContextInfo& info)
 {
     mTheme = new UITheme();
+    mThemeRevision = mTheme->GetRevision();
     mHoverWidget = nullptr;
 
     UIWindowInfo rootInfo;
@@ -49,17 +50,26 @@ Vec2 UIContext::GetSize()
 void UIContext::BeginFrame(DeltaTime dt)
 {
     mIsWithinFrame = true;
+    mLayoutStats = {};
 
-    mRoot.CalculateLayout();
+    // theme colors are baked into the generated rects, a changed theme regenerates every window
+    if (mTheme->GetRevision() != mThemeRevision)
+    {
+        mThemeRevision = mTheme->GetRevision();
+
+        for (int i = 0; i < (int)mWindowStack.Size(); i++)
+            mWindowStack[i]->InvalidateRender();
+    }
 
+    // the root window is at the bottom of the window stack
     for (int i = 0; i < (int)mWindowStack.Size(); i++)
     {
         UIWindow* window = mWindowStack[i];
-        window->CalculateLayout();
+        CalculateLayout(window->GetLayout(), window);
     }
 
-    for (UILayoutNode* layoutRoot : mLayoutRoots)
-        layoutRoot->CalculateLayout();
+    for (auto& it : mLayoutRoots)
+        CalculateLayout(it.first, it.second);
 }
 
 void UIContext::EndFrame()
@@ -138,11 +148,12 @@ void UIContext::InputKeyRelease(KeyCode key)
 {
 }
 
-void UIContext::AddLayoutRoot(UILayoutNode* root)
+void UIContext::AddLayoutRoot(UILayoutNode* root, UIWindow* window)
 {
     LD_DEBUG_ASSERT(mLayoutRoots.find(root) == mLayoutRoots.end());
+    LD_DEBUG_ASSERT(window);
 
-    mLayoutRoots.insert(root);
+    mLayoutRoots[root] = window;
 }
 
 void UIContext::RemoveLayoutRoot(UILayoutNode* root)
@@ -152,6 +163,20 @@ void UIContext::RemoveLayoutRoot(UILayoutNode* root)
     mLayoutRoots.erase(root);
 }
 
+void UIContext::CalculateLayout(UILayoutNode* root, UIWindow* window)
+{
+    // Yoga would hit its cache for a clean tree, but still walks it
+    if (!root->NeedsLayout())
+        return;
+
+    // a changed layout moves widgets, the window drawing them is generated again
+    window->InvalidateRender();
+
+    mLayoutStats.LayoutPasses++;
+    mLayoutStats.NodesVisited += root->GetLayoutVisitCount();
+    root->CalculateLayout();
+}
+
 UIWindow* UIContext::GetTopWindow(const Vec2& pos)
 {
     for (int i = (int)mWindowStack.Size() - 1; i >= 0; i--)
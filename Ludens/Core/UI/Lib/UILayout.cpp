@@ -4,6 +4,21 @@
 
 namespace LD {
 
+static u32 CountVisitedNodes(YGNodeRef node, bool visitAll)
+{
+    u32 count = 1;
+
+    if (!visitAll && !YGNodeIsDirty(node))
+        return count;
+
+    size_t childCount = YGNodeGetChildCount(node);
+
+    for (size_t i = 0; i < childCount; i++)
+        count += CountVisitedNodes(YGNodeGetChild(node, i), visitAll);
+
+    return count;
+}
+
 UILayoutNode::UILayoutNode()
 {
 }
@@ -18,7 +33,7 @@ void UILayoutNode::Startup(const UILayoutNodeInfo& info)
     LD_DEBUG_ASSERT(mNode == nullptr);
 
     mNode = YGNodeNew();
-    mChildCount = 0;
+    mHasLayout = false;
     
     if (info.Width > 0.0f)
         SetWidth(info.Width);
@@ -31,12 +46,18 @@ void UILayoutNode::Startup(const UILayoutNodeInfo& info)
     if (info.Parent)
     {
         UILayoutNode& parent = *info.Parent;
-        YGNodeInsertChild(parent.mNode, mNode, parent.mChildCount++);
+        YGNodeInsertChild(parent.mNode, mNode, YGNodeGetChildCount(parent.mNode));
     }
 }
 
 void UILayoutNode::Cleanup()
 {
+    // YGNodeFree does not dirty the parent, removing the child explicitly does
+    YGNodeRef owner = YGNodeGetOwner(mNode);
+
+    if (owner)
+        YGNodeRemoveChild(owner, mNode);
+
     YGNodeFree(mNode);
     mNode = nullptr;
 }
@@ -44,6 +65,12 @@ void UILayoutNode::Cleanup()
 void UILayoutNode::CalculateLayout()
 {
     YGNodeCalculateLayout(mNode, YGUndefined, YGUndefined, YGDirectionLTR);
+    mHasLayout = true;
+}
+
+u32 UILayoutNode::GetLayoutVisitCount() const
+{
+    return CountVisitedNodes(mNode, !mHasLayout);
 }
 
 UILayoutNode& UILayoutNode::SetFlexDirection(UIFlexDirection direction)
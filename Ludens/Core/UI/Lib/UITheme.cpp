@@ -77,6 +77,7 @@ bool UITheme::SetProperty(StringHash name, const UIProperty& prop)
     bool exists = mProps.find(name) != mProps.end();
 
     mProps[name] = prop;
+    mRevision++;
     return exists;
 }
 
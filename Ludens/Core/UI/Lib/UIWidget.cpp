@@ -136,6 +136,12 @@ Rect2D UIWidget::GetRect() const
     return { pos.x, pos.y, size.x, size.y };
 }
 
+void UIWidget::InvalidateRender()
+{
+    if (mWindow)
+        mWindow->SetRenderDirty(true);
+}
+
 void UIWidget::OnEnter()
 {
     LD_DEBUG_ASSERT(mFlags & IS_HOVERABLE_BIT);
@@ -143,6 +149,7 @@ void UIWidget::OnEnter()
     UIContext* ctx = mWindow->GetContext();
 
     mFlags |= IS_HOVERED_BIT;
+    InvalidateRender();
 
     // TODO: cursor hint
 
@@ -160,6 +167,7 @@ void UIWidget::OnLeave()
     UIContext* ctx = mWindow->GetContext();
 
     mFlags &= ~IS_HOVERED_BIT;
+    InvalidateRender();
 
     // TODO: cursor hint
 
@@ -177,6 +185,7 @@ void UIWidget::OnPress()
     UIContext* ctx = mWindow->GetContext();
 
     mFlags |= IS_PRESSED_BIT;
+    InvalidateRender();
 
     if (mLibCallback.OnPress)
         mLibCallback.OnPress(ctx, this);
@@ -207,6 +216,7 @@ void UIWidget::OnRelease()
     UIContext* ctx = mWindow->GetContext();
 
     mFlags &= ~IS_PRESSED_BIT;
+    InvalidateRender();
 
     if (mLibCallback.OnRelease)
         mLibCallback.OnRelease(ctx, this);
@@ -262,6 +272,8 @@ void UIWidget::Attach(UIWidget* parent)
     bool parentIsContainer = (parent->GetFlags() & UIWidget::IS_CONTAINER_BIT);
     mContainer = parentIsContainer ? (UIContainerWidget*)parent : parent->mContainer;
     mContainer->AddToContainer(this);
+
+    InvalidateRender();
 }
 
 void UIWidget::Detach()
@@ -272,6 +284,8 @@ void UIWidget::Detach()
         return;
     }
 
+    InvalidateRender();
+
     // detach from container
     mContainer->RemoveFromContainer(this);
     mContainer = nullptr;
@@ -4,7 +4,7 @@
 namespace LD
 {
 
-UIWindow::UIWindow() : UIContainerWidget(UIType::Window)
+UIWindow::UIWindow() : UIContainerWidget(UIType::Window), mIsRenderDirty(true)
 {
 }
 
@@ -20,6 +20,7 @@ void UIWindow::Startup(const UIWindowInfo& info)
     mContext = info.Context;
     mDebugName = info.DebugName;
     mRect = info.Rect;
+    mIsRenderDirty = true;
 
     float border, padding;
     theme->GetBackgroundColor(mColor);
@@ -59,6 +60,7 @@ void UIWindow::SetWindowPos(const Vec2& pos)
 {
     mRect.x = pos.x;
     mRect.y = pos.y;
+    mIsRenderDirty = true;
 }
 
 Vec2 UIWindow::GetWindowSize() const
@@ -82,6 +84,7 @@ Rect2D UIWindow::GetWindowRect() const
 void UIWindow::SetColor(const Vec4& color)
 {
     mColor = color;
+    mIsRenderDirty = true;
 }
 
 Vec4 UIWindow::GetColor() const
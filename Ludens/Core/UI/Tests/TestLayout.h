@@ -0,0 +1,161 @@
+#pragma once
+
+#include <doctest.h>
+#include "Core/UI/Include/UI.h"
+#include "Core/UI/Include/Control/Control.h"
+#include "Core/UI/Include/Container/Container.h"
+
+using namespace LD;
+
+static void UILayoutTestWindow(UIContext& context, UIWindow& window, float x)
+{
+	UIWindowInfo windowI{};
+	windowI.Context = &context;
+	windowI.Parent = context.GetRoot();
+	windowI.Rect = { x, 0.0f, 600.0f, 500.0f };
+	window.Startup(windowI);
+}
+
+static void UILayoutTestPanel(UIPanel& panel, UIWidget* parent)
+{
+	UIPanelInfo panelI{};
+	panelI.Widget.Parent = parent;
+	panelI.Widget.Width = 100.0f;
+	panelI.Widget.Height = 100.0f;
+	panel.Startup(panelI);
+}
+
+// returns the layout statistics of one frame
+static UILayoutStats UILayoutTestFrame(UIContext& context)
+{
+	UILayoutStats stats;
+
+	context.BeginFrame(0.16f);
+	context.GetLayoutStats(stats);
+	context.EndFrame();
+
+	return stats;
+}
+
+TEST_CASE("UIContext Layout Skips Clean Roots")
+{
+	UIContext context;
+	UIWindow window;
+	UIWindow other;
+	UIPanel panel;
+	UIScroll scroll;
+	UIPanel scrollPanel;
+
+	UIContextInfo info{};
+	info.Width = 1600.0f;
+	info.Height = 900.0f;
+	context.Startup(info);
+	UILayoutTestWindow(context, window, 0.0f);
+	UILayoutTestWindow(context, other, 700.0f);
+	{
+		UILayoutTestPanel(panel, &window);
+
+		UIScrollInfo scrollI{};
+		scrollI.Parent = &other;
+		scroll.Startup(scrollI);
+		UILayoutTestPanel(scrollPanel, &scroll);
+
+		// root window, two windows and the scroll layout root
+		CHECK(UILayoutTestFrame(context).LayoutPasses == 4);
+
+		// idle frames skip every root
+		UILayoutStats stats = UILayoutTestFrame(context);
+		CHECK(stats.LayoutPasses == 0);
+		CHECK(stats.NodesVisited == 0);
+
+		// setting the same size does not dirty the layout
+		panel.GetLayout()->SetHeight(100.0f);
+		CHECK(UILayoutTestFrame(context).LayoutPasses == 0);
+
+		// a change inside the scroll container only calculates its own root
+		scrollPanel.GetLayout()->SetWidth(200.0f);
+		stats = UILayoutTestFrame(context);
+		CHECK(stats.LayoutPasses == 1);
+		CHECK(stats.NodesVisited == 2);
+		CHECK(scrollPanel.GetRect().w == 200.0f);
+
+		scrollPanel.Cleanup();
+		scroll.Cleanup();
+		panel.Cleanup();
+	}
+	other.Cleanup();
+	window.Cleanup();
+	context.Cleanup();
+}
+
+TEST_CASE("UIContext Layout Visit Counts")
+{
+	UIContext context;
+	UIWindow window;
+	UIPanel panel1;
+	UIPanel panel2;
+
+	UIContextInfo info{};
+	info.Width = 1600.0f;
+	info.Height = 900.0f;
+	context.Startup(info);
+	UILayoutTestWindow(context, window, 0.0f);
+	{
+		UILayoutTestPanel(panel1, &window);
+		UILayoutTestPanel(panel2, &window);
+
+		// windows are separate roots, the root window alone and the window with two panels
+		UILayoutStats stats = UILayoutTestFrame(context);
+		CHECK(stats.LayoutPasses == 2);
+		CHECK(stats.NodesVisited == 4);
+
+		float y1 = panel1.GetRect().y;
+		CHECK(panel2.GetRect().y == y1 + 100.0f);
+
+		// the changed window visits its own nodes only
+		panel1.GetLayout()->SetHeight(50.0f);
+		stats = UILayoutTestFrame(context);
+		CHECK(stats.LayoutPasses == 1);
+		CHECK(stats.NodesVisited == 3);
+		CHECK(panel2.GetRect().y == y1 + 50.0f);
+
+		panel2.Cleanup();
+		panel1.Cleanup();
+	}
+	window.Cleanup();
+	context.Cleanup();
+}
+
+TEST_CASE("UIContext Layout Detach")
+{
+	UIContext context;
+	UIWindow window;
+	UIPanel panel1;
+	UIPanel panel2;
+
+	UIContextInfo info{};
+	info.Width = 1600.0f;
+	info.Height = 900.0f;
+	context.Startup(info);
+	UILayoutTestWindow(context, window, 0.0f);
+	{
+		UILayoutTestPanel(panel1, &window);
+		UILayoutTestPanel(panel2, &window);
+		UILayoutTestFrame(context);
+
+		float y1 = panel1.GetRect().y;
+
+		// detaching a widget dirties its parent, the siblings move up
+		panel1.Cleanup();
+		CHECK(window.GetLayout()->NeedsLayout());
+
+		UILayoutStats stats = UILayoutTestFrame(context);
+		CHECK(stats.LayoutPasses == 1);
+		CHECK(stats.NodesVisited == 2);
+		CHECK(panel2.GetRect().y == y1);
+
+		panel2.Cleanup();
+	}
+	window.Cleanup();
+	context.Cleanup();
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <doctest.h>
+#include "Core/UI/Include/UI.h"
+#include "Core/UI/Include/Control/Control.h"
+#include "Core/UI/Include/Container/Container.h"
+
+using namespace LD;
+
+TEST_CASE("UIWindow Render Dirty")
+{
+	UIContext context;
+	UIWindow window;
+	UIWindow other;
+	UIPanel panel;
+	UIScroll scroll;
+	UIPanel scrollPanel;
+
+	UIContextInfo info{};
+	info.Width = 1600.0f;
+	info.Height = 900.0f;
+	context.Startup(info);
+
+	UIWindowInfo windowI{};
+	windowI.Context = &context;
+	windowI.Parent = context.GetRoot();
+	windowI.Rect = { 0.0f, 0.0f, 600.0f, 500.0f };
+	window.Startup(windowI);
+	windowI.Rect = { 700.0f, 0.0f, 600.0f, 500.0f };
+	other.Startup(windowI);
+	{
+		UIPanelInfo panelI{};
+		panelI.Widget.Parent = &window;
+		panelI.Widget.Width = 100.0f;
+		panelI.Widget.Height = 100.0f;
+		panelI.Color = { 1.0f, 0.0f, 0.0f, 1.0f };
+		panel.Startup(panelI);
+
+		UIScrollInfo scrollI{};
+		scrollI.Parent = &window;
+		scroll.Startup(scrollI);
+
+		panelI.Widget.Parent = &scroll;
+		scrollPanel.Startup(panelI);
+
+		// the renderer generates every window once and clears the flag
+		auto render = [&]() {
+			for (UIWindow* w : context.GetWindows())
+				w->SetRenderDirty(false);
+		};
+
+		context.BeginFrame(0.16f);
+		CHECK(window.IsRenderDirty());
+		CHECK(other.IsRenderDirty());
+		render();
+		context.EndFrame();
+
+		// nothing changed
+		context.BeginFrame(0.16f);
+		CHECK_FALSE(window.IsRenderDirty());
+		CHECK_FALSE(other.IsRenderDirty());
+		context.EndFrame();
+
+		panel.SetColor({ 0.0f, 1.0f, 0.0f, 1.0f });
+		CHECK(window.IsRenderDirty());
+		CHECK_FALSE(other.IsRenderDirty());
+		render();
+
+		// layout changes are detected when the layout is calculated
+		panel.SetMargin(4.0f);
+		CHECK_FALSE(window.IsRenderDirty());
+		context.BeginFrame(0.16f);
+		CHECK(window.IsRenderDirty());
+		CHECK_FALSE(other.IsRenderDirty());
+		render();
+		context.EndFrame();
+
+		// widgets in a scroll container live in a separate layout root
+		scrollPanel.SetMargin(4.0f);
+		context.BeginFrame(0.16f);
+		CHECK(window.IsRenderDirty());
+		render();
+		context.EndFrame();
+
+		scroll.SetScroll(10.0f);
+		CHECK(window.IsRenderDirty());
+		render();
+		scroll.SetScroll(10.0f);
+		CHECK_FALSE(window.IsRenderDirty());
+
+		other.SetWindowPos({ 800.0f, 0.0f });
+		CHECK(other.IsRenderDirty());
+		CHECK_FALSE(window.IsRenderDirty());
+		render();
+
+		// theme colors reach every window on the next frame
+		context.GetTheme()->SetSurfaceColor({ 0.2f, 0.2f, 0.2f, 1.0f });
+		context.BeginFrame(0.16f);
+		CHECK(window.IsRenderDirty());
+		CHECK(other.IsRenderDirty());
+		render();
+		context.EndFrame();
+
+		scrollPanel.Cleanup();
+		CHECK(window.IsRenderDirty());
+
+		scroll.Cleanup();
+		panel.Cleanup();
+	}
+	other.Cleanup();
+	window.Cleanup();
+	context.Cleanup();
+}
@@ -1,4 +1,6 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <doctest.h>
 
-#include "Core/UI/Tests/TestButton.h"
\ No newline at end of file
+#include "Core/UI/Tests/TestButton.h"
+#include "Core/UI/Tests/TestWindow.h"
+#include "Core/UI/Tests/TestLayout.h"
\ No newline at end of file